@@ -29,5 +29,8 @@
 extern const uint16_t armBitRevTable[1024];    
 extern q15_t armRecipTableQ15[64];    
 extern q31_t armRecipTableQ31[64];    
+extern const q31_t armCordicAtanTableQ31[31];
+extern const q31_t armCordicInvGainTableQ31[31];
+extern const uint32_t armRecipSqrtTableQ30[49];
     
 #endif /*  ARM_COMMON_TABLES_H */    
@@ -989,6 +989,90 @@ extern "C"
     q31_t *pData;         /**< points to the data of the matrix. */  
   
   } arm_matrix_instance_q31;  
+
+  /**
+   * @brief Instance structure for the Q7 matrix structure.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    q7_t *pData;          /**< points to the data of the matrix. */
+
+  } arm_matrix_instance_q7;
+
+  /**
+   * @brief Instance structure for the floating-point packed symmetric matrix structure.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows and columns of the matrix. */
+    float32_t *pData;     /**< points to the lower triangle of the matrix, packed row by row (numRows*(numRows+1)/2 values). */
+  } arm_matrix_sym_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point packed lower triangular matrix structure.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows and columns of the matrix. */
+    float32_t *pData;     /**< points to the lower triangle of the matrix, packed row by row (numRows*(numRows+1)/2 values). */
+  } arm_matrix_tri_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point CSR sparse matrix structure.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    uint16_t *pRowPtr;    /**< points to the numRows+1 row offsets; row k holds entries pRowPtr[k] to pRowPtr[k+1]-1. */
+    uint16_t *pColIdx;    /**< points to the column index of every stored entry. */
+    float32_t *pData;     /**< points to the value of every stored entry. */
+  } arm_matrix_csr_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point CSC sparse matrix structure.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    uint16_t *pColPtr;    /**< points to the numCols+1 column offsets; column k holds entries pColPtr[k] to pColPtr[k+1]-1. */
+    uint16_t *pRowIdx;    /**< points to the row index of every stored entry. */
+    float32_t *pData;     /**< points to the value of every stored entry. */
+  } arm_matrix_csc_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 CSR sparse matrix structure.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    uint16_t *pRowPtr;    /**< points to the numRows+1 row offsets; row k holds entries pRowPtr[k] to pRowPtr[k+1]-1. */
+    uint16_t *pColIdx;    /**< points to the column index of every stored entry. */
+    q31_t *pData;         /**< points to the value of every stored entry. */
+  } arm_matrix_csr_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q31 CSC sparse matrix structure.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    uint16_t *pColPtr;    /**< points to the numCols+1 column offsets; column k holds entries pColPtr[k] to pColPtr[k+1]-1. */
+    uint16_t *pRowIdx;    /**< points to the row index of every stored entry. */
+    q31_t *pData;         /**< points to the value of every stored entry. */
+  } arm_matrix_csc_instance_q31;
   
   
   
@@ -1071,6 +1155,30 @@ extern "C"
   arm_status arm_mat_trans_q31(  
 			       const arm_matrix_instance_q31 * pSrc,  
 			       arm_matrix_instance_q31 * pDst);  
+
+  /**
+   * @brief Floating-point complex matrix transpose.
+   * @param[in]  *pSrc points to the input complex matrix
+   * @param[out] *pDst points to the output complex matrix
+   * @return 	The function returns either  <code>ARM_MATH_SIZE_MISMATCH</code>
+   * or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_cmplx_trans_f32(
+			       const arm_matrix_instance_f32 * pSrc,
+			       arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Q15 complex matrix transpose.
+   * @param[in]  *pSrc points to the input complex matrix
+   * @param[out] *pDst points to the output complex matrix
+   * @return 	The function returns either  <code>ARM_MATH_SIZE_MISMATCH</code>
+   * or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_cmplx_trans_q15(
+			       const arm_matrix_instance_q15 * pSrc,
+			       arm_matrix_instance_q15 * pDst);
   
   
   /**  
@@ -1161,6 +1269,82 @@ extern "C"
 				   const arm_matrix_instance_q15 * pSrcB,  
 				   arm_matrix_instance_q15 * pDst,  
 				   q15_t * pScratch);  
+
+  /**
+   * @brief Q7 matrix multiplication
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @param[in]       *pScratch points to scratch buffer of size numRowsB * numColsB
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_mult_q7(
+			     const arm_matrix_instance_q7 * pSrcA,
+			     const arm_matrix_instance_q7 * pSrcB,
+			     arm_matrix_instance_q7 * pDst,
+			     q7_t * pScratch);
+
+  /**
+   * @brief Q7 by Q15 matrix multiplication with Q31 accumulators.
+   * @param[in]       *pSrcA points to the Q7 weight matrix structure, reordered by arm_mat_reorder_q7()
+   * @param[in]       *pSrcB points to the Q15 activation matrix structure
+   * @param[out]      *pDst points to the Q31 accumulator matrix structure
+   * @param[in]       *pScratch points to scratch buffer of size numRowsB * numColsB
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_mult_q7_q15(
+				 const arm_matrix_instance_q7 * pSrcA,
+				 const arm_matrix_instance_q15 * pSrcB,
+				 arm_matrix_instance_q31 * pDst,
+				 q15_t * pScratch);
+
+  /**
+   * @brief Reorders a Q7 weight matrix into the layout used by arm_mat_mult_q7_q15().
+   * @param[in]       *pSrc points to the input matrix structure
+   * @param[out]      *pDst points to the output matrix structure (may be the same as pSrc)
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_reorder_q7(
+				const arm_matrix_instance_q7 * pSrc,
+				arm_matrix_instance_q7 * pDst);
+
+  /**
+   * @brief Requantizes a Q31 accumulator matrix to Q15 with one scale factor per row.
+   * @param[in]       *pSrc points to the input accumulator matrix structure
+   * @param[in]       *pMult points to the array of numRows Q31 scale fractions
+   * @param[in]       *pShift points to the array of numRows left shifts, in the range -31 to 30
+   * @param[out]      *pDst points to the output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_requantize_q15(
+				    const arm_matrix_instance_q31 * pSrc,
+				    const q31_t * pMult,
+				    const int8_t * pShift,
+				    arm_matrix_instance_q15 * pDst);
+
+  /**
+   * @brief Requantizes a Q31 accumulator matrix to Q7 with one scale factor per row.
+   * @param[in]       *pSrc points to the input accumulator matrix structure
+   * @param[in]       *pMult points to the array of numRows Q31 scale fractions
+   * @param[in]       *pShift points to the array of numRows left shifts, in the range -31 to 30
+   * @param[out]      *pDst points to the output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_requantize_q7(
+				   const arm_matrix_instance_q31 * pSrc,
+				   const q31_t * pMult,
+				   const int8_t * pShift,
+				   arm_matrix_instance_q7 * pDst);
   
   /**  
    * @brief Q31 matrix multiplication  
@@ -1309,6 +1493,21 @@ extern "C"
 			uint16_t nRows,  
 			uint16_t nColumns,  
 			q15_t    *pData);  
+
+  /**
+   * @brief  Q7 matrix initialization.
+   * @param[in,out] *S             points to an instance of the Q7 matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pData         points to the matrix data array.
+   * @return        none
+   */
+
+  void arm_mat_init_q7(
+			arm_matrix_instance_q7 * S,
+			uint16_t nRows,
+			uint16_t nColumns,
+			q7_t     *pData);
   
   /**  
    * @brief  Floating-point matrix initialization.  
@@ -1324,6 +1523,394 @@ extern "C"
 			uint16_t nRows,  
 			uint16_t nColumns,  
 			float32_t   *pData);  
+
+  /**
+   * @brief  Floating-point packed symmetric matrix initialization.
+   * @param[in,out] *S             points to an instance of the floating-point packed symmetric matrix structure.
+   * @param[in]     nRows          number of rows and columns of the matrix.
+   * @param[in]     *pData	       points to the packed data array.
+   * @return        none
+   */
+
+  void arm_mat_sym_init_f32(
+			    arm_matrix_sym_instance_f32 * S,
+			    uint16_t nRows,
+			    float32_t * pData);
+
+  /**
+   * @brief  Floating-point packed lower triangular matrix initialization.
+   * @param[in,out] *S             points to an instance of the floating-point packed triangular matrix structure.
+   * @param[in]     nRows          number of rows and columns of the matrix.
+   * @param[in]     *pData	       points to the packed data array.
+   * @return        none
+   */
+
+  void arm_mat_tri_init_f32(
+			    arm_matrix_tri_instance_f32 * S,
+			    uint16_t nRows,
+			    float32_t * pData);
+
+  /**
+   * @brief Packs a floating-point symmetric matrix.
+   * @param[in]       *pSrc points to the full input matrix structure
+   * @param[out]      *pDst points to the packed output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_sym_pack_f32(
+				  const arm_matrix_instance_f32 * pSrc,
+				  arm_matrix_sym_instance_f32 * pDst);
+
+  /**
+   * @brief Unpacks a floating-point symmetric matrix.
+   * @param[in]       *pSrc points to the packed input matrix structure
+   * @param[out]      *pDst points to the full output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_sym_unpack_f32(
+				    const arm_matrix_sym_instance_f32 * pSrc,
+				    arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point packed covariance update <code>A * P * A' + Q</code>.
+   * @param[in]       *pSrcA points to the full matrix structure A of size <code>M x N</code>
+   * @param[in]       *pSrcP points to the packed symmetric matrix structure P of order <code>N</code>
+   * @param[in]       *pSrcQ points to the packed symmetric matrix structure Q of order <code>M</code>, or NULL
+   * @param[out]      *pDst points to the packed symmetric output matrix structure of order <code>M</code>
+   * @param[in]       *pScratch points to a scratch buffer of <code>M*N</code> values
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_sym_update_f32(
+				    const arm_matrix_instance_f32 * pSrcA,
+				    const arm_matrix_sym_instance_f32 * pSrcP,
+				    const arm_matrix_sym_instance_f32 * pSrcQ,
+				    arm_matrix_sym_instance_f32 * pDst,
+				    float32_t * pScratch);
+
+  /**
+   * @brief Floating-point packed triangular matrix multiplication.
+   * @param[in]       *pSrcL points to the packed lower triangular matrix structure L of order <code>N</code>
+   * @param[in]       *pSrcB points to the full input matrix structure B of size <code>N x M</code>
+   * @param[out]      *pDst points to the full output matrix structure of size <code>N x M</code>
+   * @param[in]       transFlag flag that selects <code>L * B</code> (transFlag = 0) or <code>L' * B</code> (transFlag = 1)
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_tri_mult_f32(
+				  const arm_matrix_tri_instance_f32 * pSrcL,
+				  const arm_matrix_instance_f32 * pSrcB,
+				  arm_matrix_instance_f32 * pDst,
+				  uint8_t transFlag);
+
+  /**
+   * @brief Floating-point packed triangular system solver.
+   * @param[in]       *pSrcL points to the packed lower triangular matrix structure L of order <code>N</code>
+   * @param[in]       *pSrcB points to the full right-hand side matrix structure B of size <code>N x M</code>
+   * @param[out]      *pDst points to the full solution matrix structure X of size <code>N x M</code>
+   * @param[in]       transFlag flag that selects <code>L * X = B</code> (transFlag = 0) or <code>L' * X = B</code> (transFlag = 1)
+   * @return The function returns <code>ARM_MATH_SIZE_MISMATCH</code> on a size mismatch,
+   * <code>ARM_MATH_SINGULAR</code> if a diagonal element of L is zero, otherwise <code>ARM_MATH_SUCCESS</code>.
+   */
+
+  arm_status arm_mat_tri_solve_f32(
+				   const arm_matrix_tri_instance_f32 * pSrcL,
+				   const arm_matrix_instance_f32 * pSrcB,
+				   arm_matrix_instance_f32 * pDst,
+				   uint8_t transFlag);
+
+  /**
+   * @brief Floating-point CSR sparse matrix initialization.
+   * @param[in,out] *S             points to an instance of the floating-point CSR sparse matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pRowPtr       points to the row offsets.
+   * @param[in]     *pColIdx       points to the column indices of the stored entries.
+   * @param[in]     *pData         points to the values of the stored entries.
+   * @return none
+   */
+
+  void arm_mat_csr_init_f32(
+				arm_matrix_csr_instance_f32 * S,
+				uint16_t nRows,
+				uint16_t nColumns,
+				uint16_t * pRowPtr,
+				uint16_t * pColIdx,
+				float32_t * pData);
+
+  /**
+   * @brief Floating-point conversion of a full matrix to CSR sparse storage.
+   * @param[in]       *pSrc points to the full input matrix structure
+   * @param[in,out]   *pDst points to the CSR sparse matrix structure
+   * @param[in]       maxNonZeros number of entries that the index and value arrays can hold
+   * @return The function returns <code>ARM_MATH_SIZE_MISMATCH</code>, <code>ARM_MATH_LENGTH_ERROR</code>
+   * or <code>ARM_MATH_SUCCESS</code>.
+   */
+
+  arm_status arm_mat_csr_from_dense_f32(
+					const arm_matrix_instance_f32 * pSrc,
+					arm_matrix_csr_instance_f32 * pDst,
+					uint16_t maxNonZeros);
+
+  /**
+   * @brief Floating-point refresh of CSR sparse values from a full matrix.
+   * @param[in]       *pSrc points to the full input matrix structure
+   * @param[in,out]   *pDst points to the CSR sparse matrix structure with a valid pattern
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_csr_gather_f32(
+					const arm_matrix_instance_f32 * pSrc,
+					arm_matrix_csr_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point CSR sparse matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the CSR sparse matrix structure of size <code>M x N</code>
+   * @param[in]       *pVec points to the input vector of <code>N</code> values
+   * @param[out]      *pDst points to the output vector of <code>M</code> values
+   * @return none.
+   */
+
+  void arm_mat_csr_mult_vec_f32(
+				const arm_matrix_csr_instance_f32 * pSrcMat,
+				const float32_t * pVec,
+				float32_t * pDst);
+
+  /**
+   * @brief Floating-point CSR sparse matrix multiplication.
+   * @param[in]       *pSrcA points to the CSR sparse matrix structure of size <code>M x N</code>
+   * @param[in]       *pSrcB points to the full input matrix structure of size <code>N x P</code>
+   * @param[out]      *pDst points to the full output matrix structure of size <code>M x P</code>
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_csr_mult_f32(
+					const arm_matrix_csr_instance_f32 * pSrcA,
+					const arm_matrix_instance_f32 * pSrcB,
+					arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point CSC sparse matrix initialization.
+   * @param[in,out] *S             points to an instance of the floating-point CSC sparse matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pColPtr       points to the column offsets.
+   * @param[in]     *pRowIdx       points to the row indices of the stored entries.
+   * @param[in]     *pData         points to the values of the stored entries.
+   * @return none
+   */
+
+  void arm_mat_csc_init_f32(
+				arm_matrix_csc_instance_f32 * S,
+				uint16_t nRows,
+				uint16_t nColumns,
+				uint16_t * pColPtr,
+				uint16_t * pRowIdx,
+				float32_t * pData);
+
+  /**
+   * @brief Floating-point conversion of a full matrix to CSC sparse storage.
+   * @param[in]       *pSrc points to the full input matrix structure
+   * @param[in,out]   *pDst points to the CSC sparse matrix structure
+   * @param[in]       maxNonZeros number of entries that the index and value arrays can hold
+   * @return The function returns <code>ARM_MATH_SIZE_MISMATCH</code>, <code>ARM_MATH_LENGTH_ERROR</code>
+   * or <code>ARM_MATH_SUCCESS</code>.
+   */
+
+  arm_status arm_mat_csc_from_dense_f32(
+					const arm_matrix_instance_f32 * pSrc,
+					arm_matrix_csc_instance_f32 * pDst,
+					uint16_t maxNonZeros);
+
+  /**
+   * @brief Floating-point refresh of CSC sparse values from a full matrix.
+   * @param[in]       *pSrc points to the full input matrix structure
+   * @param[in,out]   *pDst points to the CSC sparse matrix structure with a valid pattern
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_csc_gather_f32(
+					const arm_matrix_instance_f32 * pSrc,
+					arm_matrix_csc_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point CSC sparse matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the CSC sparse matrix structure of size <code>M x N</code>
+   * @param[in]       *pVec points to the input vector of <code>N</code> values
+   * @param[out]      *pDst points to the output vector of <code>M</code> values
+   * @return none.
+   */
+
+  void arm_mat_csc_mult_vec_f32(
+				const arm_matrix_csc_instance_f32 * pSrcMat,
+				const float32_t * pVec,
+				float32_t * pDst);
+
+  /**
+   * @brief Floating-point CSC sparse matrix multiplication.
+   * @param[in]       *pSrcA points to the CSC sparse matrix structure of size <code>M x N</code>
+   * @param[in]       *pSrcB points to the full input matrix structure of size <code>N x P</code>
+   * @param[out]      *pDst points to the full output matrix structure of size <code>M x P</code>
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_csc_mult_f32(
+					const arm_matrix_csc_instance_f32 * pSrcA,
+					const arm_matrix_instance_f32 * pSrcB,
+					arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Q31 CSR sparse matrix initialization.
+   * @param[in,out] *S             points to an instance of the Q31 CSR sparse matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pRowPtr       points to the row offsets.
+   * @param[in]     *pColIdx       points to the column indices of the stored entries.
+   * @param[in]     *pData         points to the values of the stored entries.
+   * @return none
+   */
+
+  void arm_mat_csr_init_q31(
+				arm_matrix_csr_instance_q31 * S,
+				uint16_t nRows,
+				uint16_t nColumns,
+				uint16_t * pRowPtr,
+				uint16_t * pColIdx,
+				q31_t * pData);
+
+  /**
+   * @brief Q31 conversion of a full matrix to CSR sparse storage.
+   * @param[in]       *pSrc points to the full input matrix structure
+   * @param[in,out]   *pDst points to the CSR sparse matrix structure
+   * @param[in]       maxNonZeros number of entries that the index and value arrays can hold
+   * @return The function returns <code>ARM_MATH_SIZE_MISMATCH</code>, <code>ARM_MATH_LENGTH_ERROR</code>
+   * or <code>ARM_MATH_SUCCESS</code>.
+   */
+
+  arm_status arm_mat_csr_from_dense_q31(
+					const arm_matrix_instance_q31 * pSrc,
+					arm_matrix_csr_instance_q31 * pDst,
+					uint16_t maxNonZeros);
+
+  /**
+   * @brief Q31 refresh of CSR sparse values from a full matrix.
+   * @param[in]       *pSrc points to the full input matrix structure
+   * @param[in,out]   *pDst points to the CSR sparse matrix structure with a valid pattern
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_csr_gather_q31(
+					const arm_matrix_instance_q31 * pSrc,
+					arm_matrix_csr_instance_q31 * pDst);
+
+  /**
+   * @brief Q31 CSR sparse matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the CSR sparse matrix structure of size <code>M x N</code>
+   * @param[in]       *pVec points to the input vector of <code>N</code> values
+   * @param[out]      *pDst points to the output vector of <code>M</code> values
+   * @return none.
+   */
+
+  void arm_mat_csr_mult_vec_q31(
+				const arm_matrix_csr_instance_q31 * pSrcMat,
+				const q31_t * pVec,
+				q31_t * pDst);
+
+  /**
+   * @brief Q31 CSR sparse matrix multiplication.
+   * @param[in]       *pSrcA points to the CSR sparse matrix structure of size <code>M x N</code>
+   * @param[in]       *pSrcB points to the full input matrix structure of size <code>N x P</code>
+   * @param[out]      *pDst points to the full output matrix structure of size <code>M x P</code>
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_csr_mult_q31(
+					const arm_matrix_csr_instance_q31 * pSrcA,
+					const arm_matrix_instance_q31 * pSrcB,
+					arm_matrix_instance_q31 * pDst);
+
+  /**
+   * @brief Q31 CSC sparse matrix initialization.
+   * @param[in,out] *S             points to an instance of the Q31 CSC sparse matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pColPtr       points to the column offsets.
+   * @param[in]     *pRowIdx       points to the row indices of the stored entries.
+   * @param[in]     *pData         points to the values of the stored entries.
+   * @return none
+   */
+
+  void arm_mat_csc_init_q31(
+				arm_matrix_csc_instance_q31 * S,
+				uint16_t nRows,
+				uint16_t nColumns,
+				uint16_t * pColPtr,
+				uint16_t * pRowIdx,
+				q31_t * pData);
+
+  /**
+   * @brief Q31 conversion of a full matrix to CSC sparse storage.
+   * @param[in]       *pSrc points to the full input matrix structure
+   * @param[in,out]   *pDst points to the CSC sparse matrix structure
+   * @param[in]       maxNonZeros number of entries that the index and value arrays can hold
+   * @return The function returns <code>ARM_MATH_SIZE_MISMATCH</code>, <code>ARM_MATH_LENGTH_ERROR</code>
+   * or <code>ARM_MATH_SUCCESS</code>.
+   */
+
+  arm_status arm_mat_csc_from_dense_q31(
+					const arm_matrix_instance_q31 * pSrc,
+					arm_matrix_csc_instance_q31 * pDst,
+					uint16_t maxNonZeros);
+
+  /**
+   * @brief Q31 refresh of CSC sparse values from a full matrix.
+   * @param[in]       *pSrc points to the full input matrix structure
+   * @param[in,out]   *pDst points to the CSC sparse matrix structure with a valid pattern
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_csc_gather_q31(
+					const arm_matrix_instance_q31 * pSrc,
+					arm_matrix_csc_instance_q31 * pDst);
+
+  /**
+   * @brief Q31 CSC sparse matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the CSC sparse matrix structure of size <code>M x N</code>
+   * @param[in]       *pVec points to the input vector of <code>N</code> values
+   * @param[out]      *pDst points to the output vector of <code>M</code> values
+   * @return none.
+   */
+
+  void arm_mat_csc_mult_vec_q31(
+				const arm_matrix_csc_instance_q31 * pSrcMat,
+				const q31_t * pVec,
+				q31_t * pDst);
+
+  /**
+   * @brief Q31 CSC sparse matrix multiplication.
+   * @param[in]       *pSrcA points to the CSC sparse matrix structure of size <code>M x N</code>
+   * @param[in]       *pSrcB points to the full input matrix structure of size <code>N x P</code>
+   * @param[out]      *pDst points to the full output matrix structure of size <code>M x P</code>
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_csc_mult_q31(
+					const arm_matrix_csc_instance_q31 * pSrcA,
+					const arm_matrix_instance_q31 * pSrcB,
+					arm_matrix_instance_q31 * pDst);
   
   
   
@@ -1427,6 +2014,319 @@ extern "C"
    */  
   void arm_pid_reset_q15(  
 			 arm_pid_instance_q15 * S);  
+
+  /**
+   * @brief Integrator anti-windup modes of the PID controller bank.
+   */
+
+  typedef enum
+    {
+      ARM_PID_BANK_AW_NONE = 0,          /**< The integrator is not limited */
+      ARM_PID_BANK_AW_CLAMP = 1,         /**< Conditional integration and integrator clamping to the output limits */
+      ARM_PID_BANK_AW_BACKCALC = 2       /**< Back-calculation of the integrator from the saturation error */
+    } arm_pid_bank_antiwindup;
+
+  /**
+   * @brief Instance structure for the floating-point PID controller bank.
+   */
+
+  typedef struct
+  {
+    uint16_t numCtrl;                    /**< number of controllers N in the bank. */
+    uint8_t antiWindup;                  /**< integrator anti-windup mode, one of arm_pid_bank_antiwindup. */
+    float32_t *pKp;                      /**< points to the N proportional gains. */
+    float32_t *pKi;                      /**< points to the N integral gains, sample time included. */
+    float32_t *pKd;                      /**< points to the N derivative gains, divided by the sample time. */
+    float32_t *pAlpha;                   /**< points to the N derivative filter poles in [0, 1). 0 disables the filter. */
+    float32_t *pKb;                      /**< points to the N back-calculation gains, used with ARM_PID_BANK_AW_BACKCALC only. */
+    float32_t *pOutMin;                  /**< points to the N lower output limits. */
+    float32_t *pOutMax;                  /**< points to the N upper output limits. */
+    float32_t *pState;                   /**< points to the 3*N state: integrators, filtered derivatives, previous errors. */
+  } arm_pid_bank_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 PID controller bank.
+   */
+
+  typedef struct
+  {
+    uint16_t numCtrl;                    /**< number of controllers N in the bank. */
+    uint8_t antiWindup;                  /**< integrator anti-windup mode, one of arm_pid_bank_antiwindup. */
+    uint8_t postShift;                   /**< gains are scaled down by 2^postShift to fit the 1.31 format. */
+    q31_t *pKp;                          /**< points to the N proportional gains. */
+    q31_t *pKi;                          /**< points to the N integral gains, sample time included. */
+    q31_t *pKd;                          /**< points to the N derivative gains, divided by the sample time. */
+    q31_t *pAlpha;                       /**< points to the N derivative filter poles in [0, 1). 0 disables the filter. */
+    q31_t *pKb;                          /**< points to the N back-calculation gains, used with ARM_PID_BANK_AW_BACKCALC only. */
+    q31_t *pOutMin;                      /**< points to the N lower output limits. */
+    q31_t *pOutMax;                      /**< points to the N upper output limits. */
+    q31_t *pState;                       /**< points to the 3*N state: integrators, filtered derivatives, previous errors. */
+  } arm_pid_bank_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point PID controller bank.
+   * @param[in,out] *S points to an instance of the floating-point PID bank structure.
+   * @param[in] numCtrl number of controllers in the bank.
+   * @param[in] antiWindup integrator anti-windup mode, one of arm_pid_bank_antiwindup.
+   * @param[in] *pKp points to the proportional gains.
+   * @param[in] *pKi points to the integral gains.
+   * @param[in] *pKd points to the derivative gains.
+   * @param[in] *pAlpha points to the derivative filter poles.
+   * @param[in] *pKb points to the back-calculation gains. May be NULL unless antiWindup is ARM_PID_BANK_AW_BACKCALC.
+   * @param[in] *pOutMin points to the lower output limits.
+   * @param[in] *pOutMax points to the upper output limits.
+   * @param[in] *pState points to the state buffer of 3*numCtrl values.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for an unknown anti-windup mode or missing
+   * back-calculation gains.
+   */
+
+  arm_status arm_pid_bank_init_f32(
+				   arm_pid_bank_instance_f32 * S,
+				   uint16_t numCtrl,
+				   uint8_t antiWindup,
+				   float32_t * pKp,
+				   float32_t * pKi,
+				   float32_t * pKd,
+				   float32_t * pAlpha,
+				   float32_t * pKb,
+				   float32_t * pOutMin,
+				   float32_t * pOutMax,
+				   float32_t * pState);
+
+  /**
+   * @brief  Reset function for the floating-point PID controller bank.
+   * @param[in,out] *S points to an instance of the floating-point PID bank structure.
+   * @return none
+   */
+
+  void arm_pid_bank_reset_f32(
+			      arm_pid_bank_instance_f32 * S);
+
+  /**
+   * @brief  Processing function for the floating-point PID controller bank.
+   * @param[in,out] *S points to an instance of the floating-point PID bank structure.
+   * @param[in] *pSrc points to the N error samples of this tick.
+   * @param[out] *pDst points to the N limited controller outputs.
+   * @return none
+   */
+
+  void arm_pid_bank_f32(
+			arm_pid_bank_instance_f32 * S,
+			float32_t * pSrc,
+			float32_t * pDst);
+
+  /**
+   * @brief  Initialization function for the Q31 PID controller bank.
+   * @param[in,out] *S points to an instance of the Q31 PID bank structure.
+   * @param[in] numCtrl number of controllers in the bank.
+   * @param[in] antiWindup integrator anti-windup mode, one of arm_pid_bank_antiwindup.
+   * @param[in] postShift scaling of the gains, 0 to 15 bits.
+   * @param[in] *pKp points to the proportional gains.
+   * @param[in] *pKi points to the integral gains.
+   * @param[in] *pKd points to the derivative gains.
+   * @param[in] *pAlpha points to the derivative filter poles.
+   * @param[in] *pKb points to the back-calculation gains. May be NULL unless antiWindup is ARM_PID_BANK_AW_BACKCALC.
+   * @param[in] *pOutMin points to the lower output limits.
+   * @param[in] *pOutMax points to the upper output limits.
+   * @param[in] *pState points to the state buffer of 3*numCtrl values.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for an unknown anti-windup mode, missing
+   * back-calculation gains or a postShift above 15.
+   */
+
+  arm_status arm_pid_bank_init_q31(
+				   arm_pid_bank_instance_q31 * S,
+				   uint16_t numCtrl,
+				   uint8_t antiWindup,
+				   uint8_t postShift,
+				   q31_t * pKp,
+				   q31_t * pKi,
+				   q31_t * pKd,
+				   q31_t * pAlpha,
+				   q31_t * pKb,
+				   q31_t * pOutMin,
+				   q31_t * pOutMax,
+				   q31_t * pState);
+
+  /**
+   * @brief  Reset function for the Q31 PID controller bank.
+   * @param[in,out] *S points to an instance of the Q31 PID bank structure.
+   * @return none
+   */
+
+  void arm_pid_bank_reset_q31(
+			      arm_pid_bank_instance_q31 * S);
+
+  /**
+   * @brief  Processing function for the Q31 PID controller bank.
+   * @param[in,out] *S points to an instance of the Q31 PID bank structure.
+   * @param[in] *pSrc points to the N error samples of this tick.
+   * @param[out] *pDst points to the N limited controller outputs.
+   * @return none
+   */
+
+  void arm_pid_bank_q31(
+			arm_pid_bank_instance_q31 * S,
+			q31_t * pSrc,
+			q31_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point field-oriented control step.
+   */
+
+  typedef struct
+  {
+    float32_t KpD;                       /**< proportional gain of the d-axis current loop. */
+    float32_t KiD;                       /**< integral gain of the d-axis current loop, sample time included. */
+    float32_t KpQ;                       /**< proportional gain of the q-axis current loop. */
+    float32_t KiQ;                       /**< integral gain of the q-axis current loop, sample time included. */
+    float32_t vMax;                      /**< limit of the voltage vector magnitude as a fraction of the DC bus voltage. */
+    float32_t integD;                    /**< d-axis integrator state. */
+    float32_t integQ;                    /**< q-axis integrator state. */
+  } arm_foc_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 field-oriented control step.
+   */
+
+  typedef struct
+  {
+    q31_t KpD;                           /**< proportional gain of the d-axis current loop. */
+    q31_t KiD;                           /**< integral gain of the d-axis current loop, sample time included. */
+    q31_t KpQ;                           /**< proportional gain of the q-axis current loop. */
+    q31_t KiQ;                           /**< integral gain of the q-axis current loop, sample time included. */
+    q31_t vMax;                          /**< limit of the voltage vector magnitude as a fraction of the DC bus voltage. */
+    uint8_t postShift;                   /**< gains are scaled down by 2^postShift to fit the 1.31 format. */
+    q31_t integD;                        /**< d-axis integrator state. */
+    q31_t integQ;                        /**< q-axis integrator state. */
+  } arm_foc_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point field-oriented control step.
+   * @param[in,out] *S points to an instance of the floating-point FOC structure.
+   * @param[in] KpD proportional gain of the d-axis current loop.
+   * @param[in] KiD integral gain of the d-axis current loop.
+   * @param[in] KpQ proportional gain of the q-axis current loop.
+   * @param[in] KiQ integral gain of the q-axis current loop.
+   * @param[in] vMax limit of the voltage vector magnitude, in (0, 1/sqrt(3)] for linear modulation.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if vMax is out of range.
+   */
+
+  arm_status arm_foc_init_f32(
+			      arm_foc_instance_f32 * S,
+			      float32_t KpD,
+			      float32_t KiD,
+			      float32_t KpQ,
+			      float32_t KiQ,
+			      float32_t vMax);
+
+  /**
+   * @brief  Floating-point field-oriented control step.
+   * @param[in,out] *S points to an instance of the floating-point FOC structure.
+   * @param[in] Ia phase a current.
+   * @param[in] Ib phase b current.
+   * @param[in] theta electrical rotor angle in degrees, in the range accepted by arm_sin_cos_f32().
+   * @param[in] IdRef d-axis current reference.
+   * @param[in] IqRef q-axis current reference.
+   * @param[out] *pDuty points to the three phase duty cycles in [0, 1].
+   * @return none.
+   */
+
+  void arm_foc_step_f32(
+			arm_foc_instance_f32 * S,
+			float32_t Ia,
+			float32_t Ib,
+			float32_t theta,
+			float32_t IdRef,
+			float32_t IqRef,
+			float32_t * pDuty);
+
+  /**
+   * @brief  Floating-point field-oriented control step for several motors.
+   * @param[in,out] *S points to an array of numMotors floating-point FOC instances.
+   * @param[in] *pIa points to the phase a currents.
+   * @param[in] *pIb points to the phase b currents.
+   * @param[in] *pTheta points to the electrical rotor angles in degrees.
+   * @param[in] *pIdRef points to the d-axis current references.
+   * @param[in] *pIqRef points to the q-axis current references.
+   * @param[out] *pDuty points to the duty cycles, three per motor.
+   * @param[in] numMotors number of motors.
+   * @return none.
+   */
+
+  void arm_foc_step_block_f32(
+			      arm_foc_instance_f32 * S,
+			      float32_t * pIa,
+			      float32_t * pIb,
+			      float32_t * pTheta,
+			      float32_t * pIdRef,
+			      float32_t * pIqRef,
+			      float32_t * pDuty,
+			      uint32_t numMotors);
+
+  /**
+   * @brief  Initialization function for the Q31 field-oriented control step.
+   * @param[in,out] *S points to an instance of the Q31 FOC structure.
+   * @param[in] KpD proportional gain of the d-axis current loop.
+   * @param[in] KiD integral gain of the d-axis current loop.
+   * @param[in] KpQ proportional gain of the q-axis current loop.
+   * @param[in] KiQ integral gain of the q-axis current loop.
+   * @param[in] vMax limit of the voltage vector magnitude, in (0, 1/sqrt(3)] for linear modulation.
+   * @param[in] postShift scaling of the gains, 0 to 15 bits.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if vMax or postShift is out of range.
+   */
+
+  arm_status arm_foc_init_q31(
+			      arm_foc_instance_q31 * S,
+			      q31_t KpD,
+			      q31_t KiD,
+			      q31_t KpQ,
+			      q31_t KiQ,
+			      q31_t vMax,
+			      uint8_t postShift);
+
+  /**
+   * @brief  Q31 field-oriented control step.
+   * @param[in,out] *S points to an instance of the Q31 FOC structure.
+   * @param[in] Ia phase a current.
+   * @param[in] Ib phase b current.
+   * @param[in] theta electrical rotor angle, [-1 0.9999] maps to [-180 180) degrees.
+   * @param[in] IdRef d-axis current reference.
+   * @param[in] IqRef q-axis current reference.
+   * @param[out] *pDuty points to the three phase duty cycles in [0 0x7FFFFFFF].
+   * @return none.
+   */
+
+  void arm_foc_step_q31(
+			arm_foc_instance_q31 * S,
+			q31_t Ia,
+			q31_t Ib,
+			q31_t theta,
+			q31_t IdRef,
+			q31_t IqRef,
+			q31_t * pDuty);
+
+  /**
+   * @brief  Q31 field-oriented control step for several motors.
+   * @param[in,out] *S points to an array of numMotors Q31 FOC instances.
+   * @param[in] *pIa points to the phase a currents.
+   * @param[in] *pIb points to the phase b currents.
+   * @param[in] *pTheta points to the electrical rotor angles.
+   * @param[in] *pIdRef points to the d-axis current references.
+   * @param[in] *pIqRef points to the q-axis current references.
+   * @param[out] *pDuty points to the duty cycles, three per motor.
+   * @param[in] numMotors number of motors.
+   * @return none.
+   */
+
+  void arm_foc_step_block_q31(
+			      arm_foc_instance_q31 * S,
+			      q31_t * pIa,
+			      q31_t * pIb,
+			      q31_t * pTheta,
+			      q31_t * pIdRef,
+			      q31_t * pIqRef,
+			      q31_t * pDuty,
+			      uint32_t numMotors);
   
   
   /**  
@@ -1440,6 +2340,30 @@ extern "C"
     float32_t *pYData;          /**< pointer to the table of Y values */  
   } arm_linear_interp_instance_f32;  
   
+  /**  
+   * @brief Methods of the floating-point table interpolation.  
+   */  
+  typedef enum  
+  {  
+    ARM_INTERP_LINEAR = 0,        /**< linear interpolation between neighbouring table values. */  
+    ARM_INTERP_PCHIP = 1,         /**< monotone piecewise cubic Hermite interpolation (Fritsch-Carlson slopes). */  
+    ARM_INTERP_CATMULL_ROM = 2    /**< cubic Hermite interpolation with central difference slopes. */  
+  } arm_interp_method;  
+  
+  /**  
+   * @brief Instance structure for the floating-point table interpolation functions.  
+   */  
+  typedef struct  
+  {  
+    uint32_t nValues;             /**< number of table values, at least 2. */  
+    arm_interp_method method;     /**< interpolation method. */  
+    float32_t x1;                 /**< input value of the first table entry. */  
+    float32_t invSpacing;         /**< reciprocal of the spacing between table entries. */  
+    float32_t maxIndex;           /**< index of the last table entry, nValues - 1. */  
+    float32_t *pYData;            /**< points to the table of output values. */  
+    float32_t *pSlope;            /**< points to the slopes at the table entries, in table-index units. Used by the cubic methods. */  
+  } arm_interp_instance_f32;  
+  
   /**  
    * @brief Instance structure for the floating-point bilinear interpolation function.  
    */  
@@ -1484,6 +2408,91 @@ extern "C"
     q7_t *pData;		/**< points to the data table. */  
   } arm_bilinear_interp_instance_q7;  
   
+  /**  
+   * @brief Grid axis of the floating-point bilinear and trilinear maps.  
+   */  
+  typedef struct  
+  {  
+    uint16_t numPoints;           /**< number of grid points, at least 2. */  
+    float32_t x0;                 /**< first grid point. */  
+    float32_t invSpacing;         /**< reciprocal of the grid spacing of a uniform axis. */  
+    float32_t maxIndex;           /**< index of the last grid point, numPoints - 1. */  
+    const float32_t *pPoints;     /**< points to the grid points of a non-uniform axis, NULL for a uniform axis. */  
+    const float32_t *pInvDelta;   /**< points to the reciprocal interval lengths of a non-uniform axis. */  
+  } arm_interp_axis_f32;  
+  
+  /**  
+   * @brief Instance structure for the floating-point bilinear map.  
+   */  
+  typedef struct  
+  {  
+    arm_interp_axis_f32 axisX;    /**< X axis, varying fastest in the table. */  
+    arm_interp_axis_f32 axisY;    /**< Y axis. */  
+    uint32_t strideY;             /**< distance between table rows, numX. */  
+    const float32_t *pData;       /**< points to the table of numX * numY values. */  
+  } arm_bilinear_map_instance_f32;  
+  
+  /**  
+   * @brief Instance structure for the floating-point trilinear map.  
+   */  
+  typedef struct  
+  {  
+    arm_interp_axis_f32 axisX;    /**< X axis, varying fastest in the table. */  
+    arm_interp_axis_f32 axisY;    /**< Y axis. */  
+    arm_interp_axis_f32 axisZ;    /**< Z axis. */  
+    uint32_t strideY;             /**< distance between table rows, numX. */  
+    uint32_t strideZ;             /**< distance between table planes, numX * numY. */  
+    const float32_t *pData;       /**< points to the table of numX * numY * numZ values. */  
+  } arm_trilinear_map_instance_f32;  
+  
+  /**  
+   * @brief Instance structure for the Q31 bilinear map.  
+   */  
+  typedef struct  
+  {  
+    uint16_t numX;                /**< number of grid points along X, 2 to 2048. */  
+    uint16_t numY;                /**< number of grid points along Y, 2 to 2048. */  
+    uint32_t strideY;             /**< distance between table rows, numX. */  
+    const q31_t *pData;           /**< points to the table of numX * numY values. */  
+  } arm_bilinear_map_instance_q31;  
+  
+  /**  
+   * @brief Instance structure for the Q15 bilinear map.  
+   */  
+  typedef struct  
+  {  
+    uint16_t numX;                /**< number of grid points along X, 2 to 2048. */  
+    uint16_t numY;                /**< number of grid points along Y, 2 to 2048. */  
+    uint32_t strideY;             /**< distance between table rows, numX. */  
+    const q15_t *pData;           /**< points to the table of numX * numY values. */  
+  } arm_bilinear_map_instance_q15;  
+  
+  /**  
+   * @brief Instance structure for the Q31 trilinear map.  
+   */  
+  typedef struct  
+  {  
+    uint16_t numX;                /**< number of grid points along X, 2 to 2048. */  
+    uint16_t numY;                /**< number of grid points along Y, 2 to 2048. */  
+    uint16_t numZ;                /**< number of grid points along Z, 2 to 2048. */  
+    uint32_t strideY;             /**< distance between table rows, numX. */  
+    uint32_t strideZ;             /**< distance between table planes, numX * numY. */  
+    const q31_t *pData;           /**< points to the table of numX * numY * numZ values. */  
+  } arm_trilinear_map_instance_q31;  
+  
+  /**  
+   * @brief Instance structure for the Q15 trilinear map.  
+   */  
+  typedef struct  
+  {  
+    uint16_t numX;                /**< number of grid points along X, 2 to 2048. */  
+    uint16_t numY;                /**< number of grid points along Y, 2 to 2048. */  
+    uint16_t numZ;                /**< number of grid points along Z, 2 to 2048. */  
+    uint32_t strideY;             /**< distance between table rows, numX. */  
+    uint32_t strideZ;             /**< distance between table planes, numX * numY. */  
+    const q15_t *pData;           /**< points to the table of numX * numY * numZ values. */  
+  } arm_trilinear_map_instance_q15;  
+  
   
   /**  
    * @brief Q7 vector multiplication.  
@@ -1707,6 +2716,91 @@ extern "C"
   
   
   
+  /**
+   * @brief Instance structure for the Q15 2-D CFFT/CIFFT function.
+   */
+
+  typedef struct
+  {
+    uint16_t  numRows;                        /**< number of rows of the image (length of the column transforms). */
+    uint16_t  numCols;                        /**< number of columns of the image (length of the row transforms). */
+    arm_cfft_radix4_instance_q15 rowFft;      /**< CFFT/CIFFT instance applied to the rows. */
+    arm_cfft_radix4_instance_q15 colFft;      /**< CFFT/CIFFT instance applied to the columns. */
+    q15_t     *pScratch;                      /**< points to the transpose buffer of size 2*numRows*numCols. */
+  } arm_cfft2d_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point 2-D CFFT/CIFFT function.
+   */
+
+  typedef struct
+  {
+    uint16_t  numRows;                        /**< number of rows of the image (length of the column transforms). */
+    uint16_t  numCols;                        /**< number of columns of the image (length of the row transforms). */
+    arm_cfft_radix4_instance_f32 rowFft;      /**< CFFT/CIFFT instance applied to the rows. */
+    arm_cfft_radix4_instance_f32 colFft;      /**< CFFT/CIFFT instance applied to the columns. */
+    float32_t *pScratch;                      /**< points to the transpose buffer of size 2*numRows*numCols. */
+  } arm_cfft2d_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 2-D CFFT/CIFFT.
+   * @param[in]      *S    points to an instance of the Q15 2-D CFFT/CIFFT structure.
+   * @param[in, out] *pSrc points to the complex image of size <code>2*numRows*numCols</code>. Processing occurs in-place.
+   * @return none.
+   */
+
+  void arm_cfft2d_q15(
+		      const arm_cfft2d_instance_q15 * S,
+		      q15_t * pSrc);
+
+  /**
+   * @brief  Initialization function for the Q15 2-D CFFT/CIFFT.
+   * @param[in,out] *S             points to an instance of the Q15 2-D CFFT/CIFFT structure.
+   * @param[in]     numRows        number of rows of the image.
+   * @param[in]     numCols        number of columns of the image.
+   * @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]     *pScratch      points to the scratch buffer of size <code>2*numRows*numCols</code>.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numRows</code> or <code>numCols</code> is not a supported length.
+   */
+
+  arm_status arm_cfft2d_init_q15(
+				 arm_cfft2d_instance_q15 * S,
+				 uint16_t numRows,
+				 uint16_t numCols,
+				 uint8_t ifftFlag,
+				 q15_t * pScratch);
+
+  /**
+   * @brief Processing function for the floating-point 2-D CFFT/CIFFT.
+   * @param[in]      *S    points to an instance of the floating-point 2-D CFFT/CIFFT structure.
+   * @param[in, out] *pSrc points to the complex image of size <code>2*numRows*numCols</code>. Processing occurs in-place.
+   * @return none.
+   */
+
+  void arm_cfft2d_f32(
+		      const arm_cfft2d_instance_f32 * S,
+		      float32_t * pSrc);
+
+  /**
+   * @brief  Initialization function for the floating-point 2-D CFFT/CIFFT.
+   * @param[in,out] *S             points to an instance of the floating-point 2-D CFFT/CIFFT structure.
+   * @param[in]     numRows        number of rows of the image.
+   * @param[in]     numCols        number of columns of the image.
+   * @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]     *pScratch      points to the scratch buffer of size <code>2*numRows*numCols</code>.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numRows</code> or <code>numCols</code> is not a supported length.
+   */
+
+  arm_status arm_cfft2d_init_f32(
+				 arm_cfft2d_instance_f32 * S,
+				 uint16_t numRows,
+				 uint16_t numCols,
+				 uint8_t ifftFlag,
+				 float32_t * pScratch);
+
+
   /*----------------------------------------------------------------------  
    *		Internal functions prototypes FFT function  
    ----------------------------------------------------------------------*/  
@@ -2515,6 +3609,74 @@ extern "C"
 			 q31_t * pSrcB,  
 			uint32_t blockSize,  
 			q63_t * result);  
+
+  /**
+   * @brief Dot products of one floating-point vector with several Floating-point vectors.
+   * @param[in]       *pSrcA points to the common input vector
+   * @param[in]       **ppSrcB points to an array of numVecs input vector pointers
+   * @param[in]       numVecs number of vectors in ppSrcB
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *pResult points to the output array (numVecs values)
+   * @return none.
+   */
+
+  void arm_dot_prod_multi_f32(
+			      float32_t * pSrcA,
+			      float32_t ** ppSrcB,
+			      uint32_t numVecs,
+			      uint32_t blockSize,
+			      float32_t * pResult);
+
+  /**
+   * @brief Dot products of one Q31 vector with several Q31 vectors.
+   * @param[in]       *pSrcA points to the common input vector
+   * @param[in]       **ppSrcB points to an array of numVecs input vector pointers
+   * @param[in]       numVecs number of vectors in ppSrcB
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *pResult points to the output array (numVecs values)
+   * @return none.
+   */
+
+  void arm_dot_prod_multi_q31(
+			      q31_t * pSrcA,
+			      q31_t ** ppSrcB,
+			      uint32_t numVecs,
+			      uint32_t blockSize,
+			      q63_t * pResult);
+
+  /**
+   * @brief Dot products of one Q15 vector with several Q15 vectors.
+   * @param[in]       *pSrcA points to the common input vector
+   * @param[in]       **ppSrcB points to an array of numVecs input vector pointers
+   * @param[in]       numVecs number of vectors in ppSrcB
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *pResult points to the output array (numVecs values)
+   * @return none.
+   */
+
+  void arm_dot_prod_multi_q15(
+			      q15_t * pSrcA,
+			      q15_t ** ppSrcB,
+			      uint32_t numVecs,
+			      uint32_t blockSize,
+			      q63_t * pResult);
+
+  /**
+   * @brief Dot products of one Q7 vector with several Q7 vectors.
+   * @param[in]       *pSrcA points to the common input vector
+   * @param[in]       **ppSrcB points to an array of numVecs input vector pointers
+   * @param[in]       numVecs number of vectors in ppSrcB
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *pResult points to the output array (numVecs values)
+   * @return none.
+   */
+
+  void arm_dot_prod_multi_q7(
+			      q7_t * pSrcA,
+			      q7_t ** ppSrcB,
+			      uint32_t numVecs,
+			      uint32_t blockSize,
+			      q31_t * pResult);
   
   /**  
    * @brief  Shifts the elements of a Q7 vector a specified number of bits.  
@@ -2672,6 +3834,493 @@ extern "C"
 		       q31_t * pSrc,  
 		      q31_t * pDst,  
 		      uint32_t blockSize);  
+
+  /**
+   * @brief  Applies a gain vector, a scale factor, an offset and a clip to a floating-point vector in one pass.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  *pGain points to the gain vector
+   * @param[in]  scale scale factor
+   * @param[in]  offset offset added after scaling
+   * @param[in]  minVal lower limit of the output
+   * @param[in]  maxVal upper limit of the output
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vectors
+   * @return none.
+   */
+
+  void arm_gain_offset_clip_f32(
+				float32_t * pSrc,
+				float32_t * pGain,
+				float32_t scale,
+				float32_t offset,
+				float32_t minVal,
+				float32_t maxVal,
+				float32_t * pDst,
+				uint32_t blockSize);
+
+  /**
+   * @brief  Applies a gain vector, a scale factor, an offset and a clip to a Q31 vector in one pass.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  *pGain points to the gain vector
+   * @param[in]  scaleFract fractional portion of the scale value
+   * @param[in]  shift number of bits to shift the result by
+   * @param[in]  offset offset added after scaling
+   * @param[in]  minVal lower limit of the output
+   * @param[in]  maxVal upper limit of the output
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vectors
+   * @return none.
+   */
+
+  void arm_gain_offset_clip_q31(
+				q31_t * pSrc,
+				q31_t * pGain,
+				q31_t scaleFract,
+				int8_t shift,
+				q31_t offset,
+				q31_t minVal,
+				q31_t maxVal,
+				q31_t * pDst,
+				uint32_t blockSize);
+
+  /**
+   * @brief  Applies a gain vector, a scale factor, an offset and a clip to a Q15 vector in one pass.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  *pGain points to the gain vector
+   * @param[in]  scaleFract fractional portion of the scale value
+   * @param[in]  shift number of bits to shift the result by
+   * @param[in]  offset offset added after scaling
+   * @param[in]  minVal lower limit of the output
+   * @param[in]  maxVal upper limit of the output
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vectors
+   * @return none.
+   */
+
+  void arm_gain_offset_clip_q15(
+				q15_t * pSrc,
+				q15_t * pGain,
+				q15_t scaleFract,
+				int8_t shift,
+				q15_t offset,
+				q15_t minVal,
+				q15_t maxVal,
+				q15_t * pDst,
+				uint32_t blockSize);
+
+  /**
+   * @brief  Applies a gain vector, a scale factor, an offset and a clip to a Q7 vector in one pass.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  *pGain points to the gain vector
+   * @param[in]  scaleFract fractional portion of the scale value
+   * @param[in]  shift number of bits to shift the result by
+   * @param[in]  offset offset added after scaling
+   * @param[in]  minVal lower limit of the output
+   * @param[in]  maxVal upper limit of the output
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vectors
+   * @return none.
+   */
+
+  void arm_gain_offset_clip_q7(
+				q7_t * pSrc,
+				q7_t * pGain,
+				q7_t scaleFract,
+				int8_t shift,
+				q7_t offset,
+				q7_t minVal,
+				q7_t maxVal,
+				q7_t * pDst,
+				uint32_t blockSize);
+
+  /**
+   * @brief  Weighted sum of two floating-point vectors.
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  a weight of the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in]  b weight of the second input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_axpby_f32(
+		    float32_t * pSrcA,
+		    float32_t a,
+		    float32_t * pSrcB,
+		    float32_t b,
+		    float32_t * pDst,
+		    uint32_t blockSize);
+
+  /**
+   * @brief  Weighted sum of two Q31 vectors.
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  a weight of the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in]  b weight of the second input vector
+   * @param[in]  shift number of bits to shift the result by
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_axpby_q31(
+		    q31_t * pSrcA,
+		    q31_t a,
+		    q31_t * pSrcB,
+		    q31_t b,
+		    int8_t shift,
+		    q31_t * pDst,
+		    uint32_t blockSize);
+
+  /**
+   * @brief  Weighted sum of two Q15 vectors.
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  a weight of the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in]  b weight of the second input vector
+   * @param[in]  shift number of bits to shift the result by
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_axpby_q15(
+		    q15_t * pSrcA,
+		    q15_t a,
+		    q15_t * pSrcB,
+		    q15_t b,
+		    int8_t shift,
+		    q15_t * pDst,
+		    uint32_t blockSize);
+
+  /**
+   * @brief  Weighted sum of two Q7 vectors.
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  a weight of the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in]  b weight of the second input vector
+   * @param[in]  shift number of bits to shift the result by
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_axpby_q7(
+		    q7_t * pSrcA,
+		    q7_t a,
+		    q7_t * pSrcB,
+		    q7_t b,
+		    int8_t shift,
+		    q7_t * pDst,
+		    uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point vector multiply-accumulate.
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in,out]  *pDst points to the accumulator vector
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_mult_acc_f32(
+		       float32_t * pSrcA,
+		       float32_t * pSrcB,
+		       float32_t * pDst,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Q31 vector multiply-accumulate.
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in,out]  *pDst points to the accumulator vector
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_mult_acc_q31(
+		       q31_t * pSrcA,
+		       q31_t * pSrcB,
+		       q31_t * pDst,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Q15 vector multiply-accumulate.
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in,out]  *pDst points to the accumulator vector
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_mult_acc_q15(
+		       q15_t * pSrcA,
+		       q15_t * pSrcB,
+		       q15_t * pDst,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Q7 vector multiply-accumulate.
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in,out]  *pDst points to the accumulator vector
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_mult_acc_q7(
+		       q7_t * pSrcA,
+		       q7_t * pSrcB,
+		       q7_t * pDst,
+		       uint32_t blockSize);
+
+  /**
+   * @brief Number of 32-bit words of a bitmask with one bit per sample.
+   */
+#define ARM_MASK_WORDS(blockSize) (((blockSize) + 31u) >> 5u)
+
+  /**
+   * @brief Comparison operators of the vector compare functions.
+   */
+  typedef enum
+  {
+    ARM_CMP_LT = 0,               /**< x < threshold. */
+    ARM_CMP_LE = 1,               /**< x <= threshold. */
+    ARM_CMP_GT = 2,               /**< x > threshold. */
+    ARM_CMP_GE = 3,               /**< x >= threshold. */
+    ARM_CMP_EQ = 4,               /**< x == threshold. */
+    ARM_CMP_NE = 5                /**< x != threshold. */
+  } arm_compare_op;
+
+  /**
+   * @brief  Compares the elements of a floating-point vector against a threshold.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  threshold value compared against
+   * @param[in]  op comparison operator, pSrc[n] op threshold
+   * @param[out] *pMask points to the output bitmask of ARM_MASK_WORDS(blockSize) words
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void arm_compare_f32(
+		       float32_t * pSrc,
+		       float32_t threshold,
+		       arm_compare_op op,
+		       uint32_t * pMask,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Compares the elements of a Q31 vector against a threshold.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  threshold value compared against
+   * @param[in]  op comparison operator, pSrc[n] op threshold
+   * @param[out] *pMask points to the output bitmask of ARM_MASK_WORDS(blockSize) words
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void arm_compare_q31(
+		       q31_t * pSrc,
+		       q31_t threshold,
+		       arm_compare_op op,
+		       uint32_t * pMask,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Compares the elements of a Q15 vector against a threshold.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  threshold value compared against
+   * @param[in]  op comparison operator, pSrc[n] op threshold
+   * @param[out] *pMask points to the output bitmask of ARM_MASK_WORDS(blockSize) words
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void arm_compare_q15(
+		       q15_t * pSrc,
+		       q15_t threshold,
+		       arm_compare_op op,
+		       uint32_t * pMask,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Compares the elements of a Q7 vector against a threshold.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  threshold value compared against
+   * @param[in]  op comparison operator, pSrc[n] op threshold
+   * @param[out] *pMask points to the output bitmask of ARM_MASK_WORDS(blockSize) words
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void arm_compare_q7(
+		       q7_t * pSrc,
+		       q7_t threshold,
+		       arm_compare_op op,
+		       uint32_t * pMask,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Checks the elements of a floating-point vector against a closed range.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  low lower limit of the range
+   * @param[in]  high upper limit of the range
+   * @param[out] *pMask points to the output bitmask, set where low <= pSrc[n] <= high
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void arm_compare_range_f32(
+		       float32_t * pSrc,
+		       float32_t low,
+		       float32_t high,
+		       uint32_t * pMask,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Checks the elements of a Q31 vector against a closed range.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  low lower limit of the range
+   * @param[in]  high upper limit of the range
+   * @param[out] *pMask points to the output bitmask, set where low <= pSrc[n] <= high
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void arm_compare_range_q31(
+		       q31_t * pSrc,
+		       q31_t low,
+		       q31_t high,
+		       uint32_t * pMask,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Checks the elements of a Q15 vector against a closed range.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  low lower limit of the range
+   * @param[in]  high upper limit of the range
+   * @param[out] *pMask points to the output bitmask, set where low <= pSrc[n] <= high
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void arm_compare_range_q15(
+		       q15_t * pSrc,
+		       q15_t low,
+		       q15_t high,
+		       uint32_t * pMask,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Checks the elements of a Q7 vector against a closed range.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  low lower limit of the range
+   * @param[in]  high upper limit of the range
+   * @param[out] *pMask points to the output bitmask, set where low <= pSrc[n] <= high
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void arm_compare_range_q7(
+		       q7_t * pSrc,
+		       q7_t low,
+		       q7_t high,
+		       uint32_t * pMask,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Selects elements from two floating-point vectors under a bitmask.
+   * @param[in]  *pSrcA points to the vector selected where a mask bit is set
+   * @param[in]  *pSrcB points to the vector selected where a mask bit is clear
+   * @param[in]  *pMask points to the bitmask of ARM_MASK_WORDS(blockSize) words
+   * @param[out] *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vectors
+   * @return none.
+   */
+
+  void arm_select_f32(
+		       float32_t * pSrcA,
+		       float32_t * pSrcB,
+		       uint32_t * pMask,
+		       float32_t * pDst,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Selects elements from two Q31 vectors under a bitmask.
+   * @param[in]  *pSrcA points to the vector selected where a mask bit is set
+   * @param[in]  *pSrcB points to the vector selected where a mask bit is clear
+   * @param[in]  *pMask points to the bitmask of ARM_MASK_WORDS(blockSize) words
+   * @param[out] *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vectors
+   * @return none.
+   */
+
+  void arm_select_q31(
+		       q31_t * pSrcA,
+		       q31_t * pSrcB,
+		       uint32_t * pMask,
+		       q31_t * pDst,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Selects elements from two Q15 vectors under a bitmask.
+   * @param[in]  *pSrcA points to the vector selected where a mask bit is set
+   * @param[in]  *pSrcB points to the vector selected where a mask bit is clear
+   * @param[in]  *pMask points to the bitmask of ARM_MASK_WORDS(blockSize) words
+   * @param[out] *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vectors
+   * @return none.
+   */
+
+  void arm_select_q15(
+		       q15_t * pSrcA,
+		       q15_t * pSrcB,
+		       uint32_t * pMask,
+		       q15_t * pDst,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Selects elements from two Q7 vectors under a bitmask.
+   * @param[in]  *pSrcA points to the vector selected where a mask bit is set
+   * @param[in]  *pSrcB points to the vector selected where a mask bit is clear
+   * @param[in]  *pMask points to the bitmask of ARM_MASK_WORDS(blockSize) words
+   * @param[out] *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vectors
+   * @return none.
+   */
+
+  void arm_select_q7(
+		       q7_t * pSrcA,
+		       q7_t * pSrcB,
+		       uint32_t * pMask,
+		       q7_t * pDst,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Counts the set bits of a bitmask.
+   * @param[in]  *pMask points to the bitmask of ARM_MASK_WORDS(blockSize) words
+   * @param[in]  blockSize number of bits in the mask
+   * @return number of set bits.
+   */
+
+  uint32_t arm_mask_popcount(
+		       uint32_t * pMask,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Lists the indices of the set bits of a bitmask.
+   * @param[in]  *pMask points to the bitmask of ARM_MASK_WORDS(blockSize) words
+   * @param[out] *pIndex points to the indices of the set bits, in increasing order
+   * @param[in]  blockSize number of bits in the mask
+   * @return number of indices written.
+   */
+
+  uint32_t arm_mask_to_index(
+		       uint32_t * pMask,
+		       uint32_t * pIndex,
+		       uint32_t blockSize);
+
   /**  
    * @brief  Copies the elements of a floating-point vector.   
    * @param[in]  *pSrc input pointer  
@@ -3023,6 +4672,234 @@ void arm_conv_q7(
   				 q15_t *pScratch2);  
   
   
+  /**
+   * @brief Processing paths of the 2-D convolution.
+   */
+
+  typedef enum
+    {
+      ARM_CONV2D_DIRECT = 0,             /**< Direct 2-D sum */
+      ARM_CONV2D_SEPARABLE = 1,          /**< Row pass followed by a column pass for rank one kernels */
+      ARM_CONV2D_FFT = 2                 /**< Fast convolution through the 2-D FFT */
+    } arm_conv2d_method;
+
+  /**
+   * @brief Instance structure for the floating-point 2-D convolution and correlation.
+   */
+
+  typedef struct
+  {
+    uint16_t srcRows;                    /**< number of rows of the input image. */
+    uint16_t srcCols;                    /**< number of columns of the input image. */
+    uint16_t kerRows;                    /**< number of rows of the kernel. */
+    uint16_t kerCols;                    /**< number of columns of the kernel. */
+    uint8_t method;                      /**< processing path selected at initialization, one of arm_conv2d_method. */
+    uint8_t corrFlag;                    /**< flag that selects convolution (corrFlag=0) or correlation (corrFlag=1). */
+    uint16_t pivotRow;                   /**< kernel row used as row factor of a separable kernel. */
+    uint16_t pivotCol;                   /**< kernel column used as column factor of a separable kernel. */
+    float32_t invPivot;                  /**< reciprocal of the kernel element shared by both factors. */
+    float32_t *pKernel;                  /**< points to the kernel of size kerRows*kerCols. */
+    float32_t *pKerFft;                  /**< points to the kernel spectrum of size 2*fftRows*fftCols (FFT path). */
+    float32_t *pScratch;                 /**< points to the scratch buffer. */
+    arm_cfft2d_instance_f32 fwdFft;      /**< forward 2-D CFFT instance (FFT path). */
+    arm_cfft2d_instance_f32 invFft;      /**< inverse 2-D CFFT instance (FFT path). */
+  } arm_conv2d_instance_f32;
+
+  /**
+   * @brief 2-D convolution or correlation of floating-point images.
+   * @param[in]  *S    points to an instance of the floating-point 2-D convolution structure.
+   * @param[in]  *pSrc points to the input image of size <code>srcRows*srcCols</code>.
+   * @param[out] *pDst points to the output image of size <code>(srcRows+kerRows-1)*(srcCols+kerCols-1)</code>.
+   * @return none.
+   */
+
+  void arm_conv2d_f32(
+		      const arm_conv2d_instance_f32 * S,
+		      float32_t * pSrc,
+		      float32_t * pDst);
+
+  /**
+   * @brief  Initialization function for the floating-point 2-D convolution and correlation.
+   * @param[in,out] *S         points to an instance of the floating-point 2-D convolution structure.
+   * @param[in]     srcRows    number of rows of the input image.
+   * @param[in]     srcCols    number of columns of the input image.
+   * @param[in]     *pKernel   points to the kernel of size <code>kerRows*kerCols</code>.
+   * @param[in]     kerRows    number of rows of the kernel.
+   * @param[in]     kerCols    number of columns of the kernel.
+   * @param[in]     corrFlag   flag that selects convolution (corrFlag=0) or correlation (corrFlag=1).
+   * @param[in]     *pKerFft   points to the kernel spectrum buffer of size <code>2*fftRows*fftCols</code>, or NULL to disable the FFT path.
+   * @param[in]     *pScratch  points to the scratch buffer.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * one of the dimensions is zero.
+   */
+
+  arm_status arm_conv2d_init_f32(
+				 arm_conv2d_instance_f32 * S,
+				 uint16_t srcRows,
+				 uint16_t srcCols,
+				 float32_t * pKernel,
+				 uint16_t kerRows,
+				 uint16_t kerCols,
+				 uint8_t corrFlag,
+				 float32_t * pKerFft,
+				 float32_t * pScratch);
+
+  /**
+   * @brief Measurement update methods of the Kalman filter.
+   */
+
+  typedef enum
+    {
+      ARM_KALMAN_JOSEPH = 0,             /**< Block update with a full R and the Joseph form covariance update */
+      ARM_KALMAN_SEQUENTIAL = 1,         /**< One scalar update per measurement with a diagonal R, no matrix inversion */
+      ARM_KALMAN_UD = 2                  /**< Bierman scalar updates on the U-D factors of the covariance */
+    } arm_kalman_method;
+
+  /**
+   * @brief Instance structure for the floating-point Kalman filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numStates;                  /**< number of states n. */
+    uint16_t numMeas;                    /**< number of measurements m. */
+    uint8_t method;                      /**< measurement update method, one of arm_kalman_method. */
+    uint16_t measIdx;                    /**< next measurement used by a budgeted arm_kalman_step_f32(). */
+    float32_t *pState;                   /**< points to the state estimate x of n values. */
+    float32_t *pCov;                     /**< points to the n x n covariance P, or to its U-D factors for ARM_KALMAN_UD. */
+    float32_t *pF;                       /**< points to the n x n state transition matrix F. */
+    float32_t *pQ;                       /**< points to the n x n process noise covariance Q. */
+    float32_t *pH;                       /**< points to the m x n measurement matrix H. */
+    float32_t *pR;                       /**< points to the m x m measurement noise covariance R for ARM_KALMAN_JOSEPH, or to its m diagonal values otherwise. */
+    float32_t *pWork;                    /**< points to the workspace. */
+  } arm_kalman_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Kalman filter.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[in] numStates number of states n.
+   * @param[in] numMeas number of measurements m.
+   * @param[in] method measurement update method, one of arm_kalman_method.
+   * @param[in] *pState points to the initial state estimate.
+   * @param[in,out] *pCov points to the initial covariance, converted in place to U-D factors for ARM_KALMAN_UD.
+   * @param[in] *pF points to the state transition matrix.
+   * @param[in] *pQ points to the process noise covariance.
+   * @param[in] *pH points to the measurement matrix.
+   * @param[in] *pR points to the measurement noise covariance or variances.
+   * @param[in] *pWork points to the workspace.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR for an unknown method, or
+   * ARM_MATH_SINGULAR if the covariance is not positive definite for ARM_KALMAN_UD.
+   */
+
+  arm_status arm_kalman_init_f32(
+				 arm_kalman_instance_f32 * S,
+				 uint16_t numStates,
+				 uint16_t numMeas,
+				 uint8_t method,
+				 float32_t * pState,
+				 float32_t * pCov,
+				 float32_t * pF,
+				 float32_t * pQ,
+				 float32_t * pH,
+				 float32_t * pR,
+				 float32_t * pWork);
+
+  /**
+   * @brief  Floating-point Kalman filter time update.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[in] *pStatePred points to the propagated state, or NULL to compute F * x.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_SINGULAR if the U-D factorization fails.
+   */
+
+  arm_status arm_kalman_predict_f32(
+				    arm_kalman_instance_f32 * S,
+				    const float32_t * pStatePred);
+
+  /**
+   * @brief  Floating-point Kalman filter measurement update.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[in] *pMeas points to the m measurements.
+   * @param[in] *pMeasPred points to the predicted measurements, or NULL to compute H * x.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_SINGULAR if the innovation covariance is not invertible.
+   */
+
+  arm_status arm_kalman_update_f32(
+				   arm_kalman_instance_f32 * S,
+				   const float32_t * pMeas,
+				   const float32_t * pMeasPred);
+
+  /**
+   * @brief  Floating-point Kalman filter sequential scalar measurement updates.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[in] *pMeas points to the m measurements.
+   * @param[in] *pMeasPred points to the predicted measurements, or NULL to compute H * x.
+   * @param[in] firstMeas index of the first measurement to process.
+   * @param[in] numUpdates number of measurements to process, wrapping around after the last one.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_SINGULAR if an innovation variance is not positive.
+   */
+
+  arm_status arm_kalman_update_scalar_f32(
+					  arm_kalman_instance_f32 * S,
+					  const float32_t * pMeas,
+					  const float32_t * pMeasPred,
+					  uint16_t firstMeas,
+					  uint16_t numUpdates);
+
+  /**
+   * @brief  Floating-point Kalman filter step with a bounded number of measurement updates.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[in] *pStatePred points to the propagated state, or NULL to compute F * x.
+   * @param[in] *pMeas points to the m measurements, or NULL for a time update only.
+   * @param[in] *pMeasPred points to the predicted measurements, or NULL to compute H * x.
+   * @param[in] maxUpdates maximum number of scalar measurement updates in this step.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_SINGULAR.
+   */
+
+  arm_status arm_kalman_step_f32(
+				 arm_kalman_instance_f32 * S,
+				 const float32_t * pStatePred,
+				 const float32_t * pMeas,
+				 const float32_t * pMeasPred,
+				 uint16_t maxUpdates);
+
+  /**
+   * @brief  Reads the covariance of the floating-point Kalman filter.
+   * @param[in] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[out] *pDst points to the n x n output covariance.
+   * @return none.
+   */
+
+  void arm_kalman_get_cov_f32(
+			      const arm_kalman_instance_f32 * S,
+			      float32_t * pDst);
+
+  /**
+   * @brief  U-D factorization P = U * D * U' used by the Kalman filter (internal).
+   * @param[in] *pSrc points to the n x n symmetric matrix, only the upper triangle is read.
+   * @param[out] *pDst points to the factors, D on the diagonal and U above it; may be pSrc.
+   * @param[in] n order of the matrix.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_SINGULAR if the matrix is not positive definite.
+   */
+
+  arm_status arm_kalman_ud_factor_f32(
+				      const float32_t * pSrc,
+				      float32_t * pDst,
+				      uint16_t n);
+
+  /**
+   * @brief  Rebuilds P = U * D * U' from its U-D factors (internal).
+   * @param[in] *pSrc points to the factors.
+   * @param[out] *pDst points to the n x n output matrix; must not overlap pSrc.
+   * @param[in] n order of the matrix.
+   * @return none.
+   */
+
+  void arm_kalman_ud_rebuild_f32(
+				 const float32_t * pSrc,
+				 float32_t * pDst,
+				 uint16_t n);
+
+
   /**  
    * @brief Instance structure for the Q15 FIR decimator.  
    */  
@@ -3393,6 +5270,23 @@ void arm_conv_q7(
 					 q63_t * pState,  
 					 uint8_t postShift);  
   
+  /**  
+   * @brief Processing function for the high precision Q31 Biquad cascade filter, ramping the coefficients over the block.  
+   * @param[in]  *S             points to an instance of the high precision Q31 Biquad cascade filter structure.  
+   * @param[in]  *pTargetCoeffs points to the coefficients reached at the end of the block.  
+   * @param[in]  *pSrc          points to the block of input data.  
+   * @param[out] *pDst          points to the block of output data  
+   * @param[in]  blockSize      number of samples to process.  
+   * @return none.  
+   */  
+  
+  void arm_biquad_cas_df1_32x64_ramp_q31(  
+					 const arm_biquad_cas_df1_32x64_ins_q31 * S,  
+					 q31_t * pTargetCoeffs,  
+					 q31_t * pSrc,  
+					 q31_t * pDst,  
+					 uint32_t blockSize);  
+  
   
   
   /**  
@@ -3438,6 +5332,200 @@ void arm_conv_q7(
 					float32_t * pCoeffs,  
 					float32_t * pState);  
   
+  /**  
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter, ramping the coefficients over the block.  
+   * @param[in]  *S             points to an instance of the filter data structure.  
+   * @param[in]  *pTargetCoeffs points to the coefficients reached at the end of the block.  
+   * @param[in]  *pSrc          points to the block of input data.  
+   * @param[out] *pDst          points to the block of output data  
+   * @param[in]  blockSize      number of samples to process.  
+   * @return none.  
+   */  
+  
+  void arm_biquad_cascade_df2T_ramp_f32(  
+					const arm_biquad_cascade_df2T_instance_f32 * S,  
+					float32_t * pTargetCoeffs,  
+					float32_t * pSrc,  
+					float32_t * pDst,  
+					uint32_t blockSize);  
+  
+  /**  
+   * @brief Responses of the Biquad coefficient design function.  
+   */  
+  typedef enum  
+  {  
+    ARM_BIQUAD_LOWPASS = 0,       /**< second order low pass. */  
+    ARM_BIQUAD_HIGHPASS = 1,      /**< second order high pass. */  
+    ARM_BIQUAD_BANDPASS = 2,      /**< band pass with 0 dB peak gain. */  
+    ARM_BIQUAD_NOTCH = 3,         /**< notch. */  
+    ARM_BIQUAD_PEAKING = 4,       /**< peaking equalizer. */  
+    ARM_BIQUAD_LOWSHELF = 5,      /**< low shelf equalizer. */  
+    ARM_BIQUAD_HIGHSHELF = 6      /**< high shelf equalizer. */  
+  } arm_biquad_design_type;  
+  
+  /**  
+   * @brief  Designs the coefficients of one floating-point Biquad stage.  
+   * @param[in]  type     response of the stage.  
+   * @param[in]  freq     corner or centre frequency normalized to the sample rate, 0 < freq < 0.5.  
+   * @param[in]  Q        quality factor, greater than 0.  
+   * @param[in]  gainDB   gain in dB of the peaking and shelving responses.  
+   * @param[out] *pCoeffs points to the 5 coefficients of the stage.  
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.  
+   */  
+  
+  arm_status arm_biquad_design_f32(  
+				   arm_biquad_design_type type,  
+				   float32_t freq,  
+				   float32_t Q,  
+				   float32_t gainDB,  
+				   float32_t * pCoeffs);  
+  
+  /**  
+   * @brief  Converts floating-point Biquad cascade coefficients to Q31 and selects the postShift.  
+   * @param[in]  *pSrc        points to the 5*numStages floating-point coefficients.  
+   * @param[out] *pDst        points to the 5*numStages Q31 coefficients.  
+   * @param[in]  numStages    number of 2nd order stages.  
+   * @param[in]  minPostShift smallest postShift to select.  
+   * @param[out] *pPostShift  points to the selected postShift.  
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.  
+   */  
+  
+  arm_status arm_biquad_coeffs_to_q31(  
+				      const float32_t * pSrc,  
+				      q31_t * pDst,  
+				      uint32_t numStages,  
+				      uint8_t minPostShift,  
+				      uint8_t * pPostShift);  
+
+  /**
+   * @brief Instance structure for the floating-point running median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;           /**< number of samples in the window. */
+    uint16_t count;               /**< number of samples in the window so far. */
+    uint16_t idx;                 /**< ring buffer slot of the next sample. */
+    float32_t *pData;             /**< points to the ring buffer of windowLen samples. */
+    int16_t *pPos;                /**< points to the heap position of each ring buffer slot. */
+    int16_t *pHeap;               /**< points to the median entry of the heap of ring buffer slots. */
+  } arm_median_filter_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 running median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;           /**< number of samples in the window. */
+    uint16_t count;               /**< number of samples in the window so far. */
+    uint16_t idx;                 /**< ring buffer slot of the next sample. */
+    q31_t *pData;                 /**< points to the ring buffer of windowLen samples. */
+    int16_t *pPos;                /**< points to the heap position of each ring buffer slot. */
+    int16_t *pHeap;               /**< points to the median entry of the heap of ring buffer slots. */
+  } arm_median_filter_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 running median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;           /**< number of samples in the window. */
+    uint16_t count;               /**< number of samples in the window so far. */
+    uint16_t idx;                 /**< ring buffer slot of the next sample. */
+    q15_t *pData;                 /**< points to the ring buffer of windowLen samples. */
+    int16_t *pPos;                /**< points to the heap position of each ring buffer slot. */
+    int16_t *pHeap;               /**< points to the median entry of the heap of ring buffer slots. */
+  } arm_median_filter_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point running median filter.
+   * @param[out] *S points to an instance of the floating-point running median filter structure.
+   * @param[in]  windowLen number of samples in the window, 1 to 32767.
+   * @param[in]  *pData points to the ring buffer of windowLen samples.
+   * @param[in]  *pIndex points to the index buffer of 2*windowLen entries.
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+
+  arm_status arm_median_filter_init_f32(
+					arm_median_filter_instance_f32 * S,
+					uint16_t windowLen,
+					float32_t * pData,
+					int16_t * pIndex);
+
+  /**
+   * @brief  Floating-point running median filter.
+   * @param[in,out] *S points to an instance of the floating-point running median filter structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[out]    *pDst points to the block of output samples.
+   * @param[in]     blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_median_filter_f32(
+			     arm_median_filter_instance_f32 * S,
+			     float32_t * pSrc,
+			     float32_t * pDst,
+			     uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 running median filter.
+   * @param[out] *S points to an instance of the Q31 running median filter structure.
+   * @param[in]  windowLen number of samples in the window, 1 to 32767.
+   * @param[in]  *pData points to the ring buffer of windowLen samples.
+   * @param[in]  *pIndex points to the index buffer of 2*windowLen entries.
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+
+  arm_status arm_median_filter_init_q31(
+					arm_median_filter_instance_q31 * S,
+					uint16_t windowLen,
+					q31_t * pData,
+					int16_t * pIndex);
+
+  /**
+   * @brief  Q31 running median filter.
+   * @param[in,out] *S points to an instance of the Q31 running median filter structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[out]    *pDst points to the block of output samples.
+   * @param[in]     blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_median_filter_q31(
+			     arm_median_filter_instance_q31 * S,
+			     q31_t * pSrc,
+			     q31_t * pDst,
+			     uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 running median filter.
+   * @param[out] *S points to an instance of the Q15 running median filter structure.
+   * @param[in]  windowLen number of samples in the window, 1 to 32767.
+   * @param[in]  *pData points to the ring buffer of windowLen samples.
+   * @param[in]  *pIndex points to the index buffer of 2*windowLen entries.
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+
+  arm_status arm_median_filter_init_q15(
+					arm_median_filter_instance_q15 * S,
+					uint16_t windowLen,
+					q15_t * pData,
+					int16_t * pIndex);
+
+  /**
+   * @brief  Q15 running median filter.
+   * @param[in,out] *S points to an instance of the Q15 running median filter structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[out]    *pDst points to the block of output samples.
+   * @param[in]     blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_median_filter_q15(
+			     arm_median_filter_instance_q15 * S,
+			     q15_t * pSrc,
+			     q15_t * pDst,
+			     uint32_t blockSize);
+  
   
   
   /**  
@@ -4374,6 +6462,144 @@ void arm_correlate_q7(
 		       q31_t theta,  
 		       q31_t *pSinVal,  
 		       q31_t *pCosVal);  
+
+  /**
+   * @brief Floating-point product of two quaternions.
+   * @param[in]       *qa points to the first quaternion
+   * @param[in]       *qb points to the second quaternion
+   * @param[out]      *qr points to the product <code>qa * qb</code>
+   * @return none.
+   */
+
+  void arm_quaternion_product_single_f32(
+					 const float32_t * qa,
+					 const float32_t * qb,
+					 float32_t * qr);
+
+  /**
+   * @brief Floating-point product of blocks of quaternions.
+   * @param[in]       *qa points to the first block of quaternions
+   * @param[in]       *qb points to the second block of quaternions
+   * @param[out]      *qr points to the block of products <code>qa[n] * qb[n]</code>
+   * @param[in]       nbQuaternions number of quaternions in each block
+   * @return none.
+   */
+
+  void arm_quaternion_product_f32(
+				  const float32_t * qa,
+				  const float32_t * qb,
+				  float32_t * qr,
+				  uint32_t nbQuaternions);
+
+  /**
+   * @brief Floating-point quaternion conjugate.
+   * @param[in]       *pInputQuaternions points to the block of input quaternions
+   * @param[out]      *pConjugateQuaternions points to the block of conjugated quaternions
+   * @param[in]       nbQuaternions number of quaternions in the block
+   * @return none.
+   */
+
+  void arm_quaternion_conjugate_f32(
+				    const float32_t * pInputQuaternions,
+				    float32_t * pConjugateQuaternions,
+				    uint32_t nbQuaternions);
+
+  /**
+   * @brief Floating-point quaternion normalization.
+   * @param[in]       *pInputQuaternions points to the block of input quaternions
+   * @param[out]      *pNormalizedQuaternions points to the block of unit quaternions
+   * @param[in]       nbQuaternions number of quaternions in the block
+   * @return none.
+   */
+
+  void arm_quaternion_normalize_f32(
+				    const float32_t * pInputQuaternions,
+				    float32_t * pNormalizedQuaternions,
+				    uint32_t nbQuaternions);
+
+  /**
+   * @brief Floating-point rotation of vectors by quaternions.
+   * @param[in]       *pQuaternions points to the block of unit quaternions
+   * @param[in]       *pSrcVec points to the block of input vectors (3 values each)
+   * @param[out]      *pDstVec points to the block of rotated vectors (3 values each)
+   * @param[in]       nbQuaternions number of quaternions and vectors in the blocks
+   * @return none.
+   */
+
+  void arm_quaternion_rotate_f32(
+				 const float32_t * pQuaternions,
+				 const float32_t * pSrcVec,
+				 float32_t * pDstVec,
+				 uint32_t nbQuaternions);
+
+  /**
+   * @brief Floating-point conversion of quaternions to rotation matrices.
+   * @param[in]       *pInputQuaternions points to the block of unit quaternions
+   * @param[out]      *pOutputRotations points to the block of rotation matrices (9 values each, row order)
+   * @param[in]       nbQuaternions number of quaternions in the block
+   * @return none.
+   */
+
+  void arm_quaternion2rotation_f32(
+				   const float32_t * pInputQuaternions,
+				   float32_t * pOutputRotations,
+				   uint32_t nbQuaternions);
+
+  /**
+   * @brief Floating-point conversion of rotation matrices to quaternions.
+   * @param[in]       *pInputRotations points to the block of rotation matrices (9 values each, row order)
+   * @param[out]      *pOutputQuaternions points to the block of unit quaternions
+   * @param[in]       nbQuaternions number of matrices in the block
+   * @return none.
+   */
+
+  void arm_rotation2quaternion_f32(
+				   const float32_t * pInputRotations,
+				   float32_t * pOutputQuaternions,
+				   uint32_t nbQuaternions);
+
+  /**
+   * @brief Floating-point product of quaternions stored as component planes.
+   * @param[in]       *qa points to the first set of quaternions (4 planes of <code>nbQuaternions</code> values)
+   * @param[in]       *qb points to the second set of quaternions (4 planes of <code>nbQuaternions</code> values)
+   * @param[out]      *qr points to the products (4 planes of <code>nbQuaternions</code> values)
+   * @param[in]       nbQuaternions number of quaternions in each set
+   * @return none.
+   */
+
+  void arm_quaternion_product_soa_f32(
+				      const float32_t * qa,
+				      const float32_t * qb,
+				      float32_t * qr,
+				      uint32_t nbQuaternions);
+
+  /**
+   * @brief Floating-point rotation of vectors by quaternions stored as component planes.
+   * @param[in]       *pQuaternions points to the unit quaternions (4 planes of <code>nbQuaternions</code> values)
+   * @param[in]       *pSrcVec points to the input vectors (3 planes of <code>nbQuaternions</code> values)
+   * @param[out]      *pDstVec points to the rotated vectors (3 planes of <code>nbQuaternions</code> values)
+   * @param[in]       nbQuaternions number of quaternions and vectors
+   * @return none.
+   */
+
+  void arm_quaternion_rotate_soa_f32(
+				     const float32_t * pQuaternions,
+				     const float32_t * pSrcVec,
+				     float32_t * pDstVec,
+				     uint32_t nbQuaternions);
+
+  /**
+   * @brief Floating-point normalization of quaternions stored as component planes.
+   * @param[in]       *pInputQuaternions points to the input quaternions (4 planes of <code>nbQuaternions</code> values)
+   * @param[out]      *pNormalizedQuaternions points to the unit quaternions (4 planes of <code>nbQuaternions</code> values)
+   * @param[in]       nbQuaternions number of quaternions
+   * @return none.
+   */
+
+  void arm_quaternion_normalize_soa_f32(
+					const float32_t * pInputQuaternions,
+					float32_t * pNormalizedQuaternions,
+					uint32_t nbQuaternions);
   
   
   /**  
@@ -4667,6 +6893,230 @@ void arm_correlate_q7(
   arm_status arm_mat_inverse_f32(  
 				 const arm_matrix_instance_f32 * src,  
 				 arm_matrix_instance_f32 * dst);  
+
+  /**
+   * @brief Floating-point 3x3 matrix multiplication.
+   * @param[in]       *pSrcA points to the first input matrix (9 values, row order)
+   * @param[in]       *pSrcB points to the second input matrix (9 values, row order)
+   * @param[out]      *pDst points to the output matrix (9 values, row order)
+   * @return none.
+   */
+
+  void arm_mat_mult_3x3_f32(
+			    const float32_t * pSrcA,
+			    const float32_t * pSrcB,
+			    float32_t * pDst);
+
+  /**
+   * @brief Floating-point 4x4 matrix multiplication.
+   * @param[in]       *pSrcA points to the first input matrix (16 values, row order)
+   * @param[in]       *pSrcB points to the second input matrix (16 values, row order)
+   * @param[out]      *pDst points to the output matrix (16 values, row order)
+   * @return none.
+   */
+
+  void arm_mat_mult_4x4_f32(
+			    const float32_t * pSrcA,
+			    const float32_t * pSrcB,
+			    float32_t * pDst);
+
+  /**
+   * @brief Floating-point 3x3 transpose-multiply.
+   * @param[in]       *pSrcA points to the first input matrix (9 values, row order)
+   * @param[in]       *pSrcB points to the second input matrix (9 values, row order)
+   * @param[out]      *pDst points to the output matrix <code>A' * B</code> (9 values, row order)
+   * @return none.
+   */
+
+  void arm_mat_trans_mult_3x3_f32(
+				  const float32_t * pSrcA,
+				  const float32_t * pSrcB,
+				  float32_t * pDst);
+
+  /**
+   * @brief Floating-point 4x4 transpose-multiply.
+   * @param[in]       *pSrcA points to the first input matrix (16 values, row order)
+   * @param[in]       *pSrcB points to the second input matrix (16 values, row order)
+   * @param[out]      *pDst points to the output matrix <code>A' * B</code> (16 values, row order)
+   * @return none.
+   */
+
+  void arm_mat_trans_mult_4x4_f32(
+				  const float32_t * pSrcA,
+				  const float32_t * pSrcB,
+				  float32_t * pDst);
+
+  /**
+   * @brief Floating-point 3x3 matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the input matrix (9 values, row order)
+   * @param[in]       *pVec points to the input vector (3 values)
+   * @param[out]      *pDst points to the output vector (3 values)
+   * @return none.
+   */
+
+  void arm_mat_vec_mult_3x3_f32(
+				const float32_t * pSrcMat,
+				const float32_t * pVec,
+				float32_t * pDst);
+
+  /**
+   * @brief Floating-point 4x4 matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the input matrix (16 values, row order)
+   * @param[in]       *pVec points to the input vector (4 values)
+   * @param[out]      *pDst points to the output vector (4 values)
+   * @return none.
+   */
+
+  void arm_mat_vec_mult_4x4_f32(
+				const float32_t * pSrcMat,
+				const float32_t * pVec,
+				float32_t * pDst);
+
+  /**
+   * @brief Floating-point matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the input matrix structure (M x N)
+   * @param[in]       *pVec points to the input vector (N values)
+   * @param[out]      *pDst points to the output vector (M values)
+   * @return none.
+   */
+
+  void arm_mat_vec_mult_f32(
+			    const arm_matrix_instance_f32 * pSrcMat,
+			    const float32_t * pVec,
+			    float32_t * pDst);
+
+  /**
+   * @brief Q31 matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the input matrix structure (M x N)
+   * @param[in]       *pVec points to the input vector (N values)
+   * @param[out]      *pDst points to the output vector (M values)
+   * @return none.
+   */
+
+  void arm_mat_vec_mult_q31(
+			    const arm_matrix_instance_q31 * pSrcMat,
+			    const q31_t * pVec,
+			    q31_t * pDst);
+
+  /**
+   * @brief Q15 matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the input matrix structure (M x N)
+   * @param[in]       *pVec points to the input vector (N values)
+   * @param[out]      *pDst points to the output vector (M values)
+   * @return none.
+   */
+
+  void arm_mat_vec_mult_q15(
+			    const arm_matrix_instance_q15 * pSrcMat,
+			    const q15_t * pVec,
+			    q15_t * pDst);
+
+  /**
+   * @brief Q7 matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the input matrix structure (M x N)
+   * @param[in]       *pVec points to the input vector (N values)
+   * @param[out]      *pDst points to the output vector (M values)
+   * @return none.
+   */
+
+  void arm_mat_vec_mult_q7(
+			    const arm_matrix_instance_q7 * pSrcMat,
+			    const q7_t * pVec,
+			    q7_t * pDst);
+
+  /**
+   * @brief Floating-point transposed matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the input matrix structure (M x N)
+   * @param[in]       *pVec points to the input vector (M values)
+   * @param[out]      *pDst points to the output vector <code>A' * x</code> (N values)
+   * @return none.
+   */
+
+  void arm_mat_trans_vec_mult_f32(
+				  const arm_matrix_instance_f32 * pSrcMat,
+				  const float32_t * pVec,
+				  float32_t * pDst);
+
+  /**
+   * @brief Q31 transposed matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the input matrix structure (M x N)
+   * @param[in]       *pVec points to the input vector (M values)
+   * @param[out]      *pDst points to the output vector <code>A' * x</code> (N values)
+   * @return none.
+   */
+
+  void arm_mat_trans_vec_mult_q31(
+				  const arm_matrix_instance_q31 * pSrcMat,
+				  const q31_t * pVec,
+				  q31_t * pDst);
+
+  /**
+   * @brief Q15 transposed matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the input matrix structure (M x N)
+   * @param[in]       *pVec points to the input vector (M values)
+   * @param[out]      *pDst points to the output vector <code>A' * x</code> (N values)
+   * @return none.
+   */
+
+  void arm_mat_trans_vec_mult_q15(
+				  const arm_matrix_instance_q15 * pSrcMat,
+				  const q15_t * pVec,
+				  q15_t * pDst);
+
+  /**
+   * @brief Q7 transposed matrix-vector multiplication.
+   * @param[in]       *pSrcMat points to the input matrix structure (M x N)
+   * @param[in]       *pVec points to the input vector (M values)
+   * @param[out]      *pDst points to the output vector <code>A' * x</code> (N values)
+   * @return none.
+   */
+
+  void arm_mat_trans_vec_mult_q7(
+				  const arm_matrix_instance_q7 * pSrcMat,
+				  const q7_t * pVec,
+				  q7_t * pDst);
+
+  /**
+   * @brief Floating-point 3x3 matrix determinant.
+   * @param[in]       *pSrc points to the input matrix (9 values, row order)
+   * @return The determinant of the matrix.
+   */
+
+  float32_t arm_mat_det_3x3_f32(
+				const float32_t * pSrc);
+
+  /**
+   * @brief Floating-point 4x4 matrix determinant.
+   * @param[in]       *pSrc points to the input matrix (16 values, row order)
+   * @return The determinant of the matrix.
+   */
+
+  float32_t arm_mat_det_4x4_f32(
+				const float32_t * pSrc);
+
+  /**
+   * @brief Floating-point 3x3 matrix inverse.
+   * @param[in]       *pSrc points to the input matrix (9 values, row order)
+   * @param[out]      *pDst points to the output matrix (9 values, row order)
+   * @return The function returns
+   * <code>ARM_MATH_SINGULAR</code> if the determinant is zero, otherwise <code>ARM_MATH_SUCCESS</code>.
+   */
+
+  arm_status arm_mat_inverse_3x3_f32(
+				     const float32_t * pSrc,
+				     float32_t * pDst);
+
+  /**
+   * @brief Floating-point 4x4 matrix inverse.
+   * @param[in]       *pSrc points to the input matrix (16 values, row order)
+   * @param[out]      *pDst points to the output matrix (16 values, row order)
+   * @return The function returns
+   * <code>ARM_MATH_SINGULAR</code> if the determinant is zero, otherwise <code>ARM_MATH_SUCCESS</code>.
+   */
+
+  arm_status arm_mat_inverse_4x4_f32(
+				     const float32_t * pSrc,
+				     float32_t * pDst);
   
     
    
@@ -5511,6 +7961,42 @@ void arm_correlate_q7(
    * @} end of LinearInterpolate group  
    */  
   
+  /**  
+   * @brief  Initialization function for the floating-point table interpolation.  
+   * @param[out] *S points to an instance of the floating-point table interpolation structure.  
+   * @param[in]  method interpolation method.  
+   * @param[in]  nValues number of table values, at least 2.  
+   * @param[in]  x1 input value of the first table entry.  
+   * @param[in]  xSpacing spacing between the inputs of consecutive table entries, greater than 0.  
+   * @param[in]  *pYData points to the table of nValues output values.  
+   * @param[out] *pSlope points to a buffer of nValues slopes, may be NULL for ARM_INTERP_LINEAR.  
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.  
+   */  
+  
+  arm_status arm_interp_init_f32(  
+			arm_interp_instance_f32 * S,  
+			arm_interp_method method,  
+			uint32_t nValues,  
+			float32_t x1,  
+			float32_t xSpacing,  
+			float32_t * pYData,  
+			float32_t * pSlope);  
+  
+  /**  
+   * @brief  Process function for the floating-point table interpolation.  
+   * @param[in]  *S points to an instance of the floating-point table interpolation structure.  
+   * @param[in]  *pIn points to the block of input values.  
+   * @param[out] *pOut points to the block of interpolated values.  
+   * @param[in]  blockSize number of samples to process.  
+   * @return none.  
+   */  
+  
+  void arm_interp_f32(  
+		      const arm_interp_instance_f32 * S,  
+		      float32_t * pIn,  
+		      float32_t * pOut,  
+		      uint32_t blockSize);  
+  
   /**  
    * @brief  Fast approximation to the trigonometric sine function for floating-point data.  
    * @param[in] x input value in radians.  
@@ -5648,6 +8134,496 @@ void arm_correlate_q7(
   /**  
    * @} end of SQRT group  
    */  
+
+  /**
+   * @brief Instance structure for the Q31 CORDIC functions.
+   */
+
+  typedef struct
+  {
+    uint8_t numIter;                     /**< number of CORDIC iterations. */
+    q31_t invGain;                       /**< inverse CORDIC gain for numIter iterations, in 1.31 format. */
+  } arm_cordic_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 CORDIC functions.
+   */
+
+  typedef struct
+  {
+    uint8_t numIter;                     /**< number of CORDIC iterations. */
+    q31_t invGain;                       /**< inverse CORDIC gain for numIter iterations, in 1.31 format. */
+  } arm_cordic_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q31 CORDIC functions.
+   * @param[out] *S points to an instance of the Q31 CORDIC structure.
+   * @param[in] numIter number of iterations, 1 to 31.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if numIter is out of range.
+   */
+
+  arm_status arm_cordic_init_q31(
+				 arm_cordic_instance_q31 * S,
+				 uint8_t numIter);
+
+  /**
+   * @brief  Q31 block sine and cosine using CORDIC rotation.
+   * @param[in] *S points to an instance of the Q31 CORDIC structure.
+   * @param[in] *pSrc points to the block of angles, [-1 +1) maps to [-pi +pi).
+   * @param[out] *pSinVal points to the block of sine values.
+   * @param[out] *pCosVal points to the block of cosine values.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_cordic_sin_cos_q31(
+				const arm_cordic_instance_q31 * S,
+				q31_t * pSrc,
+				q31_t * pSinVal,
+				q31_t * pCosVal,
+				uint32_t blockSize);
+
+  /**
+   * @brief  Q31 block four-quadrant arctangent using CORDIC vectoring.
+   * @param[in] *S points to an instance of the Q31 CORDIC structure.
+   * @param[in] *pSrcY points to the block of y coordinates.
+   * @param[in] *pSrcX points to the block of x coordinates.
+   * @param[out] *pDst points to the block of angles, [-1 +1) maps to [-pi +pi).
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_cordic_atan2_q31(
+				const arm_cordic_instance_q31 * S,
+				q31_t * pSrcY,
+				q31_t * pSrcX,
+				q31_t * pDst,
+				uint32_t blockSize);
+
+  /**
+   * @brief  Q31 block cartesian to polar conversion using CORDIC vectoring.
+   * @param[in] *S points to an instance of the Q31 CORDIC structure.
+   * @param[in] *pSrcX points to the block of x coordinates.
+   * @param[in] *pSrcY points to the block of y coordinates.
+   * @param[out] *pMag points to the block of magnitudes.
+   * @param[out] *pPhase points to the block of angles.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_cordic_cart2polar_q31(
+				const arm_cordic_instance_q31 * S,
+				q31_t * pSrcX,
+				q31_t * pSrcY,
+				q31_t * pMag,
+				q31_t * pPhase,
+				uint32_t blockSize);
+
+  /**
+   * @brief  Q31 block polar to cartesian conversion using CORDIC rotation.
+   * @param[in] *S points to an instance of the Q31 CORDIC structure.
+   * @param[in] *pMag points to the block of magnitudes.
+   * @param[in] *pPhase points to the block of angles.
+   * @param[out] *pDstX points to the block of x coordinates.
+   * @param[out] *pDstY points to the block of y coordinates.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_cordic_polar2cart_q31(
+				const arm_cordic_instance_q31 * S,
+				q31_t * pMag,
+				q31_t * pPhase,
+				q31_t * pDstX,
+				q31_t * pDstY,
+				uint32_t blockSize);
+
+  /**
+   * @brief  Q31 block complex rotation using CORDIC.
+   * @param[in] *S points to an instance of the Q31 CORDIC structure.
+   * @param[in] *pSrc points to the block of complex input values.
+   * @param[in] *pPhase points to the block of rotation angles.
+   * @param[out] *pDst points to the block of complex output values.
+   * @param[in] numSamples number of complex samples to process.
+   * @return none.
+   */
+
+  void arm_cordic_cmplx_rotate_q31(
+				const arm_cordic_instance_q31 * S,
+				q31_t * pSrc,
+				q31_t * pPhase,
+				q31_t * pDst,
+				uint32_t numSamples);
+
+  /**
+   * @brief  Initialization function for the Q15 CORDIC functions.
+   * @param[out] *S points to an instance of the Q15 CORDIC structure.
+   * @param[in] numIter number of iterations, 1 to 16.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if numIter is out of range.
+   */
+
+  arm_status arm_cordic_init_q15(
+				 arm_cordic_instance_q15 * S,
+				 uint8_t numIter);
+
+  /**
+   * @brief  Q15 block sine and cosine using CORDIC rotation.
+   * @param[in] *S points to an instance of the Q15 CORDIC structure.
+   * @param[in] *pSrc points to the block of angles, [-1 +1) maps to [-pi +pi).
+   * @param[out] *pSinVal points to the block of sine values.
+   * @param[out] *pCosVal points to the block of cosine values.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_cordic_sin_cos_q15(
+				const arm_cordic_instance_q15 * S,
+				q15_t * pSrc,
+				q15_t * pSinVal,
+				q15_t * pCosVal,
+				uint32_t blockSize);
+
+  /**
+   * @brief  Q15 block four-quadrant arctangent using CORDIC vectoring.
+   * @param[in] *S points to an instance of the Q15 CORDIC structure.
+   * @param[in] *pSrcY points to the block of y coordinates.
+   * @param[in] *pSrcX points to the block of x coordinates.
+   * @param[out] *pDst points to the block of angles, [-1 +1) maps to [-pi +pi).
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_cordic_atan2_q15(
+				const arm_cordic_instance_q15 * S,
+				q15_t * pSrcY,
+				q15_t * pSrcX,
+				q15_t * pDst,
+				uint32_t blockSize);
+
+  /**
+   * @brief  Q15 block cartesian to polar conversion using CORDIC vectoring.
+   * @param[in] *S points to an instance of the Q15 CORDIC structure.
+   * @param[in] *pSrcX points to the block of x coordinates.
+   * @param[in] *pSrcY points to the block of y coordinates.
+   * @param[out] *pMag points to the block of magnitudes.
+   * @param[out] *pPhase points to the block of angles.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_cordic_cart2polar_q15(
+				const arm_cordic_instance_q15 * S,
+				q15_t * pSrcX,
+				q15_t * pSrcY,
+				q15_t * pMag,
+				q15_t * pPhase,
+				uint32_t blockSize);
+
+  /**
+   * @brief  Q15 block polar to cartesian conversion using CORDIC rotation.
+   * @param[in] *S points to an instance of the Q15 CORDIC structure.
+   * @param[in] *pMag points to the block of magnitudes.
+   * @param[in] *pPhase points to the block of angles.
+   * @param[out] *pDstX points to the block of x coordinates.
+   * @param[out] *pDstY points to the block of y coordinates.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_cordic_polar2cart_q15(
+				const arm_cordic_instance_q15 * S,
+				q15_t * pMag,
+				q15_t * pPhase,
+				q15_t * pDstX,
+				q15_t * pDstY,
+				uint32_t blockSize);
+
+  /**
+   * @brief  Q15 block complex rotation using CORDIC.
+   * @param[in] *S points to an instance of the Q15 CORDIC structure.
+   * @param[in] *pSrc points to the block of complex input values.
+   * @param[in] *pPhase points to the block of rotation angles.
+   * @param[out] *pDst points to the block of complex output values.
+   * @param[in] numSamples number of complex samples to process.
+   * @return none.
+   */
+
+  void arm_cordic_cmplx_rotate_q15(
+				const arm_cordic_instance_q15 * S,
+				q15_t * pSrc,
+				q15_t * pPhase,
+				q15_t * pDst,
+				uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point block sine function.
+   * @param[in] *pSrc points to the block of angles in radians.
+   * @param[out] *pDst points to the block of sine values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vsin_f32(
+		     float32_t * pSrc,
+		     float32_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point block cosine function.
+   * @param[in] *pSrc points to the block of angles in radians.
+   * @param[out] *pDst points to the block of cosine values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vcos_f32(
+		     float32_t * pSrc,
+		     float32_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point block sine and cosine function.
+   * @param[in] *pSrc points to the block of angles in radians.
+   * @param[out] *pSinVal points to the block of sine values.
+   * @param[out] *pCosVal points to the block of cosine values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vsin_cos_f32(
+		     float32_t * pSrc,
+		     float32_t * pSinVal,
+		     float32_t * pCosVal,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point block tangent function.
+   * @param[in] *pSrc points to the block of angles in radians.
+   * @param[out] *pDst points to the block of tangent values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vtan_f32(
+		     float32_t * pSrc,
+		     float32_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point block arctangent function.
+   * @param[in] *pSrc points to the block of input values.
+   * @param[out] *pDst points to the block of angles in radians.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vatan_f32(
+		     float32_t * pSrc,
+		     float32_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point block four-quadrant arctangent function.
+   * @param[in] *pSrcY points to the block of y coordinates.
+   * @param[in] *pSrcX points to the block of x coordinates.
+   * @param[out] *pDst points to the block of angles in radians.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vatan2_f32(
+		     float32_t * pSrcY,
+		     float32_t * pSrcX,
+		     float32_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point block exponential function.
+   * @param[in] *pSrc points to the block of input values.
+   * @param[out] *pDst points to the block of output values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vexp_f32(
+		     float32_t * pSrc,
+		     float32_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point block natural logarithm function.
+   * @param[in] *pSrc points to the block of input values.
+   * @param[out] *pDst points to the block of output values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vlog_f32(
+		     float32_t * pSrc,
+		     float32_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point block base-2 logarithm function.
+   * @param[in] *pSrc points to the block of input values.
+   * @param[out] *pDst points to the block of output values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vlog2_f32(
+		     float32_t * pSrc,
+		     float32_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point block power function.
+   * @param[in] *pSrcX points to the block of bases.
+   * @param[in] *pSrcY points to the block of exponents.
+   * @param[out] *pDst points to the block of output values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vpow_f32(
+		     float32_t * pSrcX,
+		     float32_t * pSrcY,
+		     float32_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point block square root function.
+   * @param[in] *pSrc points to the block of input values.
+   * @param[out] *pDst points to the block of output values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vsqrt_f32(
+		     float32_t * pSrc,
+		     float32_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point block reciprocal square root function.
+   * @param[in] *pSrc points to the block of input values.
+   * @param[out] *pDst points to the block of output values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vrsqrt_f32(
+		     float32_t * pSrc,
+		     float32_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Q31 block sine function.
+   * @param[in] *pSrc points to the block of scaled angles, [0 +0.9999] maps to [0 2*pi).
+   * @param[out] *pDst points to the block of sine values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vsin_q31(
+		     q31_t * pSrc,
+		     q31_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Q31 block cosine function.
+   * @param[in] *pSrc points to the block of scaled angles, [0 +0.9999] maps to [0 2*pi).
+   * @param[out] *pDst points to the block of cosine values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vcos_q31(
+		     q31_t * pSrc,
+		     q31_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Q31 block sine and cosine function.
+   * @param[in] *pSrc points to the block of scaled angles, [0 +0.9999] maps to [0 2*pi).
+   * @param[out] *pSinVal points to the block of sine values.
+   * @param[out] *pCosVal points to the block of cosine values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vsin_cos_q31(
+		     q31_t * pSrc,
+		     q31_t * pSinVal,
+		     q31_t * pCosVal,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Q31 block square root function.
+   * @param[in] *pSrc points to the block of input values in the range [0 +1).
+   * @param[out] *pDst points to the block of square roots.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vsqrt_q31(
+		     q31_t * pSrc,
+		     q31_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Q15 block sine function.
+   * @param[in] *pSrc points to the block of scaled angles, [0 +0.9999] maps to [0 2*pi).
+   * @param[out] *pDst points to the block of sine values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vsin_q15(
+		     q15_t * pSrc,
+		     q15_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Q15 block cosine function.
+   * @param[in] *pSrc points to the block of scaled angles, [0 +0.9999] maps to [0 2*pi).
+   * @param[out] *pDst points to the block of cosine values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vcos_q15(
+		     q15_t * pSrc,
+		     q15_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Q15 block sine and cosine function.
+   * @param[in] *pSrc points to the block of scaled angles, [0 +0.9999] maps to [0 2*pi).
+   * @param[out] *pSinVal points to the block of sine values.
+   * @param[out] *pCosVal points to the block of cosine values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vsin_cos_q15(
+		     q15_t * pSrc,
+		     q15_t * pSinVal,
+		     q15_t * pCosVal,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Q15 block square root function.
+   * @param[in] *pSrc points to the block of input values in the range [0 +1).
+   * @param[out] *pDst points to the block of square roots.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_vsqrt_q15(
+		     q15_t * pSrc,
+		     q15_t * pDst,
+		     uint32_t blockSize);
   
   
   
@@ -6162,6 +9138,758 @@ void arm_correlate_q7(
 		    q31_t * pSrc,  
 		   uint32_t blockSize,  
 		   q31_t * pResult);  
+
+  /**
+   * @brief Statistics returned by the floating-point statistics summary functions.
+   */
+  typedef struct
+  {
+    float32_t mean;               /**< mean. */
+    float32_t var;                /**< variance, normalized by N - 1. */
+    float32_t std;                /**< standard deviation. */
+    float32_t rms;                /**< root mean square value. */
+    float32_t power;              /**< sum of squares. */
+    float32_t min;                /**< minimum value. */
+    float32_t max;                /**< maximum value. */
+    uint32_t minIndex;            /**< position of the first minimum. */
+    uint32_t maxIndex;            /**< position of the first maximum. */
+  } arm_stats_result_f32;
+
+  /**
+   * @brief Instance structure for the floating-point streaming statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;               /**< number of samples since the last reset. */
+    float32_t mean;               /**< running mean. */
+    float32_t m2;                 /**< running sum of squared deviations from the mean. */
+    float32_t sumSq;              /**< running sum of squares. */
+    float32_t min;                /**< running minimum. */
+    float32_t max;                /**< running maximum. */
+    uint32_t minIndex;            /**< position of the first minimum. */
+    uint32_t maxIndex;            /**< position of the first maximum. */
+  } arm_stats_instance_f32;
+
+  /**
+   * @brief Statistics returned by the Q31 statistics summary functions.
+   */
+  typedef struct
+  {
+    q31_t mean;                   /**< mean. */
+    q31_t var;                    /**< variance, normalized by N - 1. */
+    q31_t std;                    /**< standard deviation. */
+    q31_t rms;                    /**< root mean square value. */
+    q63_t power;                  /**< sum of squares in 33.31 format. */
+    q31_t min;                    /**< minimum value. */
+    q31_t max;                    /**< maximum value. */
+    uint32_t minIndex;            /**< position of the first minimum. */
+    uint32_t maxIndex;            /**< position of the first maximum. */
+  } arm_stats_result_q31;
+
+  /**
+   * @brief Instance structure for the Q31 streaming statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;               /**< number of samples since the last reset. */
+    q63_t sum;                    /**< running sum of the samples in 1.31 units. */
+    q63_t sumSq;                  /**< running sum of squares in 33.31 format. */
+    q31_t min;                    /**< running minimum. */
+    q31_t max;                    /**< running maximum. */
+    uint32_t minIndex;            /**< position of the first minimum. */
+    uint32_t maxIndex;            /**< position of the first maximum. */
+  } arm_stats_instance_q31;
+
+  /**
+   * @brief Statistics returned by the Q15 statistics summary functions.
+   */
+  typedef struct
+  {
+    q15_t mean;                   /**< mean. */
+    q15_t var;                    /**< variance, normalized by N - 1. */
+    q15_t std;                    /**< standard deviation. */
+    q15_t rms;                    /**< root mean square value. */
+    q63_t power;                  /**< sum of squares in 34.30 format. */
+    q15_t min;                    /**< minimum value. */
+    q15_t max;                    /**< maximum value. */
+    uint32_t minIndex;            /**< position of the first minimum. */
+    uint32_t maxIndex;            /**< position of the first maximum. */
+  } arm_stats_result_q15;
+
+  /**
+   * @brief Instance structure for the Q15 streaming statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;               /**< number of samples since the last reset. */
+    q63_t sum;                    /**< running sum of the samples in 1.15 units. */
+    q63_t sumSq;                  /**< running sum of squares in 34.30 format. */
+    q15_t min;                    /**< running minimum. */
+    q15_t max;                    /**< running maximum. */
+    uint32_t minIndex;            /**< position of the first minimum. */
+    uint32_t maxIndex;            /**< position of the first maximum. */
+  } arm_stats_instance_q15;
+
+  /**
+   * @brief  Statistics summary of a floating-point vector in a single pass.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[out] *pResult points to the statistics.
+   * @return none.
+   */
+
+  void arm_stats_summary_f32(
+			     float32_t * pSrc,
+			     uint32_t blockSize,
+			     arm_stats_result_f32 * pResult);
+
+  /**
+   * @brief  Reset function for the floating-point streaming statistics.
+   * @param[out] *S points to an instance of the floating-point statistics structure.
+   * @return none.
+   */
+
+  void arm_stats_reset_f32(
+			   arm_stats_instance_f32 * S);
+
+  /**
+   * @brief  Adds a block of floating-point samples to the streaming statistics.
+   * @param[in,out] *S points to an instance of the floating-point statistics structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+
+  void arm_stats_update_f32(
+			    arm_stats_instance_f32 * S,
+			    float32_t * pSrc,
+			    uint32_t blockSize);
+
+  /**
+   * @brief  Returns the floating-point statistics accumulated since the last reset.
+   * @param[in]  *S points to an instance of the floating-point statistics structure.
+   * @param[out] *pResult points to the statistics.
+   * @return none.
+   */
+
+  void arm_stats_get_f32(
+			 const arm_stats_instance_f32 * S,
+			 arm_stats_result_f32 * pResult);
+
+  /**
+   * @brief  Statistics summary of a Q31 vector in a single pass.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[out] *pResult points to the statistics.
+   * @return none.
+   */
+
+  void arm_stats_summary_q31(
+			     q31_t * pSrc,
+			     uint32_t blockSize,
+			     arm_stats_result_q31 * pResult);
+
+  /**
+   * @brief  Reset function for the Q31 streaming statistics.
+   * @param[out] *S points to an instance of the Q31 statistics structure.
+   * @return none.
+   */
+
+  void arm_stats_reset_q31(
+			   arm_stats_instance_q31 * S);
+
+  /**
+   * @brief  Adds a block of Q31 samples to the streaming statistics.
+   * @param[in,out] *S points to an instance of the Q31 statistics structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+
+  void arm_stats_update_q31(
+			    arm_stats_instance_q31 * S,
+			    q31_t * pSrc,
+			    uint32_t blockSize);
+
+  /**
+   * @brief  Returns the Q31 statistics accumulated since the last reset.
+   * @param[in]  *S points to an instance of the Q31 statistics structure.
+   * @param[out] *pResult points to the statistics.
+   * @return none.
+   */
+
+  void arm_stats_get_q31(
+			 const arm_stats_instance_q31 * S,
+			 arm_stats_result_q31 * pResult);
+
+  /**
+   * @brief  Statistics summary of a Q15 vector in a single pass.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[out] *pResult points to the statistics.
+   * @return none.
+   */
+
+  void arm_stats_summary_q15(
+			     q15_t * pSrc,
+			     uint32_t blockSize,
+			     arm_stats_result_q15 * pResult);
+
+  /**
+   * @brief  Reset function for the Q15 streaming statistics.
+   * @param[out] *S points to an instance of the Q15 statistics structure.
+   * @return none.
+   */
+
+  void arm_stats_reset_q15(
+			   arm_stats_instance_q15 * S);
+
+  /**
+   * @brief  Adds a block of Q15 samples to the streaming statistics.
+   * @param[in,out] *S points to an instance of the Q15 statistics structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+
+  void arm_stats_update_q15(
+			    arm_stats_instance_q15 * S,
+			    q15_t * pSrc,
+			    uint32_t blockSize);
+
+  /**
+   * @brief  Returns the Q15 statistics accumulated since the last reset.
+   * @param[in]  *S points to an instance of the Q15 statistics structure.
+   * @param[out] *pResult points to the statistics.
+   * @return none.
+   */
+
+  void arm_stats_get_q15(
+			 const arm_stats_instance_q15 * S,
+			 arm_stats_result_q15 * pResult);
+
+  /**
+   * @brief Instance structure for the floating-point sliding window statistics.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;           /**< number of samples in the window. */
+    uint16_t count;               /**< number of samples in the window so far. */
+    uint16_t head;                /**< history position of the next sample. */
+    uint16_t sinceSync;           /**< samples replaced since the moments were last recomputed. */
+    uint16_t minFront;            /**< front of the minimum queue. */
+    uint16_t minLen;              /**< number of entries in the minimum queue. */
+    uint16_t maxFront;            /**< front of the maximum queue. */
+    uint16_t maxLen;              /**< number of entries in the maximum queue. */
+    float32_t *pHistory;          /**< points to the history buffer of windowLen samples. */
+    uint16_t *pMinQueue;          /**< points to the minimum queue of windowLen entries, or NULL. */
+    uint16_t *pMaxQueue;          /**< points to the maximum queue of windowLen entries, or NULL. */
+    float32_t mean;               /**< mean of the window. */
+    float32_t m2;                 /**< sum of squared deviations from the mean. */
+    float32_t sumSq;              /**< sum of squares of the window. */
+  } arm_sliding_stats_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding window statistics.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;           /**< number of samples in the window. */
+    uint16_t count;               /**< number of samples in the window so far. */
+    uint16_t head;                /**< history position of the next sample. */
+    uint16_t minFront;            /**< front of the minimum queue. */
+    uint16_t minLen;              /**< number of entries in the minimum queue. */
+    uint16_t maxFront;            /**< front of the maximum queue. */
+    uint16_t maxLen;              /**< number of entries in the maximum queue. */
+    q31_t *pHistory;              /**< points to the history buffer of windowLen samples. */
+    uint16_t *pMinQueue;          /**< points to the minimum queue of windowLen entries, or NULL. */
+    uint16_t *pMaxQueue;          /**< points to the maximum queue of windowLen entries, or NULL. */
+    q63_t sum;                    /**< sum of the window in 1.31 units. */
+    q63_t sumSq;                  /**< sum of squares of the window in 16.48 format. */
+  } arm_sliding_stats_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sliding window statistics.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;           /**< number of samples in the window. */
+    uint16_t count;               /**< number of samples in the window so far. */
+    uint16_t head;                /**< history position of the next sample. */
+    uint16_t minFront;            /**< front of the minimum queue. */
+    uint16_t minLen;              /**< number of entries in the minimum queue. */
+    uint16_t maxFront;            /**< front of the maximum queue. */
+    uint16_t maxLen;              /**< number of entries in the maximum queue. */
+    q15_t *pHistory;              /**< points to the history buffer of windowLen samples. */
+    uint16_t *pMinQueue;          /**< points to the minimum queue of windowLen entries, or NULL. */
+    uint16_t *pMaxQueue;          /**< points to the maximum queue of windowLen entries, or NULL. */
+    q63_t sum;                    /**< sum of the window in 1.15 units. */
+    q63_t sumSq;                  /**< sum of squares of the window in 34.30 format. */
+  } arm_sliding_stats_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding window statistics.
+   * @param[out] *S points to an instance of the floating-point sliding window statistics structure.
+   * @param[in]  windowLen number of samples in the window.
+   * @param[in]  *pHistory points to the history buffer of windowLen samples.
+   * @param[in]  *pMinQueue points to the minimum queue of windowLen entries, or NULL.
+   * @param[in]  *pMaxQueue points to the maximum queue of windowLen entries, or NULL.
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+
+  arm_status arm_sliding_stats_init_f32(
+					arm_sliding_stats_instance_f32 * S,
+					uint16_t windowLen,
+					float32_t * pHistory,
+					uint16_t * pMinQueue,
+					uint16_t * pMaxQueue);
+
+  /**
+   * @brief  Adds a block of floating-point samples to the sliding window statistics.
+   * @param[in,out] *S points to an instance of the floating-point sliding window statistics structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+
+  void arm_sliding_stats_update_f32(
+				    arm_sliding_stats_instance_f32 * S,
+				    float32_t * pSrc,
+				    uint32_t blockSize);
+
+  /**
+   * @brief  Returns the floating-point statistics of the current window.
+   * @param[in]  *S points to an instance of the floating-point sliding window statistics structure.
+   * @param[out] *pResult points to the statistics.
+   * @return none.
+   */
+
+  void arm_sliding_stats_get_f32(
+				 const arm_sliding_stats_instance_f32 * S,
+				 arm_stats_result_f32 * pResult);
+
+  /**
+   * @brief  Initialization function for the Q31 sliding window statistics.
+   * @param[out] *S points to an instance of the Q31 sliding window statistics structure.
+   * @param[in]  windowLen number of samples in the window, 1 to 32767.
+   * @param[in]  *pHistory points to the history buffer of windowLen samples.
+   * @param[in]  *pMinQueue points to the minimum queue of windowLen entries, or NULL.
+   * @param[in]  *pMaxQueue points to the maximum queue of windowLen entries, or NULL.
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+
+  arm_status arm_sliding_stats_init_q31(
+					arm_sliding_stats_instance_q31 * S,
+					uint16_t windowLen,
+					q31_t * pHistory,
+					uint16_t * pMinQueue,
+					uint16_t * pMaxQueue);
+
+  /**
+   * @brief  Adds a block of Q31 samples to the sliding window statistics.
+   * @param[in,out] *S points to an instance of the Q31 sliding window statistics structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+
+  void arm_sliding_stats_update_q31(
+				    arm_sliding_stats_instance_q31 * S,
+				    q31_t * pSrc,
+				    uint32_t blockSize);
+
+  /**
+   * @brief  Returns the Q31 statistics of the current window.
+   * @param[in]  *S points to an instance of the Q31 sliding window statistics structure.
+   * @param[out] *pResult points to the statistics.
+   * @return none.
+   */
+
+  void arm_sliding_stats_get_q31(
+				 const arm_sliding_stats_instance_q31 * S,
+				 arm_stats_result_q31 * pResult);
+
+  /**
+   * @brief  Initialization function for the Q15 sliding window statistics.
+   * @param[out] *S points to an instance of the Q15 sliding window statistics structure.
+   * @param[in]  windowLen number of samples in the window.
+   * @param[in]  *pHistory points to the history buffer of windowLen samples.
+   * @param[in]  *pMinQueue points to the minimum queue of windowLen entries, or NULL.
+   * @param[in]  *pMaxQueue points to the maximum queue of windowLen entries, or NULL.
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+
+  arm_status arm_sliding_stats_init_q15(
+					arm_sliding_stats_instance_q15 * S,
+					uint16_t windowLen,
+					q15_t * pHistory,
+					uint16_t * pMinQueue,
+					uint16_t * pMaxQueue);
+
+  /**
+   * @brief  Adds a block of Q15 samples to the sliding window statistics.
+   * @param[in,out] *S points to an instance of the Q15 sliding window statistics structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+
+  void arm_sliding_stats_update_q15(
+				    arm_sliding_stats_instance_q15 * S,
+				    q15_t * pSrc,
+				    uint32_t blockSize);
+
+  /**
+   * @brief  Returns the Q15 statistics of the current window.
+   * @param[in]  *S points to an instance of the Q15 sliding window statistics structure.
+   * @param[out] *pResult points to the statistics.
+   * @return none.
+   */
+
+  void arm_sliding_stats_get_q15(
+				 const arm_sliding_stats_instance_q15 * S,
+				 arm_stats_result_q15 * pResult);
+
+  /**
+   * @brief  Percentile of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  percentile requested percentile as a fraction, 0.0 to 1.0. The median is 0.5.
+   * @param[in]  *pScratch points to a scratch buffer of blockSize values.
+   * @param[out] *pResult percentile value returned here.
+   * @return none.
+   */
+
+  void arm_percentile_f32(
+			  float32_t * pSrc,
+			  uint32_t blockSize,
+			  float32_t percentile,
+			  float32_t * pScratch,
+			  float32_t * pResult);
+
+  /**
+   * @brief  Percentile of a Q31 vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  percentile requested percentile as a fraction, 0.0 to 1.0. The median is 0.5.
+   * @param[in]  *pScratch points to a scratch buffer of blockSize values.
+   * @param[out] *pResult percentile value returned here.
+   * @return none.
+   */
+
+  void arm_percentile_q31(
+			  q31_t * pSrc,
+			  uint32_t blockSize,
+			  float32_t percentile,
+			  q31_t * pScratch,
+			  q31_t * pResult);
+
+  /**
+   * @brief  Percentile of a Q15 vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  percentile requested percentile as a fraction, 0.0 to 1.0. The median is 0.5.
+   * @param[in]  *pScratch points to a scratch buffer of blockSize values.
+   * @param[out] *pResult percentile value returned here.
+   * @return none.
+   */
+
+  void arm_percentile_q15(
+			  q15_t * pSrc,
+			  uint32_t blockSize,
+			  float32_t percentile,
+			  q15_t * pScratch,
+			  q15_t * pResult);
+
+  /**
+   * @brief  Adds a block of floating-point samples to a histogram with uniform bins.
+   * @param[in]     *pSrc points to the input vector.
+   * @param[in]     blockSize length of the input vector.
+   * @param[in]     minVal lower edge of the first bin.
+   * @param[in]     maxVal upper edge of the last bin, greater than minVal.
+   * @param[in]     numBins number of bins.
+   * @param[in,out] *pHist points to the numBins bin counts, incremented by the function.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the range or numBins is invalid.
+   */
+
+  arm_status arm_histogram_f32(
+			       float32_t * pSrc,
+			       uint32_t blockSize,
+			       float32_t minVal,
+			       float32_t maxVal,
+			       uint16_t numBins,
+			       uint32_t * pHist);
+
+  /**
+   * @brief  Adds a block of Q15 samples to a histogram with uniform bins.
+   * @param[in]     *pSrc points to the input vector.
+   * @param[in]     blockSize length of the input vector.
+   * @param[in]     minVal lower edge of the first bin.
+   * @param[in]     maxVal upper edge of the last bin, greater than minVal.
+   * @param[in]     numBins number of bins.
+   * @param[in,out] *pHist points to the numBins bin counts, incremented by the function.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the range or numBins is invalid.
+   */
+
+  arm_status arm_histogram_q15(
+			       q15_t * pSrc,
+			       uint32_t blockSize,
+			       q15_t minVal,
+			       q15_t maxVal,
+			       uint16_t numBins,
+			       uint32_t * pHist);
+
+  /**
+   * @brief  Adds a block of Q7 samples to a histogram with uniform bins.
+   * @param[in]     *pSrc points to the input vector.
+   * @param[in]     blockSize length of the input vector.
+   * @param[in]     minVal lower edge of the first bin.
+   * @param[in]     maxVal upper edge of the last bin, greater than minVal.
+   * @param[in]     numBins number of bins.
+   * @param[in,out] *pHist points to the numBins bin counts, incremented by the function.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the range or numBins is invalid.
+   */
+
+  arm_status arm_histogram_q7(
+			       q7_t * pSrc,
+			       uint32_t blockSize,
+			       q7_t minVal,
+			       q7_t maxVal,
+			       uint16_t numBins,
+			       uint32_t * pHist);
+
+  /**
+   * @brief  Finds the k largest elements of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  k number of elements to find, 1 to blockSize.
+   * @param[out] *pDstVal points to the k largest values, in decreasing order.
+   * @param[out] *pDstIndex points to the k indices of the largest values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if k is 0 or larger than blockSize.
+   */
+
+  arm_status arm_top_k_f32(
+			  float32_t * pSrc,
+			  uint32_t blockSize,
+			  uint32_t k,
+			  float32_t * pDstVal,
+			  uint32_t * pDstIndex);
+
+  /**
+   * @brief  Finds the k largest elements of a Q31 vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  k number of elements to find, 1 to blockSize.
+   * @param[out] *pDstVal points to the k largest values, in decreasing order.
+   * @param[out] *pDstIndex points to the k indices of the largest values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if k is 0 or larger than blockSize.
+   */
+
+  arm_status arm_top_k_q31(
+			  q31_t * pSrc,
+			  uint32_t blockSize,
+			  uint32_t k,
+			  q31_t * pDstVal,
+			  uint32_t * pDstIndex);
+
+  /**
+   * @brief  Finds the k largest elements of a Q15 vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  k number of elements to find, 1 to blockSize.
+   * @param[out] *pDstVal points to the k largest values, in decreasing order.
+   * @param[out] *pDstIndex points to the k indices of the largest values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if k is 0 or larger than blockSize.
+   */
+
+  arm_status arm_top_k_q15(
+			  q15_t * pSrc,
+			  uint32_t blockSize,
+			  uint32_t k,
+			  q15_t * pDstVal,
+			  uint32_t * pDstIndex);
+
+  /**
+   * @brief  Finds the k largest elements of a Q7 vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  k number of elements to find, 1 to blockSize.
+   * @param[out] *pDstVal points to the k largest values, in decreasing order.
+   * @param[out] *pDstIndex points to the k indices of the largest values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if k is 0 or larger than blockSize.
+   */
+
+  arm_status arm_top_k_q7(
+			  q7_t * pSrc,
+			  uint32_t blockSize,
+			  uint32_t k,
+			  q7_t * pDstVal,
+			  uint32_t * pDstIndex);
+
+  /**
+   * @brief  Finds the local maxima of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  threshold smallest value of a reported peak.
+   * @param[in]  minDistance smallest spacing between reported peaks, in samples.
+   * @param[in]  maxPeaks size of the peak index buffer.
+   * @param[out] *pPeakIndex points to the indices of the peaks, in increasing order.
+   * @param[out] *pNumPeaks number of peaks reported.
+   * @return none.
+   */
+
+  void arm_find_peaks_f32(
+			  float32_t * pSrc,
+			  uint32_t blockSize,
+			  float32_t threshold,
+			  uint32_t minDistance,
+			  uint32_t maxPeaks,
+			  uint32_t * pPeakIndex,
+			  uint32_t * pNumPeaks);
+
+  /**
+   * @brief  Finds the local maxima of a Q31 vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  threshold smallest value of a reported peak.
+   * @param[in]  minDistance smallest spacing between reported peaks, in samples.
+   * @param[in]  maxPeaks size of the peak index buffer.
+   * @param[out] *pPeakIndex points to the indices of the peaks, in increasing order.
+   * @param[out] *pNumPeaks number of peaks reported.
+   * @return none.
+   */
+
+  void arm_find_peaks_q31(
+			  q31_t * pSrc,
+			  uint32_t blockSize,
+			  q31_t threshold,
+			  uint32_t minDistance,
+			  uint32_t maxPeaks,
+			  uint32_t * pPeakIndex,
+			  uint32_t * pNumPeaks);
+
+  /**
+   * @brief  Finds the local maxima of a Q15 vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  threshold smallest value of a reported peak.
+   * @param[in]  minDistance smallest spacing between reported peaks, in samples.
+   * @param[in]  maxPeaks size of the peak index buffer.
+   * @param[out] *pPeakIndex points to the indices of the peaks, in increasing order.
+   * @param[out] *pNumPeaks number of peaks reported.
+   * @return none.
+   */
+
+  void arm_find_peaks_q15(
+			  q15_t * pSrc,
+			  uint32_t blockSize,
+			  q15_t threshold,
+			  uint32_t minDistance,
+			  uint32_t maxPeaks,
+			  uint32_t * pPeakIndex,
+			  uint32_t * pNumPeaks);
+
+  /**
+   * @brief  Finds the local maxima of a Q7 vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  threshold smallest value of a reported peak.
+   * @param[in]  minDistance smallest spacing between reported peaks, in samples.
+   * @param[in]  maxPeaks size of the peak index buffer.
+   * @param[out] *pPeakIndex points to the indices of the peaks, in increasing order.
+   * @param[out] *pNumPeaks number of peaks reported.
+   * @return none.
+   */
+
+  void arm_find_peaks_q7(
+			  q7_t * pSrc,
+			  uint32_t blockSize,
+			  q7_t threshold,
+			  uint32_t minDistance,
+			  uint32_t maxPeaks,
+			  uint32_t * pPeakIndex,
+			  uint32_t * pNumPeaks);
+
+  /**
+   * @brief Interpolation used by the sub-sample peak refinement functions.
+   */
+  typedef enum
+  {
+    ARM_PEAK_PARABOLIC = 0,        /**< Parabola through the three samples around the peak. */
+    ARM_PEAK_GAUSSIAN = 1          /**< Parabola through the logarithms of the three samples. */
+  } arm_peak_refine_method;
+
+  /**
+   * @brief  Sub-sample refinement of a peak of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  index index of the peak sample.
+   * @param[in]  method interpolation, ARM_PEAK_PARABOLIC or ARM_PEAK_GAUSSIAN.
+   * @param[out] *pOffset position of the peak relative to index returned here.
+   * @param[out] *pValue interpolated height of the peak returned here.
+   * @return none.
+   */
+
+  void arm_peak_refine_f32(
+			  float32_t * pSrc,
+			  uint32_t blockSize,
+			  uint32_t index,
+			  arm_peak_refine_method method,
+			  float32_t * pOffset,
+			  float32_t * pValue);
+
+  /**
+   * @brief  Sub-sample refinement of a peak of a Q31 vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  index index of the peak sample.
+   * @param[in]  method interpolation, ARM_PEAK_PARABOLIC or ARM_PEAK_GAUSSIAN.
+   * @param[out] *pOffset position of the peak relative to index returned here.
+   * @param[out] *pValue interpolated height of the peak returned here.
+   * @return none.
+   */
+
+  void arm_peak_refine_q31(
+			  q31_t * pSrc,
+			  uint32_t blockSize,
+			  uint32_t index,
+			  arm_peak_refine_method method,
+			  float32_t * pOffset,
+			  q31_t * pValue);
+
+  /**
+   * @brief  Sub-sample refinement of a peak of a Q15 vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[in]  blockSize length of the input vector.
+   * @param[in]  index index of the peak sample.
+   * @param[in]  method interpolation, ARM_PEAK_PARABOLIC or ARM_PEAK_GAUSSIAN.
+   * @param[out] *pOffset position of the peak relative to index returned here.
+   * @param[out] *pValue interpolated height of the peak returned here.
+   * @return none.
+   */
+
+  void arm_peak_refine_q15(
+			  q15_t * pSrc,
+			  uint32_t blockSize,
+			  uint32_t index,
+			  arm_peak_refine_method method,
+			  float32_t * pOffset,
+			  q15_t * pValue);
+
+  /**
+   * @brief  Sub-bin refinement of a peak of a floating-point complex spectrum.
+   * @param[in]  *pSrc points to the complex spectrum.
+   * @param[in]  numBins number of complex bins.
+   * @param[in]  index bin of the peak.
+   * @param[out] *pOffset position of the peak relative to index returned here.
+   * @return none.
+   */
+
+  void arm_peak_refine_cmplx_f32(
+			  float32_t * pSrc,
+			  uint32_t numBins,
+			  uint32_t index,
+			  float32_t * pOffset);
   
   /**  
    * @brief  Standard deviation of the elements of a Q15 vector.  
@@ -6214,6 +9942,100 @@ void arm_correlate_q7(
 			  q15_t * pSrc,  
 			 q15_t * pDst,  
 			 uint32_t numSamples);  
+
+  /**
+   * @brief Accuracy of the complex magnitude functions with selectable accuracy.
+   */
+  typedef enum
+  {
+    ARM_CMPLX_MAG_APPROX = 0,     /**< alpha max plus beta min estimate, 1.01% peak error. */
+    ARM_CMPLX_MAG_NEWTON = 1,     /**< reciprocal square root seed and one Newton step. */
+    ARM_CMPLX_MAG_EXACT = 2       /**< same result as arm_cmplx_mag. */
+  } arm_cmplx_mag_accuracy;
+
+  /**
+   * @brief  Floating-point complex magnitude with selectable accuracy.
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @param[in]  accuracy approximation used for the magnitude
+   * @return none.
+   */
+
+  void arm_cmplx_mag_fast_f32(
+			      float32_t * pSrc,
+			      float32_t * pDst,
+			      uint32_t numSamples,
+			      arm_cmplx_mag_accuracy accuracy);
+
+  /**
+   * @brief  Q31 complex magnitude with selectable accuracy.
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @param[in]  accuracy approximation used for the magnitude
+   * @return none.
+   */
+
+  void arm_cmplx_mag_fast_q31(
+			      q31_t * pSrc,
+			      q31_t * pDst,
+			      uint32_t numSamples,
+			      arm_cmplx_mag_accuracy accuracy);
+
+  /**
+   * @brief  Q15 complex magnitude with selectable accuracy.
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @param[in]  accuracy approximation used for the magnitude
+   * @return none.
+   */
+
+  void arm_cmplx_mag_fast_q15(
+			      q15_t * pSrc,
+			      q15_t * pDst,
+			      uint32_t numSamples,
+			      arm_cmplx_mag_accuracy accuracy);
+
+  /**
+   * @brief  Floating-point complex log magnitude.
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector of 20 * log10(|x|)
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_log_f32(
+			     float32_t * pSrc,
+			     float32_t * pDst,
+			     uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex log magnitude.
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector of log2(|x|) in 6.26 format
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_log_q31(
+			     q31_t * pSrc,
+			     q31_t * pDst,
+			     uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex log magnitude.
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector of log2(|x|) in 5.11 format
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_log_q15(
+			     q15_t * pSrc,
+			     q15_t * pDst,
+			     uint32_t numSamples);
   
   /**  
    * @brief  Q15 complex dot product  
@@ -6474,6 +10296,312 @@ void arm_correlate_q7(
 			        float32_t * pSrcB,  
 			       float32_t * pDst,  
 			       uint32_t numSamples);  
+
+  /**
+   * @brief  Splits a floating-point interleaved complex vector into real and imaginary parts.
+   * @param[in]  *pSrc points to the interleaved complex input vector
+   * @param[out] *pDstRe points to the real parts
+   * @param[out] *pDstIm points to the imaginary parts
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_deinterleave_f32(
+		       float32_t * pSrc,
+		       float32_t * pDstRe,
+		       float32_t * pDstIm,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Splits a Q31 interleaved complex vector into real and imaginary parts.
+   * @param[in]  *pSrc points to the interleaved complex input vector
+   * @param[out] *pDstRe points to the real parts
+   * @param[out] *pDstIm points to the imaginary parts
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_deinterleave_q31(
+		       q31_t * pSrc,
+		       q31_t * pDstRe,
+		       q31_t * pDstIm,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Splits a Q15 interleaved complex vector into real and imaginary parts.
+   * @param[in]  *pSrc points to the interleaved complex input vector
+   * @param[out] *pDstRe points to the real parts
+   * @param[out] *pDstIm points to the imaginary parts
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_deinterleave_q15(
+		       q15_t * pSrc,
+		       q15_t * pDstRe,
+		       q15_t * pDstIm,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Merges floating-point real and imaginary parts into an interleaved complex vector.
+   * @param[in]  *pSrcRe points to the real parts
+   * @param[in]  *pSrcIm points to the imaginary parts
+   * @param[out] *pDst points to the interleaved complex output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_interleave_f32(
+		       float32_t * pSrcRe,
+		       float32_t * pSrcIm,
+		       float32_t * pDst,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Merges Q31 real and imaginary parts into an interleaved complex vector.
+   * @param[in]  *pSrcRe points to the real parts
+   * @param[in]  *pSrcIm points to the imaginary parts
+   * @param[out] *pDst points to the interleaved complex output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_interleave_q31(
+		       q31_t * pSrcRe,
+		       q31_t * pSrcIm,
+		       q31_t * pDst,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Merges Q15 real and imaginary parts into an interleaved complex vector.
+   * @param[in]  *pSrcRe points to the real parts
+   * @param[in]  *pSrcIm points to the imaginary parts
+   * @param[out] *pDst points to the interleaved complex output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_interleave_q15(
+		       q15_t * pSrcRe,
+		       q15_t * pSrcIm,
+		       q15_t * pDst,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex-by-complex multiplication in split format.
+   * @param[in]  *pSrcARe points to the real parts of the first input vector
+   * @param[in]  *pSrcAIm points to the imaginary parts of the first input vector
+   * @param[in]  *pSrcBRe points to the real parts of the second input vector
+   * @param[in]  *pSrcBIm points to the imaginary parts of the second input vector
+   * @param[out] *pDstRe points to the real parts of the output vector
+   * @param[out] *pDstIm points to the imaginary parts of the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_mult_cmplx_split_f32(
+		       float32_t * pSrcARe,
+		       float32_t * pSrcAIm,
+		       float32_t * pSrcBRe,
+		       float32_t * pSrcBIm,
+		       float32_t * pDstRe,
+		       float32_t * pDstIm,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex-by-complex multiplication in split format.
+   * @param[in]  *pSrcARe points to the real parts of the first input vector
+   * @param[in]  *pSrcAIm points to the imaginary parts of the first input vector
+   * @param[in]  *pSrcBRe points to the real parts of the second input vector
+   * @param[in]  *pSrcBIm points to the imaginary parts of the second input vector
+   * @param[out] *pDstRe points to the real parts of the output vector
+   * @param[out] *pDstIm points to the imaginary parts of the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_mult_cmplx_split_q31(
+		       q31_t * pSrcARe,
+		       q31_t * pSrcAIm,
+		       q31_t * pSrcBRe,
+		       q31_t * pSrcBIm,
+		       q31_t * pDstRe,
+		       q31_t * pDstIm,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex-by-complex multiplication in split format.
+   * @param[in]  *pSrcARe points to the real parts of the first input vector
+   * @param[in]  *pSrcAIm points to the imaginary parts of the first input vector
+   * @param[in]  *pSrcBRe points to the real parts of the second input vector
+   * @param[in]  *pSrcBIm points to the imaginary parts of the second input vector
+   * @param[out] *pDstRe points to the real parts of the output vector
+   * @param[out] *pDstIm points to the imaginary parts of the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_mult_cmplx_split_q15(
+		       q15_t * pSrcARe,
+		       q15_t * pSrcAIm,
+		       q15_t * pSrcBRe,
+		       q15_t * pSrcBIm,
+		       q15_t * pDstRe,
+		       q15_t * pDstIm,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex magnitude squared in split format.
+   * @param[in]  *pSrcRe points to the real parts of the complex input vector
+   * @param[in]  *pSrcIm points to the imaginary parts of the complex input vector
+   * @param[out] *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_squared_split_f32(
+		       float32_t * pSrcRe,
+		       float32_t * pSrcIm,
+		       float32_t * pDst,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex magnitude squared in split format.
+   * @param[in]  *pSrcRe points to the real parts of the complex input vector
+   * @param[in]  *pSrcIm points to the imaginary parts of the complex input vector
+   * @param[out] *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_squared_split_q31(
+		       q31_t * pSrcRe,
+		       q31_t * pSrcIm,
+		       q31_t * pDst,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex magnitude squared in split format.
+   * @param[in]  *pSrcRe points to the real parts of the complex input vector
+   * @param[in]  *pSrcIm points to the imaginary parts of the complex input vector
+   * @param[out] *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_squared_split_q15(
+		       q15_t * pSrcRe,
+		       q15_t * pSrcIm,
+		       q15_t * pDst,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex magnitude in split format.
+   * @param[in]  *pSrcRe points to the real parts of the complex input vector
+   * @param[in]  *pSrcIm points to the imaginary parts of the complex input vector
+   * @param[out] *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_split_f32(
+		       float32_t * pSrcRe,
+		       float32_t * pSrcIm,
+		       float32_t * pDst,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex magnitude in split format.
+   * @param[in]  *pSrcRe points to the real parts of the complex input vector
+   * @param[in]  *pSrcIm points to the imaginary parts of the complex input vector
+   * @param[out] *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_split_q31(
+		       q31_t * pSrcRe,
+		       q31_t * pSrcIm,
+		       q31_t * pDst,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex magnitude in split format.
+   * @param[in]  *pSrcRe points to the real parts of the complex input vector
+   * @param[in]  *pSrcIm points to the imaginary parts of the complex input vector
+   * @param[out] *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_split_q15(
+		       q15_t * pSrcRe,
+		       q15_t * pSrcIm,
+		       q15_t * pDst,
+		       uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex dot product in split format.
+   * @param[in]  *pSrcARe points to the real parts of the first input vector
+   * @param[in]  *pSrcAIm points to the imaginary parts of the first input vector
+   * @param[in]  *pSrcBRe points to the real parts of the second input vector
+   * @param[in]  *pSrcBIm points to the imaginary parts of the second input vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @param[out] *realResult real part of the result returned here
+   * @param[out] *imagResult imaginary part of the result returned here
+   * @return none.
+   */
+
+  void arm_cmplx_dot_prod_split_f32(
+		       float32_t * pSrcARe,
+		       float32_t * pSrcAIm,
+		       float32_t * pSrcBRe,
+		       float32_t * pSrcBIm,
+		       uint32_t numSamples,
+		       float32_t * realResult,
+		       float32_t * imagResult);
+
+  /**
+   * @brief  Q31 complex dot product in split format.
+   * @param[in]  *pSrcARe points to the real parts of the first input vector
+   * @param[in]  *pSrcAIm points to the imaginary parts of the first input vector
+   * @param[in]  *pSrcBRe points to the real parts of the second input vector
+   * @param[in]  *pSrcBIm points to the imaginary parts of the second input vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @param[out] *realResult real part of the result returned here
+   * @param[out] *imagResult imaginary part of the result returned here
+   * @return none.
+   */
+
+  void arm_cmplx_dot_prod_split_q31(
+		       q31_t * pSrcARe,
+		       q31_t * pSrcAIm,
+		       q31_t * pSrcBRe,
+		       q31_t * pSrcBIm,
+		       uint32_t numSamples,
+		       q63_t * realResult,
+		       q63_t * imagResult);
+
+  /**
+   * @brief  Q15 complex dot product in split format.
+   * @param[in]  *pSrcARe points to the real parts of the first input vector
+   * @param[in]  *pSrcAIm points to the imaginary parts of the first input vector
+   * @param[in]  *pSrcBRe points to the real parts of the second input vector
+   * @param[in]  *pSrcBIm points to the imaginary parts of the second input vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @param[out] *realResult real part of the result returned here
+   * @param[out] *imagResult imaginary part of the result returned here
+   * @return none.
+   */
+
+  void arm_cmplx_dot_prod_split_q15(
+		       q15_t * pSrcARe,
+		       q15_t * pSrcAIm,
+		       q15_t * pSrcBRe,
+		       q15_t * pSrcBIm,
+		       uint32_t numSamples,
+		       q31_t * realResult,
+		       q31_t * imagResult);
   
   /**  
    * @brief Converts the elements of the floating-point vector to Q31 vector.   
@@ -6573,6 +10701,112 @@ void arm_correlate_q7(
 		      q15_t * pSrc,  
 		     q7_t * pDst,  
 		     uint32_t blockSize);  
+
+  /**
+   * @brief Rounding modes of the Qm.n conversion functions.
+   */
+  typedef enum
+  {
+    ARM_CONVERT_TRUNCATE = 0,     /**< truncation towards zero. */
+    ARM_CONVERT_ROUND = 1,        /**< rounding to the nearest value. */
+    ARM_CONVERT_DITHER = 2        /**< triangular dither of up to +/-1 LSB, then rounding to the nearest value. */
+  } arm_conversion_mode;
+
+  /**
+   * @brief  Converts the elements of the floating-point vector to a Q31 vector with fracBits fractional bits.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[in]  fracBits is the number of fractional bits of the output, 0 to 31
+   * @param[in]  mode is the rounding mode
+   * @param[in,out]  *pDitherState points to the nonzero dither generator state, used by ARM_CONVERT_DITHER only
+   * @return none.
+   */
+  void arm_float_to_qmn_q31(
+			    float32_t * pSrc,
+			    q31_t * pDst,
+			    uint32_t blockSize,
+			    uint8_t fracBits,
+			    arm_conversion_mode mode,
+			    uint32_t * pDitherState);
+
+  /**
+   * @brief  Converts the elements of the floating-point vector to a Q15 vector with fracBits fractional bits.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[in]  fracBits is the number of fractional bits of the output, 0 to 15
+   * @param[in]  mode is the rounding mode
+   * @param[in,out]  *pDitherState points to the nonzero dither generator state, used by ARM_CONVERT_DITHER only
+   * @return none.
+   */
+  void arm_float_to_qmn_q15(
+			    float32_t * pSrc,
+			    q15_t * pDst,
+			    uint32_t blockSize,
+			    uint8_t fracBits,
+			    arm_conversion_mode mode,
+			    uint32_t * pDitherState);
+
+  /**
+   * @brief  Converts the elements of the floating-point vector to a Q7 vector with fracBits fractional bits.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[in]  fracBits is the number of fractional bits of the output, 0 to 7
+   * @param[in]  mode is the rounding mode
+   * @param[in,out]  *pDitherState points to the nonzero dither generator state, used by ARM_CONVERT_DITHER only
+   * @return none.
+   */
+  void arm_float_to_qmn_q7(
+			    float32_t * pSrc,
+			    q7_t * pDst,
+			    uint32_t blockSize,
+			    uint8_t fracBits,
+			    arm_conversion_mode mode,
+			    uint32_t * pDitherState);
+
+  /**
+   * @brief  Converts the elements of a Q31 vector with fracBits fractional bits to a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[in]  fracBits is the number of fractional bits of the input, 0 to 31
+   * @return none.
+   */
+  void arm_qmn_to_float_q31(
+			    q31_t * pSrc,
+			    float32_t * pDst,
+			    uint32_t blockSize,
+			    uint8_t fracBits);
+
+  /**
+   * @brief  Converts the elements of a Q15 vector with fracBits fractional bits to a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[in]  fracBits is the number of fractional bits of the input, 0 to 15
+   * @return none.
+   */
+  void arm_qmn_to_float_q15(
+			    q15_t * pSrc,
+			    float32_t * pDst,
+			    uint32_t blockSize,
+			    uint8_t fracBits);
+
+  /**
+   * @brief  Converts the elements of a Q7 vector with fracBits fractional bits to a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[in]  fracBits is the number of fractional bits of the input, 0 to 7
+   * @return none.
+   */
+  void arm_qmn_to_float_q7(
+			    q7_t * pSrc,
+			    float32_t * pDst,
+			    uint32_t blockSize,
+			    uint8_t fracBits);
   
   
   /**  
@@ -7052,6 +11286,943 @@ static INLINE void arm_bilinear_interp_q7(
    * @} end of BilinearInterpolate group  
    */  
   
+  /**  
+   * @ingroup groupInterpolation  
+   */  
+  
+  /**  
+   * @addtogroup InterpMap  
+   * @{  
+   */  
+  
+  /**  
+   * @brief  Locates a coordinate on a floating-point grid axis.  
+   * @param[in]  *A points to the axis structure.  
+   * @param[in]  x coordinate, clamped to the first and last grid points.  
+   * @param[out] *pFrac fractional position within the interval, 0 to 1.  
+   * @return index of the interval, 0 to numPoints - 2.  
+   */  
+  
+  static INLINE uint32_t arm_interp_axis_locate_f32(  
+						    const arm_interp_axis_f32 * A,  
+						    float32_t x,  
+						    float32_t * pFrac)  
+  {  
+    const float32_t *p = A->pPoints;  
+    uint32_t last = A->numPoints - 2u;          /* index of the last interval */  
+    uint32_t i, lo, hi, mid;  
+    float32_t t, xc;  
+  
+    if(p == NULL)  
+    {  
+      /* Uniform axis: table index clamped to [0, numPoints - 1].  A NaN selects 0 */  
+      t = (x - A->x0) * A->invSpacing;  
+      t = (t > 0.0f) ? t : 0.0f;  
+      t = (t < A->maxIndex) ? t : A->maxIndex;  
+  
+      i = (uint32_t) t;  
+      i = (i < last) ? i : last;  
+      *pFrac = t - (float32_t) i;  
+    }  
+    else  
+    {  
+      /* Non-uniform axis: clamp, then search for the last grid point not above x */  
+      xc = (x > p[0]) ? x : p[0];  
+      xc = (xc < p[last + 1u]) ? xc : p[last + 1u];  
+  
+      lo = 0u;  
+      hi = last;  
+  
+      while(lo < hi)  
+      {  
+        mid = (lo + hi + 1u) >> 1u;  
+  
+        if(p[mid] <= xc)  
+        {  
+          lo = mid;  
+        }  
+        else  
+        {  
+          hi = mid - 1u;  
+        }  
+      }  
+  
+      i = lo;  
+      *pFrac = (xc - p[i]) * A->pInvDelta[i];  
+    }  
+  
+    return (i);  
+  }  
+  
+  /**  
+   * @brief  Locates a 12.20 coordinate on a fixed-point map axis.  
+   * @param[in]  x coordinate in 12.20 format, clamped to 0 and numPoints - 1.  
+   * @param[in]  numPoints number of grid points along the axis, 2 to 2048.  
+   * @param[out] *pFrac fractional position within the interval, 0 to 2^20.  
+   * @return index of the interval, 0 to numPoints - 2.  
+   */  
+  
+  static INLINE uint32_t arm_interp_axis_locate_q31(  
+						    q31_t x,  
+						    uint16_t numPoints,  
+						    q31_t * pFrac)  
+  {  
+    q31_t xMax = (q31_t) ((uint32_t) (numPoints - 1u) << 20);  /* last grid point */  
+    uint32_t last = numPoints - 2u;             /* index of the last interval */  
+    uint32_t i;  
+  
+    /* Clamp to the table, then split into index and fraction */  
+    x = (x > 0) ? x : 0;  
+    x = (x < xMax) ? x : xMax;  
+  
+    i = (uint32_t) x >> 20;  
+    i = (i < last) ? i : last;  
+    *pFrac = x - (q31_t) (i << 20);  
+  
+    return (i);  
+  }  
+  
+  /**  
+   * @brief  Initialization function for a floating-point interpolation grid axis.  
+   * @param[out] *A points to the axis structure.  
+   * @param[in]  numPoints number of grid points along the axis, at least 2.  
+   * @param[in]  x0 first grid point of a uniform axis.  
+   * @param[in]  spacing spacing of a uniform axis, greater than 0.  
+   * @param[in]  *pPoints points to numPoints strictly increasing grid points, or NULL for a uniform axis.  
+   * @param[out] *pInvDelta points to a buffer of numPoints - 1 values for a non-uniform axis.  
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.  
+   */  
+  
+  arm_status arm_interp_axis_init_f32(  
+			arm_interp_axis_f32 * A,  
+			uint16_t numPoints,  
+			float32_t x0,  
+			float32_t spacing,  
+			const float32_t * pPoints,  
+			float32_t * pInvDelta);  
+  
+  /**  
+   * @brief  Initialization function for the floating-point bilinear map.  
+   * @param[out] *S points to an instance of the floating-point bilinear map structure.  
+   * @param[in]  *pAxisX points to the initialized X axis.  
+   * @param[in]  *pAxisY points to the initialized Y axis.  
+   * @param[in]  *pData points to the table of numX * numY values.  
+   * @return The function returns ARM_MATH_SUCCESS.  
+   */  
+  
+  arm_status arm_bilinear_map_init_f32(  
+			arm_bilinear_map_instance_f32 * S,  
+			const arm_interp_axis_f32 * pAxisX,  
+			const arm_interp_axis_f32 * pAxisY,  
+			const float32_t * pData);  
+  
+  /**  
+   * @brief  Floating-point block bilinear map.  
+   * @param[in]  *S points to an instance of the floating-point bilinear map structure.  
+   * @param[in]  *pX points to the block of X coordinates.  
+   * @param[in]  *pY points to the block of Y coordinates.  
+   * @param[out] *pOut points to the block of interpolated values.  
+   * @param[in]  blockSize number of points to process.  
+   * @return none.  
+   */  
+  
+  void arm_bilinear_map_f32(  
+		      const arm_bilinear_map_instance_f32 * S,  
+		      float32_t * pX,  
+		      float32_t * pY,  
+		      float32_t * pOut,  
+		      uint32_t blockSize);  
+  
+  /**  
+   * @brief  Initialization function for the floating-point trilinear map.  
+   * @param[out] *S points to an instance of the floating-point trilinear map structure.  
+   * @param[in]  *pAxisX points to the initialized X axis.  
+   * @param[in]  *pAxisY points to the initialized Y axis.  
+   * @param[in]  *pAxisZ points to the initialized Z axis.  
+   * @param[in]  *pData points to the table of numX * numY * numZ values.  
+   * @return The function returns ARM_MATH_SUCCESS.  
+   */  
+  
+  arm_status arm_trilinear_map_init_f32(  
+			arm_trilinear_map_instance_f32 * S,  
+			const arm_interp_axis_f32 * pAxisX,  
+			const arm_interp_axis_f32 * pAxisY,  
+			const arm_interp_axis_f32 * pAxisZ,  
+			const float32_t * pData);  
+  
+  /**  
+   * @brief  Floating-point block trilinear map.  
+   * @param[in]  *S points to an instance of the floating-point trilinear map structure.  
+   * @param[in]  *pX points to the block of X coordinates.  
+   * @param[in]  *pY points to the block of Y coordinates.  
+   * @param[in]  *pZ points to the block of Z coordinates.  
+   * @param[out] *pOut points to the block of interpolated values.  
+   * @param[in]  blockSize number of points to process.  
+   * @return none.  
+   */  
+  
+  void arm_trilinear_map_f32(  
+		      const arm_trilinear_map_instance_f32 * S,  
+		      float32_t * pX,  
+		      float32_t * pY,  
+		      float32_t * pZ,  
+		      float32_t * pOut,  
+		      uint32_t blockSize);  
+  
+  /**  
+   * @brief  Initialization function for the Q31 bilinear map.  
+   * @param[out] *S points to an instance of the Q31 bilinear map structure.  
+   * @param[in]  numX number of grid points along X, 2 to 2048.  
+   * @param[in]  numY number of grid points along Y, 2 to 2048.  
+   * @param[in]  *pData points to the table of numX * numY values.  
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.  
+   */  
+  
+  arm_status arm_bilinear_map_init_q31(  
+			arm_bilinear_map_instance_q31 * S,  
+			uint16_t numX,  
+			uint16_t numY,  
+			const q31_t * pData);  
+  
+  /**  
+   * @brief  Q31 block bilinear map.  
+   * @param[in]  *S points to an instance of the Q31 bilinear map structure.  
+   * @param[in]  *pX points to the block of X coordinates in 12.20 format.  
+   * @param[in]  *pY points to the block of Y coordinates in 12.20 format.  
+   * @param[out] *pOut points to the block of interpolated values.  
+   * @param[in]  blockSize number of points to process.  
+   * @return none.  
+   */  
+  
+  void arm_bilinear_map_q31(  
+		      const arm_bilinear_map_instance_q31 * S,  
+		      q31_t * pX,  
+		      q31_t * pY,  
+		      q31_t * pOut,  
+		      uint32_t blockSize);  
+  
+  /**  
+   * @brief  Initialization function for the Q15 bilinear map.  
+   * @param[out] *S points to an instance of the Q15 bilinear map structure.  
+   * @param[in]  numX number of grid points along X, 2 to 2048.  
+   * @param[in]  numY number of grid points along Y, 2 to 2048.  
+   * @param[in]  *pData points to the table of numX * numY values.  
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.  
+   */  
+  
+  arm_status arm_bilinear_map_init_q15(  
+			arm_bilinear_map_instance_q15 * S,  
+			uint16_t numX,  
+			uint16_t numY,  
+			const q15_t * pData);  
+  
+  /**  
+   * @brief  Q15 block bilinear map.  
+   * @param[in]  *S points to an instance of the Q15 bilinear map structure.  
+   * @param[in]  *pX points to the block of X coordinates in 12.20 format.  
+   * @param[in]  *pY points to the block of Y coordinates in 12.20 format.  
+   * @param[out] *pOut points to the block of interpolated values.  
+   * @param[in]  blockSize number of points to process.  
+   * @return none.  
+   */  
+  
+  void arm_bilinear_map_q15(  
+		      const arm_bilinear_map_instance_q15 * S,  
+		      q31_t * pX,  
+		      q31_t * pY,  
+		      q15_t * pOut,  
+		      uint32_t blockSize);  
+  
+  /**  
+   * @brief  Initialization function for the Q31 trilinear map.  
+   * @param[out] *S points to an instance of the Q31 trilinear map structure.  
+   * @param[in]  numX number of grid points along X, 2 to 2048.  
+   * @param[in]  numY number of grid points along Y, 2 to 2048.  
+   * @param[in]  numZ number of grid points along Z, 2 to 2048.  
+   * @param[in]  *pData points to the table of numX * numY * numZ values.  
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.  
+   */  
+  
+  arm_status arm_trilinear_map_init_q31(  
+			arm_trilinear_map_instance_q31 * S,  
+			uint16_t numX,  
+			uint16_t numY,  
+			uint16_t numZ,  
+			const q31_t * pData);  
+  
+  /**  
+   * @brief  Q31 block trilinear map.  
+   * @param[in]  *S points to an instance of the Q31 trilinear map structure.  
+   * @param[in]  *pX points to the block of X coordinates in 12.20 format.  
+   * @param[in]  *pY points to the block of Y coordinates in 12.20 format.  
+   * @param[in]  *pZ points to the block of Z coordinates in 12.20 format.  
+   * @param[out] *pOut points to the block of interpolated values.  
+   * @param[in]  blockSize number of points to process.  
+   * @return none.  
+   */  
+  
+  void arm_trilinear_map_q31(  
+		      const arm_trilinear_map_instance_q31 * S,  
+		      q31_t * pX,  
+		      q31_t * pY,  
+		      q31_t * pZ,  
+		      q31_t * pOut,  
+		      uint32_t blockSize);  
+  
+  /**  
+   * @brief  Initialization function for the Q15 trilinear map.  
+   * @param[out] *S points to an instance of the Q15 trilinear map structure.  
+   * @param[in]  numX number of grid points along X, 2 to 2048.  
+   * @param[in]  numY number of grid points along Y, 2 to 2048.  
+   * @param[in]  numZ number of grid points along Z, 2 to 2048.  
+   * @param[in]  *pData points to the table of numX * numY * numZ values.  
+   * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.  
+   */  
+  
+  arm_status arm_trilinear_map_init_q15(  
+			arm_trilinear_map_instance_q15 * S,  
+			uint16_t numX,  
+			uint16_t numY,  
+			uint16_t numZ,  
+			const q15_t * pData);  
+  
+  /**  
+   * @brief  Q15 block trilinear map.  
+   * @param[in]  *S points to an instance of the Q15 trilinear map structure.  
+   * @param[in]  *pX points to the block of X coordinates in 12.20 format.  
+   * @param[in]  *pY points to the block of Y coordinates in 12.20 format.  
+   * @param[in]  *pZ points to the block of Z coordinates in 12.20 format.  
+   * @param[out] *pOut points to the block of interpolated values.  
+   * @param[in]  blockSize number of points to process.  
+   * @return none.  
+   */  
+  
+  void arm_trilinear_map_q15(  
+		      const arm_trilinear_map_instance_q15 * S,  
+		      q31_t * pX,  
+		      q31_t * pY,  
+		      q31_t * pZ,  
+		      q15_t * pOut,  
+		      uint32_t blockSize);  
+  
+  /**  
+   * @} end of InterpMap group  
+   */  
+
+  /**
+   * @brief Sizes of the state and scratch buffers taken by the initialization and processing functions.
+   *
+   * Each function returns the number of elements of the buffer type, the same length the
+   * instance structure documents for <code>pState</code>, so a buffer of
+   * <code>size * sizeof(type)</code> bytes can be taken from an <code>arm_dsp_arena</code>.
+   * The state sizes are the lengths cleared by the initialization functions.
+   */
+
+  /**
+   * @brief State buffer size of the floating-point FIR filter.
+   */
+  static INLINE uint32_t arm_fir_get_state_size_f32(
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numTaps + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the Q31 FIR filter.
+   */
+  static INLINE uint32_t arm_fir_get_state_size_q31(
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numTaps + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the Q15 FIR filter.
+   * The Q15 and Q7 initialization functions clear numTaps+blockSize samples.
+   */
+  static INLINE uint32_t arm_fir_get_state_size_q15(
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numTaps + blockSize);
+  }
+
+  /**
+   * @brief State buffer size of the Q7 FIR filter.
+   */
+  static INLINE uint32_t arm_fir_get_state_size_q7(
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numTaps + blockSize);
+  }
+
+  /**
+   * @brief State buffer size of the floating-point FIR decimator.
+   */
+  static INLINE uint32_t arm_fir_decimate_get_state_size_f32(
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numTaps + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the Q31 FIR decimator.
+   */
+  static INLINE uint32_t arm_fir_decimate_get_state_size_q31(
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numTaps + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the Q15 FIR decimator.
+   */
+  static INLINE uint32_t arm_fir_decimate_get_state_size_q15(
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numTaps + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the floating-point FIR interpolator.
+   * The interpolators keep numTaps/L samples per polyphase branch.
+   */
+  static INLINE uint32_t arm_fir_interpolate_get_state_size_f32(
+			uint8_t L,
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return (((uint32_t) numTaps / L) + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the Q31 FIR interpolator.
+   */
+  static INLINE uint32_t arm_fir_interpolate_get_state_size_q31(
+			uint8_t L,
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return (((uint32_t) numTaps / L) + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the Q15 FIR interpolator.
+   */
+  static INLINE uint32_t arm_fir_interpolate_get_state_size_q15(
+			uint8_t L,
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return (((uint32_t) numTaps / L) + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the floating-point FIR lattice filter.
+   */
+  static INLINE uint32_t arm_fir_lattice_get_state_size_f32(
+			uint16_t numStages)
+  {
+    return ((uint32_t) numStages);
+  }
+
+  /**
+   * @brief State buffer size of the Q31 FIR lattice filter.
+   */
+  static INLINE uint32_t arm_fir_lattice_get_state_size_q31(
+			uint16_t numStages)
+  {
+    return ((uint32_t) numStages);
+  }
+
+  /**
+   * @brief State buffer size of the Q15 FIR lattice filter.
+   */
+  static INLINE uint32_t arm_fir_lattice_get_state_size_q15(
+			uint16_t numStages)
+  {
+    return ((uint32_t) numStages);
+  }
+
+  /**
+   * @brief State buffer size of the floating-point IIR lattice filter.
+   */
+  static INLINE uint32_t arm_iir_lattice_get_state_size_f32(
+			uint16_t numStages,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numStages + blockSize);
+  }
+
+  /**
+   * @brief State buffer size of the Q31 IIR lattice filter.
+   */
+  static INLINE uint32_t arm_iir_lattice_get_state_size_q31(
+			uint16_t numStages,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numStages + blockSize);
+  }
+
+  /**
+   * @brief State buffer size of the Q15 IIR lattice filter.
+   */
+  static INLINE uint32_t arm_iir_lattice_get_state_size_q15(
+			uint16_t numStages,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numStages + blockSize);
+  }
+
+  /**
+   * @brief State buffer size of the floating-point sparse FIR filter.
+   */
+  static INLINE uint32_t arm_fir_sparse_get_state_size_f32(
+			uint16_t maxDelay,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) maxDelay + blockSize);
+  }
+
+  /**
+   * @brief State buffer size of the Q31 sparse FIR filter.
+   */
+  static INLINE uint32_t arm_fir_sparse_get_state_size_q31(
+			uint16_t maxDelay,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) maxDelay + blockSize);
+  }
+
+  /**
+   * @brief State buffer size of the Q15 sparse FIR filter.
+   */
+  static INLINE uint32_t arm_fir_sparse_get_state_size_q15(
+			uint16_t maxDelay,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) maxDelay + blockSize);
+  }
+
+  /**
+   * @brief State buffer size of the Q7 sparse FIR filter.
+   */
+  static INLINE uint32_t arm_fir_sparse_get_state_size_q7(
+			uint16_t maxDelay,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) maxDelay + blockSize);
+  }
+
+  /**
+   * @brief Scratch buffer size of the sparse FIR filter.
+   * <code>pScratchIn</code>, and for Q15 and Q7 also the q31_t <code>pScratchOut</code>, hold blockSize values each.
+   */
+  static INLINE uint32_t arm_fir_sparse_get_scratch_size(
+			uint32_t blockSize)
+  {
+    return (blockSize);
+  }
+
+  /**
+   * @brief State buffer size of the floating-point Biquad cascade filter.
+   */
+  static INLINE uint32_t arm_biquad_cascade_df1_get_state_size_f32(
+			uint8_t numStages)
+  {
+    return (4u * (uint32_t) numStages);
+  }
+
+  /**
+   * @brief State buffer size of the Q31 Biquad cascade filter.
+   */
+  static INLINE uint32_t arm_biquad_cascade_df1_get_state_size_q31(
+			uint8_t numStages)
+  {
+    return (4u * (uint32_t) numStages);
+  }
+
+  /**
+   * @brief State buffer size of the Q15 Biquad cascade filter.
+   */
+  static INLINE uint32_t arm_biquad_cascade_df1_get_state_size_q15(
+			uint8_t numStages)
+  {
+    return (4u * (uint32_t) numStages);
+  }
+
+  /**
+   * @brief State buffer size of the Q31 high precision Biquad cascade filter.
+   * Elements are q63_t.
+   */
+  static INLINE uint32_t arm_biquad_cas_df1_32x64_get_state_size_q31(
+			uint8_t numStages)
+  {
+    return (4u * (uint32_t) numStages);
+  }
+
+  /**
+   * @brief State buffer size of the floating-point Biquad cascade filter (direct form II transposed).
+   */
+  static INLINE uint32_t arm_biquad_cascade_df2T_get_state_size_f32(
+			uint8_t numStages)
+  {
+    return (2u * (uint32_t) numStages);
+  }
+
+  /**
+   * @brief State buffer size of the floating-point LMS filter.
+   */
+  static INLINE uint32_t arm_lms_get_state_size_f32(
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numTaps + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the Q31 LMS filter.
+   */
+  static INLINE uint32_t arm_lms_get_state_size_q31(
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numTaps + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the Q15 LMS filter.
+   */
+  static INLINE uint32_t arm_lms_get_state_size_q15(
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numTaps + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the floating-point normalized LMS filter.
+   */
+  static INLINE uint32_t arm_lms_norm_get_state_size_f32(
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numTaps + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the Q31 normalized LMS filter.
+   */
+  static INLINE uint32_t arm_lms_norm_get_state_size_q31(
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numTaps + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the Q15 normalized LMS filter.
+   */
+  static INLINE uint32_t arm_lms_norm_get_state_size_q15(
+			uint16_t numTaps,
+			uint32_t blockSize)
+  {
+    return ((uint32_t) numTaps + blockSize - 1u);
+  }
+
+  /**
+   * @brief State buffer size of the floating-point PID controller bank.
+   */
+  static INLINE uint32_t arm_pid_bank_get_state_size_f32(
+			uint16_t numCtrl)
+  {
+    return (3u * (uint32_t) numCtrl);
+  }
+
+  /**
+   * @brief State buffer size of the Q31 PID controller bank.
+   */
+  static INLINE uint32_t arm_pid_bank_get_state_size_q31(
+			uint16_t numCtrl)
+  {
+    return (3u * (uint32_t) numCtrl);
+  }
+
+  /**
+   * @brief State buffer size of the running median filter.
+   * <code>pData</code> holds windowLen samples, <code>pPos</code> and <code>pHeap</code> windowLen int16_t values each.
+   */
+  static INLINE uint32_t arm_median_filter_get_state_size(
+			uint16_t windowLen)
+  {
+    return ((uint32_t) windowLen);
+  }
+
+  /**
+   * @brief State buffer size of the sliding window statistics.
+   * <code>pHistory</code> holds windowLen samples, <code>pMinQueue</code> and <code>pMaxQueue</code> windowLen uint16_t values each.
+   */
+  static INLINE uint32_t arm_sliding_stats_get_state_size(
+			uint16_t windowLen)
+  {
+    return ((uint32_t) windowLen);
+  }
+
+  /**
+   * @brief Scratch buffer size of the Q15 convolution and correlation.
+   * <code>pScratch1</code> of arm_conv_q15(), arm_conv_fast_q15(), arm_conv_q7(), their partial variants
+   * and arm_correlate_q7(), and <code>pScratch</code> of arm_correlate_q15() and arm_correlate_fast_q15().
+   */
+  static INLINE uint32_t arm_conv_get_scratch_size_q15(
+			uint32_t srcALen,
+			uint32_t srcBLen)
+  {
+    uint32_t maxLen = (srcALen > srcBLen) ? srcALen : srcBLen;
+    uint32_t minLen = (srcALen > srcBLen) ? srcBLen : srcALen;
+
+    return (maxLen + 2u * minLen - 2u);
+  }
+
+  /**
+   * @brief Second scratch buffer size of the Q15 convolution and correlation.
+   * <code>pScratch2</code> of the same functions.
+   */
+  static INLINE uint32_t arm_conv_get_scratch2_size_q15(
+			uint32_t srcALen,
+			uint32_t srcBLen)
+  {
+    return ((srcALen > srcBLen) ? srcBLen : srcALen);
+  }
+
+  /**
+   * @brief Scratch buffer size of the Q15 matrix multiplication.
+   * The buffer holds the transpose of B.
+   */
+  static INLINE uint32_t arm_mat_mult_get_scratch_size_q15(
+			uint16_t numRowsB,
+			uint16_t numColsB)
+  {
+    return ((uint32_t) numRowsB * numColsB);
+  }
+
+  /**
+   * @brief Scratch buffer size of the Q15 complex matrix multiplication.
+   */
+  static INLINE uint32_t arm_mat_cmplx_mult_get_scratch_size_q15(
+			uint16_t numRowsB,
+			uint16_t numColsB)
+  {
+    return (2u * (uint32_t) numRowsB * numColsB);
+  }
+
+  /**
+   * @brief Scratch buffer size of the 2-D CFFT.
+   */
+  static INLINE uint32_t arm_cfft2d_get_scratch_size(
+			uint16_t numRows,
+			uint16_t numCols)
+  {
+    return (2u * (uint32_t) numRows * numCols);
+  }
+
+  /**
+   * @brief FFT length of one dimension of the 2-D convolution.
+   * FFT size used by the 2-D convolution for one output dimension, zero if there is none.
+   */
+  static INLINE uint32_t arm_conv2d_get_fft_len(
+			uint32_t outLen)
+  {
+    uint32_t fftLen = 16u;
+
+    while((fftLen < outLen) && (fftLen < 1024u))
+    {
+      fftLen <<= 2u;
+    }
+
+    return ((fftLen < outLen) ? 0u : fftLen);
+  }
+
+  /**
+   * @brief Kernel spectrum buffer size of the floating-point 2-D convolution.
+   * Kernel spectrum buffer pKerFft, zero if the output is too large for the FFT path.
+   */
+  static INLINE uint32_t arm_conv2d_get_kernel_fft_size_f32(
+			uint16_t srcRows,
+			uint16_t srcCols,
+			uint16_t kerRows,
+			uint16_t kerCols)
+  {
+    return (2u * arm_conv2d_get_fft_len((uint32_t) srcRows + kerRows - 1u) *
+            arm_conv2d_get_fft_len((uint32_t) srcCols + kerCols - 1u));
+  }
+
+  /**
+   * @brief Scratch buffer size of the floating-point 2-D convolution.
+   * FftEnable is nonzero when a kernel spectrum buffer is passed to arm_conv2d_init_f32().
+   */
+  static INLINE uint32_t arm_conv2d_get_scratch_size_f32(
+			uint16_t srcRows,
+			uint16_t srcCols,
+			uint16_t kerRows,
+			uint16_t kerCols,
+			uint8_t fftEnable)
+  {
+    uint32_t size = (uint32_t) srcRows * ((uint32_t) srcCols + kerCols - 1u);
+    uint32_t fftSize = 2u * arm_conv2d_get_kernel_fft_size_f32(srcRows, srcCols,
+                                                                kerRows, kerCols);
+
+    return (((fftEnable != 0u) && (fftSize > size)) ? fftSize : size);
+  }
+
+  /**
+   * @brief Workspace size of the floating-point Kalman filter.
+   */
+  static INLINE uint32_t arm_kalman_get_scratch_size_f32(
+			uint16_t numStates,
+			uint16_t numMeas,
+			arm_kalman_method method)
+  {
+    uint32_t n = numStates;
+    uint32_t m = numMeas;
+    uint32_t size;
+
+    if(method == ARM_KALMAN_JOSEPH)
+    {
+      size = 2u * n * n + 2u * n * m + 2u * m * m + m;
+    }
+    else if(method == ARM_KALMAN_SEQUENTIAL)
+    {
+      size = n * n + 2u * n;
+    }
+    else
+    {
+      size = 2u * n * n + 3u * n;
+    }
+
+    return (size);
+  }
+
+  /**
+   * @brief Memory regions of a DSP arena.
+   */
+
+  typedef enum
+    {
+      ARM_DSP_ARENA_TCM = 0,             /**< tightly coupled memory */
+      ARM_DSP_ARENA_SRAM = 1,            /**< system RAM */
+      ARM_DSP_ARENA_ANY = 2              /**< TCM if the request fits there, SRAM otherwise */
+    } arm_dsp_arena_region;
+
+  /**
+   * @brief Number of memory regions of a DSP arena.
+   */
+
+#define ARM_DSP_ARENA_NUM_REGIONS	2u
+
+  /**
+   * @brief Default alignment of arena allocations, the Cortex-R4/R5 cache line size in bytes.
+   */
+
+#define ARM_DSP_ARENA_ALIGN			32u
+
+  /**
+   * @brief One memory region of a DSP arena.
+   */
+
+  typedef struct
+  {
+    uint8_t *pBase;              /**< points to the start of the region, NULL if the region is not used. */
+    uint32_t size;               /**< size of the region in bytes. */
+    uint32_t used;               /**< bytes taken by persistent allocations at the bottom of the region. */
+    uint32_t scratchSize;        /**< bytes reserved for shared scratch at the top of the region. */
+    uint32_t scratchUsed;        /**< bytes taken by the current scratch group. */
+  } arm_dsp_arena_pool;
+
+  /**
+   * @brief Instance structure for the DSP arena allocator.
+   */
+
+  typedef struct
+  {
+    arm_dsp_arena_pool pool[ARM_DSP_ARENA_NUM_REGIONS];   /**< TCM and SRAM regions. */
+  } arm_dsp_arena;
+
+  /**
+   * @brief  Initialization function for the DSP arena allocator.
+   * @param[out] *A points to an instance of the DSP arena structure.
+   * @param[in]  *pTcm points to the TCM region, or NULL.
+   * @param[in]  tcmSize size of the TCM region in bytes.
+   * @param[in]  *pSram points to the SRAM region, or NULL.
+   * @param[in]  sramSize size of the SRAM region in bytes.
+   * @return none.
+   */
+
+  void arm_dsp_arena_init(
+			  arm_dsp_arena * A,
+			  void *pTcm,
+			  uint32_t tcmSize,
+			  void *pSram,
+			  uint32_t sramSize);
+
+  /**
+   * @brief  Persistent allocation from a DSP arena.
+   * @param[in,out] *A points to an instance of the DSP arena structure.
+   * @param[in]     region region to allocate from.
+   * @param[in]     size number of bytes.
+   * @param[in]     align alignment in bytes, a power of two, or 0 for ARM_DSP_ARENA_ALIGN.
+   * @return pointer to the block, or NULL if the region is full.
+   */
+
+  void *arm_dsp_arena_alloc(
+			    arm_dsp_arena * A,
+			    arm_dsp_arena_region region,
+			    uint32_t size,
+			    uint32_t align);
+
+  /**
+   * @brief  Starts a scratch group of a DSP arena.
+   * @param[in,out] *A points to an instance of the DSP arena structure.
+   * @param[in]     region region of the group, ARM_DSP_ARENA_ANY for both.
+   * @return none.
+   */
+
+  void arm_dsp_arena_scratch_begin(
+				   arm_dsp_arena * A,
+				   arm_dsp_arena_region region);
+
+  /**
+   * @brief  Scratch allocation from a DSP arena.
+   * @param[in,out] *A points to an instance of the DSP arena structure.
+   * @param[in]     region region to allocate from.
+   * @param[in]     size number of bytes.
+   * @param[in]     align alignment in bytes, a power of two, or 0 for ARM_DSP_ARENA_ALIGN.
+   * @return pointer to the block, or NULL if the region is full.
+   */
+
+  void *arm_dsp_arena_scratch_alloc(
+				    arm_dsp_arena * A,
+				    arm_dsp_arena_region region,
+				    uint32_t size,
+				    uint32_t align);
+
+  /**
+   * @brief  Memory taken from a DSP arena.
+   * @param[in] *A points to an instance of the DSP arena structure.
+   * @param[in] region region to report, ARM_DSP_ARENA_ANY for the total.
+   * @return number of bytes taken by persistent allocations and the shared scratch.
+   */
+
+  uint32_t arm_dsp_arena_get_usage(
+				   const arm_dsp_arena * A,
+				   arm_dsp_arena_region region);
+
+  
   
   
   
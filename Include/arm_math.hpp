@@ -0,0 +1,1325 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_math.hpp
+*
+* Description:	C++ fixed-point types and templated kernels over the Cortex-R DSP Library
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#ifndef _ARM_MATH_HPP
+#define _ARM_MATH_HPP
+
+#include "arm_math.h"
+
+/**
+ * @defgroup cpp_fixed C++ Fixed-Point Types and Kernels
+ *
+ * Header-only C++ layer over the C library.  It adds a fixed-point value type whose
+ * format and arithmetic behaviour are template parameters, and templated kernels
+ * that are resolved at compile time either to the existing C kernel or to a loop
+ * specialized for the format.
+ *
+ * \par Fixed-point type
+ * <code>arm::fixed<I, F, Storage, Overflow, Rounding></code> holds a two's complement
+ * value in I.F format in a <code>q7_t</code>, <code>q15_t</code> or <code>q31_t</code>.
+ * As in the rest of the library, the integer part counts the sign bit, so 1.15 is
+ * <code>fixed<1, 15, q15_t></code> and <code>I + F</code> must equal the width of
+ * <code>Storage</code>; a mismatch does not compile.
+ * <code>Overflow</code> is <code>arm::saturate</code> (default) or <code>arm::wrap</code>,
+ * <code>Rounding</code> is <code>arm::truncate</code> (default) or <code>arm::round_nearest</code>.
+ * The policies are empty tag types, so the choice costs no storage and no run-time test.
+ * The types <code>arm::q7</code>, <code>arm::q15</code> and <code>arm::q31</code> are the
+ * library formats 1.7, 1.15 and 1.31.
+ *
+ * \par Kernel dispatch
+ * A kernel call is forwarded to the C function when the C function computes exactly
+ * what the template asks for; otherwise a generic loop is instantiated for the format:
+ * <pre>
+ *    add, sub, negate, abs, offset   any I.F, saturate                        arm_add_q15 ...
+ *    mult                            1.7 / 1.15, saturate, truncate           arm_mult_q15 ...
+ *    scale                           any I.F, saturate, truncate              arm_scale_q15 ...
+ *    dot_prod                        any I.F                                  arm_dot_prod_q15 ...
+ *    fir                             1.x coefficients, truncate, q7/q15       arm_fir_q15 ...
+ *                                    saturate or q31 wrap
+ *    biquad_cascade                  coefficients in sample storage,          arm_biquad_cascade_df1_q15 ...
+ *                                    truncate, q15 saturate or q31 wrap
+ * </pre>
+ * <code>float32_t</code> buffers are always forwarded to the <code>_f32</code> function.
+ * The fixed types have the size and layout of their storage type and the wrappers are
+ * inline, so a forwarded call compiles to the same code as calling the C function directly.
+ *
+ * \par
+ * The header only uses C++03 so that it builds with the same compilers as the C library.
+ */
+
+/**
+ * @addtogroup cpp_fixed
+ * @{
+ */
+
+namespace arm
+{
+
+  /** @brief Overflow policy: results are clipped to the range of the format. */
+  struct saturate
+  {
+  };
+
+  /** @brief Overflow policy: results wrap around modulo the storage width. */
+  struct wrap
+  {
+  };
+
+  /** @brief Rounding policy: discarded fraction bits are dropped (round towards minus infinity). */
+  struct truncate
+  {
+  };
+
+  /** @brief Rounding policy: results are rounded to the nearest representable value. */
+  struct round_nearest
+  {
+  };
+
+  namespace detail
+  {
+
+    /* Compile-time condition check: only the true case is defined. */
+    template < bool Condition > struct static_check;
+    template <> struct static_check < true >
+    {
+      enum
+      { value = 1 };
+    };
+
+    template < bool B > struct bool_
+    {
+    };
+
+    template < typename A, typename B > struct is_same
+    {
+      enum
+      { value = 0 };
+    };
+
+    template < typename A > struct is_same <A, A >
+    {
+      enum
+      { value = 1 };
+    };
+
+    /* Storage type properties: width, wide type used for intermediates,
+     * and the accumulator used by the C dot product. */
+    template < typename Storage > struct storage_traits;
+
+    template <> struct storage_traits < q7_t >
+    {
+      typedef q31_t wide_t;
+      typedef q31_t dot_t;
+      enum
+      { bits = 8, dot_shift = 0 };
+      static q7_t max_raw()
+      {
+        return (q7_t) 0x7F;
+      }
+      static q7_t min_raw()
+      {
+        return (q7_t) 0x80;
+      }
+    };
+
+    template <> struct storage_traits < q15_t >
+    {
+      typedef q31_t wide_t;
+      typedef q63_t dot_t;
+      enum
+      { bits = 16, dot_shift = 0 };
+      static q15_t max_raw()
+      {
+        return (q15_t) 0x7FFF;
+      }
+      static q15_t min_raw()
+      {
+        return (q15_t) 0x8000;
+      }
+    };
+
+    template <> struct storage_traits < q31_t >
+    {
+      typedef q63_t wide_t;
+      typedef q63_t dot_t;
+      enum
+      { bits = 32, dot_shift = 14 };
+      static q31_t max_raw()
+      {
+        return (q31_t) 0x7FFFFFFF;
+      }
+      static q31_t min_raw()
+      {
+        return (q31_t) 0x80000000;
+      }
+    };
+
+    /* Narrow a wide intermediate to the storage type. */
+    template < typename Storage, typename Wide >
+      inline Storage narrow(Wide x, saturate)
+    {
+      return (x > (Wide) storage_traits < Storage >::max_raw())? storage_traits <
+        Storage >::max_raw() : (x < (Wide) storage_traits < Storage >::min_raw())?
+        storage_traits < Storage >::min_raw() : (Storage) x;
+    }
+
+    template < typename Storage, typename Wide >
+      inline Storage narrow(Wide x, wrap)
+    {
+      return (Storage) x;
+    }
+
+    /* Multiply by 2^-shift.  shift is a compile-time constant at every call site,
+     * so the branches fold away. */
+    template < typename Wide > inline Wide rescale(Wide x, int shift, truncate)
+    {
+      return (shift > 0) ? (x >> shift) : (x * ((Wide) 1 << -shift));
+    }
+
+    template < typename Wide >
+      inline Wide rescale(Wide x, int shift, round_nearest)
+    {
+      return (shift > 0) ? ((x + ((Wide) 1 << (shift - 1))) >> shift) :
+        (x * ((Wide) 1 << -shift));
+    }
+
+    /* 2^F as a float constant. */
+    template < int F > struct pow2
+    {
+      static float32_t value()
+      {
+        return (float32_t) ((q63_t) 1 << F);
+      }
+    };
+
+    inline float32_t round_float(float32_t x, truncate)
+    {
+      return x;
+    }
+
+    inline float32_t round_float(float32_t x, round_nearest)
+    {
+      return (x > 0.0f) ? (x + 0.5f) : (x - 0.5f);
+    }
+
+  }                             /* namespace detail */
+
+  /**
+   * @brief Fixed-point value in I.F format.
+   * @tparam I         integer bits, including the sign bit.
+   * @tparam F         fraction bits.
+   * @tparam Storage   <code>q7_t</code>, <code>q15_t</code> or <code>q31_t</code>.
+   * @tparam Overflow  <code>saturate</code> or <code>wrap</code>.
+   * @tparam Rounding  <code>truncate</code> or <code>round_nearest</code>.
+   *
+   * The default constructor leaves the value uninitialized, like the built-in types,
+   * so arrays of <code>fixed</code> cost nothing to declare.  Conversion from float
+   * always saturates, whatever the overflow policy.
+   */
+  template < int I, int F, typename Storage = q31_t,
+    typename Overflow = saturate, typename Rounding = truncate > class fixed
+  {
+  public:
+    typedef Storage storage_type;
+    typedef typename detail::storage_traits < Storage >::wide_t wide_type;
+    typedef Overflow overflow_policy;
+    typedef Rounding rounding_policy;
+
+    enum
+    { int_bits = I, frac_bits = F, check_format =
+        detail::static_check < (I + F ==
+                                detail::storage_traits < Storage >::bits) &&
+        (I >= 1) && (F >= 0) >::value };
+
+    fixed()
+    {
+    }
+
+    explicit fixed(float32_t x)
+    {
+      float32_t in = detail::round_float(x * detail::pow2 < F >::value(),
+                                         Rounding());
+
+      if(in >= (float32_t) detail::storage_traits < Storage >::max_raw())
+      {
+        v = detail::storage_traits < Storage >::max_raw();
+      }
+      else if(in <= (float32_t) detail::storage_traits < Storage >::min_raw())
+      {
+        v = detail::storage_traits < Storage >::min_raw();
+      }
+      else
+      {
+        v = (Storage) in;
+      }
+    }
+
+    /** @brief Builds a value from its raw two's complement representation. */
+    static fixed from_raw(Storage raw)
+    {
+      fixed x;
+      x.v = raw;
+      return x;
+    }
+
+    /** @brief Returns the raw two's complement representation. */
+    Storage raw() const
+    {
+      return v;
+    }
+
+    /** @brief Converts to floating-point. */
+    float32_t to_float() const
+    {
+      return (float32_t) v * (1.0f / detail::pow2 < F >::value());
+    }
+
+    fixed operator+(fixed b) const
+    {
+      return from_raw(detail::narrow < Storage > ((wide_type) v + b.v,
+                                                  Overflow()));
+    }
+
+    fixed operator-(fixed b) const
+    {
+      return from_raw(detail::narrow < Storage > ((wide_type) v - b.v,
+                                                  Overflow()));
+    }
+
+    fixed operator-() const
+    {
+      return from_raw(detail::narrow < Storage > (-(wide_type) v, Overflow()));
+    }
+
+    /** Product in the same format: the double-width product is rescaled by F bits. */
+    fixed operator*(fixed b) const
+    {
+      return from_raw(detail::narrow < Storage >
+                      (detail::rescale((wide_type) v * b.v, F, Rounding()),
+                       Overflow()));
+    }
+
+    fixed & operator+=(fixed b)
+    {
+      return *this = *this + b;
+    }
+
+    fixed & operator-=(fixed b)
+    {
+      return *this = *this - b;
+    }
+
+    fixed & operator*=(fixed b)
+    {
+      return *this = *this * b;
+    }
+
+    bool operator==(fixed b) const
+    {
+      return v == b.v;
+    }
+
+    bool operator!=(fixed b) const
+    {
+      return v != b.v;
+    }
+
+    bool operator<(fixed b) const
+    {
+      return v < b.v;
+    }
+
+    bool operator>(fixed b) const
+    {
+      return v > b.v;
+    }
+
+    bool operator<=(fixed b) const
+    {
+      return v <= b.v;
+    }
+
+    bool operator>=(fixed b) const
+    {
+      return v >= b.v;
+    }
+
+  private:
+    Storage v;
+  };
+
+  /** @brief Q7 (1.7) value. */
+  typedef fixed < 1, 7, q7_t > q7;
+
+  /** @brief Q15 (1.15) value. */
+  typedef fixed < 1, 15, q15_t > q15;
+
+  /** @brief Q31 (1.31) value. */
+  typedef fixed < 1, 31, q31_t > q31;
+
+  /**
+   * @brief Converts between fixed-point formats using the policies of the destination type.
+   * @code
+   *    arm::fixed<4, 12, q15_t> y = arm::fixed_cast< arm::fixed<4, 12, q15_t> >(x);
+   * @endcode
+   */
+  template < typename To, int I, int F, typename Storage, typename Overflow,
+    typename Rounding >
+    inline To fixed_cast(fixed < I, F, Storage, Overflow, Rounding > x)
+  {
+    return To::from_raw(detail::narrow < typename To::storage_type >
+                        (detail::rescale((q63_t) x.raw(), F - To::frac_bits,
+                                         typename To::rounding_policy()),
+                         typename To::overflow_policy()));
+  }
+
+  namespace detail
+  {
+
+    /* Raw views of fixed-point buffers.  The C kernels take non-const pointers
+     * even for inputs, so constness is dropped here. */
+    template < int I, int F, typename Storage, typename Overflow,
+      typename Rounding >
+      inline Storage * raw(const fixed < I, F, Storage, Overflow,
+                           Rounding > *p)
+    {
+      enum
+      { check_layout =
+          static_check < sizeof(fixed < I, F, Storage, Overflow, Rounding >) ==
+          sizeof(Storage) >::value };
+
+      return reinterpret_cast < Storage * >(const_cast < fixed < I, F, Storage,
+                                            Overflow, Rounding > *>(p));
+    }
+
+    /* C kernels by storage type. */
+    template < typename Storage > struct kernels;
+
+    template <> struct kernels < q7_t >
+    {
+      typedef arm_fir_instance_q7 fir_instance;
+      typedef saturate fir_overflow;
+      /* There is no Q7 biquad, so no overflow policy selects a C kernel. */
+      typedef void biquad_overflow;
+
+      static void add(q7_t * a, q7_t * b, q7_t * d, uint32_t n)
+      {
+        arm_add_q7(a, b, d, n);
+      }
+      static void sub(q7_t * a, q7_t * b, q7_t * d, uint32_t n)
+      {
+        arm_sub_q7(a, b, d, n);
+      }
+      static void mult(q7_t * a, q7_t * b, q7_t * d, uint32_t n)
+      {
+        arm_mult_q7(a, b, d, n);
+      }
+      static void negate(q7_t * a, q7_t * d, uint32_t n)
+      {
+        arm_negate_q7(a, d, n);
+      }
+      static void abs(q7_t * a, q7_t * d, uint32_t n)
+      {
+        arm_abs_q7(a, d, n);
+      }
+      static void offset(q7_t * a, q7_t k, q7_t * d, uint32_t n)
+      {
+        arm_offset_q7(a, k, d, n);
+      }
+      static void scale(q7_t * a, q7_t k, int8_t shift, q7_t * d, uint32_t n)
+      {
+        arm_scale_q7(a, k, shift, d, n);
+      }
+      static q31_t dot_prod(q7_t * a, q7_t * b, uint32_t n)
+      {
+        q31_t result;
+        arm_dot_prod_q7(a, b, n, &result);
+        return result;
+      }
+      static void fir_init(fir_instance * S, uint16_t numTaps, q7_t * pCoeffs,
+                           q7_t * pState, uint32_t blockSize)
+      {
+        arm_fir_init_q7(S, numTaps, pCoeffs, pState, blockSize);
+      }
+      static void fir(const fir_instance * S, q7_t * pSrc, q7_t * pDst,
+                      uint32_t blockSize)
+      {
+        arm_fir_q7(S, pSrc, pDst, blockSize);
+      }
+    };
+
+    template <> struct kernels < q15_t >
+    {
+      typedef arm_fir_instance_q15 fir_instance;
+      typedef arm_biquad_casd_df1_inst_q15 biquad_instance;
+      typedef saturate fir_overflow;
+      typedef saturate biquad_overflow;
+      enum
+      { biquad_coeffs = 6 };
+
+      static void add(q15_t * a, q15_t * b, q15_t * d, uint32_t n)
+      {
+        arm_add_q15(a, b, d, n);
+      }
+      static void sub(q15_t * a, q15_t * b, q15_t * d, uint32_t n)
+      {
+        arm_sub_q15(a, b, d, n);
+      }
+      static void mult(q15_t * a, q15_t * b, q15_t * d, uint32_t n)
+      {
+        arm_mult_q15(a, b, d, n);
+      }
+      static void negate(q15_t * a, q15_t * d, uint32_t n)
+      {
+        arm_negate_q15(a, d, n);
+      }
+      static void abs(q15_t * a, q15_t * d, uint32_t n)
+      {
+        arm_abs_q15(a, d, n);
+      }
+      static void offset(q15_t * a, q15_t k, q15_t * d, uint32_t n)
+      {
+        arm_offset_q15(a, k, d, n);
+      }
+      static void scale(q15_t * a, q15_t k, int8_t shift, q15_t * d,
+                        uint32_t n)
+      {
+        arm_scale_q15(a, k, shift, d, n);
+      }
+      static q63_t dot_prod(q15_t * a, q15_t * b, uint32_t n)
+      {
+        q63_t result;
+        arm_dot_prod_q15(a, b, n, &result);
+        return result;
+      }
+      static void fir_init(fir_instance * S, uint16_t numTaps,
+                           q15_t * pCoeffs, q15_t * pState, uint32_t blockSize)
+      {
+        (void) arm_fir_init_q15(S, numTaps, pCoeffs, pState, blockSize);
+      }
+      static void fir(const fir_instance * S, q15_t * pSrc, q15_t * pDst,
+                      uint32_t blockSize)
+      {
+        arm_fir_q15(S, pSrc, pDst, blockSize);
+      }
+      /* The Q15 biquad expects {b0, 0, b1, b2, a1, a2} per stage. */
+      static void biquad_coeff_layout(const q15_t * pSrc, q15_t * pDst)
+      {
+        pDst[0] = pSrc[0];
+        pDst[1] = 0;
+        pDst[2] = pSrc[1];
+        pDst[3] = pSrc[2];
+        pDst[4] = pSrc[3];
+        pDst[5] = pSrc[4];
+      }
+      static void biquad_init(biquad_instance * S, uint8_t numStages,
+                              q15_t * pCoeffs, q15_t * pState,
+                              int8_t postShift)
+      {
+        arm_biquad_cascade_df1_init_q15(S, numStages, pCoeffs, pState,
+                                        postShift);
+      }
+      static void biquad(const biquad_instance * S, q15_t * pSrc,
+                         q15_t * pDst, uint32_t blockSize)
+      {
+        arm_biquad_cascade_df1_q15(S, pSrc, pDst, blockSize);
+      }
+    };
+
+    template <> struct kernels < q31_t >
+    {
+      typedef arm_fir_instance_q31 fir_instance;
+      typedef arm_biquad_casd_df1_inst_q31 biquad_instance;
+      typedef wrap fir_overflow;
+      typedef wrap biquad_overflow;
+      enum
+      { biquad_coeffs = 5 };
+
+      static void add(q31_t * a, q31_t * b, q31_t * d, uint32_t n)
+      {
+        arm_add_q31(a, b, d, n);
+      }
+      static void sub(q31_t * a, q31_t * b, q31_t * d, uint32_t n)
+      {
+        arm_sub_q31(a, b, d, n);
+      }
+      static void negate(q31_t * a, q31_t * d, uint32_t n)
+      {
+        arm_negate_q31(a, d, n);
+      }
+      static void abs(q31_t * a, q31_t * d, uint32_t n)
+      {
+        arm_abs_q31(a, d, n);
+      }
+      static void offset(q31_t * a, q31_t k, q31_t * d, uint32_t n)
+      {
+        arm_offset_q31(a, k, d, n);
+      }
+      static void scale(q31_t * a, q31_t k, int8_t shift, q31_t * d,
+                        uint32_t n)
+      {
+        arm_scale_q31(a, k, shift, d, n);
+      }
+      static q63_t dot_prod(q31_t * a, q31_t * b, uint32_t n)
+      {
+        q63_t result;
+        arm_dot_prod_q31(a, b, n, &result);
+        return result;
+      }
+      static void fir_init(fir_instance * S, uint16_t numTaps,
+                           q31_t * pCoeffs, q31_t * pState, uint32_t blockSize)
+      {
+        arm_fir_init_q31(S, numTaps, pCoeffs, pState, blockSize);
+      }
+      static void fir(const fir_instance * S, q31_t * pSrc, q31_t * pDst,
+                      uint32_t blockSize)
+      {
+        arm_fir_q31(S, pSrc, pDst, blockSize);
+      }
+      static void biquad_coeff_layout(const q31_t * pSrc, q31_t * pDst)
+      {
+        pDst[0] = pSrc[0];
+        pDst[1] = pSrc[1];
+        pDst[2] = pSrc[2];
+        pDst[3] = pSrc[3];
+        pDst[4] = pSrc[4];
+      }
+      static void biquad_init(biquad_instance * S, uint8_t numStages,
+                              q31_t * pCoeffs, q31_t * pState,
+                              int8_t postShift)
+      {
+        arm_biquad_cascade_df1_init_q31(S, numStages, pCoeffs, pState,
+                                        postShift);
+      }
+      static void biquad(const biquad_instance * S, q31_t * pSrc,
+                         q31_t * pDst, uint32_t blockSize)
+      {
+        arm_biquad_cascade_df1_q31(S, pSrc, pDst, blockSize);
+      }
+    };
+
+    /* Element-wise kernels: C path and generic path. */
+    template < typename T >
+      inline void add(const T * pSrcA, const T * pSrcB, T * pDst,
+                      uint32_t blockSize, bool_ < true >)
+    {
+      kernels < typename T::storage_type >::add(raw(pSrcA), raw(pSrcB),
+                                                raw(pDst), blockSize);
+    }
+
+    template < typename T >
+      inline void add(const T * pSrcA, const T * pSrcB, T * pDst,
+                      uint32_t blockSize, bool_ < false >)
+    {
+      while(blockSize > 0u)
+      {
+        *pDst++ = *pSrcA++ + *pSrcB++;
+        blockSize--;
+      }
+    }
+
+    template < typename T >
+      inline void sub(const T * pSrcA, const T * pSrcB, T * pDst,
+                      uint32_t blockSize, bool_ < true >)
+    {
+      kernels < typename T::storage_type >::sub(raw(pSrcA), raw(pSrcB),
+                                                raw(pDst), blockSize);
+    }
+
+    template < typename T >
+      inline void sub(const T * pSrcA, const T * pSrcB, T * pDst,
+                      uint32_t blockSize, bool_ < false >)
+    {
+      while(blockSize > 0u)
+      {
+        *pDst++ = *pSrcA++ - *pSrcB++;
+        blockSize--;
+      }
+    }
+
+    template < typename T >
+      inline void mult(const T * pSrcA, const T * pSrcB, T * pDst,
+                       uint32_t blockSize, bool_ < true >)
+    {
+      kernels < typename T::storage_type >::mult(raw(pSrcA), raw(pSrcB),
+                                                 raw(pDst), blockSize);
+    }
+
+    template < typename T >
+      inline void mult(const T * pSrcA, const T * pSrcB, T * pDst,
+                       uint32_t blockSize, bool_ < false >)
+    {
+      while(blockSize > 0u)
+      {
+        *pDst++ = *pSrcA++ * *pSrcB++;
+        blockSize--;
+      }
+    }
+
+    template < typename T >
+      inline void negate(const T * pSrc, T * pDst, uint32_t blockSize,
+                         bool_ < true >)
+    {
+      kernels < typename T::storage_type >::negate(raw(pSrc), raw(pDst),
+                                                   blockSize);
+    }
+
+    template < typename T >
+      inline void negate(const T * pSrc, T * pDst, uint32_t blockSize,
+                         bool_ < false >)
+    {
+      while(blockSize > 0u)
+      {
+        *pDst++ = -*pSrc++;
+        blockSize--;
+      }
+    }
+
+    template < typename T >
+      inline void abs(const T * pSrc, T * pDst, uint32_t blockSize,
+                      bool_ < true >)
+    {
+      kernels < typename T::storage_type >::abs(raw(pSrc), raw(pDst),
+                                                blockSize);
+    }
+
+    template < typename T >
+      inline void abs(const T * pSrc, T * pDst, uint32_t blockSize,
+                      bool_ < false >)
+    {
+      while(blockSize > 0u)
+      {
+        *pDst = (pSrc->raw() < 0) ? -*pSrc : *pSrc;
+        pSrc++;
+        pDst++;
+        blockSize--;
+      }
+    }
+
+    template < typename T >
+      inline void offset(const T * pSrc, T k, T * pDst, uint32_t blockSize,
+                         bool_ < true >)
+    {
+      kernels < typename T::storage_type >::offset(raw(pSrc), k.raw(),
+                                                   raw(pDst), blockSize);
+    }
+
+    template < typename T >
+      inline void offset(const T * pSrc, T k, T * pDst, uint32_t blockSize,
+                         bool_ < false >)
+    {
+      while(blockSize > 0u)
+      {
+        *pDst++ = *pSrc++ + k;
+        blockSize--;
+      }
+    }
+
+    template < typename T, typename K >
+      inline void scale(const T * pSrc, K k, T * pDst, uint32_t blockSize,
+                        bool_ < true >)
+    {
+      kernels < typename T::storage_type >::scale(raw(pSrc), k.raw(),
+                                                  (int8_t) (storage_traits <
+                                                            typename
+                                                            T::storage_type >::
+                                                            bits - 1 -
+                                                            K::frac_bits),
+                                                  raw(pDst), blockSize);
+    }
+
+    template < typename T, typename K >
+      inline void scale(const T * pSrc, K k, T * pDst, uint32_t blockSize,
+                        bool_ < false >)
+    {
+      typedef typename T::storage_type S;
+      typedef typename T::wide_type W;
+
+      while(blockSize > 0u)
+      {
+        *pDst++ = T::from_raw(narrow < S > (rescale((W) (pSrc++)->raw() *
+                                                    k.raw(), K::frac_bits,
+                                                    typename
+                                                    T::rounding_policy()),
+                                            typename T::overflow_policy()));
+        blockSize--;
+      }
+    }
+
+  }                             /* namespace detail */
+
+  /**
+   * @brief Element-wise addition <code>pDst[n] = pSrcA[n] + pSrcB[n]</code>.
+   * Saturating formats of any I.F use <code>arm_add_q7/q15/q31()</code>.
+   */
+  template < int I, int F, typename S, typename O, typename R >
+    inline void add(const fixed < I, F, S, O, R > *pSrcA,
+                    const fixed < I, F, S, O, R > *pSrcB,
+                    fixed < I, F, S, O, R > *pDst, uint32_t blockSize)
+  {
+    detail::add(pSrcA, pSrcB, pDst, blockSize,
+                detail::bool_ < detail::is_same < O, saturate >::value > ());
+  }
+
+  /**
+   * @brief Element-wise subtraction <code>pDst[n] = pSrcA[n] - pSrcB[n]</code>.
+   * Saturating formats of any I.F use <code>arm_sub_q7/q15/q31()</code>.
+   */
+  template < int I, int F, typename S, typename O, typename R >
+    inline void sub(const fixed < I, F, S, O, R > *pSrcA,
+                    const fixed < I, F, S, O, R > *pSrcB,
+                    fixed < I, F, S, O, R > *pDst, uint32_t blockSize)
+  {
+    detail::sub(pSrcA, pSrcB, pDst, blockSize,
+                detail::bool_ < detail::is_same < O, saturate >::value > ());
+  }
+
+  /**
+   * @brief Element-wise product in the source format.
+   * The 1.7 and 1.15 formats with saturation and truncation use
+   * <code>arm_mult_q7/q15()</code>; other formats rescale the product by F bits.
+   * 1.31 always runs the generic loop, because <code>arm_mult_q31()</code> drops the
+   * least significant bit of the product.
+   */
+  template < int I, int F, typename S, typename O, typename R >
+    inline void mult(const fixed < I, F, S, O, R > *pSrcA,
+                     const fixed < I, F, S, O, R > *pSrcB,
+                     fixed < I, F, S, O, R > *pDst, uint32_t blockSize)
+  {
+    detail::mult(pSrcA, pSrcB, pDst, blockSize,
+                 detail::bool_ < (I == 1) &&
+                 !detail::is_same < S, q31_t >::value &&
+                 detail::is_same < O, saturate >::value &&
+                 detail::is_same < R, truncate >::value > ());
+  }
+
+  /**
+   * @brief Element-wise negation.
+   * Saturating formats use <code>arm_negate_q7/q15/q31()</code>.
+   */
+  template < int I, int F, typename S, typename O, typename R >
+    inline void negate(const fixed < I, F, S, O, R > *pSrc,
+                       fixed < I, F, S, O, R > *pDst, uint32_t blockSize)
+  {
+    detail::negate(pSrc, pDst, blockSize,
+                   detail::bool_ < detail::is_same < O,
+                   saturate >::value > ());
+  }
+
+  /**
+   * @brief Element-wise absolute value.
+   * Saturating formats use <code>arm_abs_q7/q15/q31()</code>.
+   */
+  template < int I, int F, typename S, typename O, typename R >
+    inline void abs(const fixed < I, F, S, O, R > *pSrc,
+                    fixed < I, F, S, O, R > *pDst, uint32_t blockSize)
+  {
+    detail::abs(pSrc, pDst, blockSize,
+                detail::bool_ < detail::is_same < O, saturate >::value > ());
+  }
+
+  /**
+   * @brief Adds a constant to each element.
+   * Saturating formats use <code>arm_offset_q7/q15/q31()</code>.
+   */
+  template < int I, int F, typename S, typename O, typename R >
+    inline void offset(const fixed < I, F, S, O, R > *pSrc,
+                       fixed < I, F, S, O, R > k,
+                       fixed < I, F, S, O, R > *pDst, uint32_t blockSize)
+  {
+    detail::offset(pSrc, k, pDst, blockSize,
+                   detail::bool_ < detail::is_same < O,
+                   saturate >::value > ());
+  }
+
+  /**
+   * @brief Multiplies each element by a constant of any format with the same storage.
+   * The result keeps the source format.  Saturating, truncating formats use
+   * <code>arm_scale_q7/q15/q31()</code> with <code>scaleFract = k.raw()</code> and
+   * <code>shift</code> derived from the fraction bits of <code>k</code>.
+   */
+  template < int I, int F, typename S, typename O, typename R, int IK, int FK,
+    typename OK, typename RK >
+    inline void scale(const fixed < I, F, S, O, R > *pSrc,
+                      fixed < IK, FK, S, OK, RK > k,
+                      fixed < I, F, S, O, R > *pDst, uint32_t blockSize)
+  {
+    detail::scale(pSrc, k, pDst, blockSize,
+                  detail::bool_ < detail::is_same < O, saturate >::value &&
+                  detail::is_same < R, truncate >::value > ());
+  }
+
+  /**
+   * @brief Dot product returned in the format <code>Out</code>.
+   * @code
+   *    arm::q31 r = arm::dot_prod<arm::q31>(a, b, n);
+   * @endcode
+   * The sum is always computed by <code>arm_dot_prod_q7/q15/q31()</code>, whose
+   * accumulators do not depend on the format of the inputs; only the conversion of
+   * the accumulator to <code>Out</code> depends on the formats and the policies of <code>Out</code>.
+   */
+  template < typename Out, int I, int F, typename S, typename O, typename R >
+    inline Out dot_prod(const fixed < I, F, S, O, R > *pSrcA,
+                        const fixed < I, F, S, O, R > *pSrcB,
+                        uint32_t blockSize)
+  {
+    typename detail::storage_traits < S >::dot_t acc =
+      detail::kernels < S >::dot_prod(detail::raw(pSrcA), detail::raw(pSrcB),
+                                      blockSize);
+
+    return Out::from_raw(detail::narrow < typename Out::storage_type >
+                         (detail::rescale((q63_t) acc,
+                                          2 * F -
+                                          detail::storage_traits < S >::
+                                          dot_shift - Out::frac_bits,
+                                          typename Out::rounding_policy()),
+                          typename Out::overflow_policy()));
+  }
+
+  /** @brief Floating-point element-wise addition. */
+  inline void add(const float32_t * pSrcA, const float32_t * pSrcB,
+                  float32_t * pDst, uint32_t blockSize)
+  {
+    arm_add_f32(const_cast < float32_t * >(pSrcA),
+                const_cast < float32_t * >(pSrcB), pDst, blockSize);
+  }
+
+  /** @brief Floating-point element-wise subtraction. */
+  inline void sub(const float32_t * pSrcA, const float32_t * pSrcB,
+                  float32_t * pDst, uint32_t blockSize)
+  {
+    arm_sub_f32(const_cast < float32_t * >(pSrcA),
+                const_cast < float32_t * >(pSrcB), pDst, blockSize);
+  }
+
+  /** @brief Floating-point element-wise product. */
+  inline void mult(const float32_t * pSrcA, const float32_t * pSrcB,
+                   float32_t * pDst, uint32_t blockSize)
+  {
+    arm_mult_f32(const_cast < float32_t * >(pSrcA),
+                 const_cast < float32_t * >(pSrcB), pDst, blockSize);
+  }
+
+  /** @brief Floating-point element-wise negation. */
+  inline void negate(const float32_t * pSrc, float32_t * pDst,
+                     uint32_t blockSize)
+  {
+    arm_negate_f32(const_cast < float32_t * >(pSrc), pDst, blockSize);
+  }
+
+  /** @brief Floating-point element-wise absolute value. */
+  inline void abs(const float32_t * pSrc, float32_t * pDst,
+                  uint32_t blockSize)
+  {
+    arm_abs_f32(const_cast < float32_t * >(pSrc), pDst, blockSize);
+  }
+
+  /** @brief Adds a constant to each floating-point element. */
+  inline void offset(const float32_t * pSrc, float32_t k, float32_t * pDst,
+                     uint32_t blockSize)
+  {
+    arm_offset_f32(const_cast < float32_t * >(pSrc), k, pDst, blockSize);
+  }
+
+  /** @brief Multiplies each floating-point element by a constant. */
+  inline void scale(const float32_t * pSrc, float32_t k, float32_t * pDst,
+                    uint32_t blockSize)
+  {
+    arm_scale_f32(const_cast < float32_t * >(pSrc), k, pDst, blockSize);
+  }
+
+  /** @brief Floating-point dot product. */
+  template < typename Out >
+    inline Out dot_prod(const float32_t * pSrcA, const float32_t * pSrcB,
+                        uint32_t blockSize)
+  {
+    float32_t result;
+    arm_dot_prod_f32(const_cast < float32_t * >(pSrcA),
+                     const_cast < float32_t * >(pSrcB), blockSize, &result);
+    return (Out) result;
+  }
+
+  namespace detail
+  {
+
+    /* Default FIR coefficient type: the 1.x format of the sample storage. */
+    template < typename T > struct default_coeff
+    {
+      typedef fixed < 1, storage_traits < typename T::storage_type >::bits - 1,
+        typename T::storage_type > type;
+    };
+
+    template <> struct default_coeff <float32_t >
+    {
+      typedef float32_t type;
+    };
+
+    /* FIR storage and processing.  UseC selects the C kernel. */
+    template < typename T, typename Coeff, uint16_t NumTaps,
+      uint32_t BlockSize, bool UseC > class fir_impl;
+
+    template < typename T, typename Coeff, uint16_t NumTaps,
+      uint32_t BlockSize > class fir_impl <T, Coeff, NumTaps, BlockSize,
+      true >
+    {
+    public:
+      typedef typename T::storage_type S;
+
+      explicit fir_impl(const Coeff * pCoeffs)
+      {
+        kernels < S >::fir_init(&inst, NumTaps, raw(pCoeffs), state,
+                                BlockSize);
+      }
+
+      void process(const T * pSrc, T * pDst)
+      {
+        kernels < S >::fir(&inst, raw(pSrc), raw(pDst), BlockSize);
+      }
+
+    private:
+      typename kernels < S >::fir_instance inst;
+      S state[NumTaps + BlockSize];
+    };
+
+    template < typename T, typename Coeff, uint16_t NumTaps,
+      uint32_t BlockSize > class fir_impl <T, Coeff, NumTaps, BlockSize,
+      false >
+    {
+    public:
+      typedef typename T::storage_type S;
+
+      explicit fir_impl(const Coeff * pCoeffs):coeffs(pCoeffs)
+      {
+        uint32_t i;
+
+        for (i = 0u; i < NumTaps - 1u; i++)
+        {
+          state[i] = 0;
+        }
+      }
+
+      void process(const T * pSrc, T * pDst)
+      {
+        uint32_t i, k;
+        q63_t acc;
+
+        /* New samples go after the (numTaps-1) samples kept from the last call */
+        for (i = 0u; i < BlockSize; i++)
+        {
+          state[NumTaps - 1u + i] = pSrc[i].raw();
+        }
+
+        /* Coefficients are time reversed, so the oldest sample meets coeffs[0] */
+        for (i = 0u; i < BlockSize; i++)
+        {
+          acc = 0;
+          for (k = 0u; k < NumTaps; k++)
+          {
+            acc += (q63_t) state[i + k] * coeffs[k].raw();
+          }
+          pDst[i] = T::from_raw(narrow < S > (rescale(acc, Coeff::frac_bits,
+                                                      typename
+                                                      T::rounding_policy()),
+                                              typename T::overflow_policy()));
+        }
+
+        for (i = 0u; i < NumTaps - 1u; i++)
+        {
+          state[i] = state[BlockSize + i];
+        }
+      }
+
+    private:
+      const Coeff *coeffs;
+      S state[NumTaps - 1u + BlockSize];
+    };
+
+    template < uint16_t NumTaps, uint32_t BlockSize >
+      class fir_impl <float32_t, float32_t, NumTaps, BlockSize, true >
+    {
+    public:
+      explicit fir_impl(const float32_t * pCoeffs)
+      {
+        arm_fir_init_f32(&inst, NumTaps, const_cast < float32_t * >(pCoeffs),
+                         state, BlockSize);
+      }
+
+      void process(const float32_t * pSrc, float32_t * pDst)
+      {
+        arm_fir_f32(&inst, const_cast < float32_t * >(pSrc), pDst, BlockSize);
+      }
+
+    private:
+      arm_fir_instance_f32 inst;
+      float32_t state[NumTaps + BlockSize - 1u];
+    };
+
+    /* The C FIR applies when the coefficients are 1.x in the sample storage, the
+     * output truncates and overflows as the kernel does (Q7 and Q15 saturate, Q31
+     * wraps), and (Q15 only) numTaps is even and >= 4. */
+    template < typename T, typename Coeff, uint16_t NumTaps > struct fir_use_c
+    {
+      typedef typename T::storage_type S;
+      enum
+      { value = is_same < typename Coeff::storage_type, S >::value &&
+          (Coeff::int_bits == 1) &&
+          is_same < typename T::overflow_policy,
+          typename kernels < S >::fir_overflow >::value &&
+          is_same < typename T::rounding_policy, truncate >::value &&
+          (!is_same < S, q15_t >::value ||
+           ((NumTaps >= 4u) && ((NumTaps & 1u) == 0u))) };
+    };
+
+    template < uint16_t NumTaps > struct fir_use_c <float32_t, float32_t,
+      NumTaps >
+    {
+      enum
+      { value = 1 };
+    };
+
+  }                             /* namespace detail */
+
+  /**
+   * @brief FIR filter with compile-time length and block size.
+   * @tparam T          sample type: <code>float32_t</code> or a <code>fixed</code> type.
+   * @tparam NumTaps    number of coefficients.
+   * @tparam BlockSize  samples processed per call to <code>process()</code>.
+   * @tparam Coeff      coefficient type, 1.x in the sample storage by default.
+   *
+   * The state buffer is a member, so no memory is allocated.  Coefficients are in
+   * time reversed order as for <code>arm_fir_init_q15()</code> and are referenced,
+   * not copied, so the array must outlive the filter.  Filters that meet the
+   * conditions of the C kernel (1.x coefficients, truncate, the overflow of the kernel,
+   * and for Q15 an even number of at least 4 taps) run <code>arm_fir_q7/q15/q31/f32()</code>.
+   * <code>arm_fir_q7()</code> and <code>arm_fir_q15()</code> saturate and
+   * <code>arm_fir_q31()</code> wraps, so a saturating Q31 filter is not forwarded.  Others,
+   * for example a 2.14 coefficient set for gains above one, run a generic loop with a
+   * 64-bit accumulator rescaled by the coefficient fraction bits.
+   */
+  template < typename T, uint16_t NumTaps, uint32_t BlockSize,
+    typename Coeff = typename detail::default_coeff < T >::type > class fir
+  {
+  public:
+    explicit fir(const Coeff * pCoeffs):impl(pCoeffs)
+    {
+    }
+
+    /** @brief Filters <code>BlockSize</code> samples. */
+    void process(const T * pSrc, T * pDst)
+    {
+      impl.process(pSrc, pDst);
+    }
+
+  private:
+    detail::fir_impl < T, Coeff, NumTaps, BlockSize,
+      detail::fir_use_c < T, Coeff, NumTaps >::value > impl;
+  };
+
+  namespace detail
+  {
+
+    /* Direct form I biquad cascade storage and processing.  UseC selects the C kernel. */
+    template < typename T, typename Coeff, uint8_t NumStages, bool UseC >
+      class biquad_impl;
+
+    template < typename T, typename Coeff, uint8_t NumStages >
+      class biquad_impl <T, Coeff, NumStages, true >
+    {
+    public:
+      typedef typename T::storage_type S;
+
+      explicit biquad_impl(const Coeff * pCoeffs)
+      {
+        uint32_t i;
+
+        for (i = 0u; i < NumStages; i++)
+        {
+          kernels < S >::biquad_coeff_layout(raw(pCoeffs) + 5u * i,
+                                             coeffs +
+                                             kernels < S >::biquad_coeffs * i);
+        }
+        kernels < S >::biquad_init(&inst, NumStages, coeffs, state,
+                                   (int8_t) (Coeff::int_bits - 1));
+      }
+
+      void process(const T * pSrc, T * pDst, uint32_t blockSize)
+      {
+        kernels < S >::biquad(&inst, raw(pSrc), raw(pDst), blockSize);
+      }
+
+    private:
+      typename kernels < S >::biquad_instance inst;
+      S coeffs[kernels < S >::biquad_coeffs * NumStages];
+      S state[4u * NumStages];
+    };
+
+    template < typename T, typename Coeff, uint8_t NumStages >
+      class biquad_impl <T, Coeff, NumStages, false >
+    {
+    public:
+      typedef typename T::storage_type S;
+
+      explicit biquad_impl(const Coeff * pCoeffs)
+      {
+        uint32_t i;
+
+        for (i = 0u; i < 5u * NumStages; i++)
+        {
+          coeffs[i] = pCoeffs[i].raw();
+        }
+        for (i = 0u; i < 4u * NumStages; i++)
+        {
+          state[i] = 0;
+        }
+      }
+
+      void process(const T * pSrc, T * pDst, uint32_t blockSize)
+      {
+        const S *pIn = raw(pSrc);
+        S *pOut = raw(pDst);
+        S x0, x1, x2, y1, y2;
+        uint32_t stage, n;
+        q63_t acc;
+
+        for (stage = 0u; stage < NumStages; stage++)
+        {
+          const typename Coeff::storage_type *b = coeffs + 5u * stage;
+          S *st = state + 4u * stage;
+
+          x1 = st[0];
+          x2 = st[1];
+          y1 = st[2];
+          y2 = st[3];
+
+          for (n = 0u; n < blockSize; n++)
+          {
+            x0 = pIn[n];
+            /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+            acc = (q63_t) b[0] * x0 + (q63_t) b[1] * x1 + (q63_t) b[2] * x2 +
+              (q63_t) b[3] * y1 + (q63_t) b[4] * y2;
+            y2 = y1;
+            y1 = narrow < S > (rescale(acc, Coeff::frac_bits,
+                                       typename T::rounding_policy()),
+                               typename T::overflow_policy());
+            x2 = x1;
+            x1 = x0;
+            pOut[n] = y1;
+          }
+
+          st[0] = x1;
+          st[1] = x2;
+          st[2] = y1;
+          st[3] = y2;
+
+          /* Later stages filter the output of the previous one in place */
+          pIn = pOut;
+        }
+      }
+
+    private:
+      typename Coeff::storage_type coeffs[5u * NumStages];
+      S state[4u * NumStages];
+    };
+
+    template < uint8_t NumStages >
+      class biquad_impl <float32_t, float32_t, NumStages, true >
+    {
+    public:
+      explicit biquad_impl(const float32_t * pCoeffs)
+      {
+        uint32_t i;
+
+        for (i = 0u; i < 5u * NumStages; i++)
+        {
+          coeffs[i] = pCoeffs[i];
+        }
+        arm_biquad_cascade_df1_init_f32(&inst, NumStages, coeffs, state);
+      }
+
+      void process(const float32_t * pSrc, float32_t * pDst,
+                   uint32_t blockSize)
+      {
+        arm_biquad_cascade_df1_f32(&inst, const_cast < float32_t * >(pSrc),
+                                   pDst, blockSize);
+      }
+
+    private:
+      arm_biquad_casd_df1_inst_f32 inst;
+      float32_t coeffs[5u * NumStages];
+      float32_t state[4u * NumStages];
+    };
+
+    /* The C biquads exist for Q15 and Q31 storage, truncate their output, and
+     * saturate (Q15) or wrap (Q31) on overflow. */
+    template < typename T, typename Coeff > struct biquad_use_c
+    {
+      typedef typename T::storage_type S;
+      enum
+      { value = is_same < typename Coeff::storage_type, S >::value &&
+          !is_same < S, q7_t >::value &&
+          is_same < typename T::overflow_policy,
+          typename kernels < S >::biquad_overflow >::value &&
+          is_same < typename T::rounding_policy, truncate >::value };
+    };
+
+    template <> struct biquad_use_c <float32_t, float32_t >
+    {
+      enum
+      { value = 1 };
+    };
+
+  }                             /* namespace detail */
+
+  /**
+   * @brief Direct form I biquad cascade with a compile-time number of stages.
+   * @tparam T          sample type: <code>float32_t</code> or a <code>fixed</code> type.
+   * @tparam NumStages  number of second order stages.
+   * @tparam Coeff      coefficient type.  For fixed-point samples the integer bits of
+   *                    <code>Coeff</code> give the post shift: coefficients in 2.14
+   *                    run <code>arm_biquad_cascade_df1_q15()</code> with <code>postShift = 1</code>.
+   *
+   * Coefficients are given as <code>{b0, b1, b2, a1, a2}</code> per stage for every
+   * sample type, with the feedback coefficients negated as for the C functions, and are
+   * copied into the object in the layout the selected kernel expects.  Q15 samples that
+   * saturate and Q31 samples that wrap, with truncation and coefficients in the sample
+   * storage, use the C kernels; other combinations, including Q7 samples, use a generic
+   * loop with a 64-bit accumulator.
+   */
+  template < typename T, uint8_t NumStages, typename Coeff =
+    typename detail::default_coeff < T >::type > class biquad_cascade
+  {
+  public:
+    explicit biquad_cascade(const Coeff * pCoeffs):impl(pCoeffs)
+    {
+    }
+
+    /** @brief Filters <code>blockSize</code> samples. */
+    void process(const T * pSrc, T * pDst, uint32_t blockSize)
+    {
+      impl.process(pSrc, pDst, blockSize);
+    }
+
+  private:
+    detail::biquad_impl < T, Coeff, NumStages,
+      detail::biquad_use_c < T, Coeff >::value > impl;
+  };
+
+}                               /* namespace arm */
+
+/**
+ * @} end of cpp_fixed group
+ */
+
+#endif /* _ARM_MATH_HPP */
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_axpby_f32.c
+*
+* Description:	Floating-point weighted sum of two vectors.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @defgroup Axpby Vector Weighted Sum
+ *
+ * Computes the weighted sum of two vectors in a single pass:
+ * <pre>
+ *     pDst[n] = a * pSrcA[n] + b * pSrcB[n],   0 <= n < blockSize.
+ * </pre>
+ * This replaces two <code>arm_scale</code> calls and an <code>arm_add</code>, and with
+ * <code>pDst</code> equal to <code>pSrcB</code> it updates a vector in place, as in
+ * <code>y = a * x + b * y</code>. The fixed-point functions compute both products and their
+ * sum in a wider format and round once, so the result only saturates when the weighted sum
+ * itself is out of range.
+ * The functions support floating-point, Q31, Q15 and Q7 data types.
+ */
+
+/**
+ * @addtogroup Axpby
+ * @{
+ */
+
+/**
+ * @brief Weighted sum of two floating-point vectors.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       a weight of the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       b weight of the second input vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_axpby_f32(
+  float32_t * pSrcA,
+  float32_t a,
+  float32_t * pSrcB,
+  float32_t b,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t out1, out2, out3, out4;              /* temporary output variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = a * A + b * B */
+    out1 = (a * pSrcA[0]) + (b * pSrcB[0]);
+    out2 = (a * pSrcA[1]) + (b * pSrcB[1]);
+    out3 = (a * pSrcA[2]) + (b * pSrcB[2]);
+    out4 = (a * pSrcA[3]) + (b * pSrcB[3]);
+
+    /* store the results */
+    pDst[0] = out1;
+    pDst[1] = out2;
+    pDst[2] = out3;
+    pDst[3] = out4;
+
+    /* update pointers to process next samples */
+    pSrcA += 4u;
+    pSrcB += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = a * A + b * B */
+    *pDst++ = (a * *pSrcA++) + (b * *pSrcB++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Axpby group
+ */
@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_axpby_q15.c
+*
+* Description:	Q15 weighted sum of two vectors.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup Axpby
+ * @{
+ */
+
+/**
+ * @brief Weighted sum of two Q15 vectors.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       a weight of the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       b weight of the second input vector
+ * @param[in]       shift number of bits to shift the result by, at most 14
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The inputs and the weights are in 1.15 format. Each product is halved to 3.29 format,
+ * and the sum of the two products is shifted by <code>shift</code> with saturation to
+ * 1.15 format, so the weights are <code>a * 2^shift</code> and <code>b * 2^shift</code>.
+ */
+
+void arm_axpby_q15(
+  q15_t * pSrcA,
+  q15_t a,
+  q15_t * pSrcB,
+  q15_t b,
+  int8_t shift,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  int8_t kShift = 14 - shift;                    /* Shift to apply after the sum */
+  q31_t inA1, inA2, inB1, inB2;                  /* temporary input variables */
+  q31_t out1, out2, out3, out4;                  /* temporary output variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* read two samples at a time from each source */
+    inA1 = *__SIMD32(pSrcA)++;
+    inB1 = *__SIMD32(pSrcB)++;
+    inA2 = *__SIMD32(pSrcA)++;
+    inB2 = *__SIMD32(pSrcB)++;
+
+    /* C = a * A + b * B, accumulated in 3.29 format */
+    out1 = (((q15_t) inA1 * a) >> 1) + (((q15_t) inB1 * b) >> 1);
+    out2 = (((q15_t) (inA1 >> 16) * a) >> 1) + (((q15_t) (inB1 >> 16) * b) >> 1);
+    out3 = (((q15_t) inA2 * a) >> 1) + (((q15_t) inB2 * b) >> 1);
+    out4 = (((q15_t) (inA2 >> 16) * a) >> 1) + (((q15_t) (inB2 >> 16) * b) >> 1);
+
+    /* convert to 1.15 format with saturation */
+    out1 = __SSAT(out1 >> kShift, 16);
+    out2 = __SSAT(out2 >> kShift, 16);
+    out3 = __SSAT(out3 >> kShift, 16);
+    out4 = __SSAT(out4 >> kShift, 16);
+
+    /* store the results, each in the half word it was read from */
+    *__SIMD32(pDst)++ = __PKHBT(out1, out2, 16);
+    *__SIMD32(pDst)++ = __PKHBT(out3, out4, 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = a * A + b * B */
+    out1 = ((*pSrcA++ * a) >> 1) + ((*pSrcB++ * b) >> 1);
+    *pDst++ = (q15_t) __SSAT(out1 >> kShift, 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Axpby group
+ */
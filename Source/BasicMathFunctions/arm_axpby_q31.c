@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_axpby_q31.c
+*
+* Description:	Q31 weighted sum of two vectors.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup Axpby
+ * @{
+ */
+
+/**
+ * @brief Weighted sum of two Q31 vectors.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       a weight of the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       b weight of the second input vector
+ * @param[in]       shift number of bits to shift the result by, at most 30
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The inputs and the weights are in 1.31 format. Each product is halved to 3.61 format,
+ * and the sum of the two products is shifted by <code>shift</code> with saturation to
+ * 1.31 format, so the weights are <code>a * 2^shift</code> and <code>b * 2^shift</code>.
+ */
+
+void arm_axpby_q31(
+  q31_t * pSrcA,
+  q31_t a,
+  q31_t * pSrcB,
+  q31_t b,
+  int8_t shift,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  int8_t kShift = 30 - shift;                    /* Shift to apply after the sum */
+  q63_t out1, out2, out3, out4;                  /* temporary output variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = a * A + b * B, accumulated in 3.61 format */
+    out1 = (((q63_t) pSrcA[0] * a) >> 1) + (((q63_t) pSrcB[0] * b) >> 1);
+    out2 = (((q63_t) pSrcA[1] * a) >> 1) + (((q63_t) pSrcB[1] * b) >> 1);
+    out3 = (((q63_t) pSrcA[2] * a) >> 1) + (((q63_t) pSrcB[2] * b) >> 1);
+    out4 = (((q63_t) pSrcA[3] * a) >> 1) + (((q63_t) pSrcB[3] * b) >> 1);
+
+    /* convert to 1.31 format with saturation and store the results */
+    pDst[0] = clip_q63_to_q31(out1 >> kShift);
+    pDst[1] = clip_q63_to_q31(out2 >> kShift);
+    pDst[2] = clip_q63_to_q31(out3 >> kShift);
+    pDst[3] = clip_q63_to_q31(out4 >> kShift);
+
+    /* update pointers to process next samples */
+    pSrcA += 4u;
+    pSrcB += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = a * A + b * B */
+    out1 = (((q63_t) * pSrcA++ * a) >> 1) + (((q63_t) * pSrcB++ * b) >> 1);
+    *pDst++ = clip_q63_to_q31(out1 >> kShift);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Axpby group
+ */
@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_axpby_q7.c
+*
+* Description:	Q7 weighted sum of two vectors.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup Axpby
+ * @{
+ */
+
+/**
+ * @brief Weighted sum of two Q7 vectors.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       a weight of the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       b weight of the second input vector
+ * @param[in]       shift number of bits to shift the result by, at most 7
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The inputs and the weights are in 1.7 format. The sum of the two 2.14 products is
+ * formed in 32-bit precision and shifted by <code>shift</code> with saturation to
+ * 1.7 format, so the weights are <code>a * 2^shift</code> and <code>b * 2^shift</code>.
+ */
+
+void arm_axpby_q7(
+  q7_t * pSrcA,
+  q7_t a,
+  q7_t * pSrcB,
+  q7_t b,
+  int8_t shift,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  int8_t kShift = 7 - shift;                     /* Shift to apply after the sum */
+  q31_t out1, out2, out3, out4;                  /* temporary output variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = a * A + b * B, accumulated in 3.14 format */
+    out1 = ((q31_t) pSrcA[0] * a) + ((q31_t) pSrcB[0] * b);
+    out2 = ((q31_t) pSrcA[1] * a) + ((q31_t) pSrcB[1] * b);
+    out3 = ((q31_t) pSrcA[2] * a) + ((q31_t) pSrcB[2] * b);
+    out4 = ((q31_t) pSrcA[3] * a) + ((q31_t) pSrcB[3] * b);
+
+    /* update pointers to process next samples */
+    pSrcA += 4u;
+    pSrcB += 4u;
+
+    /* convert to 1.7 format with saturation and store the results of 4 inputs by packing */
+    *__SIMD32(pDst)++ = __PACKq7(__SSAT(out1 >> kShift, 8), __SSAT(out2 >> kShift, 8),
+                                 __SSAT(out3 >> kShift, 8), __SSAT(out4 >> kShift, 8));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = a * A + b * B */
+    out1 = ((q31_t) * pSrcA++ * a) + ((q31_t) * pSrcB++ * b);
+    *pDst++ = (q7_t) __SSAT(out1 >> kShift, 8);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Axpby group
+ */
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_compare_f32.c
+*
+* Description:	Floating-point vector compare against a threshold.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @defgroup Compare Vector Compare
+ *
+ * Compares each element of a vector against a threshold, or against a range, and
+ * packs the results into a bitmask:
+ * <pre>
+ *     bit (n % 32) of pMask[n / 32] = pSrc[n] op threshold,   0 <= n < blockSize
+ * </pre>
+ * The mask holds <code>ARM_MASK_WORDS(blockSize)</code> words; the unused bits of the
+ * last word are cleared. A limit check on the output of <code>arm_abs_q15()</code> or
+ * <code>arm_sub_q15()</code> becomes a single call, and the mask is consumed by the
+ * select functions, <code>arm_mask_popcount()</code> and <code>arm_mask_to_index()</code>.
+ *
+ * \par
+ * The fixed-point functions compare two Q15 or four Q7 samples per instruction
+ * with halving SIMD subtraction, whose sign bits cannot overflow. A floating-point NaN
+ * compares false under every operator except ARM_CMP_NE and is never in range.
+ */
+
+/**
+ * @addtogroup Compare
+ * @{
+ */
+
+/*
+ * @brief  Mask bits of an operator from the bits of x >= threshold and x <= threshold.
+ */
+
+static uint32_t arm_compare_word_f32(
+  uint32_t ge,
+  uint32_t le,
+  arm_compare_op op)
+{
+  uint32_t mask;                                 /* Bits of the operator */
+
+  switch (op)
+  {
+  case ARM_CMP_LT:
+    mask = le & ~ge;
+    break;
+  case ARM_CMP_LE:
+    mask = le;
+    break;
+  case ARM_CMP_GT:
+    mask = ge & ~le;
+    break;
+  case ARM_CMP_GE:
+    mask = ge;
+    break;
+  case ARM_CMP_EQ:
+    mask = ge & le;
+    break;
+  default:
+    mask = ~(ge & le);
+    break;
+  }
+
+  return (mask);
+}
+
+/**
+ * @brief  Compares the elements of a floating-point vector against a threshold.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  threshold value compared against.
+ * @param[in]  op comparison operator, pSrc[n] op threshold.
+ * @param[out] *pMask points to the output bitmask of ARM_MASK_WORDS(blockSize) words.
+ * @param[in]  blockSize number of samples in the vector.
+ * @return none.
+ */
+
+void arm_compare_f32(
+  float32_t * pSrc,
+  float32_t threshold,
+  arm_compare_op op,
+  uint32_t * pMask,
+  uint32_t blockSize)
+{
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+  uint32_t ge, le;                               /* Bits of x >= threshold and x <= threshold */
+  uint32_t bit;                                  /* Bit of the current sample */
+  uint32_t wordCnt, blkCnt;                      /* Loop counters */
+
+  /* Whole mask words, 32 samples each */
+  wordCnt = blockSize >> 5u;
+
+  while(wordCnt > 0u)
+  {
+    ge = 0u;
+    le = 0u;
+
+    /* Compare 4 samples at a time */
+    for (bit = 0u; bit < 32u; bit += 4u)
+    {
+      in1 = pSrc[0];
+      in2 = pSrc[1];
+      in3 = pSrc[2];
+      in4 = pSrc[3];
+
+      ge |= (((in1 >= threshold) ? 1u : 0u) | ((in2 >= threshold) ? 2u : 0u) |
+             ((in3 >= threshold) ? 4u : 0u) | ((in4 >= threshold) ? 8u : 0u)) << bit;
+      le |= (((in1 <= threshold) ? 1u : 0u) | ((in2 <= threshold) ? 2u : 0u) |
+             ((in3 <= threshold) ? 4u : 0u) | ((in4 <= threshold) ? 8u : 0u)) << bit;
+
+      pSrc += 4u;
+    }
+
+    *pMask++ = arm_compare_word_f32(ge, le, op);
+
+    /* Decrement the loop counter */
+    wordCnt--;
+  }
+
+  /* Remaining samples of a partial last word */
+  blkCnt = blockSize & 0x1Fu;
+
+  if(blkCnt > 0u)
+  {
+    ge = 0u;
+    le = 0u;
+
+    for (bit = 0u; bit < blkCnt; bit++)
+    {
+      in1 = *pSrc++;
+      ge |= ((in1 >= threshold) ? 1u : 0u) << bit;
+      le |= ((in1 <= threshold) ? 1u : 0u) << bit;
+    }
+
+    /* Clear the bits past the end of the vector */
+    *pMask = arm_compare_word_f32(ge, le, op) & ((1u << blkCnt) - 1u);
+  }
+}
+
+/**
+ * @} end of Compare group
+ */
@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_compare_q15.c
+*
+* Description:	Q15 vector compare against a threshold.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup Compare
+ * @{
+ */
+
+/*
+ * @brief  Mask bits of an operator from the bits of x < threshold and x > threshold.
+ */
+
+static uint32_t arm_compare_word_q15(
+  uint32_t lt,
+  uint32_t gt,
+  arm_compare_op op)
+{
+  uint32_t mask;                                 /* Bits of the operator */
+
+  switch (op)
+  {
+  case ARM_CMP_LT:
+    mask = lt;
+    break;
+  case ARM_CMP_LE:
+    mask = ~gt;
+    break;
+  case ARM_CMP_GT:
+    mask = gt;
+    break;
+  case ARM_CMP_GE:
+    mask = ~lt;
+    break;
+  case ARM_CMP_EQ:
+    mask = ~(lt | gt);
+    break;
+  default:
+    mask = lt | gt;
+    break;
+  }
+
+  return (mask);
+}
+
+/**
+ * @brief  Compares the elements of a Q15 vector against a threshold.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  threshold value compared against.
+ * @param[in]  op comparison operator, pSrc[n] op threshold.
+ * @param[out] *pMask points to the output bitmask of ARM_MASK_WORDS(blockSize) words.
+ * @param[in]  blockSize number of samples in the vector.
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input buffer should be aligned by 32-bit
+ */
+
+void arm_compare_q15(
+  q15_t * pSrc,
+  q15_t threshold,
+  arm_compare_op op,
+  uint32_t * pMask,
+  uint32_t blockSize)
+{
+  q31_t thr;                                     /* Threshold in both half words */
+  q31_t in1, in2;                                /* Two samples each */
+  uint32_t d1, d2, d3, d4;                       /* Halved differences */
+  uint32_t lt, gt;                               /* Bits of x < threshold and x > threshold */
+  uint32_t bit;                                  /* Bit of the current sample */
+  uint32_t wordCnt, blkCnt;                      /* Loop counters */
+  q15_t in;                                      /* Temporary input variable */
+
+  thr = (q31_t) __PKHBT(threshold, threshold, 16);
+
+  /* Whole mask words, 32 samples each */
+  wordCnt = blockSize >> 5u;
+
+  while(wordCnt > 0u)
+  {
+    lt = 0u;
+    gt = 0u;
+
+    /* Compare 4 samples at a time */
+    for (bit = 0u; bit < 32u; bit += 4u)
+    {
+      in1 = *__SIMD32(pSrc)++;
+      in2 = *__SIMD32(pSrc)++;
+
+      /* (x - threshold) / 2 is negative in a half word where x < threshold */
+      d1 = (uint32_t) __SHSUB16(in1, thr);
+      d2 = (uint32_t) __SHSUB16(in2, thr);
+      d3 = (uint32_t) __SHSUB16(thr, in1);
+      d4 = (uint32_t) __SHSUB16(thr, in2);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      /* Gather the four sign bits of each comparison, the first sample is the low half word */
+      lt |= (((d1 >> 15) & 1u) | ((d1 >> 30) & 2u) |
+             ((d2 >> 13) & 4u) | ((d2 >> 28) & 8u)) << bit;
+      gt |= (((d3 >> 15) & 1u) | ((d3 >> 30) & 2u) |
+             ((d4 >> 13) & 4u) | ((d4 >> 28) & 8u)) << bit;
+
+#else
+
+      /* Gather the four sign bits of each comparison, the first sample is the high half word */
+      lt |= (((d1 >> 31) & 1u) | ((d1 >> 14) & 2u) |
+             ((d2 >> 29) & 4u) | ((d2 >> 12) & 8u)) << bit;
+      gt |= (((d3 >> 31) & 1u) | ((d3 >> 14) & 2u) |
+             ((d4 >> 29) & 4u) | ((d4 >> 12) & 8u)) << bit;
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+    }
+
+    *pMask++ = arm_compare_word_q15(lt, gt, op);
+
+    /* Decrement the loop counter */
+    wordCnt--;
+  }
+
+  /* Remaining samples of a partial last word */
+  blkCnt = blockSize & 0x1Fu;
+
+  if(blkCnt > 0u)
+  {
+    lt = 0u;
+    gt = 0u;
+
+    for (bit = 0u; bit < blkCnt; bit++)
+    {
+      in = *pSrc++;
+      lt |= ((in < threshold) ? 1u : 0u) << bit;
+      gt |= ((in > threshold) ? 1u : 0u) << bit;
+    }
+
+    /* Clear the bits past the end of the vector */
+    *pMask = arm_compare_word_q15(lt, gt, op) & ((1u << blkCnt) - 1u);
+  }
+}
+
+/**
+ * @} end of Compare group
+ */
@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_compare_q7.c
+*
+* Description:	Q7 vector compare against a threshold.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup Compare
+ * @{
+ */
+
+/*
+ * @brief  Mask bits of an operator from the bits of x < threshold and x > threshold.
+ */
+
+static uint32_t arm_compare_word_q7(
+  uint32_t lt,
+  uint32_t gt,
+  arm_compare_op op)
+{
+  uint32_t mask;                                 /* Bits of the operator */
+
+  switch (op)
+  {
+  case ARM_CMP_LT:
+    mask = lt;
+    break;
+  case ARM_CMP_LE:
+    mask = ~gt;
+    break;
+  case ARM_CMP_GT:
+    mask = gt;
+    break;
+  case ARM_CMP_GE:
+    mask = ~lt;
+    break;
+  case ARM_CMP_EQ:
+    mask = ~(lt | gt);
+    break;
+  default:
+    mask = lt | gt;
+    break;
+  }
+
+  return (mask);
+}
+
+/**
+ * @brief  Compares the elements of a Q7 vector against a threshold.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  threshold value compared against.
+ * @param[in]  op comparison operator, pSrc[n] op threshold.
+ * @param[out] *pMask points to the output bitmask of ARM_MASK_WORDS(blockSize) words.
+ * @param[in]  blockSize number of samples in the vector.
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input buffer should be aligned by 32-bit
+ */
+
+void arm_compare_q7(
+  q7_t * pSrc,
+  q7_t threshold,
+  arm_compare_op op,
+  uint32_t * pMask,
+  uint32_t blockSize)
+{
+  q31_t thr;                                     /* Threshold in all four bytes */
+  q31_t in1, in2;                                /* Four samples each */
+  uint32_t d1, d2, d3, d4;                       /* Halved differences */
+  uint32_t lt, gt;                               /* Bits of x < threshold and x > threshold */
+  uint32_t bit;                                  /* Bit of the current sample */
+  uint32_t wordCnt, blkCnt;                      /* Loop counters */
+  q7_t in;                                       /* Temporary input variable */
+
+  thr = (q31_t) (((uint32_t) threshold & 0xFFu) * 0x01010101u);
+
+  /* Whole mask words, 32 samples each */
+  wordCnt = blockSize >> 5u;
+
+  while(wordCnt > 0u)
+  {
+    lt = 0u;
+    gt = 0u;
+
+    /* Compare 8 samples at a time */
+    for (bit = 0u; bit < 32u; bit += 8u)
+    {
+      in1 = *__SIMD32(pSrc)++;
+      in2 = *__SIMD32(pSrc)++;
+
+      /* (x - threshold) / 2 is negative in a byte where x < threshold */
+      d1 = (uint32_t) __SHSUB8(in1, thr);
+      d2 = (uint32_t) __SHSUB8(in2, thr);
+      d3 = (uint32_t) __SHSUB8(thr, in1);
+      d4 = (uint32_t) __SHSUB8(thr, in2);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      /* Gather the eight sign bits of each comparison, the first sample is the low byte */
+      lt |= (((d1 >> 7) & 0x01u) | ((d1 >> 14) & 0x02u) |
+             ((d1 >> 21) & 0x04u) | ((d1 >> 28) & 0x08u) |
+             ((d2 >> 3) & 0x10u) | ((d2 >> 10) & 0x20u) |
+             ((d2 >> 17) & 0x40u) | ((d2 >> 24) & 0x80u)) << bit;
+      gt |= (((d3 >> 7) & 0x01u) | ((d3 >> 14) & 0x02u) |
+             ((d3 >> 21) & 0x04u) | ((d3 >> 28) & 0x08u) |
+             ((d4 >> 3) & 0x10u) | ((d4 >> 10) & 0x20u) |
+             ((d4 >> 17) & 0x40u) | ((d4 >> 24) & 0x80u)) << bit;
+
+#else
+
+      /* Gather the eight sign bits of each comparison, the first sample is the high byte */
+      lt |= (((d1 >> 31) & 0x01u) | ((d1 >> 22) & 0x02u) |
+             ((d1 >> 13) & 0x04u) | ((d1 >> 4) & 0x08u) |
+             ((d2 >> 27) & 0x10u) | ((d2 >> 18) & 0x20u) |
+             ((d2 >> 9) & 0x40u) | (d2 & 0x80u)) << bit;
+      gt |= (((d3 >> 31) & 0x01u) | ((d3 >> 22) & 0x02u) |
+             ((d3 >> 13) & 0x04u) | ((d3 >> 4) & 0x08u) |
+             ((d4 >> 27) & 0x10u) | ((d4 >> 18) & 0x20u) |
+             ((d4 >> 9) & 0x40u) | (d4 & 0x80u)) << bit;
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+    }
+
+    *pMask++ = arm_compare_word_q7(lt, gt, op);
+
+    /* Decrement the loop counter */
+    wordCnt--;
+  }
+
+  /* Remaining samples of a partial last word */
+  blkCnt = blockSize & 0x1Fu;
+
+  if(blkCnt > 0u)
+  {
+    lt = 0u;
+    gt = 0u;
+
+    for (bit = 0u; bit < blkCnt; bit++)
+    {
+      in = *pSrc++;
+      lt |= ((in < threshold) ? 1u : 0u) << bit;
+      gt |= ((in > threshold) ? 1u : 0u) << bit;
+    }
+
+    /* Clear the bits past the end of the vector */
+    *pMask = arm_compare_word_q7(lt, gt, op) & ((1u << blkCnt) - 1u);
+  }
+}
+
+/**
+ * @} end of Compare group
+ */
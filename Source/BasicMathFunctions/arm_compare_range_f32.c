@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_compare_range_f32.c
+*
+* Description:	Floating-point vector range check.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup Compare
+ * @{
+ */
+
+/**
+ * @brief  Checks the elements of a floating-point vector against a closed range.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  low lower limit of the range.
+ * @param[in]  high upper limit of the range.
+ * @param[out] *pMask points to the output bitmask of ARM_MASK_WORDS(blockSize) words,
+ *             with a bit set where low <= pSrc[n] <= high.
+ * @param[in]  blockSize number of samples in the vector.
+ * @return none.
+ */
+
+void arm_compare_range_f32(
+  float32_t * pSrc,
+  float32_t low,
+  float32_t high,
+  uint32_t * pMask,
+  uint32_t blockSize)
+{
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+  uint32_t mask;                                 /* Bits of the current word */
+  uint32_t bit;                                  /* Bit of the current sample */
+  uint32_t wordCnt, blkCnt;                      /* Loop counters */
+
+  /* Whole mask words, 32 samples each */
+  wordCnt = blockSize >> 5u;
+
+  while(wordCnt > 0u)
+  {
+    mask = 0u;
+
+    /* Check 4 samples at a time */
+    for (bit = 0u; bit < 32u; bit += 4u)
+    {
+      in1 = pSrc[0];
+      in2 = pSrc[1];
+      in3 = pSrc[2];
+      in4 = pSrc[3];
+
+      mask |= ((((in1 >= low) && (in1 <= high)) ? 1u : 0u) |
+               (((in2 >= low) && (in2 <= high)) ? 2u : 0u) |
+               (((in3 >= low) && (in3 <= high)) ? 4u : 0u) |
+               (((in4 >= low) && (in4 <= high)) ? 8u : 0u)) << bit;
+
+      pSrc += 4u;
+    }
+
+    *pMask++ = mask;
+
+    /* Decrement the loop counter */
+    wordCnt--;
+  }
+
+  /* Remaining samples of a partial last word */
+  blkCnt = blockSize & 0x1Fu;
+
+  if(blkCnt > 0u)
+  {
+    mask = 0u;
+
+    for (bit = 0u; bit < blkCnt; bit++)
+    {
+      in1 = *pSrc++;
+      mask |= (((in1 >= low) && (in1 <= high)) ? 1u : 0u) << bit;
+    }
+
+    *pMask = mask;
+  }
+}
+
+/**
+ * @} end of Compare group
+ */
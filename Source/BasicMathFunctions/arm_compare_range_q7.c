@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_compare_range_q7.c
+*
+* Description:	Q7 vector range check.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup Compare
+ * @{
+ */
+
+/**
+ * @brief  Checks the elements of a Q7 vector against a closed range.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  low lower limit of the range.
+ * @param[in]  high upper limit of the range.
+ * @param[out] *pMask points to the output bitmask of ARM_MASK_WORDS(blockSize) words,
+ *             with a bit set where low <= pSrc[n] <= high.
+ * @param[in]  blockSize number of samples in the vector.
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input buffer should be aligned by 32-bit
+ */
+
+void arm_compare_range_q7(
+  q7_t * pSrc,
+  q7_t low,
+  q7_t high,
+  uint32_t * pMask,
+  uint32_t blockSize)
+{
+  q31_t lo, hi;                                  /* Limits in all four bytes */
+  q31_t in1, in2;                                /* Four samples each */
+  uint32_t d1, d2, d3, d4;                       /* Halved differences */
+  uint32_t lt, gt;                               /* Bits of x < low and x > high */
+  uint32_t bit;                                  /* Bit of the current sample */
+  uint32_t wordCnt, blkCnt;                      /* Loop counters */
+  q7_t in;                                       /* Temporary input variable */
+
+  lo = (q31_t) (((uint32_t) low & 0xFFu) * 0x01010101u);
+  hi = (q31_t) (((uint32_t) high & 0xFFu) * 0x01010101u);
+
+  /* Whole mask words, 32 samples each */
+  wordCnt = blockSize >> 5u;
+
+  while(wordCnt > 0u)
+  {
+    lt = 0u;
+    gt = 0u;
+
+    /* Compare 8 samples at a time */
+    for (bit = 0u; bit < 32u; bit += 8u)
+    {
+      in1 = *__SIMD32(pSrc)++;
+      in2 = *__SIMD32(pSrc)++;
+
+      /* (x - low) / 2 is negative in a byte where x < low */
+      d1 = (uint32_t) __SHSUB8(in1, lo);
+      d2 = (uint32_t) __SHSUB8(in2, lo);
+      d3 = (uint32_t) __SHSUB8(hi, in1);
+      d4 = (uint32_t) __SHSUB8(hi, in2);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      /* Gather the eight sign bits of each comparison, the first sample is the low byte */
+      lt |= (((d1 >> 7) & 0x01u) | ((d1 >> 14) & 0x02u) |
+             ((d1 >> 21) & 0x04u) | ((d1 >> 28) & 0x08u) |
+             ((d2 >> 3) & 0x10u) | ((d2 >> 10) & 0x20u) |
+             ((d2 >> 17) & 0x40u) | ((d2 >> 24) & 0x80u)) << bit;
+      gt |= (((d3 >> 7) & 0x01u) | ((d3 >> 14) & 0x02u) |
+             ((d3 >> 21) & 0x04u) | ((d3 >> 28) & 0x08u) |
+             ((d4 >> 3) & 0x10u) | ((d4 >> 10) & 0x20u) |
+             ((d4 >> 17) & 0x40u) | ((d4 >> 24) & 0x80u)) << bit;
+
+#else
+
+      /* Gather the eight sign bits of each comparison, the first sample is the high byte */
+      lt |= (((d1 >> 31) & 0x01u) | ((d1 >> 22) & 0x02u) |
+             ((d1 >> 13) & 0x04u) | ((d1 >> 4) & 0x08u) |
+             ((d2 >> 27) & 0x10u) | ((d2 >> 18) & 0x20u) |
+             ((d2 >> 9) & 0x40u) | (d2 & 0x80u)) << bit;
+      gt |= (((d3 >> 31) & 0x01u) | ((d3 >> 22) & 0x02u) |
+             ((d3 >> 13) & 0x04u) | ((d3 >> 4) & 0x08u) |
+             ((d4 >> 27) & 0x10u) | ((d4 >> 18) & 0x20u) |
+             ((d4 >> 9) & 0x40u) | (d4 & 0x80u)) << bit;
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+    }
+
+    *pMask++ = ~(lt | gt);
+
+    /* Decrement the loop counter */
+    wordCnt--;
+  }
+
+  /* Remaining samples of a partial last word */
+  blkCnt = blockSize & 0x1Fu;
+
+  if(blkCnt > 0u)
+  {
+    lt = 0u;
+    gt = 0u;
+
+    for (bit = 0u; bit < blkCnt; bit++)
+    {
+      in = *pSrc++;
+      lt |= ((in < low) ? 1u : 0u) << bit;
+      gt |= ((in > high) ? 1u : 0u) << bit;
+    }
+
+    /* Clear the bits past the end of the vector */
+    *pMask = ~(lt | gt) & ((1u << blkCnt) - 1u);
+  }
+}
+
+/**
+ * @} end of Compare group
+ */
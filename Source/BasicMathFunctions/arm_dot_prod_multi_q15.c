@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_dot_prod_multi_q15.c
+*
+* Description:	Q15 dot products of one vector with several vectors.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup dot_prod
+ * @{
+ */
+
+/**
+ * @brief Dot products of a Q15 vector with several vectors.
+ * @param[in]       *pSrcA points to the common input vector
+ * @param[in]       **ppSrcB points to an array of numVecs pointers to the other input vectors
+ * @param[in]       numVecs number of dot products
+ * @param[in]       blockSize number of samples in each vector
+ * @param[out]      *pResult points to the numVecs results
+ * @return none.
+ *
+ * \par
+ * Computes <code>pResult[k] = pSrcA . ppSrcB[k]</code> four vectors at a time, so
+ * each sample of <code>pSrcA</code> is loaded once for four products. The vectors
+ * of <code>ppSrcB</code> can lie anywhere in memory, for example the weight sets
+ * of several beams. For vectors stored as consecutive rows of a matrix use
+ * <code>arm_mat_vec_mult_q15()</code>.
+ *
+ * \par Conditions for optimum performance
+ *  Input buffers should be aligned by 32-bit
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each product is accumulated as in <code>arm_dot_prod_q15()</code>: the 1.15 by 1.15
+ * products are in 2.30 format and are added in 64-bit accumulators of 34.30 format.
+ * The results are in 34.30 format.
+ */
+
+void arm_dot_prod_multi_q15(
+  q15_t * pSrcA,
+  q15_t ** ppSrcB,
+  uint32_t numVecs,
+  uint32_t blockSize,
+  q63_t * pResult)
+{
+  q15_t *pA;                                     /* common vector pointer */
+  q15_t *pB0, *pB1, *pB2, *pB3;                  /* vectors of the current group */
+  q63_t sum0, sum1, sum2, sum3;                  /* accumulators */
+  q31_t a;                                       /* two samples of the common vector */
+  uint32_t vecCnt, blkCnt;                       /* loop counters */
+
+  /* Loop unrolling: four vectors at a time */
+  vecCnt = numVecs >> 2u;
+
+  while(vecCnt > 0u)
+  {
+    pB0 = ppSrcB[0];
+    pB1 = ppSrcB[1];
+    pB2 = ppSrcB[2];
+    pB3 = ppSrcB[3];
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+    pA = pSrcA;
+
+    /* Each pair of samples of the common vector is loaded once for the four products */
+    blkCnt = blockSize >> 1u;
+
+    while(blkCnt > 0u)
+    {
+      a = *__SIMD32(pA)++;
+      sum0 = __SMLALD(a, *__SIMD32(pB0)++, sum0);
+      sum1 = __SMLALD(a, *__SIMD32(pB1)++, sum1);
+      sum2 = __SMLALD(a, *__SIMD32(pB2)++, sum2);
+      sum3 = __SMLALD(a, *__SIMD32(pB3)++, sum3);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Last sample of an odd blockSize */
+    if((blockSize & 0x1u) != 0u)
+    {
+      a = *pA;
+      sum0 += (q31_t) a * *pB0;
+      sum1 += (q31_t) a * *pB1;
+      sum2 += (q31_t) a * *pB2;
+      sum3 += (q31_t) a * *pB3;
+    }
+
+    pResult[0] = sum0;
+    pResult[1] = sum1;
+    pResult[2] = sum2;
+    pResult[3] = sum3;
+
+    pResult += 4u;
+    ppSrcB += 4u;
+
+    /* Decrement the loop counter */
+    vecCnt--;
+  }
+
+  /* Remaining 1 to 3 vectors */
+  vecCnt = numVecs % 0x4u;
+
+  while(vecCnt > 0u)
+  {
+    arm_dot_prod_q15(pSrcA, *ppSrcB++, blockSize, pResult++);
+
+    /* Decrement the loop counter */
+    vecCnt--;
+  }
+}
+
+/**
+ * @} end of dot_prod group
+ */
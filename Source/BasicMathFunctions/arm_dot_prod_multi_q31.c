@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_dot_prod_multi_q31.c
+*
+* Description:	Q31 dot products of one vector with several vectors.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup dot_prod
+ * @{
+ */
+
+/**
+ * @brief Dot products of a Q31 vector with several vectors.
+ * @param[in]       *pSrcA points to the common input vector
+ * @param[in]       **ppSrcB points to an array of numVecs pointers to the other input vectors
+ * @param[in]       numVecs number of dot products
+ * @param[in]       blockSize number of samples in each vector
+ * @param[out]      *pResult points to the numVecs results
+ * @return none.
+ *
+ * \par
+ * Computes <code>pResult[k] = pSrcA . ppSrcB[k]</code> four vectors at a time, so
+ * each sample of <code>pSrcA</code> is loaded once for four products. The vectors
+ * of <code>ppSrcB</code> can lie anywhere in memory, for example the weight sets
+ * of several beams. For vectors stored as consecutive rows of a matrix use
+ * <code>arm_mat_vec_mult_q31()</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each product is accumulated as in <code>arm_dot_prod_q31()</code>: the 1.31 by 1.31
+ * products are truncated to 2.48 format and added in 64-bit accumulators of 16.48 format.
+ * The results are in 16.48 format.
+ */
+
+void arm_dot_prod_multi_q31(
+  q31_t * pSrcA,
+  q31_t ** ppSrcB,
+  uint32_t numVecs,
+  uint32_t blockSize,
+  q63_t * pResult)
+{
+  q31_t *pA;                                     /* common vector pointer */
+  q31_t *pB0, *pB1, *pB2, *pB3;                  /* vectors of the current group */
+  q63_t sum0, sum1, sum2, sum3;                  /* accumulators */
+  q31_t a;                                       /* sample of the common vector */
+  uint32_t vecCnt, blkCnt;                       /* loop counters */
+
+  /* Loop unrolling: four vectors at a time */
+  vecCnt = numVecs >> 2u;
+
+  while(vecCnt > 0u)
+  {
+    pB0 = ppSrcB[0];
+    pB1 = ppSrcB[1];
+    pB2 = ppSrcB[2];
+    pB3 = ppSrcB[3];
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+    pA = pSrcA;
+    blkCnt = blockSize;
+
+    /* Each sample of the common vector is loaded once for the four products */
+    while(blkCnt > 0u)
+    {
+      a = *pA++;
+      sum0 += ((q63_t) a * *pB0++) >> 14;
+      sum1 += ((q63_t) a * *pB1++) >> 14;
+      sum2 += ((q63_t) a * *pB2++) >> 14;
+      sum3 += ((q63_t) a * *pB3++) >> 14;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    pResult[0] = sum0;
+    pResult[1] = sum1;
+    pResult[2] = sum2;
+    pResult[3] = sum3;
+
+    pResult += 4u;
+    ppSrcB += 4u;
+
+    /* Decrement the loop counter */
+    vecCnt--;
+  }
+
+  /* Remaining 1 to 3 vectors */
+  vecCnt = numVecs % 0x4u;
+
+  while(vecCnt > 0u)
+  {
+    arm_dot_prod_q31(pSrcA, *ppSrcB++, blockSize, pResult++);
+
+    /* Decrement the loop counter */
+    vecCnt--;
+  }
+}
+
+/**
+ * @} end of dot_prod group
+ */
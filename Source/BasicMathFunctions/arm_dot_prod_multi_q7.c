@@ -0,0 +1,174 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_dot_prod_multi_q7.c
+*
+* Description:	Q7 dot products of one vector with several vectors.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup dot_prod
+ * @{
+ */
+
+/**
+ * @brief Dot products of a Q7 vector with several vectors.
+ * @param[in]       *pSrcA points to the common input vector
+ * @param[in]       **ppSrcB points to an array of numVecs pointers to the other input vectors
+ * @param[in]       numVecs number of dot products
+ * @param[in]       blockSize number of samples in each vector
+ * @param[out]      *pResult points to the numVecs results
+ * @return none.
+ *
+ * \par
+ * Computes <code>pResult[k] = pSrcA . ppSrcB[k]</code> four vectors at a time, so
+ * each sample of <code>pSrcA</code> is loaded once for four products. The vectors
+ * of <code>ppSrcB</code> can lie anywhere in memory, for example the weight sets
+ * of several beams. For vectors stored as consecutive rows of a matrix use
+ * <code>arm_mat_vec_mult_q7()</code>.
+ *
+ * \par Conditions for optimum performance
+ *  Input buffers should be aligned by 32-bit
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each product is accumulated as in <code>arm_dot_prod_q7()</code>: the 1.7 by 1.7
+ * products are in 2.14 format and are added in 32-bit accumulators of 18.14 format.
+ * The results are in 18.14 format.
+ */
+
+void arm_dot_prod_multi_q7(
+  q7_t * pSrcA,
+  q7_t ** ppSrcB,
+  uint32_t numVecs,
+  uint32_t blockSize,
+  q31_t * pResult)
+{
+  q7_t *pA;                                      /* common vector pointer */
+  q7_t *pB0, *pB1, *pB2, *pB3;                   /* vectors of the current group */
+  q31_t sum0, sum1, sum2, sum3;                  /* accumulators */
+  q31_t in0, in1, in2, in3;                      /* four samples of each vector */
+  q31_t a, a13, a02;                             /* four samples of the common vector, odd and even pairs */
+  uint32_t vecCnt, blkCnt;                       /* loop counters */
+
+  /* Loop unrolling: four vectors at a time */
+  vecCnt = numVecs >> 2u;
+
+  while(vecCnt > 0u)
+  {
+    pB0 = ppSrcB[0];
+    pB1 = ppSrcB[1];
+    pB2 = ppSrcB[2];
+    pB3 = ppSrcB[3];
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+    pA = pSrcA;
+
+    /* Four samples at a time: the common vector is loaded and extended once for the four products */
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      a = *__SIMD32(pA)++;
+      in0 = *__SIMD32(pB0)++;
+      in1 = *__SIMD32(pB1)++;
+      in2 = *__SIMD32(pB2)++;
+      in3 = *__SIMD32(pB3)++;
+
+#ifdef CCS
+
+      /* extract the odd and the even q7_t samples to q15_t samples */
+      a13 = __SXTB16(a, 8);
+      a02 = __SXTB16(a, 0);
+
+      sum0 = __SMLAD(a13, __SXTB16(in0, 8), sum0);
+      sum1 = __SMLAD(a13, __SXTB16(in1, 8), sum1);
+      sum2 = __SMLAD(a13, __SXTB16(in2, 8), sum2);
+      sum3 = __SMLAD(a13, __SXTB16(in3, 8), sum3);
+
+      sum0 = __SMLAD(a02, __SXTB16(in0, 0), sum0);
+      sum1 = __SMLAD(a02, __SXTB16(in1, 0), sum1);
+      sum2 = __SMLAD(a02, __SXTB16(in2, 0), sum2);
+      sum3 = __SMLAD(a02, __SXTB16(in3, 0), sum3);
+
+#else
+
+      /* extract the odd and the even q7_t samples to q15_t samples */
+      a13 = __SXTB16(__ROR(a, 8));
+      a02 = __SXTB16(a);
+
+      sum0 = __SMLAD(a13, __SXTB16(__ROR(in0, 8)), sum0);
+      sum1 = __SMLAD(a13, __SXTB16(__ROR(in1, 8)), sum1);
+      sum2 = __SMLAD(a13, __SXTB16(__ROR(in2, 8)), sum2);
+      sum3 = __SMLAD(a13, __SXTB16(__ROR(in3, 8)), sum3);
+
+      sum0 = __SMLAD(a02, __SXTB16(in0), sum0);
+      sum1 = __SMLAD(a02, __SXTB16(in1), sum1);
+      sum2 = __SMLAD(a02, __SXTB16(in2), sum2);
+      sum3 = __SMLAD(a02, __SXTB16(in3), sum3);
+
+#endif
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Remaining 1 to 3 samples */
+    blkCnt = blockSize % 0x4u;
+
+    while(blkCnt > 0u)
+    {
+      a = *pA++;
+      sum0 += (q15_t) a * *pB0++;
+      sum1 += (q15_t) a * *pB1++;
+      sum2 += (q15_t) a * *pB2++;
+      sum3 += (q15_t) a * *pB3++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    pResult[0] = sum0;
+    pResult[1] = sum1;
+    pResult[2] = sum2;
+    pResult[3] = sum3;
+
+    pResult += 4u;
+    ppSrcB += 4u;
+
+    /* Decrement the loop counter */
+    vecCnt--;
+  }
+
+  /* Remaining 1 to 3 vectors */
+  vecCnt = numVecs % 0x4u;
+
+  while(vecCnt > 0u)
+  {
+    arm_dot_prod_q7(pSrcA, *ppSrcB++, blockSize, pResult++);
+
+    /* Decrement the loop counter */
+    vecCnt--;
+  }
+}
+
+/**
+ * @} end of dot_prod group
+ */
@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_gain_offset_clip_f32.c
+*
+* Description:	Floating-point fused gain, offset and clip.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @defgroup GainOffsetClip Vector Gain, Offset and Clip
+ *
+ * Applies a per-sample gain, a scale factor and an offset to a vector and limits the
+ * result to a range, in a single pass over the data:
+ * <pre>
+ *     pDst[n] = min(max(scale * pSrc[n] * pGain[n] + offset, minVal), maxVal),   0 <= n < blockSize.
+ * </pre>
+ * This is equivalent to <code>arm_mult</code>, <code>arm_scale</code> and
+ * <code>arm_offset</code> followed by a clip, but reads each input and writes each output
+ * once instead of making four sweeps over the buffer.
+ *
+ * \par
+ * The fixed-point functions use the same <code>scaleFract</code> and <code>shift</code>
+ * representation of the scale factor as <code>arm_scale</code>, so the scale factor is
+ * <code>scaleFract * 2^shift</code>. The intermediate result is kept in a wider format and the
+ * clip to <code>[minVal, maxVal]</code> also saturates it to the output format.
+ * <code>pDst</code> may point to <code>pSrc</code> or <code>pGain</code> for in-place operation.
+ * The functions support floating-point, Q31, Q15 and Q7 data types.
+ */
+
+/**
+ * @addtogroup GainOffsetClip
+ * @{
+ */
+
+/**
+ * @brief Applies a gain vector, a scale factor, an offset and a clip to a floating-point vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       *pGain points to the gain vector
+ * @param[in]       scale scale factor
+ * @param[in]       offset offset added after scaling
+ * @param[in]       minVal lower limit of the output
+ * @param[in]       maxVal upper limit of the output
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in the vectors
+ * @return none.
+ */
+
+void arm_gain_offset_clip_f32(
+  float32_t * pSrc,
+  float32_t * pGain,
+  float32_t scale,
+  float32_t offset,
+  float32_t minVal,
+  float32_t maxVal,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t out1, out2, out3, out4;              /* temporary output variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = clip(scale * A * G + offset) */
+    out1 = (scale * pSrc[0] * pGain[0]) + offset;
+    out2 = (scale * pSrc[1] * pGain[1]) + offset;
+    out3 = (scale * pSrc[2] * pGain[2]) + offset;
+    out4 = (scale * pSrc[3] * pGain[3]) + offset;
+
+    /* limit the results to [minVal, maxVal] */
+    out1 = (out1 > minVal) ? out1 : minVal;
+    out2 = (out2 > minVal) ? out2 : minVal;
+    out3 = (out3 > minVal) ? out3 : minVal;
+    out4 = (out4 > minVal) ? out4 : minVal;
+
+    out1 = (out1 < maxVal) ? out1 : maxVal;
+    out2 = (out2 < maxVal) ? out2 : maxVal;
+    out3 = (out3 < maxVal) ? out3 : maxVal;
+    out4 = (out4 < maxVal) ? out4 : maxVal;
+
+    /* store the results */
+    pDst[0] = out1;
+    pDst[1] = out2;
+    pDst[2] = out3;
+    pDst[3] = out4;
+
+    /* update pointers to process next samples */
+    pSrc += 4u;
+    pGain += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = clip(scale * A * G + offset) */
+    out1 = (scale * *pSrc++ * *pGain++) + offset;
+    out1 = (out1 > minVal) ? out1 : minVal;
+    *pDst++ = (out1 < maxVal) ? out1 : maxVal;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of GainOffsetClip group
+ */
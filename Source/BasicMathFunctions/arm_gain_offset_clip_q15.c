@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_gain_offset_clip_q15.c
+*
+* Description:	Q15 fused gain, offset and clip.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup GainOffsetClip
+ * @{
+ */
+
+/**
+ * @brief Applies a gain vector, a scale factor, an offset and a clip to a Q15 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       *pGain points to the gain vector
+ * @param[in]       scaleFract fractional portion of the scale value
+ * @param[in]       shift number of bits to shift the result by, at most 15
+ * @param[in]       offset offset added after scaling
+ * @param[in]       minVal lower limit of the output
+ * @param[in]       maxVal upper limit of the output
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in the vectors
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input, the gain and <code>scaleFract</code> are in 1.15 format. The product of the
+ * input and the gain is truncated to 2.15 format and multiplied by <code>scaleFract</code>,
+ * and the 3.30 result is shifted to 1.15 format in 32-bit precision. The offset is added
+ * and the sum is limited to <code>[minVal, maxVal]</code>, which also saturates it to Q15.
+ */
+
+void arm_gain_offset_clip_q15(
+  q15_t * pSrc,
+  q15_t * pGain,
+  q15_t scaleFract,
+  int8_t shift,
+  q15_t offset,
+  q15_t minVal,
+  q15_t maxVal,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  int8_t kShift = 15 - shift;                    /* Shift to apply after scaling */
+  q31_t inA1, inA2, inG1, inG2;                  /* temporary input variables */
+  q31_t out1, out2, out3, out4;                  /* temporary output variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* read two samples at a time from the source and the gain */
+    inA1 = *__SIMD32(pSrc)++;
+    inG1 = *__SIMD32(pGain)++;
+    inA2 = *__SIMD32(pSrc)++;
+    inG2 = *__SIMD32(pGain)++;
+
+    /* multiply the inputs by the gains, result in 2.15 format */
+    out1 = ((q31_t) ((q15_t) inA1) * (q15_t) inG1) >> 15;
+    out2 = ((q31_t) ((q15_t) (inA1 >> 16)) * (q15_t) (inG1 >> 16)) >> 15;
+    out3 = ((q31_t) ((q15_t) inA2) * (q15_t) inG2) >> 15;
+    out4 = ((q31_t) ((q15_t) (inA2 >> 16)) * (q15_t) (inG2 >> 16)) >> 15;
+
+    /* scale and add the offset */
+    out1 = ((out1 * scaleFract) >> kShift) + offset;
+    out2 = ((out2 * scaleFract) >> kShift) + offset;
+    out3 = ((out3 * scaleFract) >> kShift) + offset;
+    out4 = ((out4 * scaleFract) >> kShift) + offset;
+
+    /* limit the results to [minVal, maxVal] */
+    out1 = (out1 > minVal) ? out1 : minVal;
+    out2 = (out2 > minVal) ? out2 : minVal;
+    out3 = (out3 > minVal) ? out3 : minVal;
+    out4 = (out4 > minVal) ? out4 : minVal;
+
+    out1 = (out1 < maxVal) ? out1 : maxVal;
+    out2 = (out2 < maxVal) ? out2 : maxVal;
+    out3 = (out3 < maxVal) ? out3 : maxVal;
+    out4 = (out4 < maxVal) ? out4 : maxVal;
+
+    /* store the results, each in the half word it was read from */
+    *__SIMD32(pDst)++ = __PKHBT(out1, out2, 16);
+    *__SIMD32(pDst)++ = __PKHBT(out3, out4, 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = clip(scale * A * G + offset) */
+    out1 = ((q31_t) * pSrc++ * *pGain++) >> 15;
+    out1 = ((out1 * scaleFract) >> kShift) + offset;
+    out1 = (out1 > minVal) ? out1 : minVal;
+    *pDst++ = (q15_t) ((out1 < maxVal) ? out1 : maxVal);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of GainOffsetClip group
+ */
@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_gain_offset_clip_q7.c
+*
+* Description:	Q7 fused gain, offset and clip.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup GainOffsetClip
+ * @{
+ */
+
+/**
+ * @brief Applies a gain vector, a scale factor, an offset and a clip to a Q7 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       *pGain points to the gain vector
+ * @param[in]       scaleFract fractional portion of the scale value
+ * @param[in]       shift number of bits to shift the result by, at most 7
+ * @param[in]       offset offset added after scaling
+ * @param[in]       minVal lower limit of the output
+ * @param[in]       maxVal upper limit of the output
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in the vectors
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input, the gain and <code>scaleFract</code> are in 1.7 format. The product of the
+ * input and the gain is truncated to 2.7 format and multiplied by <code>scaleFract</code>,
+ * and the 3.14 result is shifted to 1.7 format in 32-bit precision. The offset is added
+ * and the sum is limited to <code>[minVal, maxVal]</code>, which also saturates it to Q7.
+ */
+
+void arm_gain_offset_clip_q7(
+  q7_t * pSrc,
+  q7_t * pGain,
+  q7_t scaleFract,
+  int8_t shift,
+  q7_t offset,
+  q7_t minVal,
+  q7_t maxVal,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  int8_t kShift = 7 - shift;                     /* Shift to apply after scaling */
+  q31_t out1, out2, out3, out4;                  /* temporary output variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* multiply the inputs by the gains, result in 2.7 format */
+    out1 = ((q31_t) pSrc[0] * pGain[0]) >> 7;
+    out2 = ((q31_t) pSrc[1] * pGain[1]) >> 7;
+    out3 = ((q31_t) pSrc[2] * pGain[2]) >> 7;
+    out4 = ((q31_t) pSrc[3] * pGain[3]) >> 7;
+
+    /* scale and add the offset */
+    out1 = ((out1 * scaleFract) >> kShift) + offset;
+    out2 = ((out2 * scaleFract) >> kShift) + offset;
+    out3 = ((out3 * scaleFract) >> kShift) + offset;
+    out4 = ((out4 * scaleFract) >> kShift) + offset;
+
+    /* limit the results to [minVal, maxVal] */
+    out1 = (out1 > minVal) ? out1 : minVal;
+    out2 = (out2 > minVal) ? out2 : minVal;
+    out3 = (out3 > minVal) ? out3 : minVal;
+    out4 = (out4 > minVal) ? out4 : minVal;
+
+    out1 = (out1 < maxVal) ? out1 : maxVal;
+    out2 = (out2 < maxVal) ? out2 : maxVal;
+    out3 = (out3 < maxVal) ? out3 : maxVal;
+    out4 = (out4 < maxVal) ? out4 : maxVal;
+
+    /* update pointers to process next samples */
+    pSrc += 4u;
+    pGain += 4u;
+
+    /* Store the results of 4 inputs in the destination buffer in single cycle by packing */
+    *__SIMD32(pDst)++ = __PACKq7(out1, out2, out3, out4);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = clip(scale * A * G + offset) */
+    out1 = ((q31_t) * pSrc++ * *pGain++) >> 7;
+    out1 = ((out1 * scaleFract) >> kShift) + offset;
+    out1 = (out1 > minVal) ? out1 : minVal;
+    *pDst++ = (q7_t) ((out1 < maxVal) ? out1 : maxVal);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of GainOffsetClip group
+ */
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mask_popcount.c
+*
+* Description:	Population count of a bitmask.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @defgroup MaskOps Bitmask Operations
+ *
+ * Reduce the bitmasks produced by the compare functions. <code>arm_mask_popcount()</code>
+ * counts the set bits, for example the samples that failed a limit check, and
+ * <code>arm_mask_to_index()</code> lists the indices of the set bits in increasing order
+ * so that only the flagged samples are processed further.
+ *
+ * \par
+ * Bits of the last mask word past <code>blockSize</code> are ignored.
+ */
+
+/**
+ * @addtogroup MaskOps
+ * @{
+ */
+
+/**
+ * @brief  Counts the set bits of a bitmask.
+ * @param[in]  *pMask points to the bitmask of ARM_MASK_WORDS(blockSize) words.
+ * @param[in]  blockSize number of bits in the mask.
+ * @return number of set bits.
+ */
+
+uint32_t arm_mask_popcount(
+  uint32_t * pMask,
+  uint32_t blockSize)
+{
+  uint32_t word;                                 /* Current mask word */
+  uint32_t count = 0u;                           /* Number of set bits */
+  uint32_t wordCnt;                              /* Loop counter */
+
+  wordCnt = ARM_MASK_WORDS(blockSize);
+
+  while(wordCnt > 0u)
+  {
+    word = *pMask++;
+
+    /* Clear the bits past the end of the mask */
+    if((wordCnt == 1u) && ((blockSize & 0x1Fu) != 0u))
+    {
+      word &= (1u << (blockSize & 0x1Fu)) - 1u;
+    }
+
+    /* Count the bits in pairs, nibbles and bytes, then add the four bytes */
+    word = word - ((word >> 1) & 0x55555555u);
+    word = (word & 0x33333333u) + ((word >> 2) & 0x33333333u);
+    word = (word + (word >> 4)) & 0x0F0F0F0Fu;
+    count += (word * 0x01010101u) >> 24;
+
+    /* Decrement the loop counter */
+    wordCnt--;
+  }
+
+  return (count);
+}
+
+/**
+ * @} end of MaskOps group
+ */
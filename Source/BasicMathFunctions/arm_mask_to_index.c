@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mask_to_index.c
+*
+* Description:	Indices of the set bits of a bitmask.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup MaskOps
+ * @{
+ */
+
+/**
+ * @brief  Lists the indices of the set bits of a bitmask.
+ * @param[in]  *pMask points to the bitmask of ARM_MASK_WORDS(blockSize) words.
+ * @param[in]  blockSize number of bits in the mask.
+ * @param[out] *pIndex points to the indices of the set bits, in increasing order. The
+ *             buffer must hold arm_mask_popcount(pMask, blockSize) entries.
+ * @return number of indices written.
+ *
+ * \par
+ * Words without set bits cost one test, and each set bit is located with a count of
+ * leading zeros, so a sparse mask is walked in far fewer steps than its length.
+ */
+
+uint32_t arm_mask_to_index(
+  uint32_t * pMask,
+  uint32_t * pIndex,
+  uint32_t blockSize)
+{
+  uint32_t word;                                 /* Remaining bits of the mask word */
+  uint32_t low;                                  /* Lowest set bit */
+  uint32_t base = 0u;                            /* Index of bit 0 of the word */
+  uint32_t count = 0u;                           /* Number of indices written */
+  uint32_t wordCnt;                              /* Loop counter */
+
+  wordCnt = ARM_MASK_WORDS(blockSize);
+
+  while(wordCnt > 0u)
+  {
+    word = *pMask++;
+
+    /* Clear the bits past the end of the mask */
+    if((wordCnt == 1u) && ((blockSize & 0x1Fu) != 0u))
+    {
+      word &= (1u << (blockSize & 0x1Fu)) - 1u;
+    }
+
+    while(word != 0u)
+    {
+      /* Isolate the lowest set bit and remove it */
+      low = word & (0u - word);
+      word ^= low;
+
+      *pIndex++ = base + (31u - __CLZ(low));
+      count++;
+    }
+
+    base += 32u;
+
+    /* Decrement the loop counter */
+    wordCnt--;
+  }
+
+  return (count);
+}
+
+/**
+ * @} end of MaskOps group
+ */
@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mult_acc_f32.c
+*
+* Description:	Floating-point vector multiply-accumulate.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @defgroup MultAcc Vector Multiply-Accumulate
+ *
+ * Multiplies two vectors element-by-element and adds the products to the destination:
+ * <pre>
+ *     pDst[n] = pDst[n] + pSrcA[n] * pSrcB[n],   0 <= n < blockSize.
+ * </pre>
+ * This replaces an <code>arm_mult</code> into a temporary buffer followed by an
+ * <code>arm_add</code>. The fixed-point functions add the product to the destination before
+ * saturating, so the only saturation is that of the final sum.
+ * The functions support floating-point, Q31, Q15 and Q7 data types.
+ */
+
+/**
+ * @addtogroup MultAcc
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector multiply-accumulate.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in,out]   *pDst points to the accumulator vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_mult_acc_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t out1, out2, out3, out4;              /* temporary output variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = C + A * B */
+    out1 = pDst[0] + (pSrcA[0] * pSrcB[0]);
+    out2 = pDst[1] + (pSrcA[1] * pSrcB[1]);
+    out3 = pDst[2] + (pSrcA[2] * pSrcB[2]);
+    out4 = pDst[3] + (pSrcA[3] * pSrcB[3]);
+
+    /* store the results */
+    pDst[0] = out1;
+    pDst[1] = out2;
+    pDst[2] = out3;
+    pDst[3] = out4;
+
+    /* update pointers to process next samples */
+    pSrcA += 4u;
+    pSrcB += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = C + A * B */
+    *pDst += (*pSrcA++ * *pSrcB++);
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of MultAcc group
+ */
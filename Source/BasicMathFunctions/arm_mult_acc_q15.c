@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mult_acc_q15.c
+*
+* Description:	Q15 vector multiply-accumulate.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup MultAcc
+ * @{
+ */
+
+/**
+ * @brief Q15 vector multiply-accumulate.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in,out]   *pDst points to the accumulator vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 2.30 product is truncated to 2.15 format and added to the accumulator in 32-bit
+ * precision. The sum is saturated to the Q15 range [0x8000 0x7FFF].
+ */
+
+void arm_mult_acc_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t inA1, inA2, inB1, inB2;                  /* temporary input variables */
+  q31_t acc1, acc2;                              /* packed accumulator values */
+  q31_t out1, out2, out3, out4;                  /* temporary output variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* read two samples at a time from each source and the accumulator */
+    inA1 = *__SIMD32(pSrcA)++;
+    inB1 = *__SIMD32(pSrcB)++;
+    inA2 = *__SIMD32(pSrcA)++;
+    inB2 = *__SIMD32(pSrcB)++;
+    acc1 = _SIMD32_OFFSET(pDst);
+    acc2 = _SIMD32_OFFSET(pDst + 2);
+
+    /* C = C + A * B */
+    out1 = (q15_t) acc1 + (((q15_t) inA1 * (q15_t) inB1) >> 15);
+    out2 = (q15_t) (acc1 >> 16) + (((q15_t) (inA1 >> 16) * (q15_t) (inB1 >> 16)) >> 15);
+    out3 = (q15_t) acc2 + (((q15_t) inA2 * (q15_t) inB2) >> 15);
+    out4 = (q15_t) (acc2 >> 16) + (((q15_t) (inA2 >> 16) * (q15_t) (inB2 >> 16)) >> 15);
+
+    /* saturate to 1.15 format */
+    out1 = __SSAT(out1, 16);
+    out2 = __SSAT(out2, 16);
+    out3 = __SSAT(out3, 16);
+    out4 = __SSAT(out4, 16);
+
+    /* store the results, each in the half word it was read from */
+    *__SIMD32(pDst)++ = __PKHBT(out1, out2, 16);
+    *__SIMD32(pDst)++ = __PKHBT(out3, out4, 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = C + A * B */
+    out1 = *pDst + ((*pSrcA++ * *pSrcB++) >> 15);
+    *pDst++ = (q15_t) __SSAT(out1, 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of MultAcc group
+ */
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mult_acc_q31.c
+*
+* Description:	Q31 vector multiply-accumulate.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup MultAcc
+ * @{
+ */
+
+/**
+ * @brief Q31 vector multiply-accumulate.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in,out]   *pDst points to the accumulator vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 2.62 product is truncated to 2.31 format and added to the accumulator in 64-bit
+ * precision. The sum is saturated to the Q31 range [0x80000000 0x7FFFFFFF].
+ */
+
+void arm_mult_acc_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q63_t out1, out2, out3, out4;                  /* temporary output variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = C + A * B */
+    out1 = (q63_t) pDst[0] + (((q63_t) pSrcA[0] * pSrcB[0]) >> 31);
+    out2 = (q63_t) pDst[1] + (((q63_t) pSrcA[1] * pSrcB[1]) >> 31);
+    out3 = (q63_t) pDst[2] + (((q63_t) pSrcA[2] * pSrcB[2]) >> 31);
+    out4 = (q63_t) pDst[3] + (((q63_t) pSrcA[3] * pSrcB[3]) >> 31);
+
+    /* saturate and store the results */
+    pDst[0] = clip_q63_to_q31(out1);
+    pDst[1] = clip_q63_to_q31(out2);
+    pDst[2] = clip_q63_to_q31(out3);
+    pDst[3] = clip_q63_to_q31(out4);
+
+    /* update pointers to process next samples */
+    pSrcA += 4u;
+    pSrcB += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = C + A * B */
+    out1 = (q63_t) * pDst + (((q63_t) * pSrcA++ * *pSrcB++) >> 31);
+    *pDst++ = clip_q63_to_q31(out1);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of MultAcc group
+ */
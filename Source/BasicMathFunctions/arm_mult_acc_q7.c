@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mult_acc_q7.c
+*
+* Description:	Q7 vector multiply-accumulate.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup MultAcc
+ * @{
+ */
+
+/**
+ * @brief Q7 vector multiply-accumulate.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in,out]   *pDst points to the accumulator vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 2.14 product is truncated to 2.7 format and added to the accumulator in 32-bit
+ * precision. The sum is saturated to the Q7 range [0x80 0x7F].
+ */
+
+void arm_mult_acc_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t out1, out2, out3, out4;                  /* temporary output variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = C + A * B */
+    out1 = pDst[0] + (((q31_t) pSrcA[0] * pSrcB[0]) >> 7);
+    out2 = pDst[1] + (((q31_t) pSrcA[1] * pSrcB[1]) >> 7);
+    out3 = pDst[2] + (((q31_t) pSrcA[2] * pSrcB[2]) >> 7);
+    out4 = pDst[3] + (((q31_t) pSrcA[3] * pSrcB[3]) >> 7);
+
+    /* update pointers to process next samples */
+    pSrcA += 4u;
+    pSrcB += 4u;
+
+    /* saturate and store the results of 4 inputs by packing */
+    *__SIMD32(pDst)++ = __PACKq7(__SSAT(out1, 8), __SSAT(out2, 8),
+                                 __SSAT(out3, 8), __SSAT(out4, 8));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = C + A * B */
+    out1 = *pDst + (((q31_t) * pSrcA++ * *pSrcB++) >> 7);
+    *pDst++ = (q7_t) __SSAT(out1, 8);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of MultAcc group
+ */
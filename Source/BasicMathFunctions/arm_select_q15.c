@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_select_q15.c
+*
+* Description:	Q15 mask select.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup MaskSelect
+ * @{
+ */
+
+/**
+ * @brief  Selects elements from two Q15 vectors under a bitmask.
+ * @param[in]  *pSrcA points to the vector selected where a mask bit is set.
+ * @param[in]  *pSrcB points to the vector selected where a mask bit is clear.
+ * @param[in]  *pMask points to the bitmask of ARM_MASK_WORDS(blockSize) words.
+ * @param[out] *pDst points to the output vector.
+ * @param[in]  blockSize number of samples in the vectors.
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ */
+
+void arm_select_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  uint32_t * pMask,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t inA1, inA2, inB1, inB2;                  /* Two samples each */
+  q31_t out;                                     /* Two selected samples */
+  uint32_t sel1, sel2;                           /* Lane masks of two samples */
+  uint32_t mask;                                 /* Remaining bits of the mask word */
+  uint32_t bit;                                  /* Bit of the current sample */
+  uint32_t wordCnt, blkCnt;                      /* Loop counters */
+
+  /* Whole mask words, 32 samples each */
+  wordCnt = blockSize >> 5u;
+
+  while(wordCnt > 0u)
+  {
+    mask = *pMask++;
+
+    /* Select 4 samples at a time */
+    for (bit = 0u; bit < 32u; bit += 4u)
+    {
+      inA1 = *__SIMD32(pSrcA)++;
+      inA2 = *__SIMD32(pSrcA)++;
+      inB1 = *__SIMD32(pSrcB)++;
+      inB2 = *__SIMD32(pSrcB)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      /* One mask bit in the low bit of each half word, the first sample is the low one */
+      sel1 = (mask & 1u) | ((mask & 2u) << 15);
+      sel2 = ((mask >> 2) & 1u) | ((mask & 8u) << 13);
+
+#else
+
+      /* One mask bit in the low bit of each half word, the first sample is the high one */
+      sel1 = ((mask & 1u) << 16) | ((mask >> 1) & 1u);
+      sel2 = ((mask & 4u) << 14) | ((mask >> 3) & 1u);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      /* All ones in the half words holding 1, then A where set and B elsewhere */
+      sel1 *= 0xFFFFu;
+      sel2 *= 0xFFFFu;
+
+      out = (q31_t) (((uint32_t) inA1 & sel1) | ((uint32_t) inB1 & ~sel1));
+      *__SIMD32(pDst)++ = out;
+
+      out = (q31_t) (((uint32_t) inA2 & sel2) | ((uint32_t) inB2 & ~sel2));
+      *__SIMD32(pDst)++ = out;
+
+      mask >>= 4u;
+    }
+
+    /* Decrement the loop counter */
+    wordCnt--;
+  }
+
+  /* Remaining samples of a partial last word */
+  blkCnt = blockSize & 0x1Fu;
+
+  if(blkCnt > 0u)
+  {
+    mask = *pMask;
+
+    while(blkCnt > 0u)
+    {
+      *pDst++ = ((mask & 1u) != 0u) ? *pSrcA : *pSrcB;
+
+      mask >>= 1u;
+      pSrcA++;
+      pSrcB++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of MaskSelect group
+ */
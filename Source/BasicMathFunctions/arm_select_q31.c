@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_select_q31.c
+*
+* Description:	Q31 mask select.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup MaskSelect
+ * @{
+ */
+
+/**
+ * @brief  Selects elements from two Q31 vectors under a bitmask.
+ * @param[in]  *pSrcA points to the vector selected where a mask bit is set.
+ * @param[in]  *pSrcB points to the vector selected where a mask bit is clear.
+ * @param[in]  *pMask points to the bitmask of ARM_MASK_WORDS(blockSize) words.
+ * @param[out] *pDst points to the output vector.
+ * @param[in]  blockSize number of samples in the vectors.
+ * @return none.
+ */
+
+void arm_select_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  uint32_t * pMask,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t mask;                                 /* Remaining bits of the mask word */
+  uint32_t bit;                                  /* Bit of the current sample */
+  uint32_t wordCnt, blkCnt;                      /* Loop counters */
+
+  /* Whole mask words, 32 samples each */
+  wordCnt = blockSize >> 5u;
+
+  while(wordCnt > 0u)
+  {
+    mask = *pMask++;
+
+    /* Select 4 samples at a time */
+    for (bit = 0u; bit < 32u; bit += 4u)
+    {
+      pDst[0] = ((mask & 1u) != 0u) ? pSrcA[0] : pSrcB[0];
+      pDst[1] = ((mask & 2u) != 0u) ? pSrcA[1] : pSrcB[1];
+      pDst[2] = ((mask & 4u) != 0u) ? pSrcA[2] : pSrcB[2];
+      pDst[3] = ((mask & 8u) != 0u) ? pSrcA[3] : pSrcB[3];
+
+      mask >>= 4u;
+      pSrcA += 4u;
+      pSrcB += 4u;
+      pDst += 4u;
+    }
+
+    /* Decrement the loop counter */
+    wordCnt--;
+  }
+
+  /* Remaining samples of a partial last word */
+  blkCnt = blockSize & 0x1Fu;
+
+  if(blkCnt > 0u)
+  {
+    mask = *pMask;
+
+    while(blkCnt > 0u)
+    {
+      *pDst++ = ((mask & 1u) != 0u) ? *pSrcA : *pSrcB;
+
+      mask >>= 1u;
+      pSrcA++;
+      pSrcB++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of MaskSelect group
+ */
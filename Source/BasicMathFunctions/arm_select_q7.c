@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_select_q7.c
+*
+* Description:	Q7 mask select.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup MaskSelect
+ * @{
+ */
+
+/**
+ * @brief  Selects elements from two Q7 vectors under a bitmask.
+ * @param[in]  *pSrcA points to the vector selected where a mask bit is set.
+ * @param[in]  *pSrcB points to the vector selected where a mask bit is clear.
+ * @param[in]  *pMask points to the bitmask of ARM_MASK_WORDS(blockSize) words.
+ * @param[out] *pDst points to the output vector.
+ * @param[in]  blockSize number of samples in the vectors.
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ */
+
+void arm_select_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  uint32_t * pMask,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t inA1, inA2, inB1, inB2;                  /* Four samples each */
+  q31_t out;                                     /* Four selected samples */
+  uint32_t sel1, sel2;                           /* Lane masks of four samples */
+  uint32_t mask;                                 /* Remaining bits of the mask word */
+  uint32_t bit;                                  /* Bit of the current sample */
+  uint32_t wordCnt, blkCnt;                      /* Loop counters */
+
+  /* Whole mask words, 32 samples each */
+  wordCnt = blockSize >> 5u;
+
+  while(wordCnt > 0u)
+  {
+    mask = *pMask++;
+
+    /* Select 8 samples at a time */
+    for (bit = 0u; bit < 32u; bit += 8u)
+    {
+      inA1 = *__SIMD32(pSrcA)++;
+      inA2 = *__SIMD32(pSrcA)++;
+      inB1 = *__SIMD32(pSrcB)++;
+      inB2 = *__SIMD32(pSrcB)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      /* Spread four mask bits to the low bit of each byte, the first sample is the low one */
+      sel1 = ((mask & 0x0Fu) * 0x00204081u) & 0x01010101u;
+      sel2 = (((mask >> 4) & 0x0Fu) * 0x00204081u) & 0x01010101u;
+
+#else
+
+      /* Spread four mask bits to the low bit of each byte, the first sample is the high one */
+      sel1 = (((mask & 0x0Fu) * 0x08040201u) >> 3) & 0x01010101u;
+      sel2 = ((((mask >> 4) & 0x0Fu) * 0x08040201u) >> 3) & 0x01010101u;
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      /* All ones in the bytes holding 1, then A where set and B elsewhere */
+      sel1 *= 0xFFu;
+      sel2 *= 0xFFu;
+
+      out = (q31_t) (((uint32_t) inA1 & sel1) | ((uint32_t) inB1 & ~sel1));
+      *__SIMD32(pDst)++ = out;
+
+      out = (q31_t) (((uint32_t) inA2 & sel2) | ((uint32_t) inB2 & ~sel2));
+      *__SIMD32(pDst)++ = out;
+
+      mask >>= 8u;
+    }
+
+    /* Decrement the loop counter */
+    wordCnt--;
+  }
+
+  /* Remaining samples of a partial last word */
+  blkCnt = blockSize & 0x1Fu;
+
+  if(blkCnt > 0u)
+  {
+    mask = *pMask;
+
+    while(blkCnt > 0u)
+    {
+      *pDst++ = ((mask & 1u) != 0u) ? *pSrcA : *pSrcB;
+
+      mask >>= 1u;
+      pSrcA++;
+      pSrcB++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of MaskSelect group
+ */
@@ -246,3 +246,74 @@ const q31_t armRecipTableQ31[64] = {
   0x4521CCE1, 0x448DB244, 0x43FC0CFA, 0x436CCD78, 0x42DFE4B4, 0x42554426,     
   0x41CCDDB6, 0x4146A3C6, 0x40C28923, 0x40408102     
 };     
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+* \par
+* CORDIC elementary angles <code>atan(2^-i) / pi</code> for i = 0..30 in 1.31 format,
+* so that 0x80000000 corresponds to -pi.
+*/
+const q31_t armCordicAtanTableQ31[31] = {
+  0x20000000, 0x12E4051E, 0x09FB385B, 0x051111D4, 0x028B0D43, 0x0145D7E1,
+  0x00A2F61E, 0x00517C55, 0x0028BE53, 0x00145F2F, 0x000A2F98, 0x000517CC,
+  0x00028BE6, 0x000145F3, 0x0000A2FA, 0x0000517D, 0x000028BE, 0x0000145F,
+  0x00000A30, 0x00000518, 0x0000028C, 0x00000146, 0x000000A3, 0x00000051,
+  0x00000029, 0x00000014, 0x0000000A, 0x00000005, 0x00000003, 0x00000001,
+  0x00000001
+};
+
+/**
+* \par
+* Inverse CORDIC gains <code>1 / prod(sqrt(1 + 2^-2i), i = 0..n-1)</code> in 1.31 format,
+* indexed by n - 1 for n = 1..31 iterations.
+*/
+const q31_t armCordicInvGainTableQ31[31] = {
+  0x5A82799A, 0x50F44D89, 0x4E8986EA, 0x4DEE4507, 0x4DC76B06, 0x4DBDB3EB,
+  0x4DBB461A, 0x4DBAAAA6, 0x4DBA83C9, 0x4DBA7A11, 0x4DBA77A3, 0x4DBA7708,
+  0x4DBA76E1, 0x4DBA76D7, 0x4DBA76D5, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4,
+  0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4,
+  0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4,
+  0x4DBA76D4
+};
+
+/**
+ * @} end of CORDIC group
+ */
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag_fast
+ * @{
+ */
+
+/**
+* \par
+* Reciprocal square roots <code>1 / sqrt(0.25 + i / 64)</code> for i = 0..48 in unsigned 2.30
+* format, used with linear interpolation as the seed of the fixed-point Newton iteration.
+*/
+const uint32_t armRecipSqrtTableQ30[49] = {
+  0x80000000, 0x7C2DA123, 0x78ADF778, 0x7575FAA4, 0x727C9717, 0x6FBA415C,
+  0x6D28A4F0, 0x6AC266BA, 0x6882F5C0, 0x66666666, 0x64695585, 0x6288D173,
+  0x60C2479B, 0x5F137599, 0x5D7A5D1B, 0x5BF539E5, 0x5A82799A, 0x5920B4DF,
+  0x57CEA99D, 0x568B3632, 0x55555555, 0x542C1AA4, 0x530EAFA5, 0x51FC5140,
+  0x50F44D89, 0x4FF601E0, 0x4F00D944, 0x4E144AE9, 0x4D2FD8F4, 0x4C530F65,
+  0x4B7D8317, 0x4AAED0F0, 0x49E69D16, 0x49249249, 0x48686148, 0x47B1C049,
+  0x47006A81, 0x46541FB4, 0x45ACA3D5, 0x4509BEB0, 0x446B3B96, 0x43D0E917,
+  0x433A98C6, 0x42A81EF6, 0x4219528B, 0x418E0CC8, 0x41062920, 0x40818512,
+  0x40000000
+};
+
+/**
+ * @} end of cmplx_mag_fast group
+ */
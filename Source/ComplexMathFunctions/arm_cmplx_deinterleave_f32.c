@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_deinterleave_f32.c
+*
+* Description:	Floating-point interleaved to split complex conversion.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup CmplxInterleave Complex Interleave and Deinterleave
+ *
+ * Converts complex vectors between the interleaved format used by the complex math
+ * and FFT functions, <code>(real, imag, real, imag, ...)</code>, and the split format,
+ * which holds the real parts and the imaginary parts in two separate arrays:
+ * <pre>
+ *     pDstRe[n] = pSrc[(2*n)+0];
+ *     pDstIm[n] = pSrc[(2*n)+1];        0 <= n < numSamples
+ * </pre>
+ * and back again. Split vectors are read with consecutive loads, need no shuffling
+ * when only the real or the imaginary parts are processed, and go straight into the
+ * real vector functions.
+ *
+ * \par
+ * The split format has its own multiplication, magnitude, squared magnitude and dot
+ * product functions, <code>arm_cmplx_<op>_split_<type>()</code>. The remaining
+ * operations reduce to real functions on the planes: the conjugate is
+ * <code>arm_negate_<type>()</code> on the imaginary part, and a complex-by-real
+ * multiplication is <code>arm_mult_<type>()</code> on each part. The FFT functions
+ * take interleaved data; their input is interleaved once and the spectrum is
+ * deinterleaved once, so the rest of a pipeline can stay in the split format.
+ *
+ * \par
+ * The Q15 functions move two samples of each part per load and store.
+ */
+
+/**
+ * @addtogroup CmplxInterleave
+ * @{
+ */
+
+/**
+ * @brief  Splits a floating-point interleaved complex vector into real and imaginary parts.
+ * @param[in]  *pSrc points to the interleaved complex input vector
+ * @param[out] *pDstRe points to the real parts
+ * @param[out] *pDstIm points to the imaginary parts
+ * @param[in]  numSamples number of complex samples
+ * @return none.
+ */
+
+void arm_cmplx_deinterleave_f32(
+  float32_t * pSrc,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples)
+{
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    in1 = pSrc[0];
+    in2 = pSrc[2];
+    in3 = pSrc[4];
+    in4 = pSrc[6];
+
+    pDstRe[0] = in1;
+    pDstRe[1] = in2;
+    pDstRe[2] = in3;
+    pDstRe[3] = in4;
+
+    in1 = pSrc[1];
+    in2 = pSrc[3];
+    in3 = pSrc[5];
+    in4 = pSrc[7];
+
+    pDstIm[0] = in1;
+    pDstIm[1] = in2;
+    pDstIm[2] = in3;
+    pDstIm[3] = in4;
+
+    /* update pointers to process next samples */
+    pSrc += 8u;
+    pDstRe += 4u;
+    pDstIm += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    *pDstRe++ = *pSrc++;
+    *pDstIm++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxInterleave group
+ */
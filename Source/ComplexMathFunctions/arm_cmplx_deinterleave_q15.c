@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_deinterleave_q15.c
+*
+* Description:	Q15 interleaved to split complex conversion.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxInterleave
+ * @{
+ */
+
+/**
+ * @brief  Splits a Q15 interleaved complex vector into real and imaginary parts.
+ * @param[in]  *pSrc points to the interleaved complex input vector
+ * @param[out] *pDstRe points to the real parts
+ * @param[out] *pDstIm points to the imaginary parts
+ * @param[in]  numSamples number of complex samples
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ */
+
+void arm_cmplx_deinterleave_q15(
+  q15_t * pSrc,
+  q15_t * pDstRe,
+  q15_t * pDstIm,
+  uint32_t numSamples)
+{
+  q31_t in1, in2, in3, in4;                      /* One complex sample each */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* read four complex samples */
+    in1 = *__SIMD32(pSrc)++;
+    in2 = *__SIMD32(pSrc)++;
+    in3 = *__SIMD32(pSrc)++;
+    in4 = *__SIMD32(pSrc)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    /* pair the lower half words as real parts and the upper as imaginary parts */
+    *__SIMD32(pDstRe)++ = __PKHBT(in1, in2, 16);
+    *__SIMD32(pDstRe)++ = __PKHBT(in3, in4, 16);
+    *__SIMD32(pDstIm)++ = __PKHTB(in2, in1, 16);
+    *__SIMD32(pDstIm)++ = __PKHTB(in4, in3, 16);
+
+#else
+
+    /* pair the upper half words as real parts and the lower as imaginary parts */
+    *__SIMD32(pDstRe)++ = __PKHTB(in1, in2, 16);
+    *__SIMD32(pDstRe)++ = __PKHTB(in3, in4, 16);
+    *__SIMD32(pDstIm)++ = __PKHBT(in2, in1, 16);
+    *__SIMD32(pDstIm)++ = __PKHBT(in4, in3, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    *pDstRe++ = *pSrc++;
+    *pDstIm++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxInterleave group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_deinterleave_q31.c
+*
+* Description:	Q31 interleaved to split complex conversion.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxInterleave
+ * @{
+ */
+
+/**
+ * @brief  Splits a Q31 interleaved complex vector into real and imaginary parts.
+ * @param[in]  *pSrc points to the interleaved complex input vector
+ * @param[out] *pDstRe points to the real parts
+ * @param[out] *pDstIm points to the imaginary parts
+ * @param[in]  numSamples number of complex samples
+ * @return none.
+ */
+
+void arm_cmplx_deinterleave_q31(
+  q31_t * pSrc,
+  q31_t * pDstRe,
+  q31_t * pDstIm,
+  uint32_t numSamples)
+{
+  q31_t in1, in2, in3, in4;                      /* Temporary input variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    in1 = pSrc[0];
+    in2 = pSrc[2];
+    in3 = pSrc[4];
+    in4 = pSrc[6];
+
+    pDstRe[0] = in1;
+    pDstRe[1] = in2;
+    pDstRe[2] = in3;
+    pDstRe[3] = in4;
+
+    in1 = pSrc[1];
+    in2 = pSrc[3];
+    in3 = pSrc[5];
+    in4 = pSrc[7];
+
+    pDstIm[0] = in1;
+    pDstIm[1] = in2;
+    pDstIm[2] = in3;
+    pDstIm[3] = in4;
+
+    /* update pointers to process next samples */
+    pSrc += 8u;
+    pDstRe += 4u;
+    pDstIm += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    *pDstRe++ = *pSrc++;
+    *pDstIm++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxInterleave group
+ */
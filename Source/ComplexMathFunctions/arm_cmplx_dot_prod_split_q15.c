@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_dot_prod_split_q15.c
+*
+* Description:	Q15 complex dot product in split format.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_dot_prod
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex dot product in split format
+ * @param[in]  *pSrcARe points to the real parts of the first input vector
+ * @param[in]  *pSrcAIm points to the imaginary parts of the first input vector
+ * @param[in]  *pSrcBRe points to the real parts of the second input vector
+ * @param[in]  *pSrcBIm points to the imaginary parts of the second input vector
+ * @param[in]  numSamples number of complex samples in each vector
+ * @param[out] *realResult real part of the result returned here
+ * @param[out] *imagResult imaginary part of the result returned here
+ * @return none.
+ *
+ * \par
+ * Computes the sum of the complex products <code>A[n] * B[n]</code> given at the top
+ * of this group, on vectors in the split format described in \ref CmplxInterleave.
+ *
+ * \par Conditions for optimum performance
+ *  Input buffers should be aligned by 32-bit
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using internal 64-bit accumulators.
+ * The intermediate 1.15 by 1.15 multiplications are performed with full precision and yield a 2.30 result.
+ * These are accumulated in 64-bit accumulators with 34.30 precision.
+ * As a final step, the accumulators are converted to 8.24 format.
+ * The return results <code>realResult</code> and <code>imagResult</code> are in 8.24 format.
+ */
+
+void arm_cmplx_dot_prod_split_q15(
+  q15_t * pSrcARe,
+  q15_t * pSrcAIm,
+  q15_t * pSrcBRe,
+  q15_t * pSrcBIm,
+  uint32_t numSamples,
+  q31_t * realResult,
+  q31_t * imagResult)
+{
+  q63_t sumRR = 0, sumII = 0, imag_sum = 0;      /* Accumulators of ARe*BRe, AIm*BIm and the imaginary part */
+  q31_t a, b, c, d;                              /* Real and imaginary parts of two samples each */
+  q15_t a1, b1, c1, d1;                          /* Temporary variables to store real and imaginary values */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* CReal += ARe[i] * BRe[i] - AIm[i] * BIm[i] */
+    /* CImag += ARe[i] * BIm[i] + AIm[i] * BRe[i] */
+    a = *__SIMD32(pSrcARe)++;
+    b = *__SIMD32(pSrcAIm)++;
+    c = *__SIMD32(pSrcBRe)++;
+    d = *__SIMD32(pSrcBIm)++;
+
+    sumRR = __SMLALD(a, c, sumRR);
+    sumII = __SMLALD(b, d, sumII);
+    imag_sum = __SMLALD(a, d, imag_sum);
+    imag_sum = __SMLALD(b, c, imag_sum);
+
+    a = *__SIMD32(pSrcARe)++;
+    b = *__SIMD32(pSrcAIm)++;
+    c = *__SIMD32(pSrcBRe)++;
+    d = *__SIMD32(pSrcBIm)++;
+
+    sumRR = __SMLALD(a, c, sumRR);
+    sumII = __SMLALD(b, d, sumII);
+    imag_sum = __SMLALD(a, d, imag_sum);
+    imag_sum = __SMLALD(b, c, imag_sum);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    a1 = *pSrcARe++;
+    b1 = *pSrcAIm++;
+    c1 = *pSrcBRe++;
+    d1 = *pSrcBIm++;
+
+    sumRR += (q31_t) a1 * c1;
+    sumII += (q31_t) b1 * d1;
+    imag_sum += (q31_t) a1 * d1;
+    imag_sum += (q31_t) b1 * c1;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Convert the results in 34.30 to 8.24 by 6 right shifts */
+  *realResult = (q31_t) ((sumRR - sumII) >> 6);
+  *imagResult = (q31_t) (imag_sum >> 6);
+}
+
+/**
+ * @} end of cmplx_dot_prod group
+ */
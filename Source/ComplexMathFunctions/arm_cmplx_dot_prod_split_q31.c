@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_dot_prod_split_q31.c
+*
+* Description:	Q31 complex dot product in split format.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_dot_prod
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex dot product in split format
+ * @param[in]  *pSrcARe points to the real parts of the first input vector
+ * @param[in]  *pSrcAIm points to the imaginary parts of the first input vector
+ * @param[in]  *pSrcBRe points to the real parts of the second input vector
+ * @param[in]  *pSrcBIm points to the imaginary parts of the second input vector
+ * @param[in]  numSamples number of complex samples in each vector
+ * @param[out] *realResult real part of the result returned here
+ * @param[out] *imagResult imaginary part of the result returned here
+ * @return none.
+ *
+ * \par
+ * Computes the sum of the complex products <code>A[n] * B[n]</code> given at the top
+ * of this group, on vectors in the split format described in \ref CmplxInterleave.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using an internal 64-bit accumulator.
+ * The intermediate 1.31 by 1.31 multiplications are performed with 64-bit precision and then shifted to 16.48 format.
+ * The internal real and imaginary accumulators are in 16.48 format and provide 15 guard bits.
+ * Additions are nonsaturating and no overflow will occur as long as <code>numSamples</code> is less than 16384.
+ * The return results <code>realResult</code> and <code>imagResult</code> are in 16.48 format.
+ * Input down scaling is not required.
+ */
+
+void arm_cmplx_dot_prod_split_q31(
+  q31_t * pSrcARe,
+  q31_t * pSrcAIm,
+  q31_t * pSrcBRe,
+  q31_t * pSrcBIm,
+  uint32_t numSamples,
+  q63_t * realResult,
+  q63_t * imagResult)
+{
+  q63_t real_sum = 0, imag_sum = 0;              /* Temporary result storage */
+  q31_t a1, b1, c1, d1;                          /* Temporary variables to store real and imaginary values */
+  q31_t a2, b2, c2, d2;                          /* Temporary variables to store real and imaginary values */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* CReal += ARe[i] * BRe[i] - AIm[i] * BIm[i] */
+    /* CImag += ARe[i] * BIm[i] + AIm[i] * BRe[i] */
+    a1 = pSrcARe[0];
+    b1 = pSrcAIm[0];
+    c1 = pSrcBRe[0];
+    d1 = pSrcBIm[0];
+
+    a2 = pSrcARe[1];
+    b2 = pSrcAIm[1];
+    c2 = pSrcBRe[1];
+    d2 = pSrcBIm[1];
+
+    real_sum += (((q63_t) a1 * c1) >> 14) - (((q63_t) b1 * d1) >> 14);
+    imag_sum += (((q63_t) a1 * d1) >> 14) + (((q63_t) b1 * c1) >> 14);
+    real_sum += (((q63_t) a2 * c2) >> 14) - (((q63_t) b2 * d2) >> 14);
+    imag_sum += (((q63_t) a2 * d2) >> 14) + (((q63_t) b2 * c2) >> 14);
+
+    a1 = pSrcARe[2];
+    b1 = pSrcAIm[2];
+    c1 = pSrcBRe[2];
+    d1 = pSrcBIm[2];
+
+    a2 = pSrcARe[3];
+    b2 = pSrcAIm[3];
+    c2 = pSrcBRe[3];
+    d2 = pSrcBIm[3];
+
+    real_sum += (((q63_t) a1 * c1) >> 14) - (((q63_t) b1 * d1) >> 14);
+    imag_sum += (((q63_t) a1 * d1) >> 14) + (((q63_t) b1 * c1) >> 14);
+    real_sum += (((q63_t) a2 * c2) >> 14) - (((q63_t) b2 * d2) >> 14);
+    imag_sum += (((q63_t) a2 * d2) >> 14) + (((q63_t) b2 * c2) >> 14);
+
+    /* update pointers to process next samples */
+    pSrcARe += 4u;
+    pSrcAIm += 4u;
+    pSrcBRe += 4u;
+    pSrcBIm += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    a1 = *pSrcARe++;
+    b1 = *pSrcAIm++;
+    c1 = *pSrcBRe++;
+    d1 = *pSrcBIm++;
+
+    real_sum += (((q63_t) a1 * c1) >> 14) - (((q63_t) b1 * d1) >> 14);
+    imag_sum += (((q63_t) a1 * d1) >> 14) + (((q63_t) b1 * c1) >> 14);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Store the real and imaginary results in 16.48 format */
+  *realResult = real_sum;
+  *imagResult = imag_sum;
+}
+
+/**
+ * @} end of cmplx_dot_prod group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_interleave_f32.c
+*
+* Description:	Floating-point split to interleaved complex conversion.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxInterleave
+ * @{
+ */
+
+/**
+ * @brief  Merges floating-point real and imaginary parts into an interleaved complex vector.
+ * @param[in]  *pSrcRe points to the real parts
+ * @param[in]  *pSrcIm points to the imaginary parts
+ * @param[out] *pDst points to the interleaved complex output vector
+ * @param[in]  numSamples number of complex samples
+ * @return none.
+ */
+
+void arm_cmplx_interleave_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  float32_t re1, re2, im1, im2;                  /* Temporary input variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    re1 = pSrcRe[0];
+    im1 = pSrcIm[0];
+    re2 = pSrcRe[1];
+    im2 = pSrcIm[1];
+
+    pDst[0] = re1;
+    pDst[1] = im1;
+    pDst[2] = re2;
+    pDst[3] = im2;
+
+    re1 = pSrcRe[2];
+    im1 = pSrcIm[2];
+    re2 = pSrcRe[3];
+    im2 = pSrcIm[3];
+
+    pDst[4] = re1;
+    pDst[5] = im1;
+    pDst[6] = re2;
+    pDst[7] = im2;
+
+    /* update pointers to process next samples */
+    pSrcRe += 4u;
+    pSrcIm += 4u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = *pSrcRe++;
+    *pDst++ = *pSrcIm++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxInterleave group
+ */
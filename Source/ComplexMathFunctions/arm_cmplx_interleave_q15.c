@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_interleave_q15.c
+*
+* Description:	Q15 split to interleaved complex conversion.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxInterleave
+ * @{
+ */
+
+/**
+ * @brief  Merges Q15 real and imaginary parts into an interleaved complex vector.
+ * @param[in]  *pSrcRe points to the real parts
+ * @param[in]  *pSrcIm points to the imaginary parts
+ * @param[out] *pDst points to the interleaved complex output vector
+ * @param[in]  numSamples number of complex samples
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ */
+
+void arm_cmplx_interleave_q15(
+  q15_t * pSrcRe,
+  q15_t * pSrcIm,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+  q31_t re1, re2, im1, im2;                      /* Two parts of two samples each */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* read the real and imaginary parts of four samples */
+    re1 = *__SIMD32(pSrcRe)++;
+    re2 = *__SIMD32(pSrcRe)++;
+    im1 = *__SIMD32(pSrcIm)++;
+    im2 = *__SIMD32(pSrcIm)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    /* each output word holds the real part in the lower and the imaginary part in the upper half word */
+    *__SIMD32(pDst)++ = __PKHBT(re1, im1, 16);
+    *__SIMD32(pDst)++ = __PKHTB(im1, re1, 16);
+    *__SIMD32(pDst)++ = __PKHBT(re2, im2, 16);
+    *__SIMD32(pDst)++ = __PKHTB(im2, re2, 16);
+
+#else
+
+    /* each output word holds the real part in the upper and the imaginary part in the lower half word */
+    *__SIMD32(pDst)++ = __PKHTB(re1, im1, 16);
+    *__SIMD32(pDst)++ = __PKHBT(im1, re1, 16);
+    *__SIMD32(pDst)++ = __PKHTB(re2, im2, 16);
+    *__SIMD32(pDst)++ = __PKHBT(im2, re2, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = *pSrcRe++;
+    *pDst++ = *pSrcIm++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxInterleave group
+ */
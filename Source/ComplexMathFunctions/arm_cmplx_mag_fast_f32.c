@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_mag_fast_f32.c
+*
+* Description:	Floating-point complex magnitude with selectable accuracy.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup cmplx_mag_fast Complex Magnitude with Selectable Accuracy
+ *
+ * Computes the magnitude of the elements of a complex data vector like
+ * <code>arm_cmplx_mag</code>, with a choice between speed and accuracy:
+ *
+ * - <code>ARM_CMPLX_MAG_APPROX</code> uses the two segment alpha max plus beta min estimate
+ * <pre>
+ *     mag = max(0.99 * M + 0.197 * m, 0.84 * M + 0.561 * m),   M = max(|re|, |im|),  m = min(|re|, |im|)
+ * </pre>
+ * which needs no square root and has a peak error of 1.01%.
+ * - <code>ARM_CMPLX_MAG_NEWTON</code> forms the power <code>p = re^2 + im^2</code>, takes
+ * a reciprocal square root seed and refines it with one Newton step
+ * <code>y = y * (3 - p * y^2) / 2</code>; the magnitude is <code>p * y</code>. No division
+ * or square root instruction is used. The floating-point function seeds from the exponent
+ * bits and has a peak relative error of 0.18%. The fixed-point functions normalize
+ * <code>p</code> with a count of leading zeros and interpolate the seed from a 49 entry
+ * table, which leaves a relative error below 2^-21 after the Newton step.
+ * - <code>ARM_CMPLX_MAG_EXACT</code> computes the same result as <code>arm_cmplx_mag</code>.
+ *
+ * \par
+ * The approximate and Newton modes take the same number of cycles for every sample.
+ * The output formats of the fixed-point functions are those of <code>arm_cmplx_mag</code>:
+ * 2.30 for Q31 and 2.14 for Q15 inputs.
+ */
+
+/**
+ * @addtogroup cmplx_mag_fast
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex magnitude with selectable accuracy.
+ * @param[in]  *pSrc points to the complex input vector
+ * @param[out] *pDst points to the real output vector
+ * @param[in]  numSamples number of complex samples in the input vector
+ * @param[in]  accuracy approximation used for the magnitude
+ * @return none.
+ */
+
+void arm_cmplx_mag_fast_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples,
+  arm_cmplx_mag_accuracy accuracy)
+{
+  float32_t real, imag;                          /* Input values */
+  float32_t p, y;                                /* Power and reciprocal square root */
+  float32_t est;                                 /* Second magnitude estimate */
+  float32_t maxVal, minVal;                      /* Larger and smaller magnitude of the parts */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u;                                           /* Bits of the seed */
+  uint32_t blkCnt = numSamples;                  /* loop counter */
+
+  if(accuracy == ARM_CMPLX_MAG_EXACT)
+  {
+    arm_cmplx_mag_f32(pSrc, pDst, numSamples);
+  }
+  else if(accuracy == ARM_CMPLX_MAG_NEWTON)
+  {
+    while(blkCnt > 0u)
+    {
+      real = *pSrc++;
+      imag = *pSrc++;
+      p = (real * real) + (imag * imag);
+
+      /* Reciprocal square root seed from the exponent bits, then one Newton step.
+       ** A zero power gives a finite seed and a zero magnitude. */
+      u.f = p;
+      u.i = 0x5F375A86 - (u.i >> 1);
+      y = u.f;
+      y = y * (1.5f - ((0.5f * p) * (y * y)));
+
+      *pDst++ = p * y;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while(blkCnt > 0u)
+    {
+      real = *pSrc++;
+      imag = *pSrc++;
+      real = (real > 0.0f) ? real : -real;
+      imag = (imag > 0.0f) ? imag : -imag;
+
+      /* Alpha max plus beta min */
+      maxVal = (real > imag) ? real : imag;
+      minVal = (real > imag) ? imag : real;
+      p = (0.99f * maxVal) + (0.197f * minVal);
+      est = (0.84f * maxVal) + (0.561f * minVal);
+
+      *pDst++ = (p > est) ? p : est;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of cmplx_mag_fast group
+ */
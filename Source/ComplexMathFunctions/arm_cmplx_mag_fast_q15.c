@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_mag_fast_q15.c
+*
+* Description:	Q15 complex magnitude with selectable accuracy.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag_fast
+ * @{
+ */
+
+/**
+ * @brief  Square root of a normalized value.
+ * @param[in]  x value in unsigned 0.32 format, at least 0.25 or zero.
+ * @return sqrt(x) in unsigned 0.32 format.
+ *
+ * The reciprocal square root is interpolated from armRecipSqrtTableQ30 and refined
+ * with one Newton step before it is multiplied by <code>x</code>.
+ */
+
+static uint32_t arm_cmplx_mag_sqrt_norm_q15(
+  uint32_t x)
+{
+  uint32_t idx;                                  /* Table index */
+  uint32_t y;                                    /* Reciprocal square root in 2.30 format */
+  uint32_t t;                                    /* x * y^2 in 4.28 format */
+  uint64_t r;                                    /* Square root in 0.32 format */
+  int32_t d;                                     /* Difference of neighbouring table values */
+
+  /* Seed by linear interpolation; values below 0.25 only occur for zero and use the first entry */
+  idx = x >> 26;
+  idx = (idx > 16u) ? (idx - 16u) : 0u;
+  d = (int32_t) (armRecipSqrtTableQ30[idx + 1u] - armRecipSqrtTableQ30[idx]);
+  y = armRecipSqrtTableQ30[idx] + (uint32_t) (((q63_t) d * ((x >> 10) & 0xFFFFu)) >> 16);
+
+  /* One Newton step y = y * (3 - x * y^2) / 2 */
+  t = (uint32_t) (((uint64_t) y * y) >> 32);
+  t = (uint32_t) (((uint64_t) x * t) >> 32);
+  y = (uint32_t) (((uint64_t) y * (0x30000000u - t)) >> 29);
+
+  /* sqrt(x) = x / sqrt(x) */
+  r = ((uint64_t) x * y) >> 30;
+
+  return ((r > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32_t) r);
+}
+
+/**
+ * @brief  Q15 complex magnitude with selectable accuracy.
+ * @param[in]  *pSrc points to the complex input vector
+ * @param[out] *pDst points to the real output vector
+ * @param[in]  numSamples number of complex samples in the input vector
+ * @param[in]  accuracy approximation used for the magnitude
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is in 1.15 format and the output in 2.14 format, as for arm_cmplx_mag_q15().
+ * The approximate and Newton modes work on the absolute values and the 32-bit power,
+ * so no down scaling of the input is required.
+ */
+
+void arm_cmplx_mag_fast_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples,
+  arm_cmplx_mag_accuracy accuracy)
+{
+  q31_t in;                                      /* Packed real and imaginary parts */
+  q31_t real, imag;                              /* Input values */
+  q31_t maxVal, minVal;                          /* Larger and smaller magnitude of the parts */
+  q31_t est, est2;                               /* Magnitude estimates */
+  uint32_t p;                                    /* Power in 2.30 format */
+  uint32_t n;                                    /* Normalization shift */
+  uint32_t blkCnt = numSamples;                  /* loop counter */
+
+  if(accuracy == ARM_CMPLX_MAG_EXACT)
+  {
+    arm_cmplx_mag_q15(pSrc, pDst, numSamples);
+  }
+  else if(accuracy == ARM_CMPLX_MAG_NEWTON)
+  {
+    while(blkCnt > 0u)
+    {
+      /* read the real and imaginary parts with one load, the power does not depend on their order */
+      in = *__SIMD32(pSrc)++;
+      p = (uint32_t) __SMUAD(in, in);
+
+      /* Normalize by an even shift to [0.25, 1); a zero power stays zero */
+      n = __CLZ(p);
+      n = (n < 30u) ? (n & ~1u) : 30u;
+
+      /* sqrt(p) = sqrt(p * 2^n) / 2^(n / 2 + 16); the 2.14 result is half of it */
+      est = (q31_t) (arm_cmplx_mag_sqrt_norm_q15(p << n) >> (16u + (n >> 1)));
+      *pDst++ = (q15_t) (est >> 1);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while(blkCnt > 0u)
+    {
+      real = *pSrc++;
+      imag = *pSrc++;
+      real = (real > 0) ? real : -real;
+      imag = (imag > 0) ? imag : -imag;
+
+      /* Alpha max plus beta min with the 1.15 coefficients 0.99, 0.197 and 0.84, 0.561 */
+      maxVal = (real > imag) ? real : imag;
+      minVal = (real > imag) ? imag : real;
+      est = ((maxVal * 32440) + (minVal * 6455)) >> 15;
+      est2 = ((maxVal * 27525) + (minVal * 18383)) >> 15;
+      est = (est > est2) ? est : est2;
+
+      *pDst++ = (q15_t) (est >> 1);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of cmplx_mag_fast group
+ */
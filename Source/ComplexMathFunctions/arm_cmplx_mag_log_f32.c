@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_mag_log_f32.c
+*
+* Description:	Floating-point complex log magnitude.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup cmplx_mag_log Complex Log Magnitude
+ *
+ * Computes the logarithm of the magnitude of the elements of a complex data vector,
+ * as used by detectors that compare levels in decibels. Because
+ * <code>log(sqrt(p)) = log(p) / 2</code>, the logarithm is taken of the power
+ * <code>p = re^2 + im^2</code> and no square root is needed.
+ *
+ * \par
+ * The exponent of the power is found from the floating-point exponent bits or, for the
+ * fixed-point functions, with a count of leading zeros, and the logarithm of the
+ * remaining mantissa <code>1 + f</code>, <code>0 <= f < 1</code>, is evaluated with a
+ * polynomial. There are no data dependent branches.
+ *
+ * \par
+ * The floating-point function returns the power in decibels,
+ * <code>10 * log10(p) = 20 * log10(|x|)</code>, with an error below 2e-5 dB.
+ * The fixed-point functions return <code>log2(|x|)</code>: in 6.26 format for Q31 inputs
+ * and in 5.11 format for Q15 inputs, where <code>|x| = 1.0</code> corresponds to the
+ * full scale input. Multiply by 6.0206 to convert the fixed-point result to decibels.
+ */
+
+/**
+ * @addtogroup cmplx_mag_log
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex log magnitude in decibels.
+ * @param[in]  *pSrc points to the complex input vector
+ * @param[out] *pDst points to the real output vector of 20 * log10(|x|)
+ * @param[in]  numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * A power below the smallest normalized single precision value, including zero,
+ * gives -382.3 dB, the result for 2^-127.
+ */
+
+void arm_cmplx_mag_log_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  float32_t real, imag;                          /* Input values */
+  float32_t f, y;                                /* Mantissa fraction and polynomial */
+  int32_t e;                                     /* Exponent */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u;                                           /* Bits of the power */
+  uint32_t blkCnt = numSamples;                  /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    real = *pSrc++;
+    imag = *pSrc++;
+    u.f = (real * real) + (imag * imag);
+
+    /* Split the power into exponent and mantissa in [1, 2) */
+    e = (u.i >> 23) - 127;
+    u.i = (u.i & 0x007FFFFF) | 0x3F800000;
+    f = u.f - 1.0f;
+
+    /* log2(1 + f) polynomial */
+    y = 2.0016649997e-2f;
+    y = (y * f) - 9.4626809736e-2f;
+    y = (y * f) + 2.1394321218e-1f;
+    y = (y * f) - 3.3837719766e-1f;
+    y = (y * f) + 4.7749636368e-1f;
+    y = (y * f) - 7.2114409218e-1f;
+    y = (y * f) + 1.4426929832f;
+    y = y * f;
+
+    /* 10 * log10(p) = 10 * log10(2) * log2(p) */
+    *pDst++ = ((float32_t) e + y) * 3.0102999566f;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag_log group
+ */
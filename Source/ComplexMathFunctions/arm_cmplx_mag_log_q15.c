@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_mag_log_q15.c
+*
+* Description:	Q15 complex log magnitude.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag_log
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex log magnitude.
+ * @param[in]  *pSrc points to the complex input vector
+ * @param[out] *pDst points to the real output vector of log2(|x|)
+ * @param[in]  numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is in 1.15 format and the output <code>log2(|x|)</code> is in 5.11 format,
+ * ranging from -15 to 0.5. The logarithm of the mantissa of the 32-bit power uses a
+ * degree 5 polynomial with 2.14 coefficients, which keeps the error within 1 LSB.
+ * A zero input gives 0x8000, which is -16.
+ */
+
+void arm_cmplx_mag_log_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+  q31_t in;                                      /* Packed real and imaginary parts */
+  uint32_t p;                                    /* Power in 2.30 format */
+  uint32_t n;                                    /* Normalization shift */
+  q31_t f;                                       /* Mantissa fraction in 0.15 format */
+  q31_t y;                                       /* Polynomial in 2.14 format */
+  uint32_t blkCnt = numSamples;                  /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* read the real and imaginary parts with one load, the power does not depend on their order */
+    in = *__SIMD32(pSrc)++;
+    p = (uint32_t) __SMUAD(in, in);
+
+    /* Normalize the power to [1, 2) and keep the fraction below the leading one */
+    n = __CLZ(p);
+    n = (n < 31u) ? n : 31u;
+    f = (q31_t) (((p << n) >> 16) & 0x7FFFu);
+
+    /* log2(1 + f) polynomial */
+    y = 961;
+    y = ((y * f) >> 15) - 3688;
+    y = ((y * f) >> 15) + 7219;
+    y = ((y * f) >> 15) - 11743;
+    y = ((y * f) >> 15) + 23636;
+    y = (y * f) >> 15;
+
+    /* log2(|x|) = (log2(p) - 30) / 2 = (1 - n + log2(1 + f)) / 2 in 5.11 format */
+    y = ((1 - (q31_t) n) << 10) + ((y + 8) >> 4);
+    *pDst++ = (p != 0u) ? (q15_t) y : (q15_t) 0x8000;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag_log group
+ */
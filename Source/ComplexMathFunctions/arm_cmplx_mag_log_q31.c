@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_mag_log_q31.c
+*
+* Description:	Q31 complex log magnitude.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag_log
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex log magnitude.
+ * @param[in]  *pSrc points to the complex input vector
+ * @param[out] *pDst points to the real output vector of log2(|x|)
+ * @param[in]  numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is in 1.31 format and the output <code>log2(|x|)</code> is in 6.26 format,
+ * ranging from -31 to 0.5. The power is formed in 64-bit precision and the logarithm
+ * of its mantissa uses a degree 10 polynomial with 2.30 coefficients, which keeps the
+ * error within 1 LSB. A zero input gives 0x80000000, which is -32.
+ */
+
+void arm_cmplx_mag_log_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numSamples)
+{
+  q31_t real, imag;                              /* Input values */
+  uint64_t p;                                    /* Power in 2.62 format */
+  uint32_t n;                                    /* Normalization shift */
+  uint32_t f;                                    /* Mantissa fraction in 0.32 format */
+  q31_t y;                                       /* Polynomial in 2.30 format */
+  uint32_t blkCnt = numSamples;                  /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    real = *pSrc++;
+    imag = *pSrc++;
+    p = (uint64_t) ((q63_t) real * real) + (uint64_t) ((q63_t) imag * imag);
+
+    /* Normalize the power to [1, 2) and keep the fraction below the leading one */
+    n = (uint32_t) (p >> 32);
+    n = (n != 0u) ? __CLZ(n) : (32u + __CLZ((uint32_t) p));
+    n = (n < 63u) ? n : 63u;
+    f = (uint32_t) ((p << n) >> 31);
+
+    /* log2(1 + f) polynomial */
+    y = -4919973;
+    y = (q31_t) (((q63_t) y * f) >> 32) + 30272977;
+    y = (q31_t) (((q63_t) y * f) >> 32) - 87327348;
+    y = (q31_t) (((q63_t) y * f) >> 32) + 163329378;
+    y = (q31_t) (((q63_t) y * f) >> 32) - 236539664;
+    y = (q31_t) (((q63_t) y * f) >> 32) + 304600243;
+    y = (q31_t) (((q63_t) y * f) >> 32) - 386520997;
+    y = (q31_t) (((q63_t) y * f) >> 32) + 516304548;
+    y = (q31_t) (((q63_t) y * f) >> 32) - 774539339;
+    y = (q31_t) (((q63_t) y * f) >> 32) + 1549081996;
+    y = (q31_t) (((q63_t) y * f) >> 32);
+
+    /* log2(|x|) = (log2(p) - 62) / 2 = (1 - n + log2(1 + f)) / 2 in 6.26 format */
+    y = ((1 - (q31_t) n) << 25) + ((y + 16) >> 5);
+    *pDst++ = (p != 0u) ? y : (q31_t) 0x80000000;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag_log group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_mag_split_q15.c
+*
+* Description:	Q15 complex magnitude in split format.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex magnitude in split format
+ * @param[in]  *pSrcRe points to the real parts of the complex input vector
+ * @param[in]  *pSrcIm points to the imaginary parts of the complex input vector
+ * @param[out] *pDst points to the real output vector
+ * @param[in]  numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * \par
+ * Computes <code>pDst[n] = sqrt(pSrcRe[n]^2 + pSrcIm[n]^2)</code>, the same result as
+ * <code>arm_cmplx_mag_q15()</code> on vectors in the split format described
+ * in \ref CmplxInterleave.
+ *
+ * \par Conditions for optimum performance
+ *  Input buffers should be aligned by 32-bit
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function implements 1.15 by 1.15 multiplications and finally output is converted into 2.14 format.
+ * The sum of the squares cannot overflow, including for real and imaginary parts of -32768.
+ */
+
+void arm_cmplx_mag_split_q15(
+  q15_t * pSrcRe,
+  q15_t * pSrcIm,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+  q31_t re1, re2, im1, im2;                      /* Real and imaginary parts of two samples each */
+  q31_t in1, in2, in3, in4;                      /* Real and imaginary parts of one sample each */
+  q31_t acc1, acc2, acc3, acc4;                  /* Accumulators */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* read the real and imaginary parts of four samples */
+    re1 = *__SIMD32(pSrcRe)++;
+    re2 = *__SIMD32(pSrcRe)++;
+    im1 = *__SIMD32(pSrcIm)++;
+    im2 = *__SIMD32(pSrcIm)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    /* pack each real part with its imaginary part, the first sample is in the lower half words */
+    in1 = __PKHBT(re1, im1, 16);
+    in2 = __PKHTB(im1, re1, 16);
+    in3 = __PKHBT(re2, im2, 16);
+    in4 = __PKHTB(im2, re2, 16);
+
+#else
+
+    /* pack each real part with its imaginary part, the first sample is in the upper half words */
+    in1 = __PKHTB(im1, re1, 16);
+    in2 = __PKHBT(re1, im1, 16);
+    in3 = __PKHTB(im2, re2, 16);
+    in4 = __PKHBT(re2, im2, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* C[i] = sqrt(ARe[i] * ARe[i] + AIm[i] * AIm[i]) */
+    acc1 = __SMUAD(in1, in1);
+    acc2 = __SMUAD(in2, in2);
+    acc3 = __SMUAD(in3, in3);
+    acc4 = __SMUAD(in4, in4);
+
+    /* square root of the 3.13 power gives the magnitude in 2.14 format.
+     ** The power reaches 2^31 for re = im = -32768, so it is shifted as an unsigned value. */
+    arm_sqrt_q15((q15_t) ((uint32_t) acc1 >> 17), &pDst[0]);
+    arm_sqrt_q15((q15_t) ((uint32_t) acc2 >> 17), &pDst[1]);
+    arm_sqrt_q15((q15_t) ((uint32_t) acc3 >> 17), &pDst[2]);
+    arm_sqrt_q15((q15_t) ((uint32_t) acc4 >> 17), &pDst[3]);
+
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C[i] = sqrt(ARe[i] * ARe[i] + AIm[i] * AIm[i]) */
+    in1 = __PKHBT(*pSrcRe++, *pSrcIm++, 16);
+    acc1 = __SMUAD(in1, in1);
+
+    /* store the result in 2.14 format in the destination buffer. */
+    arm_sqrt_q15((q15_t) ((uint32_t) acc1 >> 17), pDst++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag group
+ */
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_mag_split_q31.c
+*
+* Description:	Q31 complex magnitude in split format.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex magnitude in split format
+ * @param[in]  *pSrcRe points to the real parts of the complex input vector
+ * @param[in]  *pSrcIm points to the imaginary parts of the complex input vector
+ * @param[out] *pDst points to the real output vector
+ * @param[in]  numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * \par
+ * Computes <code>pDst[n] = sqrt(pSrcRe[n]^2 + pSrcIm[n]^2)</code>, the same result as
+ * <code>arm_cmplx_mag_q31()</code> on vectors in the split format described
+ * in \ref CmplxInterleave.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function implements 1.31 by 1.31 multiplications and finally output is converted into 2.30 format.
+ * Input down scaling is not required.
+ */
+
+void arm_cmplx_mag_split_q31(
+  q31_t * pSrcRe,
+  q31_t * pSrcIm,
+  q31_t * pDst,
+  uint32_t numSamples)
+{
+  q31_t re1, re2, re3, re4;                      /* Temporary variables to hold real input values */
+  q31_t im1, im2, im3, im4;                      /* Temporary variables to hold imaginary input values */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[i] = sqrt(ARe[i] * ARe[i] + AIm[i] * AIm[i]) */
+    re1 = pSrcRe[0];
+    im1 = pSrcIm[0];
+    re2 = pSrcRe[1];
+    im2 = pSrcIm[1];
+    re3 = pSrcRe[2];
+    im3 = pSrcIm[2];
+    re4 = pSrcRe[3];
+    im4 = pSrcIm[3];
+
+    arm_sqrt_q31((q31_t) (((q63_t) re1 * re1) >> 33) + (q31_t) (((q63_t) im1 * im1) >> 33), &pDst[0]);
+    arm_sqrt_q31((q31_t) (((q63_t) re2 * re2) >> 33) + (q31_t) (((q63_t) im2 * im2) >> 33), &pDst[1]);
+    arm_sqrt_q31((q31_t) (((q63_t) re3 * re3) >> 33) + (q31_t) (((q63_t) im3 * im3) >> 33), &pDst[2]);
+    arm_sqrt_q31((q31_t) (((q63_t) re4 * re4) >> 33) + (q31_t) (((q63_t) im4 * im4) >> 33), &pDst[3]);
+
+    /* update pointers to process next samples */
+    pSrcRe += 4u;
+    pSrcIm += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    re1 = *pSrcRe++;
+    im1 = *pSrcIm++;
+    arm_sqrt_q31((q31_t) (((q63_t) re1 * re1) >> 33) + (q31_t) (((q63_t) im1 * im1) >> 33), pDst++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag group
+ */
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_mag_squared_split_f32.c
+*
+* Description:	Floating-point complex magnitude squared in split format.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag_squared
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex magnitude squared in split format
+ * @param[in]  *pSrcRe points to the real parts of the complex input vector
+ * @param[in]  *pSrcIm points to the imaginary parts of the complex input vector
+ * @param[out] *pDst points to the real output vector
+ * @param[in]  numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * \par
+ * Computes <code>pDst[n] = pSrcRe[n]^2 + pSrcIm[n]^2</code>, the same result as
+ * <code>arm_cmplx_mag_squared_f32()</code> on vectors in the split format described
+ * in \ref CmplxInterleave.
+ */
+
+void arm_cmplx_mag_squared_split_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  float32_t re1, re2, re3, re4;                  /* Temporary variables to hold real input values */
+  float32_t im1, im2, im3, im4;                  /* Temporary variables to hold imaginary input values */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[i] = (ARe[i] * ARe[i] + AIm[i] * AIm[i]) */
+    re1 = pSrcRe[0];
+    im1 = pSrcIm[0];
+    re2 = pSrcRe[1];
+    im2 = pSrcIm[1];
+    re3 = pSrcRe[2];
+    im3 = pSrcIm[2];
+    re4 = pSrcRe[3];
+    im4 = pSrcIm[3];
+
+    pDst[0] = (re1 * re1) + (im1 * im1);
+    pDst[1] = (re2 * re2) + (im2 * im2);
+    pDst[2] = (re3 * re3) + (im3 * im3);
+    pDst[3] = (re4 * re4) + (im4 * im4);
+
+    /* update pointers to process next samples */
+    pSrcRe += 4u;
+    pSrcIm += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    re1 = *pSrcRe++;
+    im1 = *pSrcIm++;
+    *pDst++ = (re1 * re1) + (im1 * im1);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag_squared group
+ */
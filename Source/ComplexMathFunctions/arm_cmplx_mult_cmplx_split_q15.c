@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_mult_cmplx_split_q15.c
+*
+* Description:	Q15 complex-by-complex multiplication in split format.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxByCmplxMult
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex-by-complex multiplication in split format
+ * @param[in]  *pSrcARe points to the real parts of the first input vector
+ * @param[in]  *pSrcAIm points to the imaginary parts of the first input vector
+ * @param[in]  *pSrcBRe points to the real parts of the second input vector
+ * @param[in]  *pSrcBIm points to the imaginary parts of the second input vector
+ * @param[out] *pDstRe points to the real parts of the output vector
+ * @param[out] *pDstIm points to the imaginary parts of the output vector
+ * @param[in]  numSamples number of complex samples in each vector
+ * @return none.
+ *
+ * \par
+ * Computes the same products as <code>arm_cmplx_mult_cmplx_q15()</code> on vectors
+ * in the split format described in \ref CmplxInterleave.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function implements 1.15 by 1.15 multiplications and finally output is converted into 3.13 format.
+ */
+
+void arm_cmplx_mult_cmplx_split_q15(
+  q15_t * pSrcARe,
+  q15_t * pSrcAIm,
+  q15_t * pSrcBRe,
+  q15_t * pSrcBIm,
+  q15_t * pDstRe,
+  q15_t * pDstIm,
+  uint32_t numSamples)
+{
+  q31_t a, b, c, d;                              /* Real and imaginary parts of two samples each */
+  q31_t re1, re2, im1, im2;                      /* Temporary output variables */
+  q15_t a1, b1, c1, d1;                          /* Temporary variables to store real and imaginary values */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 1u;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+   ** a second loop below computes the remaining sample. */
+  while(blkCnt > 0u)
+  {
+    /* read the real and imaginary parts of two samples */
+    a = *__SIMD32(pSrcARe)++;
+    b = *__SIMD32(pSrcAIm)++;
+    c = *__SIMD32(pSrcBRe)++;
+    d = *__SIMD32(pSrcBIm)++;
+
+    /* CRe[i] = ARe[i] * BRe[i] - AIm[i] * BIm[i], in 3.13 format.  */
+    re1 = (((q31_t) (q15_t) a * (q15_t) c) >> 17) - (((q31_t) (q15_t) b * (q15_t) d) >> 17);
+    re2 = (((a >> 16) * (c >> 16)) >> 17) - (((b >> 16) * (d >> 16)) >> 17);
+
+    /* CIm[i] = ARe[i] * BIm[i] + AIm[i] * BRe[i], in 3.13 format.  */
+    im1 = (((q31_t) (q15_t) a * (q15_t) d) >> 17) + (((q31_t) (q15_t) b * (q15_t) c) >> 17);
+    im2 = (((a >> 16) * (d >> 16)) >> 17) + (((b >> 16) * (c >> 16)) >> 17);
+
+    /* store the real and imaginary parts of both samples.
+     ** Each result goes back to the half word its inputs came from, so this holds for either endianness. */
+    *__SIMD32(pDstRe)++ = __PKHBT(re1, re2, 16);
+    *__SIMD32(pDstIm)++ = __PKHBT(im1, im2, 16);
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is odd, compute the last output sample here. */
+  if((numSamples & 0x1u) != 0u)
+  {
+    a1 = *pSrcARe;
+    b1 = *pSrcAIm;
+    c1 = *pSrcBRe;
+    d1 = *pSrcBIm;
+
+    /* store the result in 3.13 format in the destination buffer. */
+    *pDstRe = (q15_t) ((((q31_t) a1 * c1) >> 17) - (((q31_t) b1 * d1) >> 17));
+    *pDstIm = (q15_t) ((((q31_t) a1 * d1) >> 17) + (((q31_t) b1 * c1) >> 17));
+  }
+}
+
+/**
+ * @} end of CmplxByCmplxMult group
+ */
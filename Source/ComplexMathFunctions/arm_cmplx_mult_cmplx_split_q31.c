@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cmplx_mult_cmplx_split_q31.c
+*
+* Description:	Q31 complex-by-complex multiplication in split format.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxByCmplxMult
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex-by-complex multiplication in split format
+ * @param[in]  *pSrcARe points to the real parts of the first input vector
+ * @param[in]  *pSrcAIm points to the imaginary parts of the first input vector
+ * @param[in]  *pSrcBRe points to the real parts of the second input vector
+ * @param[in]  *pSrcBIm points to the imaginary parts of the second input vector
+ * @param[out] *pDstRe points to the real parts of the output vector
+ * @param[out] *pDstIm points to the imaginary parts of the output vector
+ * @param[in]  numSamples number of complex samples in each vector
+ * @return none.
+ *
+ * \par
+ * Computes the same products as <code>arm_cmplx_mult_cmplx_q31()</code> on vectors
+ * in the split format described in \ref CmplxInterleave.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function implements 1.31 by 1.31 multiplications and finally output is converted into 3.29 format.
+ * Input down scaling is not required.
+ */
+
+void arm_cmplx_mult_cmplx_split_q31(
+  q31_t * pSrcARe,
+  q31_t * pSrcAIm,
+  q31_t * pSrcBRe,
+  q31_t * pSrcBIm,
+  q31_t * pDstRe,
+  q31_t * pDstIm,
+  uint32_t numSamples)
+{
+  q31_t a1, b1, c1, d1;                          /* Temporary variables to store real and imaginary values */
+  q31_t a2, b2, c2, d2;                          /* Temporary variables to store real and imaginary values */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* CRe[i] = ARe[i] * BRe[i] - AIm[i] * BIm[i].  */
+    /* CIm[i] = ARe[i] * BIm[i] + AIm[i] * BRe[i].  */
+    a1 = pSrcARe[0];
+    b1 = pSrcAIm[0];
+    c1 = pSrcBRe[0];
+    d1 = pSrcBIm[0];
+
+    a2 = pSrcARe[1];
+    b2 = pSrcAIm[1];
+    c2 = pSrcBRe[1];
+    d2 = pSrcBIm[1];
+
+    pDstRe[0] = (q31_t) ((((q63_t) a1 * c1) >> 33) - (((q63_t) b1 * d1) >> 33));
+    pDstIm[0] = (q31_t) ((((q63_t) a1 * d1) >> 33) + (((q63_t) b1 * c1) >> 33));
+    pDstRe[1] = (q31_t) ((((q63_t) a2 * c2) >> 33) - (((q63_t) b2 * d2) >> 33));
+    pDstIm[1] = (q31_t) ((((q63_t) a2 * d2) >> 33) + (((q63_t) b2 * c2) >> 33));
+
+    a1 = pSrcARe[2];
+    b1 = pSrcAIm[2];
+    c1 = pSrcBRe[2];
+    d1 = pSrcBIm[2];
+
+    a2 = pSrcARe[3];
+    b2 = pSrcAIm[3];
+    c2 = pSrcBRe[3];
+    d2 = pSrcBIm[3];
+
+    pDstRe[2] = (q31_t) ((((q63_t) a1 * c1) >> 33) - (((q63_t) b1 * d1) >> 33));
+    pDstIm[2] = (q31_t) ((((q63_t) a1 * d1) >> 33) + (((q63_t) b1 * c1) >> 33));
+    pDstRe[3] = (q31_t) ((((q63_t) a2 * c2) >> 33) - (((q63_t) b2 * d2) >> 33));
+    pDstIm[3] = (q31_t) ((((q63_t) a2 * d2) >> 33) + (((q63_t) b2 * c2) >> 33));
+
+    /* update pointers to process next samples */
+    pSrcARe += 4u;
+    pSrcAIm += 4u;
+    pSrcBRe += 4u;
+    pSrcBIm += 4u;
+    pDstRe += 4u;
+    pDstIm += 4u;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    a1 = *pSrcARe++;
+    b1 = *pSrcAIm++;
+    c1 = *pSrcBRe++;
+    d1 = *pSrcBIm++;
+
+    *pDstRe++ = (q31_t) ((((q63_t) a1 * c1) >> 33) - (((q63_t) b1 * d1) >> 33));
+    *pDstIm++ = (q31_t) ((((q63_t) a1 * d1) >> 33) + (((q63_t) b1 * c1) >> 33));
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxByCmplxMult group
+ */
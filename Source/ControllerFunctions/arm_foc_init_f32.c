@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_foc_init_f32.c
+*
+* Description:	Floating-point field-oriented control initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point field-oriented control step.
+ * @param[in,out] *S points to an instance of the floating-point FOC structure.
+ * @param[in] KpD proportional gain of the d-axis current loop.
+ * @param[in] KiD integral gain of the d-axis current loop, sample time included.
+ * @param[in] KpQ proportional gain of the q-axis current loop.
+ * @param[in] KiQ integral gain of the q-axis current loop, sample time included.
+ * @param[in] vMax limit of the voltage vector magnitude, in (0, 1/sqrt(3)] for linear modulation.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if vMax is not
+ * in the range (0, 1].
+ * \par Description:
+ * The gains and the voltage limit are stored in the instance and the integrators are cleared.
+ */
+
+arm_status arm_foc_init_f32(
+  arm_foc_instance_f32 * S,
+  float32_t KpD,
+  float32_t KiD,
+  float32_t KpQ,
+  float32_t KiQ,
+  float32_t vMax)
+{
+  arm_status status;                             /* status of initialization */
+
+  if((vMax <= 0.0f) || (vMax > 1.0f))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign the gains and the voltage limit */
+    S->KpD = KpD;
+    S->KiD = KiD;
+    S->KpQ = KpQ;
+    S->KiQ = KiQ;
+    S->vMax = vMax;
+
+    /* Clear the integrators */
+    S->integD = 0.0f;
+    S->integQ = 0.0f;
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FOC group
+ */
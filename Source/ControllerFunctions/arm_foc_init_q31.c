@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_foc_init_q31.c
+*
+* Description:	Q31 field-oriented control initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 field-oriented control step.
+ * @param[in,out] *S points to an instance of the Q31 FOC structure.
+ * @param[in] KpD proportional gain of the d-axis current loop.
+ * @param[in] KiD integral gain of the d-axis current loop, sample time included.
+ * @param[in] KpQ proportional gain of the q-axis current loop.
+ * @param[in] KiQ integral gain of the q-axis current loop, sample time included.
+ * @param[in] vMax limit of the voltage vector magnitude, in (0, 1/sqrt(3)] for linear modulation.
+ * @param[in] postShift scaling of the gains, 0 to 15 bits.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if vMax is not
+ * positive or postShift is above 15.
+ * \par Description:
+ * The gains, in 1.31 format scaled down by <code>2^postShift</code>, and the voltage limit
+ * are stored in the instance and the integrators are cleared.
+ */
+
+arm_status arm_foc_init_q31(
+  arm_foc_instance_q31 * S,
+  q31_t KpD,
+  q31_t KiD,
+  q31_t KpQ,
+  q31_t KiQ,
+  q31_t vMax,
+  uint8_t postShift)
+{
+  arm_status status;                             /* status of initialization */
+
+  if((vMax <= 0) || (postShift > 15u))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign the gains, their scaling and the voltage limit */
+    S->KpD = KpD;
+    S->KiD = KiD;
+    S->KpQ = KpQ;
+    S->KiQ = KiQ;
+    S->vMax = vMax;
+    S->postShift = postShift;
+
+    /* Clear the integrators */
+    S->integD = 0;
+    S->integQ = 0;
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FOC group
+ */
@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_foc_step_block_q31.c
+*
+* Description:	Q31 field-oriented control step for several motors.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Q31 field-oriented control step for several motors.
+ * @param[in,out] *S points to an array of numMotors Q31 FOC instances.
+ * @param[in] *pIa points to the phase a currents.
+ * @param[in] *pIb points to the phase b currents.
+ * @param[in] *pTheta points to the electrical rotor angles.
+ * @param[in] *pIdRef points to the d-axis current references.
+ * @param[in] *pIqRef points to the q-axis current references.
+ * @param[out] *pDuty points to the duty cycles, three consecutive values per motor.
+ * @param[in] numMotors number of motors.
+ * @return none.
+ * \par Description:
+ * Motor <code>n</code> uses instance <code>S[n]</code> and element <code>n</code> of
+ * each input array. See arm_foc_step_q31() for the units of the inputs.
+ */
+
+void arm_foc_step_block_q31(
+  arm_foc_instance_q31 * S,
+  q31_t * pIa,
+  q31_t * pIb,
+  q31_t * pTheta,
+  q31_t * pIdRef,
+  q31_t * pIqRef,
+  q31_t * pDuty,
+  uint32_t numMotors)
+{
+  uint32_t blkCnt = numMotors;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Run the complete control step of one motor */
+    arm_foc_step_q31(S++, *pIa++, *pIb++, *pTheta++, *pIdRef++, *pIqRef++, pDuty);
+    pDuty += 3u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of FOC group
+ */
@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_foc_step_f32.c
+*
+* Description:	Floating-point field-oriented control step.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup FOC Field-Oriented Control Step
+ *
+ * Runs one complete current-control step of a permanent magnet synchronous motor
+ * in a single function, instead of separate calls to the Clarke and Park transforms
+ * that each take their own sine and cosine values.
+ *
+ * \par Algorithm:
+ * <pre>
+ *    sin/cos          = sin_cos(theta)                      computed once per step
+ *    Ialpha, Ibeta    = Clarke(Ia, Ib)
+ *    Id, Iq           = Park(Ialpha, Ibeta, sin, cos)
+ *    Vd               = PI_d(IdRef - Id)                    limited to [-vMax, vMax]
+ *    Vq               = PI_q(IqRef - Iq)                    limited to +/- sqrt(vMax^2 - Vd^2)
+ *    Valpha, Vbeta    = inverse Park(Vd, Vq, sin, cos)
+ *    Va, Vb, Vc       = inverse Clarke(Valpha, Vbeta)
+ *    duty[k]          = 0.5 + Vk - (max(Va, Vb, Vc) + min(Va, Vb, Vc)) / 2  </pre>
+ * \par
+ * The voltages are normalized to the DC bus voltage. The last line is space-vector
+ * modulation written as min-max zero-sequence injection, so no sector decode is needed.
+ * It stays linear for <code>vMax <= 1/sqrt(3)</code>, and the duty cycles are
+ * clamped to their range in any case.
+ *
+ * \par
+ * The d-axis voltage has priority over the q-axis voltage within the circular
+ * voltage limit. The integrators are clamped to the same limits to prevent windup.
+ *
+ * \par
+ * The step has no loops. Its branches are the limits and the compare-and-select
+ * operations above, and those inside the sine/cosine and square root functions it
+ * calls, so the cycle count varies with the operating point but has a fixed worst
+ * case, which is what a fixed-rate PWM interrupt has to budget for.
+ * The block functions run the step for several motors that each have their own instance.
+ */
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Floating-point field-oriented control step.
+ * @param[in,out] *S points to an instance of the floating-point FOC structure.
+ * @param[in] Ia phase a current.
+ * @param[in] Ib phase b current.
+ * @param[in] theta electrical rotor angle in degrees, in the range accepted by arm_sin_cos_f32().
+ * @param[in] IdRef d-axis current reference.
+ * @param[in] IqRef q-axis current reference.
+ * @param[out] *pDuty points to the three phase duty cycles in [0, 1].
+ * @return none.
+ */
+
+void arm_foc_step_f32(
+  arm_foc_instance_f32 * S,
+  float32_t Ia,
+  float32_t Ib,
+  float32_t theta,
+  float32_t IdRef,
+  float32_t IqRef,
+  float32_t * pDuty)
+{
+  float32_t sinVal, cosVal;                      /* Sine and cosine of the rotor angle */
+  float32_t alpha, beta;                         /* Stationary frame values */
+  float32_t Id, Iq, err;                         /* Rotor frame currents and error */
+  float32_t Vd, Vq, vqMax;                       /* Rotor frame voltages and q-axis limit */
+  float32_t Va, Vb, Vc;                          /* Phase voltages */
+  float32_t vHi, vLo, offset, duty;              /* Zero-sequence injection */
+  float32_t vMax = S->vMax;                      /* Voltage limit */
+
+  /* Sine and cosine are computed once and shared by both Park transforms */
+  arm_sin_cos_f32(theta, &sinVal, &cosVal);
+
+  /* Currents into the rotor frame */
+  arm_clarke_f32(Ia, Ib, &alpha, &beta);
+  arm_park_f32(alpha, beta, &Id, &Iq, sinVal, cosVal);
+
+  /* d-axis PI controller, limited to [-vMax, vMax] */
+  err = IdRef - Id;
+  S->integD += S->KiD * err;
+  S->integD = (S->integD > vMax) ? vMax : ((S->integD < -vMax) ? -vMax : S->integD);
+  Vd = (S->KpD * err) + S->integD;
+  Vd = (Vd > vMax) ? vMax : ((Vd < -vMax) ? -vMax : Vd);
+
+  /* q-axis PI controller, limited to the voltage left by Vd */
+  arm_sqrt_f32((vMax * vMax) - (Vd * Vd), &vqMax);
+  err = IqRef - Iq;
+  S->integQ += S->KiQ * err;
+  S->integQ = (S->integQ > vqMax) ? vqMax : ((S->integQ < -vqMax) ? -vqMax : S->integQ);
+  Vq = (S->KpQ * err) + S->integQ;
+  Vq = (Vq > vqMax) ? vqMax : ((Vq < -vqMax) ? -vqMax : Vq);
+
+  /* Voltages back to the phases */
+  arm_inv_park_f32(Vd, Vq, &alpha, &beta, sinVal, cosVal);
+  arm_inv_clarke_f32(alpha, beta, &Va, &Vb);
+  Vc = -Va - Vb;
+
+  /* Space-vector modulation by min-max zero-sequence injection */
+  vHi = (Va > Vb) ? Va : Vb;
+  vHi = (Vc > vHi) ? Vc : vHi;
+  vLo = (Va < Vb) ? Va : Vb;
+  vLo = (Vc < vLo) ? Vc : vLo;
+  offset = 0.5f - (0.5f * (vHi + vLo));
+
+  duty = Va + offset;
+  pDuty[0] = (duty > 1.0f) ? 1.0f : ((duty < 0.0f) ? 0.0f : duty);
+  duty = Vb + offset;
+  pDuty[1] = (duty > 1.0f) ? 1.0f : ((duty < 0.0f) ? 0.0f : duty);
+  duty = Vc + offset;
+  pDuty[2] = (duty > 1.0f) ? 1.0f : ((duty < 0.0f) ? 0.0f : duty);
+}
+
+/**
+ * @} end of FOC group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_foc_step_q31.c
+*
+* Description:	Q31 field-oriented control step.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Q31 field-oriented control step.
+ * @param[in,out] *S points to an instance of the Q31 FOC structure.
+ * @param[in] Ia phase a current.
+ * @param[in] Ib phase b current.
+ * @param[in] theta electrical rotor angle, [-1 0.9999] maps to [-180 180) degrees.
+ * @param[in] IdRef d-axis current reference.
+ * @param[in] IqRef q-axis current reference.
+ * @param[out] *pDuty points to the three phase duty cycles in [0 0x7FFFFFFF].
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Currents and voltages are in 1.31 format, with voltages normalized to the DC bus.
+ * The transforms use the Q31 Clarke and Park functions, which saturate.
+ * The PI gains are scaled down by <code>2^postShift</code>, and each gain product
+ * in 2.62 format is shifted right by <code>31 - postShift</code> bits.
+ * The integrators and the voltages saturate to the 1.31 range before the limits are applied.
+ */
+
+void arm_foc_step_q31(
+  arm_foc_instance_q31 * S,
+  q31_t Ia,
+  q31_t Ib,
+  q31_t theta,
+  q31_t IdRef,
+  q31_t IqRef,
+  q31_t * pDuty)
+{
+  q31_t sinVal, cosVal;                          /* Sine and cosine of the rotor angle */
+  q31_t alpha, beta;                             /* Stationary frame values */
+  q31_t Id, Iq, err;                             /* Rotor frame currents and error */
+  q31_t Vd, Vq, vqMax;                           /* Rotor frame voltages and q-axis limit */
+  q31_t Va, Vb, Vc;                              /* Phase voltages */
+  q31_t vHi, vLo;                                /* Largest and smallest phase voltages */
+  q63_t offset, duty;                            /* Zero-sequence injection */
+  q31_t vMax = S->vMax;                          /* Voltage limit */
+  uint32_t shift = 31u - S->postShift;           /* Shift of the gain products */
+
+  /* Sine and cosine are computed once and shared by both Park transforms */
+  arm_sin_cos_q31(theta, &sinVal, &cosVal);
+
+  /* Currents into the rotor frame */
+  arm_clarke_q31(Ia, Ib, &alpha, &beta);
+  arm_park_q31(alpha, beta, &Id, &Iq, sinVal, cosVal);
+
+  /* d-axis PI controller, limited to [-vMax, vMax] */
+  err = __QSUB(IdRef, Id);
+  S->integD = clip_q63_to_q31((q63_t) S->integD + (((q63_t) S->KiD * err) >> shift));
+  S->integD = (S->integD > vMax) ? vMax : ((S->integD < -vMax) ? -vMax : S->integD);
+  Vd = clip_q63_to_q31((((q63_t) S->KpD * err) >> shift) + S->integD);
+  Vd = (Vd > vMax) ? vMax : ((Vd < -vMax) ? -vMax : Vd);
+
+  /* q-axis PI controller, limited to the voltage left by Vd */
+  arm_sqrt_q31((q31_t) (((q63_t) vMax * vMax) >> 31) - (q31_t) (((q63_t) Vd * Vd) >> 31),
+               &vqMax);
+  err = __QSUB(IqRef, Iq);
+  S->integQ = clip_q63_to_q31((q63_t) S->integQ + (((q63_t) S->KiQ * err) >> shift));
+  S->integQ = (S->integQ > vqMax) ? vqMax : ((S->integQ < -vqMax) ? -vqMax : S->integQ);
+  Vq = clip_q63_to_q31((((q63_t) S->KpQ * err) >> shift) + S->integQ);
+  Vq = (Vq > vqMax) ? vqMax : ((Vq < -vqMax) ? -vqMax : Vq);
+
+  /* Voltages back to the phases */
+  arm_inv_park_q31(Vd, Vq, &alpha, &beta, sinVal, cosVal);
+  arm_inv_clarke_q31(alpha, beta, &Va, &Vb);
+  Vc = clip_q63_to_q31(-(q63_t) Va - Vb);
+
+  /* Space-vector modulation by min-max zero-sequence injection */
+  vHi = (Va > Vb) ? Va : Vb;
+  vHi = (Vc > vHi) ? Vc : vHi;
+  vLo = (Va < Vb) ? Va : Vb;
+  vLo = (Vc < vLo) ? Vc : vLo;
+  offset = 0x40000000 - (((q63_t) vHi + vLo) >> 1);
+
+  duty = Va + offset;
+  pDuty[0] = (duty > 0x7FFFFFFF) ? 0x7FFFFFFF : ((duty < 0) ? 0 : (q31_t) duty);
+  duty = Vb + offset;
+  pDuty[1] = (duty > 0x7FFFFFFF) ? 0x7FFFFFFF : ((duty < 0) ? 0 : (q31_t) duty);
+  duty = Vc + offset;
+  pDuty[2] = (duty > 0x7FFFFFFF) ? 0x7FFFFFFF : ((duty < 0) ? 0 : (q31_t) duty);
+}
+
+/**
+ * @} end of FOC group
+ */
@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_pid_bank_f32.c
+*
+* Description:	Floating-point PID controller bank.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup PID_Bank PID Controller Bank
+ *
+ * A PID controller bank updates N independent PID controllers in one call per
+ * control tick. The gains, limits and states of the controllers are stored as
+ * separate arrays of N values (structure-of-arrays), so a single loop streams
+ * through all of them without per-controller call and instance overhead.
+ *
+ * \par Algorithm:
+ * For each controller <code>k</code> and error sample <code>e[n]</code>:
+ * <pre>
+ *    P    = Kp * e[n]
+ *    d[n] = alpha * d[n-1] + (1 - alpha) * Kd * (e[n] - e[n-1])
+ *    i[n] = i[n-1] + Ki * e[n]
+ *    u    = P + i[n] + d[n]
+ *    y[n] = min(max(u, outMin), outMax)  </pre>
+ * \par
+ * \c Ki includes the sample time and \c Kd is divided by it. \c alpha is the pole
+ * of the first-order filter applied to the derivative term; <code>alpha = 0</code>
+ * gives the unfiltered derivative.
+ *
+ * \par Anti-windup
+ * The integrator is protected against windup while the output saturates:
+ * - ARM_PID_BANK_AW_NONE: no protection.
+ * - ARM_PID_BANK_AW_CLAMP: the integration of the current tick is discarded when the
+ * output saturates and the error drives it further into saturation, and the
+ * integrator is clamped to <code>[outMin, outMax]</code>.
+ * - ARM_PID_BANK_AW_BACKCALC: the saturation error is fed back into the integrator,
+ * <code>i[n] += Kb * (y[n] - u)</code>.
+ *
+ * \par Instance Structure
+ * The instance structure holds pointers to the N-value coefficient arrays and to the
+ * state buffer of <code>3*N</code> values laid out as N integrators, N filtered
+ * derivatives and N previous errors. The coefficient arrays may be updated between
+ * ticks to retune a controller.
+ *
+ * \par Initialization and Reset Functions
+ * The initialization function checks the anti-windup mode and clears the state buffer.
+ * The reset function clears the state buffer only.
+ *
+ * \par Fixed-Point Behavior
+ * The Q31 gains \c Kp, \c Ki, \c Kd and \c Kb are scaled down by <code>2^postShift</code>.
+ * The terms are computed with 64-bit products and summed in a 64-bit accumulator,
+ * and the integrator, the derivative and the output saturate to the 1.31 range.
+ */
+
+/**
+ * @addtogroup PID_Bank
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point PID controller bank.
+ * @param[in,out] *S points to an instance of the floating-point PID bank structure.
+ * @param[in] *pSrc points to the N error samples of this tick.
+ * @param[out] *pDst points to the N limited controller outputs.
+ * @return none.
+ */
+
+void arm_pid_bank_f32(
+  arm_pid_bank_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  uint16_t numCtrl = S->numCtrl;                 /* Number of controllers */
+  float32_t *pInteg = S->pState;                 /* Integrator states */
+  float32_t *pDeriv = pInteg + numCtrl;          /* Filtered derivative states */
+  float32_t *pPrev = pDeriv + numCtrl;           /* Previous errors */
+  float32_t *pKp = S->pKp, *pKi = S->pKi, *pKd = S->pKd; /* Gains */
+  float32_t *pAlpha = S->pAlpha, *pKb = S->pKb;  /* Filter poles and back-calculation gains */
+  float32_t *pMin = S->pOutMin, *pMax = S->pOutMax; /* Output limits */
+  float32_t e, prop, integ, integPrev, deriv, alpha; /* Temporary variables */
+  float32_t u, out, outMin, outMax;              /* Unlimited and limited outputs */
+  uint8_t antiWindup = S->antiWindup;            /* Anti-windup mode */
+  uint32_t blkCnt = numCtrl;                     /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    e = *pSrc++;
+    outMin = *pMin++;
+    outMax = *pMax++;
+
+    /* Proportional term */
+    prop = *pKp++ * e;
+
+    /* Filtered derivative term: d[n] = alpha * d[n-1] + (1 - alpha) * Kd * (e[n] - e[n-1]) */
+    alpha = *pAlpha++;
+    deriv = (alpha * *pDeriv) + ((1.0f - alpha) * (*pKd++ * (e - *pPrev)));
+    *pDeriv++ = deriv;
+    *pPrev++ = e;
+
+    /* Integral term */
+    integPrev = *pInteg;
+    integ = integPrev + (*pKi++ * e);
+
+    /* Limit the output */
+    u = prop + integ + deriv;
+    out = (u > outMax) ? outMax : ((u < outMin) ? outMin : u);
+
+    if(antiWindup == ARM_PID_BANK_AW_CLAMP)
+    {
+      /* Discard the integration when the error drives the output further into saturation */
+      if(((u > outMax) && (e > 0.0f)) || ((u < outMin) && (e < 0.0f)))
+      {
+        integ = integPrev;
+        u = prop + integ + deriv;
+        out = (u > outMax) ? outMax : ((u < outMin) ? outMin : u);
+      }
+
+      /* Clamp the integrator to the output range */
+      integ = (integ > outMax) ? outMax : ((integ < outMin) ? outMin : integ);
+    }
+    else if(antiWindup == ARM_PID_BANK_AW_BACKCALC)
+    {
+      /* Feed the saturation error back into the integrator */
+      integ += *pKb++ * (out - u);
+    }
+
+    *pInteg++ = integ;
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of PID_Bank group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_pid_bank_init_f32.c
+*
+* Description:	Floating-point PID controller bank initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup PID_Bank
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point PID controller bank.
+ * @param[in,out] *S points to an instance of the floating-point PID bank structure.
+ * @param[in] numCtrl number of controllers in the bank.
+ * @param[in] antiWindup integrator anti-windup mode, one of arm_pid_bank_antiwindup.
+ * @param[in] *pKp points to the proportional gains.
+ * @param[in] *pKi points to the integral gains.
+ * @param[in] *pKd points to the derivative gains.
+ * @param[in] *pAlpha points to the derivative filter poles.
+ * @param[in] *pKb points to the back-calculation gains. May be NULL unless antiWindup is ARM_PID_BANK_AW_BACKCALC.
+ * @param[in] *pOutMin points to the lower output limits.
+ * @param[in] *pOutMax points to the upper output limits.
+ * @param[in] *pState points to the state buffer of <code>3*numCtrl</code> values.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the anti-windup mode is
+ * unknown or the back-calculation gains are missing.
+ *
+ * \par Description:
+ * Each coefficient array holds one value per controller. The arrays are referenced, not
+ * copied, and may be updated between ticks. The state buffer is cleared.
+ */
+
+arm_status arm_pid_bank_init_f32(
+  arm_pid_bank_instance_f32 * S,
+  uint16_t numCtrl,
+  uint8_t antiWindup,
+  float32_t * pKp,
+  float32_t * pKi,
+  float32_t * pKd,
+  float32_t * pAlpha,
+  float32_t * pKb,
+  float32_t * pOutMin,
+  float32_t * pOutMax,
+  float32_t * pState)
+{
+  arm_status status;                             /* status of initialization */
+
+  if((antiWindup > ARM_PID_BANK_AW_BACKCALC) ||
+     ((antiWindup == ARM_PID_BANK_AW_BACKCALC) && (pKb == NULL)))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign the number of controllers and the anti-windup mode */
+    S->numCtrl = numCtrl;
+    S->antiWindup = antiWindup;
+
+    /* Assign the coefficient arrays */
+    S->pKp = pKp;
+    S->pKi = pKi;
+    S->pKd = pKd;
+    S->pAlpha = pAlpha;
+    S->pKb = pKb;
+    S->pOutMin = pOutMin;
+    S->pOutMax = pOutMax;
+
+    /* Assign the state pointer and clear the state buffer */
+    S->pState = pState;
+    memset(pState, 0, 3u * numCtrl * sizeof(float32_t));
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of PID_Bank group
+ */
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_pid_bank_init_q31.c
+*
+* Description:	Q31 PID controller bank initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup PID_Bank
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 PID controller bank.
+ * @param[in,out] *S points to an instance of the Q31 PID bank structure.
+ * @param[in] numCtrl number of controllers in the bank.
+ * @param[in] antiWindup integrator anti-windup mode, one of arm_pid_bank_antiwindup.
+ * @param[in] postShift scaling of the gains, 0 to 15 bits.
+ * @param[in] *pKp points to the proportional gains.
+ * @param[in] *pKi points to the integral gains.
+ * @param[in] *pKd points to the derivative gains.
+ * @param[in] *pAlpha points to the derivative filter poles.
+ * @param[in] *pKb points to the back-calculation gains. May be NULL unless antiWindup is ARM_PID_BANK_AW_BACKCALC.
+ * @param[in] *pOutMin points to the lower output limits.
+ * @param[in] *pOutMax points to the upper output limits.
+ * @param[in] *pState points to the state buffer of <code>3*numCtrl</code> values.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the anti-windup mode is
+ * unknown or the back-calculation gains are missing, or if postShift is above 15.
+ *
+ * \par Description:
+ * Each coefficient array holds one value per controller. The arrays are referenced, not
+ * copied, and may be updated between ticks. The state buffer is cleared.
+ */
+
+arm_status arm_pid_bank_init_q31(
+  arm_pid_bank_instance_q31 * S,
+  uint16_t numCtrl,
+  uint8_t antiWindup,
+  uint8_t postShift,
+  q31_t * pKp,
+  q31_t * pKi,
+  q31_t * pKd,
+  q31_t * pAlpha,
+  q31_t * pKb,
+  q31_t * pOutMin,
+  q31_t * pOutMax,
+  q31_t * pState)
+{
+  arm_status status;                             /* status of initialization */
+
+  if((antiWindup > ARM_PID_BANK_AW_BACKCALC) ||
+     ((antiWindup == ARM_PID_BANK_AW_BACKCALC) && (pKb == NULL)) ||
+     (postShift > 15u))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign the number of controllers and the anti-windup mode */
+    S->numCtrl = numCtrl;
+    S->antiWindup = antiWindup;
+    S->postShift = postShift;
+
+    /* Assign the coefficient arrays */
+    S->pKp = pKp;
+    S->pKi = pKi;
+    S->pKd = pKd;
+    S->pAlpha = pAlpha;
+    S->pKb = pKb;
+    S->pOutMin = pOutMin;
+    S->pOutMax = pOutMax;
+
+    /* Assign the state pointer and clear the state buffer */
+    S->pState = pState;
+    memset(pState, 0, 3u * numCtrl * sizeof(q31_t));
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of PID_Bank group
+ */
@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_pid_bank_q31.c
+*
+* Description:	Q31 PID controller bank.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup PID_Bank
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 PID controller bank.
+ * @param[in,out] *S points to an instance of the Q31 PID bank structure.
+ * @param[in] *pSrc points to the N error samples of this tick.
+ * @param[out] *pDst points to the N limited controller outputs.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The gains are in 1.31 format scaled down by <code>2^postShift</code>, so each
+ * 2.62 gain product is shifted right by <code>31 - postShift</code> bits.
+ * The proportional, integral and derivative terms are summed in a 64-bit
+ * accumulator before the output limits are applied, so the sum itself cannot overflow.
+ * The integrator and the derivative state saturate to the 1.31 range.
+ */
+
+void arm_pid_bank_q31(
+  arm_pid_bank_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst)
+{
+  uint16_t numCtrl = S->numCtrl;                 /* Number of controllers */
+  q31_t *pInteg = S->pState;                     /* Integrator states */
+  q31_t *pDeriv = pInteg + numCtrl;              /* Filtered derivative states */
+  q31_t *pPrev = pDeriv + numCtrl;               /* Previous errors */
+  q31_t *pKp = S->pKp, *pKi = S->pKi, *pKd = S->pKd; /* Gains */
+  q31_t *pAlpha = S->pAlpha, *pKb = S->pKb;      /* Filter poles and back-calculation gains */
+  q31_t *pMin = S->pOutMin, *pMax = S->pOutMax;  /* Output limits */
+  q31_t e, integ, integPrev, deriv, alpha;       /* Temporary variables */
+  q31_t out, outMin, outMax;                     /* Limited output and limits */
+  q63_t prop, u;                                 /* Proportional term and unlimited output */
+  uint32_t shift = 31u - S->postShift;           /* Shift of the gain products */
+  uint8_t antiWindup = S->antiWindup;            /* Anti-windup mode */
+  uint32_t blkCnt = numCtrl;                     /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    e = *pSrc++;
+    outMin = *pMin++;
+    outMax = *pMax++;
+
+    /* Proportional term */
+    prop = ((q63_t) * pKp++ * e) >> shift;
+
+    /* Filtered derivative term: d[n] = alpha * d[n-1] + (1 - alpha) * Kd * (e[n] - e[n-1]) */
+    deriv = clip_q63_to_q31(((q63_t) * pKd++ *
+                             clip_q63_to_q31((q63_t) e - *pPrev)) >> shift);
+    alpha = *pAlpha++;
+    deriv = (q31_t) ((((q63_t) alpha * *pDeriv) +
+                      ((q63_t) (0x7FFFFFFF - alpha) * deriv)) >> 31);
+    *pDeriv++ = deriv;
+    *pPrev++ = e;
+
+    /* Integral term */
+    integPrev = *pInteg;
+    integ = clip_q63_to_q31((q63_t) integPrev + (((q63_t) * pKi++ * e) >> shift));
+
+    /* Limit the output */
+    u = prop + integ + deriv;
+    out = (u > outMax) ? outMax : ((u < outMin) ? outMin : (q31_t) u);
+
+    if(antiWindup == ARM_PID_BANK_AW_CLAMP)
+    {
+      /* Discard the integration when the error drives the output further into saturation */
+      if(((u > outMax) && (e > 0)) || ((u < outMin) && (e < 0)))
+      {
+        integ = integPrev;
+        u = prop + integ + deriv;
+        out = (u > outMax) ? outMax : ((u < outMin) ? outMin : (q31_t) u);
+      }
+
+      /* Clamp the integrator to the output range */
+      integ = (integ > outMax) ? outMax : ((integ < outMin) ? outMin : integ);
+    }
+    else if(antiWindup == ARM_PID_BANK_AW_BACKCALC)
+    {
+      /* Feed the saturation error back into the integrator */
+      integ = clip_q63_to_q31((q63_t) integ +
+                              (((q63_t) * pKb++ * clip_q63_to_q31(out - u)) >> shift));
+    }
+
+    *pInteg++ = integ;
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of PID_Bank group
+ */
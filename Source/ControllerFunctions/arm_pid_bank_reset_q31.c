@@ -0,0 +1,45 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_pid_bank_reset_q31.c
+*
+* Description:	Q31 PID controller bank reset function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup PID_Bank
+ * @{
+ */
+
+/**
+ * @brief  Reset function for the Q31 PID controller bank.
+ * @param[in,out] *S points to an instance of the Q31 PID bank structure.
+ * @return none.
+ * \par Description:
+ * The function clears the integrators, the filtered derivatives and the previous errors
+ * of all controllers. The coefficient arrays are not changed.
+ */
+
+void arm_pid_bank_reset_q31(
+  arm_pid_bank_instance_q31 * S)
+{
+  /* Clear the state buffer.  The size is always 3 values per controller */
+  memset(S->pState, 0, 3u * S->numCtrl * sizeof(q31_t));
+}
+
+/**
+ * @} end of PID_Bank group
+ */
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_quaternion2rotation_f32.c
+*
+* Description:	Floating-point conversion of quaternions to rotation matrices.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point conversion of quaternions to rotation matrices.
+ * @param[in]       *pInputQuaternions points to the block of unit quaternions
+ * @param[out]      *pOutputRotations points to the block of rotation matrices (9 values each, row order)
+ * @param[in]       nbQuaternions number of quaternions in the block
+ * @return none.
+ *
+ * The quaternions must be normalized. The destination must not overlap the source.
+ */
+
+void arm_quaternion2rotation_f32(
+  const float32_t * pInputQuaternions,
+  float32_t * pOutputRotations,
+  uint32_t nbQuaternions)
+{
+  float32_t w, x, y, z;                          /* Quaternion */
+  float32_t xx, yy, zz, xy, xz, yz, wx, wy, wz;  /* Doubled products of the components */
+  uint32_t blkCnt = nbQuaternions;               /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    w = *pInputQuaternions++;
+    x = *pInputQuaternions++;
+    y = *pInputQuaternions++;
+    z = *pInputQuaternions++;
+
+    xx = 2.0f * (x * x);
+    yy = 2.0f * (y * y);
+    zz = 2.0f * (z * z);
+    xy = 2.0f * (x * y);
+    xz = 2.0f * (x * z);
+    yz = 2.0f * (y * z);
+    wx = 2.0f * (w * x);
+    wy = 2.0f * (w * y);
+    wz = 2.0f * (w * z);
+
+    pOutputRotations[0] = 1.0f - yy - zz;
+    pOutputRotations[1] = xy - wz;
+    pOutputRotations[2] = xz + wy;
+    pOutputRotations[3] = xy + wz;
+    pOutputRotations[4] = 1.0f - xx - zz;
+    pOutputRotations[5] = yz - wx;
+    pOutputRotations[6] = xz - wy;
+    pOutputRotations[7] = yz + wx;
+    pOutputRotations[8] = 1.0f - xx - yy;
+
+    pOutputRotations += 9u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
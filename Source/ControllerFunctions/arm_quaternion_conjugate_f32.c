@@ -0,0 +1,61 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_quaternion_conjugate_f32.c
+*
+* Description:	Floating-point quaternion conjugate.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point quaternion conjugate.
+ * @param[in]       *pInputQuaternions points to the block of input quaternions
+ * @param[out]      *pConjugateQuaternions points to the block of conjugated quaternions
+ * @param[in]       nbQuaternions number of quaternions in the block
+ * @return none.
+ *
+ * For a unit quaternion the conjugate is also the inverse rotation.
+ */
+
+void arm_quaternion_conjugate_f32(
+  const float32_t * pInputQuaternions,
+  float32_t * pConjugateQuaternions,
+  uint32_t nbQuaternions)
+{
+  uint32_t blkCnt = nbQuaternions;               /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    pConjugateQuaternions[0] = pInputQuaternions[0];
+    pConjugateQuaternions[1] = -pInputQuaternions[1];
+    pConjugateQuaternions[2] = -pInputQuaternions[2];
+    pConjugateQuaternions[3] = -pInputQuaternions[3];
+
+    pInputQuaternions += 4u;
+    pConjugateQuaternions += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_quaternion_normalize_f32.c
+*
+* Description:	Floating-point quaternion normalization.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point quaternion normalization.
+ * @param[in]       *pInputQuaternions points to the block of input quaternions
+ * @param[out]      *pNormalizedQuaternions points to the block of unit quaternions
+ * @param[in]       nbQuaternions number of quaternions in the block
+ * @return none.
+ *
+ * Integrating body rates makes the quaternion norm drift away from one; normalizing
+ * after every propagation step keeps the rotation matrix orthonormal.
+ * The input quaternions must not be zero.
+ */
+
+void arm_quaternion_normalize_f32(
+  const float32_t * pInputQuaternions,
+  float32_t * pNormalizedQuaternions,
+  uint32_t nbQuaternions)
+{
+  float32_t w, x, y, z;                          /* Input quaternion */
+  float32_t norm;                                /* Quaternion norm */
+  float32_t invNorm;                             /* Reciprocal of the norm */
+  uint32_t blkCnt = nbQuaternions;               /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    w = *pInputQuaternions++;
+    x = *pInputQuaternions++;
+    y = *pInputQuaternions++;
+    z = *pInputQuaternions++;
+
+    arm_sqrt_f32((w * w) + (x * x) + (y * y) + (z * z), &norm);
+    invNorm = 1.0f / norm;
+
+    *pNormalizedQuaternions++ = w * invNorm;
+    *pNormalizedQuaternions++ = x * invNorm;
+    *pNormalizedQuaternions++ = y * invNorm;
+    *pNormalizedQuaternions++ = z * invNorm;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
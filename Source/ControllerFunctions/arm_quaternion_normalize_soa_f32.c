@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_quaternion_normalize_soa_f32.c
+*
+* Description:	Floating-point normalization of quaternion planes.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point normalization of quaternions stored as component planes.
+ * @param[in]       *pInputQuaternions points to the input quaternions (4 planes of <code>nbQuaternions</code> values)
+ * @param[out]      *pNormalizedQuaternions points to the unit quaternions (4 planes of <code>nbQuaternions</code> values)
+ * @param[in]       nbQuaternions number of quaternions
+ * @return none.
+ *
+ * The input quaternions must not be zero.
+ */
+
+void arm_quaternion_normalize_soa_f32(
+  const float32_t * pInputQuaternions,
+  float32_t * pNormalizedQuaternions,
+  uint32_t nbQuaternions)
+{
+  const float32_t *pw = pInputQuaternions, *px = pInputQuaternions + nbQuaternions;     /* Input planes */
+  const float32_t *py = px + nbQuaternions, *pz = py + nbQuaternions;
+  float32_t *pnw = pNormalizedQuaternions, *pnx = pNormalizedQuaternions + nbQuaternions;       /* Output planes */
+  float32_t *pny = pnx + nbQuaternions, *pnz = pny + nbQuaternions;
+  float32_t w, x, y, z;                          /* Input quaternion */
+  float32_t norm;                                /* Quaternion norm */
+  float32_t invNorm;                             /* Reciprocal of the norm */
+  uint32_t blkCnt = nbQuaternions;               /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    w = *pw++;
+    x = *px++;
+    y = *py++;
+    z = *pz++;
+
+    arm_sqrt_f32((w * w) + (x * x) + (y * y) + (z * z), &norm);
+    invNorm = 1.0f / norm;
+
+    *pnw++ = w * invNorm;
+    *pnx++ = x * invNorm;
+    *pny++ = y * invNorm;
+    *pnz++ = z * invNorm;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
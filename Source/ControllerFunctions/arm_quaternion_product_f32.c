@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_quaternion_product_f32.c
+*
+* Description:	Floating-point product of blocks of quaternions.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point product of blocks of quaternions.
+ * @param[in]       *qa points to the first block of quaternions
+ * @param[in]       *qb points to the second block of quaternions
+ * @param[out]      *qr points to the block of products <code>qa[n] * qb[n]</code>
+ * @param[in]       nbQuaternions number of quaternions in each block
+ * @return none.
+ */
+
+void arm_quaternion_product_f32(
+  const float32_t * qa,
+  const float32_t * qb,
+  float32_t * qr,
+  uint32_t nbQuaternions)
+{
+  float32_t aw, ax, ay, az;                      /* First quaternion */
+  float32_t bw, bx, by, bz;                      /* Second quaternion */
+  uint32_t blkCnt = nbQuaternions;               /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    aw = *qa++;
+    ax = *qa++;
+    ay = *qa++;
+    az = *qa++;
+
+    bw = *qb++;
+    bx = *qb++;
+    by = *qb++;
+    bz = *qb++;
+
+    *qr++ = (aw * bw) - (ax * bx) - (ay * by) - (az * bz);
+    *qr++ = (aw * bx) + (ax * bw) + (ay * bz) - (az * by);
+    *qr++ = (aw * by) - (ax * bz) + (ay * bw) + (az * bx);
+    *qr++ = (aw * bz) + (ax * by) - (ay * bx) + (az * bw);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_quaternion_product_single_f32.c
+*
+* Description:	Floating-point product of two quaternions.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup QuatMath Quaternion Math Functions
+ *
+ * Functions operating on attitude quaternions.
+ *
+ * \par
+ * A quaternion is stored as four consecutive floating-point values
+ * <code>(w, x, y, z)</code> with the scalar part first. The Hamilton convention is used:
+ * <pre>
+ *    i*i = j*j = k*k = i*j*k = -1
+ * </pre>
+ * and a unit quaternion <code>q</code> rotates a vector <code>v</code> as
+ * <code>q * v * conj(q)</code>, which corresponds to the rotation matrix
+ * <pre>
+ *        | 1-2(y*y+z*z)   2(x*y-w*z)     2(x*z+w*y)   |
+ *    R = | 2(x*y+w*z)     1-2(x*x+z*z)   2(y*z-w*x)   |
+ *        | 2(x*z-w*y)     2(y*z+w*x)     1-2(x*x+y*y) |
+ * </pre>
+ * stored in row order. Products chain as for rotation matrices:
+ * <code>R(a * b) = R(a) * R(b)</code>.
+ *
+ * \par Block processing
+ * Apart from <code>arm_quaternion_product_single_f32()</code> every function processes
+ * <code>nbQuaternions</code> quaternions per call. Two layouts are supported:
+ * - Array of structures (default): quaternion <code>n</code> occupies
+ * <code>p[4n] .. p[4n+3]</code> and vector <code>n</code> occupies <code>p[3n] .. p[3n+2]</code>.
+ * - Structure of arrays (<code>_soa</code> functions): each component is stored in its own plane
+ * of <code>nbQuaternions</code> values, so component <code>k</code> of quaternion <code>n</code>
+ * is found at <code>p[k * nbQuaternions + n]</code>. This is the natural layout when many
+ * rotations are propagated together (sensor arrays, star tracker catalogues, Monte-Carlo runs);
+ * every plane is walked sequentially and no value is loaded twice.
+ *
+ * \par
+ * The destination may be the same array as a source for the element-wise functions:
+ * the products, the rotation of vectors, the normalization and the conjugate.
+ * <code>arm_quaternion2rotation_f32()</code> and <code>arm_rotation2quaternion_f32()</code>
+ * change the size of each element, so their destination must not overlap the source.
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point product of two quaternions.
+ * @param[in]       *qa points to the first quaternion
+ * @param[in]       *qb points to the second quaternion
+ * @param[out]      *qr points to the product <code>qa * qb</code>
+ * @return none.
+ */
+
+void arm_quaternion_product_single_f32(
+  const float32_t * qa,
+  const float32_t * qb,
+  float32_t * qr)
+{
+  float32_t aw, ax, ay, az;                      /* First quaternion */
+  float32_t bw, bx, by, bz;                      /* Second quaternion */
+
+  aw = qa[0];
+  ax = qa[1];
+  ay = qa[2];
+  az = qa[3];
+
+  bw = qb[0];
+  bx = qb[1];
+  by = qb[2];
+  bz = qb[3];
+
+  qr[0] = (aw * bw) - (ax * bx) - (ay * by) - (az * bz);
+  qr[1] = (aw * bx) + (ax * bw) + (ay * bz) - (az * by);
+  qr[2] = (aw * by) - (ax * bz) + (ay * bw) + (az * bx);
+  qr[3] = (aw * bz) + (ax * by) - (ay * bx) + (az * bw);
+}
+
+/**
+ * @} end of QuatMath group
+ */
@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_quaternion_product_soa_f32.c
+*
+* Description:	Floating-point product of quaternion planes.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point product of quaternions stored as component planes.
+ * @param[in]       *qa points to the first set of quaternions (4 planes of <code>nbQuaternions</code> values)
+ * @param[in]       *qb points to the second set of quaternions (4 planes of <code>nbQuaternions</code> values)
+ * @param[out]      *qr points to the products <code>qa[n] * qb[n]</code> (4 planes of <code>nbQuaternions</code> values)
+ * @param[in]       nbQuaternions number of quaternions in each set
+ * @return none.
+ */
+
+void arm_quaternion_product_soa_f32(
+  const float32_t * qa,
+  const float32_t * qb,
+  float32_t * qr,
+  uint32_t nbQuaternions)
+{
+  const float32_t *paw = qa, *pax = qa + nbQuaternions;         /* Planes of the first set */
+  const float32_t *pay = pax + nbQuaternions, *paz = pay + nbQuaternions;
+  const float32_t *pbw = qb, *pbx = qb + nbQuaternions;         /* Planes of the second set */
+  const float32_t *pby = pbx + nbQuaternions, *pbz = pby + nbQuaternions;
+  float32_t *prw = qr, *prx = qr + nbQuaternions;               /* Planes of the result */
+  float32_t *pry = prx + nbQuaternions, *prz = pry + nbQuaternions;
+  float32_t aw, ax, ay, az;                      /* First quaternion */
+  float32_t bw, bx, by, bz;                      /* Second quaternion */
+  uint32_t blkCnt = nbQuaternions;               /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    aw = *paw++;
+    ax = *pax++;
+    ay = *pay++;
+    az = *paz++;
+
+    bw = *pbw++;
+    bx = *pbx++;
+    by = *pby++;
+    bz = *pbz++;
+
+    *prw++ = (aw * bw) - (ax * bx) - (ay * by) - (az * bz);
+    *prx++ = (aw * bx) + (ax * bw) + (ay * bz) - (az * by);
+    *pry++ = (aw * by) - (ax * bz) + (ay * bw) + (az * bx);
+    *prz++ = (aw * bz) + (ax * by) - (ay * bx) + (az * bw);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
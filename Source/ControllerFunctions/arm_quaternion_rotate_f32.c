@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_quaternion_rotate_f32.c
+*
+* Description:	Floating-point rotation of vectors by quaternions.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point rotation of vectors by quaternions.
+ * @param[in]       *pQuaternions points to the block of unit quaternions
+ * @param[in]       *pSrcVec points to the block of input vectors (3 values each)
+ * @param[out]      *pDstVec points to the block of rotated vectors (3 values each)
+ * @param[in]       nbQuaternions number of quaternions and vectors in the blocks
+ * @return none.
+ *
+ * \par
+ * Vector <code>n</code> is rotated by quaternion <code>n</code>, which gives the same result as
+ * multiplying it by the rotation matrix of the quaternion. The rotation matrix is not formed;
+ * with <code>u = (x, y, z)</code> the rotated vector is computed as
+ * <pre>
+ *    t  = 2 * cross(u, v)
+ *    v' = v + w * t + cross(u, t)
+ * </pre>
+ * which needs 15 multiplications instead of the 27 needed to build and apply the matrix.
+ * The quaternions must be normalized.
+ */
+
+void arm_quaternion_rotate_f32(
+  const float32_t * pQuaternions,
+  const float32_t * pSrcVec,
+  float32_t * pDstVec,
+  uint32_t nbQuaternions)
+{
+  float32_t w, x, y, z;                          /* Quaternion */
+  float32_t vx, vy, vz;                          /* Input vector */
+  float32_t tx, ty, tz;                          /* Twice the cross product of u and v */
+  uint32_t blkCnt = nbQuaternions;               /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    w = *pQuaternions++;
+    x = *pQuaternions++;
+    y = *pQuaternions++;
+    z = *pQuaternions++;
+
+    vx = *pSrcVec++;
+    vy = *pSrcVec++;
+    vz = *pSrcVec++;
+
+    tx = 2.0f * ((y * vz) - (z * vy));
+    ty = 2.0f * ((z * vx) - (x * vz));
+    tz = 2.0f * ((x * vy) - (y * vx));
+
+    *pDstVec++ = vx + (w * tx) + ((y * tz) - (z * ty));
+    *pDstVec++ = vy + (w * ty) + ((z * tx) - (x * tz));
+    *pDstVec++ = vz + (w * tz) + ((x * ty) - (y * tx));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_quaternion_rotate_soa_f32.c
+*
+* Description:	Floating-point rotation of vector planes by quaternion planes.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point rotation of vectors by quaternions stored as component planes.
+ * @param[in]       *pQuaternions points to the unit quaternions (4 planes of <code>nbQuaternions</code> values)
+ * @param[in]       *pSrcVec points to the input vectors (3 planes of <code>nbQuaternions</code> values)
+ * @param[out]      *pDstVec points to the rotated vectors (3 planes of <code>nbQuaternions</code> values)
+ * @param[in]       nbQuaternions number of quaternions and vectors
+ * @return none.
+ *
+ * Uses the same formulation as <code>arm_quaternion_rotate_f32()</code>.
+ * The quaternions must be normalized.
+ */
+
+void arm_quaternion_rotate_soa_f32(
+  const float32_t * pQuaternions,
+  const float32_t * pSrcVec,
+  float32_t * pDstVec,
+  uint32_t nbQuaternions)
+{
+  const float32_t *pw = pQuaternions, *px = pQuaternions + nbQuaternions;       /* Quaternion planes */
+  const float32_t *py = px + nbQuaternions, *pz = py + nbQuaternions;
+  const float32_t *pvx = pSrcVec, *pvy = pSrcVec + nbQuaternions;               /* Input vector planes */
+  const float32_t *pvz = pvy + nbQuaternions;
+  float32_t *pdx = pDstVec, *pdy = pDstVec + nbQuaternions;                     /* Output vector planes */
+  float32_t *pdz = pdy + nbQuaternions;
+  float32_t w, x, y, z;                          /* Quaternion */
+  float32_t vx, vy, vz;                          /* Input vector */
+  float32_t tx, ty, tz;                          /* Twice the cross product of u and v */
+  uint32_t blkCnt = nbQuaternions;               /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    w = *pw++;
+    x = *px++;
+    y = *py++;
+    z = *pz++;
+
+    vx = *pvx++;
+    vy = *pvy++;
+    vz = *pvz++;
+
+    tx = 2.0f * ((y * vz) - (z * vy));
+    ty = 2.0f * ((z * vx) - (x * vz));
+    tz = 2.0f * ((x * vy) - (y * vx));
+
+    *pdx++ = vx + (w * tx) + ((y * tz) - (z * ty));
+    *pdy++ = vy + (w * ty) + ((z * tx) - (x * tz));
+    *pdz++ = vz + (w * tz) + ((x * ty) - (y * tx));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
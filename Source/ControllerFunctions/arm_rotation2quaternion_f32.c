@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_rotation2quaternion_f32.c
+*
+* Description:	Floating-point conversion of rotation matrices to quaternions.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point conversion of rotation matrices to quaternions.
+ * @param[in]       *pInputRotations points to the block of rotation matrices (9 values each, row order)
+ * @param[out]      *pOutputQuaternions points to the block of unit quaternions
+ * @param[in]       nbQuaternions number of matrices in the block
+ * @return none.
+ *
+ * \par
+ * Shepperd's method is used: the square root is taken of the largest of
+ * <code>4w^2, 4x^2, 4y^2, 4z^2</code>, read from the trace and the diagonal, so the
+ * division that recovers the other three components is always well conditioned.
+ * A rotation matrix describes both <code>q</code> and <code>-q</code>; the sign of the
+ * result follows from the selected component, which is always positive.
+ * The destination must not overlap the source.
+ */
+
+void arm_rotation2quaternion_f32(
+  const float32_t * pInputRotations,
+  float32_t * pOutputQuaternions,
+  uint32_t nbQuaternions)
+{
+  float32_t r00, r01, r02, r10, r11, r12, r20, r21, r22;        /* Rotation matrix */
+  float32_t trace;                               /* Trace of the matrix */
+  float32_t s;                                   /* Four times the selected component */
+  float32_t invS;                                /* Reciprocal of s */
+  uint32_t blkCnt = nbQuaternions;               /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    r00 = pInputRotations[0];
+    r01 = pInputRotations[1];
+    r02 = pInputRotations[2];
+    r10 = pInputRotations[3];
+    r11 = pInputRotations[4];
+    r12 = pInputRotations[5];
+    r20 = pInputRotations[6];
+    r21 = pInputRotations[7];
+    r22 = pInputRotations[8];
+
+    trace = r00 + r11 + r22;
+
+    if(trace > 0.0f)
+    {
+      /* w is the largest component */
+      arm_sqrt_f32(trace + 1.0f, &s);
+      s = 2.0f * s;
+      invS = 1.0f / s;
+
+      pOutputQuaternions[0] = 0.25f * s;
+      pOutputQuaternions[1] = (r21 - r12) * invS;
+      pOutputQuaternions[2] = (r02 - r20) * invS;
+      pOutputQuaternions[3] = (r10 - r01) * invS;
+    }
+    else if((r00 > r11) && (r00 > r22))
+    {
+      /* x is the largest component */
+      arm_sqrt_f32(1.0f + r00 - r11 - r22, &s);
+      s = 2.0f * s;
+      invS = 1.0f / s;
+
+      pOutputQuaternions[0] = (r21 - r12) * invS;
+      pOutputQuaternions[1] = 0.25f * s;
+      pOutputQuaternions[2] = (r01 + r10) * invS;
+      pOutputQuaternions[3] = (r02 + r20) * invS;
+    }
+    else if(r11 > r22)
+    {
+      /* y is the largest component */
+      arm_sqrt_f32(1.0f + r11 - r00 - r22, &s);
+      s = 2.0f * s;
+      invS = 1.0f / s;
+
+      pOutputQuaternions[0] = (r02 - r20) * invS;
+      pOutputQuaternions[1] = (r01 + r10) * invS;
+      pOutputQuaternions[2] = 0.25f * s;
+      pOutputQuaternions[3] = (r12 + r21) * invS;
+    }
+    else
+    {
+      /* z is the largest component */
+      arm_sqrt_f32(1.0f + r22 - r00 - r11, &s);
+      s = 2.0f * s;
+      invS = 1.0f / s;
+
+      pOutputQuaternions[0] = (r10 - r01) * invS;
+      pOutputQuaternions[1] = (r02 + r20) * invS;
+      pOutputQuaternions[2] = (r12 + r21) * invS;
+      pOutputQuaternions[3] = 0.25f * s;
+    }
+
+    pInputRotations += 9u;
+    pOutputQuaternions += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
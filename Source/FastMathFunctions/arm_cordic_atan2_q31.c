@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cordic_atan2_q31.c
+*
+* Description:	Q31 block four-quadrant arctangent using CORDIC.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Q31 block four-quadrant arctangent using CORDIC vectoring.
+ * @param[in] *S points to an instance of the Q31 CORDIC structure.
+ * @param[in] *pSrcY points to the block of y coordinates.
+ * @param[in] *pSrcX points to the block of x coordinates.
+ * @param[out] *pDst points to the block of angles <code>atan2(y, x)</code>, [-1 +1) maps to [-pi +pi).
+ * @param[in] blockSize number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The coordinates are scaled down to 3.29 format to leave room for the CORDIC gain.
+ * The angle of <code>(0, 0)</code> is 0 and the angle of the negative x axis is -pi.
+ */
+
+void arm_cordic_atan2_q31(
+  const arm_cordic_instance_q31 * S,
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  const q31_t *pAtan;                            /* Table of elementary angles */
+  q31_t x, y, z, xs, ys, a, d;                   /* CORDIC variables */
+  uint32_t numIter = S->numIter;                 /* Number of iterations */
+  uint32_t i, blkCnt = blockSize;                /* loop counters */
+
+  while(blkCnt > 0u)
+  {
+    /* Scale to 3.29 format */
+    y = *pSrcY++ >> 2;
+    x = *pSrcX++ >> 2;
+
+    /* Rotate a vector in the left half plane by -/+90 degrees into the right half plane */
+    if(x < 0)
+    {
+      if(y >= 0)
+      {
+        xs = x;
+        x = y;
+        y = -xs;
+        z = 0x40000000;
+      }
+      else
+      {
+        xs = x;
+        x = -y;
+        y = xs;
+        z = -0x40000000;
+      }
+    }
+    else
+    {
+      z = 0;
+    }
+
+    /* Vectoring mode: drive y to zero and accumulate the angle */
+    pAtan = armCordicAtanTableQ31;
+
+    for (i = 0u; i < numIter; i++)
+    {
+      /* d is -1 for a negative y and 0 otherwise, (v ^ d) - d negates v when d is -1 */
+      d = y >> 31;
+      xs = ((x >> i) ^ d) - d;
+      ys = ((y >> i) ^ d) - d;
+      a = (*pAtan++ ^ d) - d;
+
+      x += ys;
+      y -= xs;
+      z += a;
+    }
+
+    /* The iterations leave the zero vector unchanged, its angle is defined as 0 */
+    if((x | y) == 0)
+    {
+      z = 0;
+    }
+
+    *pDst++ = z;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CORDIC group
+ */
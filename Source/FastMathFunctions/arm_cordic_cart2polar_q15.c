@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cordic_cart2polar_q15.c
+*
+* Description:	Q15 block cartesian to polar conversion using CORDIC.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Q15 block cartesian to polar conversion using CORDIC vectoring.
+ * @param[in] *S points to an instance of the Q15 CORDIC structure.
+ * @param[in] *pSrcX points to the block of x coordinates.
+ * @param[in] *pSrcY points to the block of y coordinates.
+ * @param[out] *pMag points to the block of magnitudes <code>sqrt(x^2 + y^2)</code>.
+ * @param[out] *pPhase points to the block of angles <code>atan2(y, x)</code>, [-1 +1) maps to [-pi +pi).
+ * @param[in] blockSize number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The coordinates are extended to 3.29 format, which leaves room for the CORDIC gain.
+ * Magnitudes above 1 saturate to 0x7FFF.
+ */
+
+void arm_cordic_cart2polar_q15(
+  const arm_cordic_instance_q15 * S,
+  q15_t * pSrcX,
+  q15_t * pSrcY,
+  q15_t * pMag,
+  q15_t * pPhase,
+  uint32_t blockSize)
+{
+  const q31_t *pAtan;                            /* Table of elementary angles */
+  q31_t x, y, z, xs, ys, a, d;                   /* CORDIC variables */
+  q31_t invGain = S->invGain;                    /* Inverse CORDIC gain */
+  uint32_t numIter = S->numIter;                 /* Number of iterations */
+  uint32_t i, blkCnt = blockSize;                /* loop counters */
+
+  while(blkCnt > 0u)
+  {
+    /* Convert to 3.29 format */
+    x = (q31_t) * pSrcX++ << 14;
+    y = (q31_t) * pSrcY++ << 14;
+
+    /* Rotate a vector in the left half plane by -/+90 degrees into the right half plane */
+    if(x < 0)
+    {
+      if(y >= 0)
+      {
+        xs = x;
+        x = y;
+        y = -xs;
+        z = 0x40000000;
+      }
+      else
+      {
+        xs = x;
+        x = -y;
+        y = xs;
+        z = -0x40000000;
+      }
+    }
+    else
+    {
+      z = 0;
+    }
+
+    /* Vectoring mode: drive y to zero and accumulate the angle */
+    pAtan = armCordicAtanTableQ31;
+
+    for (i = 0u; i < numIter; i++)
+    {
+      /* d is -1 for a negative y and 0 otherwise, (v ^ d) - d negates v when d is -1 */
+      d = y >> 31;
+      xs = ((x >> i) ^ d) - d;
+      ys = ((y >> i) ^ d) - d;
+      a = (*pAtan++ ^ d) - d;
+
+      x += ys;
+      y -= xs;
+      z += a;
+    }
+
+    /* The iterations leave the zero vector unchanged, its angle is defined as 0 */
+    if((x | y) == 0)
+    {
+      z = 0;
+    }
+
+    /* Remove the CORDIC gain and convert from 3.29 to 1.15 format */
+    *pMag++ = (q15_t) __SSAT(((q63_t) x * invGain) >> 45, 16);
+    *pPhase++ = (q15_t) (z >> 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CORDIC group
+ */
@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cordic_cmplx_rotate_q31.c
+*
+* Description:	Q31 block complex rotation using CORDIC.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Q31 block complex rotation using CORDIC.
+ * @param[in] *S points to an instance of the Q31 CORDIC structure.
+ * @param[in] *pSrc points to the block of complex input values.
+ * @param[in] *pPhase points to the block of rotation angles, [-1 +1) maps to [-pi +pi).
+ * @param[out] *pDst points to the block of complex output values <code>pSrc[n] * exp(j * pi * pPhase[n])</code>.
+ * @param[in] numSamples number of complex samples to process.
+ * @return none.
+ *
+ * The complex values are stored in an interleaved fashion (real, imag, real, imag, ...).
+ * \par
+ * Each sample is rotated without computing sine and cosine, at the cost of one
+ * multiplication per component for the gain correction. <code>pDst</code> may be
+ * equal to <code>pSrc</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is multiplied by the inverse CORDIC gain into 2.30 format before
+ * the rotation, and the output saturates to the 1.31 range.
+ */
+
+void arm_cordic_cmplx_rotate_q31(
+  const arm_cordic_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pPhase,
+  q31_t * pDst,
+  uint32_t numSamples)
+{
+  const q31_t *pAtan;                            /* Table of elementary angles */
+  q31_t x, y, z, xs, ys, a, d;                   /* CORDIC variables */
+  q31_t invGain = S->invGain;                    /* Inverse CORDIC gain */
+  uint32_t numIter = S->numIter;                 /* Number of iterations */
+  uint32_t i, blkCnt = numSamples;               /* loop counters */
+
+  while(blkCnt > 0u)
+  {
+    /* Input with the CORDIC gain removed, in 2.30 format */
+    x = (q31_t) (((q63_t) * pSrc++ * invGain) >> 32);
+    y = (q31_t) (((q63_t) * pSrc++ * invGain) >> 32);
+    z = *pPhase++;
+
+    /* Rotate by +/-90 degrees, so that the residual lies in [-pi/2, pi/2] */
+    if(z > 0x40000000)
+    {
+      xs = x;
+      x = -y;
+      y = xs;
+      z -= 0x40000000;
+    }
+    else if(z < -0x40000000)
+    {
+      xs = x;
+      x = y;
+      y = -xs;
+      z += 0x40000000;
+    }
+
+    /* Rotation mode: drive the residual angle to zero */
+    pAtan = armCordicAtanTableQ31;
+
+    for (i = 0u; i < numIter; i++)
+    {
+      /* d is -1 for a negative residual and 0 otherwise, (v ^ d) - d negates v when d is -1 */
+      d = z >> 31;
+      xs = ((x >> i) ^ d) - d;
+      ys = ((y >> i) ^ d) - d;
+      a = (*pAtan++ ^ d) - d;
+
+      x -= ys;
+      y += xs;
+      z -= a;
+    }
+
+    /* Convert from 2.30 to 1.31 format with saturation */
+    *pDst++ = __QADD(x, x);
+    *pDst++ = __QADD(y, y);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CORDIC group
+ */
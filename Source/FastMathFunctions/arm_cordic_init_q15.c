@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cordic_init_q15.c
+*
+* Description:	Q15 CORDIC initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 CORDIC functions.
+ * @param[out] *S points to an instance of the Q15 CORDIC structure.
+ * @param[in] numIter number of iterations, 1 to 16.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numIter</code> is out of range.
+ */
+
+arm_status arm_cordic_init_q15(
+  arm_cordic_instance_q15 * S,
+  uint8_t numIter)
+{
+  arm_status status;                             /* status of initialization */
+
+  if((numIter == 0u) || (numIter > 16u))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign the number of iterations and the matching inverse gain */
+    S->numIter = numIter;
+    S->invGain = armCordicInvGainTableQ31[numIter - 1u];
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of CORDIC group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cordic_init_q31.c
+*
+* Description:	Q31 CORDIC initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup CORDIC CORDIC Functions
+ *
+ * The CORDIC (COordinate Rotation DIgital Computer) algorithm computes trigonometric
+ * functions, vector magnitudes and rotations with shifts, additions and a small table
+ * of angles. Each iteration adds about one bit of precision, so the number of iterations
+ * stored in the instance trades precision for cycles.
+ *
+ * \par Rotation mode
+ * The vector <code>(x, y)</code> is rotated by the angle <code>z</code> through
+ * micro-rotations of <code>+/-atan(2^-i)</code>, with the sign chosen so that the
+ * residual angle converges to zero:
+ * <pre>
+ *    d = sign(z)
+ *    x' = x - d * y * 2^-i
+ *    y' = y + d * x * 2^-i
+ *    z' = z - d * atan(2^-i)  </pre>
+ * This mode gives sine and cosine, polar to cartesian conversion and complex rotation.
+ *
+ * \par Vectoring mode
+ * The signs are chosen so that <code>y</code> converges to zero. The angle accumulator
+ * then holds <code>atan2(y, x)</code> and <code>x</code> holds the magnitude times the
+ * CORDIC gain. This mode gives atan2 and cartesian to polar conversion.
+ *
+ * \par
+ * Both modes first rotate by +/-90 degrees so that the full circle is covered. Each
+ * micro-rotation grows the vector by <code>sqrt(1 + 2^-2i)</code>, and the inverse of
+ * the accumulated gain for the configured number of iterations is applied once per sample.
+ * Inside the micro-rotation loop the direction is selected with masks instead of branches,
+ * so the loop takes the same number of cycles for every sample. The quadrant pre-rotation
+ * and, in vectoring mode, the zero input check are branches, so the total cost per sample
+ * still varies slightly with the input.
+ *
+ * \par Angle format
+ * Angles are in 1.31 or 1.15 format, where [-1 +1) maps to [-pi +pi).
+ *
+ * \par Precision
+ * After <code>n</code> iterations the residual angle is at most <code>atan(2^(1-n))</code>,
+ * about <code>2^(1-n)</code> radians. Sine, cosine, rotation and magnitude results carry
+ * an error of the same order relative to the vector length. In Q31 the truncation of
+ * the shifted terms accumulates, and the error settles at about 1e-7 (23 bits) for
+ * n = 24 and above. The Q15 functions use the same datapath and reach 1.15 precision
+ * at n = 16, which is also their maximum.
+ *
+ * \par Instance Structure
+ * The instance holds the number of iterations and the matching inverse gain.
+ * The initialization function looks up the gain and checks the number of iterations.
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 CORDIC functions.
+ * @param[out] *S points to an instance of the Q31 CORDIC structure.
+ * @param[in] numIter number of iterations, 1 to 31.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numIter</code> is out of range.
+ */
+
+arm_status arm_cordic_init_q31(
+  arm_cordic_instance_q31 * S,
+  uint8_t numIter)
+{
+  arm_status status;                             /* status of initialization */
+
+  if((numIter == 0u) || (numIter > 31u))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign the number of iterations and the matching inverse gain */
+    S->numIter = numIter;
+    S->invGain = armCordicInvGainTableQ31[numIter - 1u];
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of CORDIC group
+ */
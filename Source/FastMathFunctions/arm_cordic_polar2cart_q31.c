@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cordic_polar2cart_q31.c
+*
+* Description:	Q31 block polar to cartesian conversion using CORDIC.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Q31 block polar to cartesian conversion using CORDIC rotation.
+ * @param[in] *S points to an instance of the Q31 CORDIC structure.
+ * @param[in] *pMag points to the block of magnitudes in the range [0 +1).
+ * @param[in] *pPhase points to the block of angles, [-1 +1) maps to [-pi +pi).
+ * @param[out] *pDstX points to the block of x coordinates.
+ * @param[out] *pDstY points to the block of y coordinates.
+ * @param[in] blockSize number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The magnitude is multiplied by the inverse CORDIC gain into 2.30 format before
+ * the rotation, and the coordinates saturate to the 1.31 range.
+ */
+
+void arm_cordic_polar2cart_q31(
+  const arm_cordic_instance_q31 * S,
+  q31_t * pMag,
+  q31_t * pPhase,
+  q31_t * pDstX,
+  q31_t * pDstY,
+  uint32_t blockSize)
+{
+  const q31_t *pAtan;                            /* Table of elementary angles */
+  q31_t x, y, z, xs, ys, a, d, r;                /* CORDIC variables */
+  q31_t invGain = S->invGain;                    /* Inverse CORDIC gain */
+  uint32_t numIter = S->numIter;                 /* Number of iterations */
+  uint32_t i, blkCnt = blockSize;                /* loop counters */
+
+  while(blkCnt > 0u)
+  {
+    /* Start vector length with the CORDIC gain removed, in 2.30 format */
+    r = (q31_t) (((q63_t) * pMag++ * invGain) >> 32);
+    z = *pPhase++;
+
+    /* Start on the axis nearest to the angle, so that the residual lies in [-pi/2, pi/2] */
+    if(z > 0x40000000)
+    {
+      x = 0;
+      y = r;
+      z -= 0x40000000;
+    }
+    else if(z < -0x40000000)
+    {
+      x = 0;
+      y = -r;
+      z += 0x40000000;
+    }
+    else
+    {
+      x = r;
+      y = 0;
+    }
+
+    /* Rotation mode: drive the residual angle to zero */
+    pAtan = armCordicAtanTableQ31;
+
+    for (i = 0u; i < numIter; i++)
+    {
+      /* d is -1 for a negative residual and 0 otherwise, (v ^ d) - d negates v when d is -1 */
+      d = z >> 31;
+      xs = ((x >> i) ^ d) - d;
+      ys = ((y >> i) ^ d) - d;
+      a = (*pAtan++ ^ d) - d;
+
+      x -= ys;
+      y += xs;
+      z -= a;
+    }
+
+    /* Convert from 2.30 to 1.31 format with saturation */
+    *pDstX++ = __QADD(x, x);
+    *pDstY++ = __QADD(y, y);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CORDIC group
+ */
@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cordic_sin_cos_q15.c
+*
+* Description:	Q15 block sine and cosine using CORDIC.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Q15 block sine and cosine using CORDIC rotation.
+ * @param[in] *S points to an instance of the Q15 CORDIC structure.
+ * @param[in] *pSrc points to the block of angles, [-1 +1) maps to [-pi +pi).
+ * @param[out] *pSinVal points to the block of sine values.
+ * @param[out] *pCosVal points to the block of cosine values.
+ * @param[in] blockSize number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The angles are extended to 1.31 format and the iterations run in 2.30 format.
+ * The results are truncated to 1.15 format with saturation, so an angle of 0 gives
+ * a cosine of 0x7FFF.
+ */
+
+void arm_cordic_sin_cos_q15(
+  const arm_cordic_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pSinVal,
+  q15_t * pCosVal,
+  uint32_t blockSize)
+{
+  const q31_t *pAtan;                            /* Table of elementary angles */
+  q31_t x, y, z, xs, ys, a, d;                   /* CORDIC variables */
+  q31_t x0 = S->invGain >> 1;                    /* Start vector length in 2.30 format */
+  uint32_t numIter = S->numIter;                 /* Number of iterations */
+  uint32_t i, blkCnt = blockSize;                /* loop counters */
+
+  while(blkCnt > 0u)
+  {
+    z = (q31_t) * pSrc++ << 16;
+
+    /* Start on the axis nearest to the angle, so that the residual lies in [-pi/2, pi/2] */
+    if(z > 0x40000000)
+    {
+      x = 0;
+      y = x0;
+      z -= 0x40000000;
+    }
+    else if(z < -0x40000000)
+    {
+      x = 0;
+      y = -x0;
+      z += 0x40000000;
+    }
+    else
+    {
+      x = x0;
+      y = 0;
+    }
+
+    /* Rotation mode: drive the residual angle to zero */
+    pAtan = armCordicAtanTableQ31;
+
+    for (i = 0u; i < numIter; i++)
+    {
+      /* d is -1 for a negative residual and 0 otherwise, (v ^ d) - d negates v when d is -1 */
+      d = z >> 31;
+      xs = ((x >> i) ^ d) - d;
+      ys = ((y >> i) ^ d) - d;
+      a = (*pAtan++ ^ d) - d;
+
+      x -= ys;
+      y += xs;
+      z -= a;
+    }
+
+    /* Convert from 2.30 to 1.15 format with saturation */
+    *pSinVal++ = (q15_t) __SSAT(y >> 15, 16);
+    *pCosVal++ = (q15_t) __SSAT(x >> 15, 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CORDIC group
+ */
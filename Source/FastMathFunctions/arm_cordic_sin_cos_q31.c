@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cordic_sin_cos_q31.c
+*
+* Description:	Q31 block sine and cosine using CORDIC.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Q31 block sine and cosine using CORDIC rotation.
+ * @param[in] *S points to an instance of the Q31 CORDIC structure.
+ * @param[in] *pSrc points to the block of angles, [-1 +1) maps to [-pi +pi).
+ * @param[out] *pSinVal points to the block of sine values.
+ * @param[out] *pCosVal points to the block of cosine values.
+ * @param[in] blockSize number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The iterations run in 2.30 format and the results saturate to the 1.31 range,
+ * so an angle of 0 gives a cosine of 0x7FFFFFFF.
+ */
+
+void arm_cordic_sin_cos_q31(
+  const arm_cordic_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  uint32_t blockSize)
+{
+  const q31_t *pAtan;                            /* Table of elementary angles */
+  q31_t x, y, z, xs, ys, a, d;                   /* CORDIC variables */
+  q31_t x0 = S->invGain >> 1;                    /* Start vector length in 2.30 format */
+  uint32_t numIter = S->numIter;                 /* Number of iterations */
+  uint32_t i, blkCnt = blockSize;                /* loop counters */
+
+  while(blkCnt > 0u)
+  {
+    z = *pSrc++;
+
+    /* Start on the axis nearest to the angle, so that the residual lies in [-pi/2, pi/2] */
+    if(z > 0x40000000)
+    {
+      x = 0;
+      y = x0;
+      z -= 0x40000000;
+    }
+    else if(z < -0x40000000)
+    {
+      x = 0;
+      y = -x0;
+      z += 0x40000000;
+    }
+    else
+    {
+      x = x0;
+      y = 0;
+    }
+
+    /* Rotation mode: drive the residual angle to zero */
+    pAtan = armCordicAtanTableQ31;
+
+    for (i = 0u; i < numIter; i++)
+    {
+      /* d is -1 for a negative residual and 0 otherwise, (v ^ d) - d negates v when d is -1 */
+      d = z >> 31;
+      xs = ((x >> i) ^ d) - d;
+      ys = ((y >> i) ^ d) - d;
+      a = (*pAtan++ ^ d) - d;
+
+      x -= ys;
+      y += xs;
+      z -= a;
+    }
+
+    /* Convert from 2.30 to 1.31 format with saturation */
+    *pSinVal++ = __QADD(y, y);
+    *pCosVal++ = __QADD(x, x);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CORDIC group
+ */
@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_vatan2_f32.c
+*
+* Description:	Floating-point block four-quadrant arctangent function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VecTrans
+ * @{
+ */
+
+/**
+ * @brief  Floating-point block four-quadrant arctangent function.
+ * @param[in]  *pSrcY points to the block of y coordinates.
+ * @param[in]  *pSrcX points to the block of x coordinates.
+ * @param[out] *pDst points to the block of angles <code>atan2(y, x)</code> in radians, in [-pi, pi].
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The arctangent of <code>y / x</code> is computed as in arm_vatan_f32() and moved
+ * to the quadrant given by the signs of <code>x</code> and <code>y</code>.
+ * The angle of <code>(0, 0)</code> is 0.
+ */
+
+void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, y, q, aq, t, z, y0, a;            /* Temporary variables */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    y = *pSrcY++;
+    x = *pSrcX++;
+
+    if(x == 0.0f)
+    {
+      /* On the y axis */
+      a = (y > 0.0f) ? 1.570796326794897f : ((y < 0.0f) ? -1.570796326794897f : 0.0f);
+    }
+    else
+    {
+      q = y / x;
+      aq = (q < 0.0f) ? -q : q;
+
+      /* Range reduction to |t| <= tan(pi/8) */
+      if(aq > 2.414213562373095f)
+      {
+        y0 = 1.570796326794897f;
+        t = -1.0f / aq;
+      }
+      else if(aq > 0.4142135623730950f)
+      {
+        y0 = 0.7853981633974483f;
+        t = (aq - 1.0f) / (aq + 1.0f);
+      }
+      else
+      {
+        y0 = 0.0f;
+        t = aq;
+      }
+
+      /* Arctangent polynomial */
+      z = t * t;
+      a = 8.05374449538e-2f;
+      a = (a * z) - 1.38776856032e-1f;
+      a = (a * z) + 1.99777106478e-1f;
+      a = (a * z) - 3.33329491539e-1f;
+      a = y0 + ((a * z * t) + t);
+      a = (q < 0.0f) ? -a : a;
+
+      /* Move to the left half plane */
+      if(x < 0.0f)
+      {
+        a += (y < 0.0f) ? -3.141592653589793f : 3.141592653589793f;
+      }
+    }
+
+    *pDst++ = a;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VecTrans group
+ */
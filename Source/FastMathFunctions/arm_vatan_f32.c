@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_vatan_f32.c
+*
+* Description:	Floating-point block arctangent function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VecTrans
+ * @{
+ */
+
+/**
+ * @brief  Floating-point block arctangent function.
+ * @param[in]  *pSrc points to the block of input values.
+ * @param[out] *pDst points to the block of angles in radians, in [-pi/2, pi/2].
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The magnitude of the input is reduced to <code>[0, tan(pi/8)]</code> with
+ * <code>atan(x) = pi/4 + atan((x - 1) / (x + 1))</code> or
+ * <code>atan(x) = pi/2 - atan(1 / x)</code> before the polynomial is evaluated.
+ */
+
+void arm_vatan_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, ax, t, z, y0, y;                  /* Temporary variables */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pSrc++;
+    ax = (x < 0.0f) ? -x : x;
+
+    /* Range reduction to |t| <= tan(pi/8) */
+    if(ax > 2.414213562373095f)
+    {
+      y0 = 1.570796326794897f;
+      t = -1.0f / ax;
+    }
+    else if(ax > 0.4142135623730950f)
+    {
+      y0 = 0.7853981633974483f;
+      t = (ax - 1.0f) / (ax + 1.0f);
+    }
+    else
+    {
+      y0 = 0.0f;
+      t = ax;
+    }
+
+    /* Arctangent polynomial */
+    z = t * t;
+    y = 8.05374449538e-2f;
+    y = (y * z) - 1.38776856032e-1f;
+    y = (y * z) + 1.99777106478e-1f;
+    y = (y * z) - 3.33329491539e-1f;
+    y = y0 + ((y * z * t) + t);
+
+    *pDst++ = (x < 0.0f) ? -y : y;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VecTrans group
+ */
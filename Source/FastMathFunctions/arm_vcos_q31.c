@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_vcos_q31.c
+*
+* Description:	Q31 block cosine function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VecTrans
+ * @{
+ */
+
+/**
+ * @brief  Q31 block cosine function.
+ * @param[in]  *pSrc points to the block of scaled angles, [0 +0.9999] maps to [0 2*pi).
+ * @param[out] *pDst points to the block of cosine values.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The angle is treated as an unsigned phase, so negative inputs wrap to [pi 2*pi).
+ * The octant is taken from the top three bits of the phase and the angle within the
+ * octant, at most pi/4, is evaluated with the sine or the cosine polynomial.
+ * The cosine is the sine of the phase advanced by a quarter turn.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The polynomials are evaluated in 1.31 format with rounded products.
+ * The results saturate to the 1.31 range and are accurate to 1.8 LSB.
+ */
+
+void arm_vcos_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t phase, oct, r;                        /* Phase, octant and angle within the octant */
+  q31_t x, x2, p;                                /* Polynomial variables */
+  q63_t y;                                       /* Result */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Full turn is 2^32 */
+    phase = ((uint32_t) *pSrc++ << 1) + 0x40000000u;
+    oct = phase >> 29;
+    r = phase & 0x1FFFFFFFu;
+
+    /* Odd octants run backwards from the next multiple of pi/4 */
+    if((oct & 1u) != 0u)
+    {
+      r = 0x20000000u - r;
+    }
+
+    /* Angle in radians, 1.31 format: r * (pi/4) / 2^29 */
+    x = (q31_t) (((q63_t) r * 0x6487ED51) >> 29);
+    x2 = (q31_t) ((((q63_t) x * x) + 0x40000000) >> 31);
+
+    if((((oct + 1u) & 2u)) != 0u)
+    {
+      /* cos(x) = 1 - x^2/2! + x^4/4! - x^6/6! + x^8/8! - x^10/10! */
+      p = -0x00000250;
+      p = 0x0000D00D + (q31_t) ((((q63_t) p * x2) + 0x40000000) >> 31);
+      p = -0x002D82D8 + (q31_t) ((((q63_t) p * x2) + 0x40000000) >> 31);
+      p = 0x05555555 + (q31_t) ((((q63_t) p * x2) + 0x40000000) >> 31);
+      p = -0x40000000 + (q31_t) ((((q63_t) p * x2) + 0x40000000) >> 31);
+      y = 0x80000000LL + ((((q63_t) p * x2) + 0x40000000) >> 31);
+    }
+    else
+    {
+      /* sin(x) = x - x^3/3! + x^5/5! - x^7/7! + x^9/9! - x^11/11! */
+      p = -0x00000036;
+      p = 0x0000171E + (q31_t) ((((q63_t) p * x2) + 0x40000000) >> 31);
+      p = -0x00068068 + (q31_t) ((((q63_t) p * x2) + 0x40000000) >> 31);
+      p = 0x01111111 + (q31_t) ((((q63_t) p * x2) + 0x40000000) >> 31);
+      p = -0x15555555 + (q31_t) ((((q63_t) p * x2) + 0x40000000) >> 31);
+      p = (q31_t) ((((q63_t) p * x2) + 0x40000000) >> 31);
+      y = x + ((((q63_t) p * x) + 0x40000000) >> 31);
+    }
+
+    /* The second half turn is negative */
+    y = (oct >= 4u) ? -y : y;
+    *pDst++ = clip_q63_to_q31(y);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VecTrans group
+ */
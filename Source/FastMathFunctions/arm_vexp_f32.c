@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_vexp_f32.c
+*
+* Description:	Floating-point block exponential function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VecTrans
+ * @{
+ */
+
+/**
+ * @brief  Floating-point block exponential function.
+ * @param[in]  *pSrc points to the block of input values.
+ * @param[out] *pDst points to the block of values <code>e^x</code>.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The input is reduced to <code>x = n * ln(2) + r</code>, <code>|r| <= ln(2)/2</code>,
+ * and the polynomial for <code>e^r</code> is scaled by <code>2^n</code> through the exponent
+ * field. Inputs above 88.72 give +infinity and inputs below -87.33 give 0.
+ */
+
+void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, r, p, fn;                         /* Temporary variables */
+  int32_t n, n1;                                 /* Power of two */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } s1, s2;                                      /* Scale factors 2^n1 and 2^(n - n1) */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pSrc++;
+
+    if(x > 88.72283905206835f)
+    {
+      /* Overflow */
+      s1.i = 0x7F800000;
+      *pDst++ = s1.f;
+    }
+    else if(x < -87.33654475055310898657f)
+    {
+      /* Underflow */
+      *pDst++ = 0.0f;
+    }
+    else
+    {
+      /* Range reduction: x = n * ln(2) + r, with ln(2) split into two parts */
+      n = (int32_t) ((x * 1.44269504088896341f) + ((x < 0.0f) ? -0.5f : 0.5f));
+      fn = (float32_t) n;
+      r = (x - (fn * 0.693359375f)) + (fn * 2.12194440e-4f);
+
+      /* e^r polynomial */
+      p = 1.9875691500e-4f;
+      p = (p * r) + 1.3981999507e-3f;
+      p = (p * r) + 8.3334519073e-3f;
+      p = (p * r) + 4.1665795894e-2f;
+      p = (p * r) + 1.6666665459e-1f;
+      p = (p * r) + 5.0000001201e-1f;
+      p = ((p * (r * r)) + r) + 1.0f;
+
+      /* Scale by 2^n in two steps, so that each factor is a normal number */
+      n1 = n >> 1;
+      s1.i = (n1 + 127) << 23;
+      s2.i = ((n - n1) + 127) << 23;
+      *pDst++ = (p * s1.f) * s2.f;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VecTrans group
+ */
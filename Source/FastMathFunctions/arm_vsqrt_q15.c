@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_vsqrt_q15.c
+*
+* Description:	Q15 block square root function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VecTrans
+ * @{
+ */
+
+/**
+ * @brief  Q15 block square root function.
+ * @param[in]  *pSrc points to the block of input values in the range [0 +1).
+ * @param[out] *pDst points to the block of square roots.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * <code>x * 2^15</code> is exact in single precision, so the square root instruction
+ * followed by rounding gives the nearest 1.15 result.
+ * Inputs that are not positive give 0.
+ */
+
+void arm_vsqrt_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t s;                                   /* Floating-point square root */
+  q31_t y;                                       /* Rounded result */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* sqrt(in * 2^15), which is 0 for inputs that are not positive */
+    arm_sqrt_f32((float32_t) * pSrc++ * 32768.0f, &s);
+    y = (q31_t) (s + 0.5f);
+    *pDst++ = (q15_t) ((y > 0x7FFF) ? 0x7FFF : y);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VecTrans group
+ */
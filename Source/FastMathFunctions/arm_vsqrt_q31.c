@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_vsqrt_q31.c
+*
+* Description:	Q31 block square root function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VecTrans
+ * @{
+ */
+
+/**
+ * @brief  Q31 block square root function.
+ * @param[in]  *pSrc points to the block of input values in the range [0 +1).
+ * @param[out] *pDst points to the block of square roots.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * A single precision square root gives a 24-bit estimate <code>y0</code> of
+ * <code>Y = sqrt(x * 2^31)</code>. One correction step
+ * <code>y = y0 + (x * 2^31 - y0^2) / (2 * y0)</code> with an exact 64-bit residual
+ * then brings the result to within 0.5 LSB. Each sample takes the
+ * same number of cycles. Inputs that are not positive give 0.
+ */
+
+void arm_vsqrt_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in, y;                                   /* Input and result */
+  float32_t s, c;                                /* Floating-point estimate and correction */
+  q63_t e;                                       /* Residual */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(in > 0)
+    {
+      /* 24-bit estimate of sqrt(in * 2^31), which is below 2^31 */
+      arm_sqrt_f32((float32_t) in * 2147483648.0f, &s);
+      y = (s >= 2147483520.0f) ? 0x7FFFFF80 : (q31_t) s;
+
+      /* Correct with the exact residual */
+      e = ((q63_t) in << 31) - ((q63_t) y * y);
+      c = (float32_t) e / (2.0f * s);
+      y += (c >= 0.0f) ? (q31_t) (c + 0.5f) : -(q31_t) (0.5f - c);
+      *pDst++ = (y < 0) ? 0x7FFFFFFF : y;
+    }
+    else
+    {
+      *pDst++ = 0;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VecTrans group
+ */
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_vtan_f32.c
+*
+* Description:	Floating-point block tangent function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VecTrans
+ * @{
+ */
+
+/**
+ * @brief  Floating-point block tangent function.
+ * @param[in]  *pSrc points to the block of angles in radians.
+ * @param[out] *pDst points to the block of tangent values.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * Uses the range reduction of arm_vsin_f32(). In odd quadrants the result is
+ * <code>-1 / tan(r)</code>.
+ */
+
+void arm_vtan_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, r, r2, t, fk;                     /* Temporary variables */
+  int32_t k;                                     /* Quadrant */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pSrc++;
+
+    /* Range reduction: x = k * pi/2 + r */
+    k = (int32_t) ((x * 0.636619772367581f) + ((x < 0.0f) ? -0.5f : 0.5f));
+    fk = (float32_t) k;
+    r = ((x - (fk * 1.5703125f)) - (fk * 4.837512969970703125e-4f)) -
+      (fk * 7.54978995489188216e-8f);
+    r2 = r * r;
+
+    /* Tangent polynomial on [-pi/4, pi/4] */
+    t = 9.38540185543e-3f;
+    t = (t * r2) + 3.11992232697e-3f;
+    t = (t * r2) + 2.44301354525e-2f;
+    t = (t * r2) + 5.34112807005e-2f;
+    t = (t * r2) + 1.33387994085e-1f;
+    t = (t * r2) + 3.33331568548e-1f;
+    t = r + ((r * r2) * t);
+
+    *pDst++ = ((k & 1) != 0) ? (-1.0f / t) : t;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VecTrans group
+ */
@@ -0,0 +1,164 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_biquad_cascade_df1_32x64_ramp_q31.c
+*
+* Description:	High precision Q31 Biquad cascade filter with coefficient ramping.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1_32x64
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the high precision Q31 Biquad cascade filter, ramping
+ * the coefficients to a new set over the block.
+ * @param[in]  *S points to an instance of the high precision Q31 Biquad cascade filter structure.
+ * @param[in]  *pTargetCoeffs points to the 5*numStages coefficients reached at the end of the block.
+ * @param[in]  *pSrc points to the block of input data.
+ * @param[out] *pDst points to the block of output data.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * Each coefficient moves linearly from its value in <code>S->pCoeffs</code> to the target
+ * value, one step per sample, and the target set is copied into <code>S->pCoeffs</code> at
+ * the end of the block. The coefficient array must therefore be writable and not shared
+ * with other instances. The target coefficients must be scaled for the <code>postShift</code>
+ * of the instance, see arm_biquad_coeffs_to_q31().
+ *
+ * \par
+ * The steps are truncated, so the coefficients approach the target to within
+ * <code>blockSize</code> LSBs before the exact target is stored. A linear path between two
+ * stable stages stays stable, as for arm_biquad_cascade_df2T_ramp_f32().
+ *
+ * \par Scaling and Overflow Behavior:
+ * The arithmetic is the same as in arm_biquad_cas_df1_32x64_q31().
+ */
+
+void arm_biquad_cas_df1_32x64_ramp_q31(
+  const arm_biquad_cas_df1_32x64_ins_q31 * S,
+  q31_t * pTargetCoeffs,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pIn = pSrc;                             /*  input pointer initialization  */
+  q31_t *pOut = pDst;                            /*  output pointer initialization */
+  q63_t *pState = S->pState;                     /*  state pointer initialization  */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coeff pointer initialization  */
+  q31_t *pTarget = pTargetCoeffs;                /*  target coeff pointer          */
+  q63_t acc;                                     /*  accumulator                   */
+  q31_t Xn1, Xn2;                                /*  Input Filter state variables  */
+  q63_t Yn1, Yn2;                                /*  Output Filter state variables */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+  q31_t db0, db1, db2, da1, da2;                 /*  Coefficient steps             */
+  q31_t Xn;                                      /*  temporary input               */
+  int32_t shift = (int32_t) S->postShift + 1;    /*  Shift to be applied to the output */
+  uint32_t sample, stage = S->numStages;         /*  loop counters                 */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    /* Coefficient change per sample, computed in 64 bits as the
+     ** difference of two Q31 values may not fit in 32 bits */
+    if(blockSize > 0u)
+    {
+      db0 = (q31_t) (((q63_t) pTarget[0] - b0) / (q63_t) blockSize);
+      db1 = (q31_t) (((q63_t) pTarget[1] - b1) / (q63_t) blockSize);
+      db2 = (q31_t) (((q63_t) pTarget[2] - b2) / (q63_t) blockSize);
+      da1 = (q31_t) (((q63_t) pTarget[3] - a1) / (q63_t) blockSize);
+      da2 = (q31_t) (((q63_t) pTarget[4] - a2) / (q63_t) blockSize);
+    }
+    else
+    {
+      db0 = db1 = db2 = da1 = da2 = 0;
+    }
+
+    /* Reading the state values */
+    Xn1 = (q31_t) (pState[0]);
+    Xn2 = (q31_t) (pState[1]);
+    Yn1 = pState[2];
+    Yn2 = pState[3];
+
+    sample = blockSize;
+
+    while(sample > 0u)
+    {
+      /* Advance the coefficients.  The truncated steps never pass the target */
+      b0 += db0;
+      b1 += db1;
+      b2 += db2;
+      a1 += da1;
+      a2 += da2;
+
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      acc = (q63_t) Xn * b0;
+      acc += (q63_t) Xn1 * b1;
+      acc += (q63_t) Xn2 * b2;
+      acc += mult32x64(Yn1, a1);
+      acc += mult32x64(Yn2, a2);
+
+      /* Every time after the output is computed state should be updated. */
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+
+      /* The result is converted to 1.63 */
+      Yn1 = acc << shift;
+
+      /* Store the output in the destination buffer in 1.31 format. */
+      *pOut++ = (q31_t) (acc >> (32 - shift));
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /*  The first stage output is given as input to the second stage. */
+    pIn = pDst;
+
+    /* Reset to destination buffer working pointer */
+    pOut = pDst;
+
+    /*  Store the updated state variables back into the pState array */
+    *pState++ = (q63_t) Xn1;
+    *pState++ = (q63_t) Xn2;
+    *pState++ = Yn1;
+    *pState++ = Yn2;
+
+    /* The target coefficients become the coefficients of the filter */
+    *pCoeffs++ = *pTarget++;
+    *pCoeffs++ = *pTarget++;
+    *pCoeffs++ = *pTarget++;
+    *pCoeffs++ = *pTarget++;
+    *pCoeffs++ = *pTarget++;
+
+  } while(--stage);
+}
+
+/**
+ * @} end of BiquadCascadeDF1_32x64 group
+ */
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_biquad_cascade_df2T_ramp_f32.c
+*
+* Description:	Floating-point transposed direct form II Biquad cascade with coefficient ramping.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point transposed direct form II Biquad cascade
+ * filter, ramping the coefficients to a new set over the block.
+ * @param[in]  *S points to an instance of the filter data structure.
+ * @param[in]  *pTargetCoeffs points to the 5*numStages coefficients reached at the end of the block.
+ * @param[in]  *pSrc points to the block of input data.
+ * @param[out] *pDst points to the block of output data.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * Each coefficient moves linearly from its value in <code>S->pCoeffs</code> to the target
+ * value, one step per sample, and the target set is copied into <code>S->pCoeffs</code> at
+ * the end of the block. Later calls of arm_biquad_cascade_df2T_f32() then run with the new
+ * coefficients. The coefficient array must therefore be writable and not shared with
+ * other instances.
+ *
+ * \par
+ * The set of stable <code>(a1, a2)</code> pairs is a triangle, and a linear path between
+ * two stable stages stays inside it. If both coefficient sets are stable, every
+ * intermediate filter is stable too. The ramp costs 5 additions per stage and sample,
+ * so call arm_biquad_cascade_df2T_f32() once the parameters have settled.
+ */
+
+void arm_biquad_cascade_df2T_ramp_f32(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+  float32_t * pTargetCoeffs,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /*  source pointer            */
+  float32_t *pOut = pDst;                        /*  destination pointer       */
+  float32_t *pState = S->pState;                 /*  State pointer             */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  float32_t *pTarget = pTargetCoeffs;            /*  target coefficient pointer */
+  float32_t acc;                                 /*  accumulator               */
+  float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+  float32_t db0, db1, db2, da1, da2;             /*  Coefficient steps         */
+  float32_t Xn;                                  /*  temporary input           */
+  float32_t d1, d2;                              /*  state variables           */
+  float32_t step;                                /*  1 / blockSize             */
+  uint32_t sample, stage = S->numStages;         /*  loop counters             */
+
+  step = (blockSize > 0u) ? (1.0f / (float32_t) blockSize) : 0.0f;
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    /* Coefficient change per sample */
+    db0 = (pTarget[0] - b0) * step;
+    db1 = (pTarget[1] - b1) * step;
+    db2 = (pTarget[2] - b2) * step;
+    da1 = (pTarget[3] - a1) * step;
+    da2 = (pTarget[4] - a2) * step;
+
+    /* Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+    sample = blockSize;
+
+    while(sample > 0u)
+    {
+      /* Advance the coefficients */
+      b0 += db0;
+      b1 += db1;
+      b2 += db2;
+      a1 += da1;
+      a2 += da2;
+
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1 */
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      acc = (b0 * Xn) + d1;
+      d1 = (b1 * Xn) + (a1 * acc) + d2;
+      d2 = (b2 * Xn) + (a2 * acc);
+
+      /* Store the result in the destination buffer. */
+      *pOut++ = acc;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the pState array */
+    *pState++ = d1;
+    *pState++ = d2;
+
+    /* The target coefficients become the coefficients of the filter */
+    *pCoeffs++ = *pTarget++;
+    *pCoeffs++ = *pTarget++;
+    *pCoeffs++ = *pTarget++;
+    *pCoeffs++ = *pTarget++;
+    *pCoeffs++ = *pTarget++;
+
+    /* The current stage output is given as the input to the next stage */
+    pIn = pDst;
+
+    /*Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_biquad_coeffs_to_q31.c
+*
+* Description:	Conversion of floating-point biquad coefficients to Q31 with postShift selection.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadDesign
+ * @{
+ */
+
+/**
+ * @brief  Converts floating-point Biquad cascade coefficients to Q31 and selects the postShift.
+ * @param[in]  *pSrc points to the 5*numStages floating-point coefficients.
+ * @param[out] *pDst points to the 5*numStages Q31 coefficients.
+ * @param[in]  numStages number of 2nd order stages.
+ * @param[in]  minPostShift smallest postShift to select.
+ * @param[out] *pPostShift points to the selected postShift.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if a
+ * coefficient is not finite or needs a postShift above 15.
+ *
+ * \par
+ * The Q31 Biquad cascades shift the accumulator left by <code>postShift</code> bits, so
+ * the Q31 coefficients are the floating-point coefficients divided by <code>2^postShift</code>.
+ * The function selects the smallest <code>postShift</code>, not below <code>minPostShift</code>,
+ * for which every coefficient of the cascade fits in <code>[-1 +1)</code>, and rounds the
+ * scaled coefficients to nearest. The result is used with arm_biquad_cascade_df1_init_q31()
+ * or arm_biquad_cas_df1_32x64_init_q31().
+ *
+ * \par
+ * All coefficient sets exchanged through arm_biquad_cas_df1_32x64_ramp_q31() must share the
+ * postShift of the filter instance. When parameters are changed at run time, convert every
+ * set with a <code>minPostShift</code> that covers the whole parameter range; 2 is enough for
+ * the low pass, high pass, band pass and notch responses at any frequency and Q.
+ */
+
+arm_status arm_biquad_coeffs_to_q31(
+  const float32_t * pSrc,
+  q31_t * pDst,
+  uint32_t numStages,
+  uint8_t minPostShift,
+  uint8_t * pPostShift)
+{
+  float32_t maxAbs = 0.0f;                       /* largest coefficient magnitude */
+  float32_t in, scale;                           /* coefficient and scale factor */
+  q63_t out;                                     /* scaled and rounded coefficient */
+  uint32_t i, numCoeffs = 5u * numStages;        /* loop counter and number of coefficients */
+  uint32_t shift = minPostShift;                 /* selected postShift */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the conversion */
+
+  /* Largest coefficient magnitude.  The comparison fails for NaN */
+  for (i = 0u; i < numCoeffs; i++)
+  {
+    in = fabsf(pSrc[i]);
+
+    if(!(in <= 3.4e38f))
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else if(in > maxAbs)
+    {
+      maxAbs = in;
+    }
+  }
+
+  /* Smallest shift that brings every coefficient below 1.0 */
+  while((shift <= 15u) && (maxAbs >= (float32_t) (1u << shift)))
+  {
+    shift++;
+  }
+
+  if(shift > 15u)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    scale = 2147483648.0f / (float32_t) (1u << shift);
+
+    for (i = 0u; i < numCoeffs; i++)
+    {
+      /* Round to nearest and saturate the value that rounds up to +1.0 */
+      in = pSrc[i] * scale;
+      out = (q63_t) ((in > 0.0f) ? (in + 0.5f) : (in - 0.5f));
+      pDst[i] = clip_q63_to_q31(out);
+    }
+
+    *pPostShift = (uint8_t) shift;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of BiquadDesign group
+ */
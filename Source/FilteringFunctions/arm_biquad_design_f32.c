@@ -0,0 +1,204 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_biquad_design_f32.c
+*
+* Description:	Floating-point biquad coefficient design function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup BiquadDesign Biquad Coefficient Design
+ *
+ * Computes the coefficients of a second order section at run time from the
+ * Audio EQ Cookbook formulas by R. Bristow-Johnson, so that the corner frequency,
+ * quality factor or gain of a Biquad cascade can be changed without a host tool.
+ *
+ * \par
+ * The frequency <code>freq</code> is normalized to the sample rate, <code>f0 / fs</code>,
+ * and must lie in <code>(0, 0.5)</code>. With <code>w0 = 2 * pi * freq</code>,
+ * <code>alpha = sin(w0) / (2 * Q)</code> and <code>A = 10^(gainDB / 40)</code>,
+ * the supported responses are:
+ * - ARM_BIQUAD_LOWPASS and ARM_BIQUAD_HIGHPASS: second order low and high pass.
+ * - ARM_BIQUAD_BANDPASS: band pass with 0 dB gain at <code>f0</code>.
+ * - ARM_BIQUAD_NOTCH: band stop with a zero at <code>f0</code>.
+ * - ARM_BIQUAD_PEAKING: peaking equalizer with <code>gainDB</code> at <code>f0</code>.
+ * - ARM_BIQUAD_LOWSHELF and ARM_BIQUAD_HIGHSHELF: shelving equalizers with
+ *   <code>gainDB</code> below or above <code>f0</code>. <code>Q</code> sets the shelf slope,
+ *   and <code>Q = 1/sqrt(2)</code> gives the steepest slope without overshoot.
+ *
+ * \par
+ * <code>gainDB</code> is only used by the peaking and shelving responses.
+ * The trigonometric and exponential terms are computed with arm_vsin_cos_f32() and
+ * arm_vexp_f32() in single precision. The sine and cosine of <code>w0 / 2</code> are
+ * used to form <code>1 - cos(w0)</code> and <code>1 + cos(w0)</code> without cancellation,
+ * which keeps low corner frequencies accurate.
+ *
+ * \par
+ * The coefficients are written as <code>{b0, b1, b2, a1, a2}</code>, normalized by
+ * <code>a0</code> and with the feedback coefficients negated, in the form used by the
+ * Biquad cascade functions of this library. A cascade is designed by calling the
+ * function once per stage with <code>pCoeffs</code> advanced by 5.
+ * arm_biquad_coeffs_to_q31() converts the coefficients of a cascade to Q31 and
+ * selects its <code>postShift</code>.
+ *
+ * \par Changing coefficients at run time
+ * Replacing the coefficients of a running filter in one step causes audible clicks.
+ * arm_biquad_cascade_df2T_ramp_f32() and arm_biquad_cas_df1_32x64_ramp_q31() instead
+ * move the coefficients linearly to a new set over one block.
+ */
+
+/**
+ * @addtogroup BiquadDesign
+ * @{
+ */
+
+/**
+ * @brief  Designs the coefficients of one floating-point Biquad stage.
+ * @param[in]  type response of the stage.
+ * @param[in]  freq corner or centre frequency normalized to the sample rate, 0 < freq < 0.5.
+ * @param[in]  Q quality factor, greater than 0.
+ * @param[in]  gainDB gain in dB of the peaking and shelving responses.
+ * @param[out] *pCoeffs points to the 5 coefficients of the stage.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * the response is unknown, the frequency is out of range or Q is not positive.
+ */
+
+arm_status arm_biquad_design_f32(
+  arm_biquad_design_type type,
+  float32_t freq,
+  float32_t Q,
+  float32_t gainDB,
+  float32_t * pCoeffs)
+{
+  float32_t half;                                /* w0 / 2 */
+  float32_t sh, ch;                              /* sine and cosine of w0 / 2 */
+  float32_t sn, cs;                              /* sine and cosine of w0 */
+  float32_t alpha;                               /* bandwidth term */
+  float32_t expIn[2], expOut[2];                 /* arguments and results of the exponentials */
+  float32_t A, sqrtA;                            /* amplitude and its square root */
+  float32_t Ap1, Am1, sq;                        /* shelf terms */
+  float32_t b0, b1, b2, a0, a1, a2;              /* unnormalized coefficients */
+  float32_t invA0;                               /* reciprocal of a0 */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the design */
+
+  if(!(freq > 0.0f) || !(freq < 0.5f) || !(Q > 0.0f))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* sin and cos of w0 from the half angle, 1 - cos(w0) = 2 * sin(w0/2)^2 */
+    half = PI * freq;
+    arm_vsin_cos_f32(&half, &sh, &ch, 1u);
+
+    sn = 2.0f * sh * ch;
+    cs = (ch - sh) * (ch + sh);
+    alpha = sn / (2.0f * Q);
+
+    /* A = 10^(gainDB / 40) and sqrt(A) = 10^(gainDB / 80) */
+    expIn[0] = gainDB * 0.0575646273f;
+    expIn[1] = gainDB * 0.0287823137f;
+    arm_vexp_f32(expIn, expOut, 2u);
+    A = expOut[0];
+    sqrtA = expOut[1];
+
+    a0 = 1.0f + alpha;
+    a1 = -2.0f * cs;
+    a2 = 1.0f - alpha;
+
+    switch (type)
+    {
+    case ARM_BIQUAD_LOWPASS:
+      b1 = 2.0f * sh * sh;
+      b0 = 0.5f * b1;
+      b2 = b0;
+      break;
+
+    case ARM_BIQUAD_HIGHPASS:
+      b0 = ch * ch;
+      b1 = -2.0f * b0;
+      b2 = b0;
+      break;
+
+    case ARM_BIQUAD_BANDPASS:
+      b0 = alpha;
+      b1 = 0.0f;
+      b2 = -alpha;
+      break;
+
+    case ARM_BIQUAD_NOTCH:
+      b0 = 1.0f;
+      b1 = a1;
+      b2 = 1.0f;
+      break;
+
+    case ARM_BIQUAD_PEAKING:
+      b0 = 1.0f + (alpha * A);
+      b1 = a1;
+      b2 = 1.0f - (alpha * A);
+      a0 = 1.0f + (alpha / A);
+      a2 = 1.0f - (alpha / A);
+      break;
+
+    case ARM_BIQUAD_LOWSHELF:
+      Ap1 = A + 1.0f;
+      Am1 = A - 1.0f;
+      sq = 2.0f * sqrtA * alpha;
+      b0 = A * ((Ap1 - (Am1 * cs)) + sq);
+      b1 = 2.0f * A * (Am1 - (Ap1 * cs));
+      b2 = A * ((Ap1 - (Am1 * cs)) - sq);
+      a0 = (Ap1 + (Am1 * cs)) + sq;
+      a1 = -2.0f * (Am1 + (Ap1 * cs));
+      a2 = (Ap1 + (Am1 * cs)) - sq;
+      break;
+
+    case ARM_BIQUAD_HIGHSHELF:
+      Ap1 = A + 1.0f;
+      Am1 = A - 1.0f;
+      sq = 2.0f * sqrtA * alpha;
+      b0 = A * ((Ap1 + (Am1 * cs)) + sq);
+      b1 = -2.0f * A * (Am1 + (Ap1 * cs));
+      b2 = A * ((Ap1 + (Am1 * cs)) - sq);
+      a0 = (Ap1 - (Am1 * cs)) + sq;
+      a1 = 2.0f * (Am1 - (Ap1 * cs));
+      a2 = (Ap1 - (Am1 * cs)) - sq;
+      break;
+
+    default:
+      status = ARM_MATH_ARGUMENT_ERROR;
+      break;
+    }
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    /* Normalize by a0 and negate the feedback coefficients */
+    invA0 = 1.0f / a0;
+
+    pCoeffs[0] = b0 * invA0;
+    pCoeffs[1] = b1 * invA0;
+    pCoeffs[2] = b2 * invA0;
+    pCoeffs[3] = -a1 * invA0;
+    pCoeffs[4] = -a2 * invA0;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of BiquadDesign group
+ */
@@ -0,0 +1,262 @@
+/* ----------------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:		arm_conv2d_f32.c
+*
+* Description:	2-D convolution and correlation of floating-point images.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Conv2D 2-D Convolution and Correlation
+ *
+ * Convolves or correlates a <code>srcRows x srcCols</code> image with a
+ * <code>kerRows x kerCols</code> kernel. Both are stored in row order.
+ *
+ * \par Algorithm
+ * The 2-D convolution is defined as
+ * <pre>
+ *    y(m, n) = sum(i=0..kerRows-1) sum(j=0..kerCols-1) h(i, j) * x(m - i, n - j)
+ * </pre>
+ * and the output is the full result of size <code>(srcRows+kerRows-1) x (srcCols+kerCols-1)</code>,
+ * the 2-D equivalent of <code>arm_conv_f32()</code>.
+ * The 2-D correlation (template matching) is computed as the convolution with the kernel rotated by 180 degrees,
+ * so that the template is aligned with the image at output <code>(m, n) = (i0+kerRows-1, j0+kerCols-1)</code>
+ * when it matches the image at offset <code>(i0, j0)</code>.
+ *
+ * \par
+ * The initialization function selects one of three processing paths and records it in the
+ * <code>method</code> field of the instance:
+ * - <code>ARM_CONV2D_SEPARABLE</code>: the kernel is rank one, <code>h(i, j) = g(i) * f(j)</code>.
+ *   The rows of the image are first filtered with <code>f</code> and the columns of the intermediate
+ *   image are then filtered with <code>g</code>, i.e. <code>kerRows + kerCols</code> multiplies per pixel
+ *   instead of <code>kerRows * kerCols</code>. Separability is detected from the kernel values,
+ *   so Gaussian, box and Sobel style kernels take this path automatically.
+ * - <code>ARM_CONV2D_FFT</code>: the image is zero padded to the next supported 2-D FFT size,
+ *   transformed with <code>arm_cfft2d_f32()</code>, multiplied by the kernel spectrum computed at
+ *   initialization and transformed back. It is selected for large kernels when a kernel spectrum buffer is supplied.
+ * - <code>ARM_CONV2D_DIRECT</code>: the direct sum, used for small non separable kernels.
+ * \par
+ * The choice is made by comparing the multiply count of each path.
+ * All paths operate on whole image rows: each kernel tap is applied as a scaled row
+ * accumulation, so the inner loops stream through contiguous memory.
+ *
+ * \par Buffers
+ * The scratch buffer must hold <code>srcRows*(srcCols+kerCols-1)</code> values for the direct and separable paths,
+ * and <code>4*fftRows*fftCols</code> values when a kernel spectrum buffer is supplied, where <code>fftRows</code>
+ * and <code>fftCols</code> are the smallest of [16, 64, 256, 1024] not less than the output dimensions.
+ * The kernel spectrum buffer holds <code>2*fftRows*fftCols</code> values.
+ */
+
+/**
+ * @addtogroup Conv2D
+ * @{
+ */
+
+/*
+ * @brief  Scaled accumulation of a row: pDst[n] += coef * pSrc[n].
+ */
+
+static void arm_conv2d_accum_f32(
+  const float32_t * pSrc,
+  float32_t coef,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t in1, in2, in3, in4;                  /* temporary variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    in1 = pSrc[0] * coef;
+    in2 = pSrc[1] * coef;
+    in3 = pSrc[2] * coef;
+    in4 = pSrc[3] * coef;
+
+    pDst[0] += in1;
+    pDst[1] += in2;
+    pDst[2] += in3;
+    pDst[3] += in4;
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Process the remaining samples */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ += *pSrc++ * coef;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief Processing function for the floating-point 2-D convolution and correlation.
+ * @param[in]  *S    points to an instance of the floating-point 2-D convolution structure.
+ * @param[in]  *pSrc points to the input image of size <code>srcRows*srcCols</code>.
+ * @param[out] *pDst points to the output image of size <code>(srcRows+kerRows-1)*(srcCols+kerCols-1)</code>.
+ * @return none.
+ */
+
+void arm_conv2d_f32(
+  const arm_conv2d_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t *pKernel = S->pKernel;               /* kernel pointer */
+  float32_t *pScr = S->pScratch;                 /* scratch pointer */
+  float32_t *pIn;                                /* input row pointer */
+  float32_t *pOut;                               /* output row pointer */
+  float32_t *pTap;                               /* kernel factor pointer */
+  float32_t coef;                                /* kernel tap */
+  uint16_t srcRows = S->srcRows;                 /* image rows */
+  uint16_t srcCols = S->srcCols;                 /* image columns */
+  uint16_t kerRows = S->kerRows;                 /* kernel rows */
+  uint16_t kerCols = S->kerCols;                 /* kernel columns */
+  uint32_t outRows = (uint32_t) srcRows + kerRows - 1u;  /* output rows */
+  uint32_t outCols = (uint32_t) srcCols + kerCols - 1u;  /* output columns */
+  uint32_t fftRows, fftCols;                     /* 2-D FFT dimensions */
+  uint32_t r, c, i, j;                           /* loop counters */
+  int32_t tapInc;                                /* kernel tap increment, negative for correlation */
+
+  if(S->method == ARM_CONV2D_FFT)
+  {
+    fftRows = S->fwdFft.numRows;
+    fftCols = S->fwdFft.numCols;
+
+    /* Zero pad the image into the complex work buffer */
+    arm_fill_f32(0.0f, pScr, 2u * fftRows * fftCols);
+
+    pIn = pSrc;
+    for (r = 0u; r < srcRows; r++)
+    {
+      pOut = pScr + 2u * r * fftCols;
+
+      for (c = 0u; c < srcCols; c++)
+      {
+        pOut[2u * c] = *pIn++;
+      }
+    }
+
+    /* Y = IFFT2(FFT2(x) . H) */
+    arm_cfft2d_f32(&S->fwdFft, pScr);
+    arm_cmplx_mult_cmplx_f32(pScr, S->pKerFft, pScr, fftRows * fftCols);
+    arm_cfft2d_f32(&S->invFft, pScr);
+
+    /* Keep the real part of the linear convolution region */
+    pOut = pDst;
+    for (r = 0u; r < outRows; r++)
+    {
+      pIn = pScr + 2u * r * fftCols;
+
+      for (c = 0u; c < outCols; c++)
+      {
+        *pOut++ = pIn[2u * c];
+      }
+    }
+  }
+  else if(S->method == ARM_CONV2D_SEPARABLE)
+  {
+    /* Row pass: scratch(r, :) = x(r, :) * f, f being the pivot row of the kernel */
+    arm_fill_f32(0.0f, pScr, srcRows * outCols);
+
+    /* Correlation walks the kernel backwards */
+    pTap = pKernel + S->pivotRow * kerCols;
+    tapInc = 1;
+
+    if(S->corrFlag != 0u)
+    {
+      pTap += kerCols - 1u;
+      tapInc = -1;
+    }
+
+    for (r = 0u; r < srcRows; r++)
+    {
+      pIn = pSrc + r * srcCols;
+      pOut = pScr + r * outCols;
+
+      for (j = 0u; j < kerCols; j++)
+      {
+        arm_conv2d_accum_f32(pIn, pTap[(int32_t) j * tapInc], pOut + j, srcCols);
+      }
+    }
+
+    /* Column pass: y(r + i, :) += g(i) * scratch(r, :), g being the normalized pivot column */
+    arm_fill_f32(0.0f, pDst, outRows * outCols);
+
+    pTap = pKernel + S->pivotCol;
+    tapInc = (int32_t) kerCols;
+
+    if(S->corrFlag != 0u)
+    {
+      pTap += (kerRows - 1u) * kerCols;
+      tapInc = -tapInc;
+    }
+
+    for (r = 0u; r < srcRows; r++)
+    {
+      pIn = pScr + r * outCols;
+
+      for (i = 0u; i < kerRows; i++)
+      {
+        coef = pTap[(int32_t) i * tapInc] * S->invPivot;
+        arm_conv2d_accum_f32(pIn, coef, pDst + (r + i) * outCols, outCols);
+      }
+    }
+  }
+  else
+  {
+    /* Direct path: y(r + i, j : j + srcCols) += h(i, j) * x(r, :) */
+    arm_fill_f32(0.0f, pDst, outRows * outCols);
+
+    for (r = 0u; r < srcRows; r++)
+    {
+      pIn = pSrc + r * srcCols;
+
+      for (i = 0u; i < kerRows; i++)
+      {
+        pOut = pDst + (r + i) * outCols;
+
+        for (j = 0u; j < kerCols; j++)
+        {
+          if(S->corrFlag == 0u)
+          {
+            coef = pKernel[i * kerCols + j];
+          }
+          else
+          {
+            coef = pKernel[(kerRows - 1u - i) * kerCols + (kerCols - 1u - j)];
+          }
+
+          arm_conv2d_accum_f32(pIn, coef, pOut + j, srcCols);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @} end of Conv2D group
+ */
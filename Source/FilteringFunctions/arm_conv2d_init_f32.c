@@ -0,0 +1,209 @@
+/* ----------------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:		arm_conv2d_init_f32.c
+*
+* Description:	Floating-point 2-D convolution and correlation initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv2D
+ * @{
+ */
+
+/*
+ * @brief  log2 of a power of two.
+ */
+
+static uint32_t arm_conv2d_log2(
+  uint32_t len)
+{
+  uint32_t n = 0u;
+
+  while(len > 1u)
+  {
+    len >>= 1u;
+    n++;
+  }
+
+  return (n);
+}
+
+/**
+ * @brief  Initialization function for the floating-point 2-D convolution and correlation.
+ * @param[in,out] *S         points to an instance of the floating-point 2-D convolution structure.
+ * @param[in]     srcRows    number of rows of the input image.
+ * @param[in]     srcCols    number of columns of the input image.
+ * @param[in]     *pKernel   points to the kernel of size <code>kerRows*kerCols</code>.
+ * @param[in]     kerRows    number of rows of the kernel.
+ * @param[in]     kerCols    number of columns of the kernel.
+ * @param[in]     corrFlag   flag that selects convolution (corrFlag=0) or correlation (corrFlag=1).
+ * @param[in]     *pKerFft   points to the kernel spectrum buffer of size <code>2*fftRows*fftCols</code>, or NULL to disable the FFT path.
+ * @param[in]     *pScratch  points to the scratch buffer, refer to the group description for its size.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ * one of the dimensions is zero.
+ *
+ * \par
+ * The kernel buffer is referenced by the instance and must stay valid.
+ * When the FFT path is selected the kernel spectrum is computed here, using the scratch buffer.
+ */
+
+arm_status arm_conv2d_init_f32(
+  arm_conv2d_instance_f32 * S,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  float32_t * pKernel,
+  uint16_t kerRows,
+  uint16_t kerCols,
+  uint8_t corrFlag,
+  float32_t * pKerFft,
+  float32_t * pScratch)
+{
+  float32_t pivot, absVal, err;                  /* separability test */
+  float32_t costDirect, costSep, costFft;        /* estimated multiply counts of the paths */
+  uint32_t outRows, outCols;                     /* output dimensions */
+  uint32_t fftRows, fftCols;                     /* 2-D FFT dimensions */
+  uint32_t i, j;                                 /* loop counters */
+  uint16_t p = 0u, q = 0u;                       /* pivot position */
+  uint8_t separable;                             /* separability flag */
+
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  if((srcRows == 0u) || (srcCols == 0u) || (kerRows == 0u) || (kerCols == 0u))
+  {
+    /* Reporting argument error for empty images or kernels */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign the dimensions and buffers */
+    S->srcRows = srcRows;
+    S->srcCols = srcCols;
+    S->kerRows = kerRows;
+    S->kerCols = kerCols;
+    S->corrFlag = corrFlag;
+    S->pKernel = pKernel;
+    S->pKerFft = pKerFft;
+    S->pScratch = pScratch;
+
+    outRows = (uint32_t) srcRows + kerRows - 1u;
+    outCols = (uint32_t) srcCols + kerCols - 1u;
+
+    /* Find the largest kernel element, used as pivot of the rank one factorization */
+    pivot = 0.0f;
+
+    for (i = 0u; i < kerRows; i++)
+    {
+      for (j = 0u; j < kerCols; j++)
+      {
+        absVal = fabsf(pKernel[i * kerCols + j]);
+
+        if(absVal > pivot)
+        {
+          pivot = absVal;
+          p = (uint16_t) i;
+          q = (uint16_t) j;
+        }
+      }
+    }
+
+    /* h is rank one if h(i, j) * h(p, q) == h(i, q) * h(p, j) everywhere */
+    separable = (pivot > 0.0f) ? 1u : 0u;
+    pivot = pKernel[p * kerCols + q];
+
+    for (i = 0u; (i < kerRows) && (separable != 0u); i++)
+    {
+      for (j = 0u; j < kerCols; j++)
+      {
+        err = (pKernel[i * kerCols + j] * pivot) - (pKernel[i * kerCols + q] * pKernel[p * kerCols + j]);
+
+        if(fabsf(err) > (1.0e-6f * pivot * pivot))
+        {
+          separable = 0u;
+          break;
+        }
+      }
+    }
+
+    S->pivotRow = p;
+    S->pivotCol = q;
+    S->invPivot = (separable != 0u) ? (1.0f / pivot) : 0.0f;
+
+    /* Multiply counts of the direct paths */
+    costDirect = (float32_t) srcRows * srcCols * kerRows * kerCols;
+    costSep = ((float32_t) srcRows * srcCols * kerCols) + ((float32_t) srcRows * outCols * kerRows);
+
+    if((separable != 0u) && (costSep < costDirect))
+    {
+      S->method = (uint8_t) ARM_CONV2D_SEPARABLE;
+      costDirect = costSep;
+    }
+    else
+    {
+      S->method = (uint8_t) ARM_CONV2D_DIRECT;
+    }
+
+    /* FFT path: two 2-D transforms, the spectrum product and the padding passes */
+    fftRows = arm_conv2d_get_fft_len(outRows);
+    fftCols = arm_conv2d_get_fft_len(outCols);
+
+    if((pKerFft != NULL) && (fftRows != 0u) && (fftCols != 0u))
+    {
+      costFft = (float32_t) fftRows * fftCols *
+        ((4.25f * (float32_t) arm_conv2d_log2(fftRows * fftCols)) + 12.0f);
+
+      if(costFft < costDirect)
+      {
+        S->method = (uint8_t) ARM_CONV2D_FFT;
+
+        /* The transpose buffer follows the complex work buffer in the scratch area */
+        arm_cfft2d_init_f32(&S->fwdFft, (uint16_t) fftRows, (uint16_t) fftCols, 0u,
+                            pScratch + 2u * fftRows * fftCols);
+        arm_cfft2d_init_f32(&S->invFft, (uint16_t) fftRows, (uint16_t) fftCols, 1u,
+                            pScratch + 2u * fftRows * fftCols);
+
+        /* Zero pad the kernel, rotated by 180 degrees for correlation */
+        arm_fill_f32(0.0f, pKerFft, 2u * fftRows * fftCols);
+
+        for (i = 0u; i < kerRows; i++)
+        {
+          for (j = 0u; j < kerCols; j++)
+          {
+            if(corrFlag == 0u)
+            {
+              pKerFft[2u * (i * fftCols + j)] = pKernel[i * kerCols + j];
+            }
+            else
+            {
+              pKerFft[2u * (i * fftCols + j)] =
+                pKernel[(kerRows - 1u - i) * kerCols + (kerCols - 1u - j)];
+            }
+          }
+        }
+
+        /* Kernel spectrum */
+        arm_cfft2d_f32(&S->fwdFft, pKerFft);
+      }
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Conv2D group
+ */
@@ -0,0 +1,53 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_kalman_get_cov_f32.c
+*
+* Description:	Reads the covariance of the floating-point Kalman filter.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Reads the covariance of the floating-point Kalman filter.
+ * @param[in]  *S points to an instance of the floating-point Kalman filter structure.
+ * @param[out] *pDst points to the n x n output covariance.
+ * @return none.
+ *
+ * For <code>ARM_KALMAN_UD</code> the covariance is rebuilt from its U-D factors,
+ * otherwise it is copied.
+ */
+
+void arm_kalman_get_cov_f32(
+  const arm_kalman_instance_f32 * S,
+  float32_t * pDst)
+{
+  if(S->method == (uint8_t) ARM_KALMAN_UD)
+  {
+    arm_kalman_ud_rebuild_f32(S->pCov, pDst, S->numStates);
+  }
+  else
+  {
+    arm_copy_f32(S->pCov, pDst, (uint32_t) S->numStates * S->numStates);
+  }
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_kalman_init_f32.c
+*
+* Description:	Floating-point Kalman filter initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Kalman Kalman Filter
+ *
+ * Linear and extended Kalman filter built on the matrix functions.
+ * The filter estimates the state <code>x</code> of <code>n</code> values and its covariance
+ * <code>P</code> from <code>m</code> measurements per step:
+ * <pre>
+ *    time update:         x = F * x                      P = F * P * F' + Q
+ *    measurement update:  K = P * H' * inv(H * P * H' + R)
+ *                         x = x + K * (z - H * x)        P = (I - K * H) * P
+ * </pre>
+ * All matrices are stored in row order as plain arrays referenced by the instance structure.
+ * F, Q, H and R may be rewritten by the application between calls, e.g. with the Jacobians of an
+ * extended Kalman filter. For an extended filter the propagated state <code>f(x)</code> and the
+ * predicted measurements <code>h(x)</code> are passed to the time and measurement updates
+ * instead of being computed from F and H.
+ *
+ * \par Measurement update methods
+ * - <code>ARM_KALMAN_JOSEPH</code>: all measurements are processed as one block with a full R.
+ * The gain needs the inverse of the m x m innovation covariance (<code>arm_mat_inverse_f32()</code>), and the
+ * covariance is updated in the Joseph form <code>P = (I-K*H)*P*(I-K*H)' + K*R*K'</code>, which stays
+ * symmetric and positive definite in the presence of rounding errors.
+ * - <code>ARM_KALMAN_SEQUENTIAL</code>: R is diagonal and each measurement is processed as a scalar update.
+ * The innovation covariance is a scalar, so no matrix is inverted, and every update costs
+ * about <code>1.5*n*n</code> multiply-accumulates. The covariance update is applied symmetrically.
+ * - <code>ARM_KALMAN_UD</code>: the covariance is kept as <code>P = U*D*U'</code> (U unit upper triangular,
+ * D diagonal) and the scalar updates use Bierman's algorithm, a square-root form that keeps P
+ * positive definite with single-precision arithmetic. The time update rebuilds P, propagates it and
+ * factorizes the result again.
+ *
+ * \par
+ * For <code>ARM_KALMAN_SEQUENTIAL</code> and <code>ARM_KALMAN_UD</code>, <code>pR</code> points to the
+ * m measurement variances. Correlated measurement noise must be decorrelated first or processed with
+ * <code>ARM_KALMAN_JOSEPH</code>.
+ *
+ * \par Workspace
+ * The application provides the workspace <code>pWork</code>; no memory is allocated and no temporary
+ * matrix is transposed. Its size in floating-point values is:
+ * - <code>ARM_KALMAN_JOSEPH</code>: <code>2*n*n + 2*n*m + 2*m*m + m</code>
+ * - <code>ARM_KALMAN_SEQUENTIAL</code>: <code>n*n + 2*n</code>
+ * - <code>ARM_KALMAN_UD</code>: <code>2*n*n + 3*n</code>
+ *
+ * \par Real-time use
+ * <code>arm_kalman_step_f32()</code> runs the time update followed by at most <code>maxUpdates</code> scalar
+ * measurement updates, taken in turn from the measurement vector across successive calls.
+ * The loop trip counts depend only on n, m and <code>maxUpdates</code>, never on the data, so the
+ * worst-case execution time of a step is fixed once these are chosen.
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Kalman filter.
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in] numStates number of states n.
+ * @param[in] numMeas number of measurements m.
+ * @param[in] method measurement update method, one of arm_kalman_method.
+ * @param[in] *pState points to the initial state estimate of n values.
+ * @param[in,out] *pCov points to the n x n initial covariance. For <code>ARM_KALMAN_UD</code> it is
+ * converted in place to its U-D factors: D on the diagonal, U above it and zeros below it.
+ * @param[in] *pF points to the n x n state transition matrix.
+ * @param[in] *pQ points to the n x n process noise covariance.
+ * @param[in] *pH points to the m x n measurement matrix.
+ * @param[in] *pR points to the m x m measurement noise covariance for <code>ARM_KALMAN_JOSEPH</code>,
+ * or to the m measurement variances otherwise.
+ * @param[in] *pWork points to the workspace.
+ * @return The function returns ARM_MATH_ARGUMENT_ERROR for an unknown method,
+ * ARM_MATH_SINGULAR if the covariance is not positive definite for <code>ARM_KALMAN_UD</code>,
+ * otherwise ARM_MATH_SUCCESS.
+ */
+
+arm_status arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  uint16_t numMeas,
+  uint8_t method,
+  float32_t * pState,
+  float32_t * pCov,
+  float32_t * pF,
+  float32_t * pQ,
+  float32_t * pH,
+  float32_t * pR,
+  float32_t * pWork)
+{
+  arm_status status;                             /* status of the initialization */
+
+  /* Assign the dimensions and the update method */
+  S->numStates = numStates;
+  S->numMeas = numMeas;
+  S->method = method;
+  S->measIdx = 0u;
+
+  /* Assign the state, model and workspace pointers */
+  S->pState = pState;
+  S->pCov = pCov;
+  S->pF = pF;
+  S->pQ = pQ;
+  S->pH = pH;
+  S->pR = pR;
+  S->pWork = pWork;
+
+  if(method > (uint8_t) ARM_KALMAN_UD)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else if(method == (uint8_t) ARM_KALMAN_UD)
+  {
+    /* The UD filter keeps the factors of P instead of P */
+    status = arm_kalman_ud_factor_f32(pCov, pCov, numStates);
+  }
+  else
+  {
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Kalman group
+ */
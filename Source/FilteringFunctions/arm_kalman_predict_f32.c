@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_kalman_predict_f32.c
+*
+* Description:	Floating-point Kalman filter time update.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Floating-point Kalman filter time update.
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in] *pStatePred points to the propagated state <code>f(x)</code> of an extended filter,
+ * or NULL to compute <code>F * x</code>.
+ * @return The function returns ARM_MATH_SINGULAR if the propagated covariance cannot be
+ * factorized for <code>ARM_KALMAN_UD</code>, otherwise ARM_MATH_SUCCESS.
+ *
+ * \par
+ * The covariance is propagated as <code>T = F * P</code> followed by <code>P = T * F' + Q</code>.
+ * The second product reads F by rows instead of transposing it, and only its lower triangle is
+ * computed and mirrored, which keeps P exactly symmetric and costs <code>n*n*(n+1)/2</code>
+ * multiply-accumulates instead of <code>n^3</code>.
+ */
+
+arm_status arm_kalman_predict_f32(
+  arm_kalman_instance_f32 * S,
+  const float32_t * pStatePred)
+{
+  uint16_t n = S->numStates;                     /* number of states */
+  float32_t *pX = S->pState;                     /* state estimate */
+  float32_t *pF = S->pF;                         /* state transition matrix */
+  float32_t *pQ = S->pQ;                         /* process noise covariance */
+  float32_t *pP;                                 /* full covariance */
+  float32_t *pT;                                 /* F * P */
+  float32_t *pTi, *pFj;                          /* rows of T and F */
+  arm_matrix_instance_f32 F, P, T;               /* matrix structures for the library calls */
+  float32_t sum;                                 /* accumulator */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the time update */
+
+  /* State: x = f(x) for an extended filter, x = F * x otherwise */
+  if(pStatePred != NULL)
+  {
+    if(pStatePred != pX)
+    {
+      arm_copy_f32((float32_t *) pStatePred, pX, n);
+    }
+  }
+  else
+  {
+    for (i = 0u; i < n; i++)
+    {
+      sum = 0.0f;
+
+      for (k = 0u; k < n; k++)
+      {
+        sum += pF[(i * n) + k] * pX[k];
+      }
+
+      S->pWork[i] = sum;
+    }
+
+    arm_copy_f32(S->pWork, pX, n);
+  }
+
+  /* The UD filter works on P rebuilt from its factors */
+  if(S->method == (uint8_t) ARM_KALMAN_UD)
+  {
+    pP = S->pWork;
+    pT = S->pWork + (n * n);
+    arm_kalman_ud_rebuild_f32(S->pCov, pP, n);
+  }
+  else
+  {
+    pP = S->pCov;
+    pT = S->pWork;
+  }
+
+  /* T = F * P */
+  arm_mat_init_f32(&F, n, n, pF);
+  arm_mat_init_f32(&P, n, n, pP);
+  arm_mat_init_f32(&T, n, n, pT);
+  arm_mat_mult_f32(&F, &P, &T);
+
+  /* P = T * F' + Q, lower triangle computed and mirrored */
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j <= i; j++)
+    {
+      pTi = pT + (i * n);
+      pFj = pF + (j * n);
+      sum = pQ[(i * n) + j];
+
+      for (k = 0u; k < n; k++)
+      {
+        sum += *pTi++ * *pFj++;
+      }
+
+      pP[(i * n) + j] = sum;
+      pP[(j * n) + i] = sum;
+    }
+  }
+
+  if(S->method == (uint8_t) ARM_KALMAN_UD)
+  {
+    status = arm_kalman_ud_factor_f32(pP, S->pCov, n);
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_kalman_step_f32.c
+*
+* Description:	Floating-point Kalman filter step with bounded measurement work.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Floating-point Kalman filter step with a bounded number of measurement updates.
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in] *pStatePred points to the propagated state <code>f(x)</code> of an extended filter,
+ * or NULL to compute <code>F * x</code>.
+ * @param[in] *pMeas points to the m measurements, or NULL when no measurement is available.
+ * @param[in] *pMeasPred points to the predicted measurements <code>h(x)</code> of an extended filter,
+ * or NULL to compute <code>H * x</code>.
+ * @param[in] maxUpdates maximum number of scalar measurement updates in this step.
+ * @return The function returns ARM_MATH_ARGUMENT_ERROR if <code>maxUpdates</code> is smaller than
+ * the number of measurements with <code>ARM_KALMAN_JOSEPH</code>, ARM_MATH_SINGULAR if the time
+ * or measurement update fails, otherwise ARM_MATH_SUCCESS.
+ *
+ * \par
+ * Runs <code>arm_kalman_predict_f32()</code> and then updates the estimate with the measurements.
+ * When <code>maxUpdates</code> covers all m measurements, the configured update method is used.
+ * Otherwise <code>maxUpdates</code> scalar updates are applied, starting where the previous step
+ * stopped (<code>measIdx</code>), so that every measurement is used in turn across successive steps.
+ * The measurements skipped in a step are not kept.
+ *
+ * \par
+ * The cost of a step is bounded by the time update plus <code>maxUpdates</code> scalar updates of
+ * about <code>1.5*n*n</code> multiply-accumulates each, independently of the data. This allows a
+ * fixed cycle budget to be met in hard real-time loops while processing large measurement vectors.
+ * Budgeted steps require <code>ARM_KALMAN_SEQUENTIAL</code> or <code>ARM_KALMAN_UD</code>.
+ */
+
+arm_status arm_kalman_step_f32(
+  arm_kalman_instance_f32 * S,
+  const float32_t * pStatePred,
+  const float32_t * pMeas,
+  const float32_t * pMeasPred,
+  uint16_t maxUpdates)
+{
+  uint32_t nextIdx;                              /* first measurement of the next step */
+  arm_status status;                             /* status of the filter step */
+
+  if((maxUpdates < S->numMeas) && (S->method == (uint8_t) ARM_KALMAN_JOSEPH))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    status = arm_kalman_predict_f32(S, pStatePred);
+
+    if((status == ARM_MATH_SUCCESS) && (pMeas != NULL) && (S->numMeas > 0u))
+    {
+      if(maxUpdates >= S->numMeas)
+      {
+        status = arm_kalman_update_f32(S, pMeas, pMeasPred);
+      }
+      else
+      {
+        status = arm_kalman_update_scalar_f32(S, pMeas, pMeasPred, S->measIdx,
+                                              maxUpdates);
+
+        /* Continue with the following measurements in the next step */
+        nextIdx = (uint32_t) S->measIdx + maxUpdates;
+
+        if(nextIdx >= S->numMeas)
+        {
+          nextIdx -= S->numMeas;
+        }
+
+        S->measIdx = (uint16_t) nextIdx;
+      }
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_kalman_ud_f32.c
+*
+* Description:	U-D factorization helpers of the Kalman filter.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  U-D factorization P = U * D * U' used by the Kalman filter.
+ * @param[in]  *pSrc points to the n x n symmetric matrix; only the upper triangle is read.
+ * @param[out] *pDst points to the n x n factors: D on the diagonal, U above it and zeros below it.
+ * @param[in]  n order of the matrix.
+ * @return ARM_MATH_SINGULAR if the matrix is not positive definite, otherwise ARM_MATH_SUCCESS.
+ *
+ * \par
+ * The columns are factorized from the last to the first. Column j only reads the source
+ * on and above the diagonal of column j and the factors of the later columns, so the
+ * destination may be the same array as the source.
+ */
+
+arm_status arm_kalman_ud_factor_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint16_t n)
+{
+  float32_t d;                                   /* diagonal factor of column j */
+  float32_t invD;                                /* reciprocal of d */
+  float32_t sum;                                 /* accumulator */
+  float32_t ujk;                                 /* U(j,k) */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the factorization */
+
+  for (j = n; (j > 0u) && (status == ARM_MATH_SUCCESS); j--)
+  {
+    /* d(j) = P(j,j) - sum over k > j of D(k) * U(j,k)^2 */
+    sum = pSrc[((j - 1u) * n) + (j - 1u)];
+
+    for (k = j; k < n; k++)
+    {
+      ujk = pDst[((j - 1u) * n) + k];
+      sum -= pDst[(k * n) + k] * ujk * ujk;
+    }
+
+    if(sum <= 0.0f)
+    {
+      status = ARM_MATH_SINGULAR;
+    }
+    else
+    {
+      d = sum;
+      invD = 1.0f / d;
+
+      /* U(i,j) = (P(i,j) - sum over k > j of D(k) * U(i,k) * U(j,k)) / d(j) */
+      for (i = 0u; i < (j - 1u); i++)
+      {
+        sum = pSrc[(i * n) + (j - 1u)];
+
+        for (k = j; k < n; k++)
+        {
+          sum -= pDst[(k * n) + k] * pDst[(i * n) + k] * pDst[((j - 1u) * n) + k];
+        }
+
+        pDst[(i * n) + (j - 1u)] = sum * invD;
+        pDst[((j - 1u) * n) + i] = 0.0f;
+      }
+
+      pDst[((j - 1u) * n) + (j - 1u)] = d;
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @brief  Rebuilds P = U * D * U' from its U-D factors.
+ * @param[in]  *pSrc points to the n x n factors: D on the diagonal and U above it.
+ * @param[out] *pDst points to the n x n output matrix; must not overlap the source.
+ * @param[in]  n order of the matrix.
+ * @return none.
+ */
+
+void arm_kalman_ud_rebuild_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint16_t n)
+{
+  float32_t sum;                                 /* accumulator */
+  uint32_t i, j, k;                              /* loop counters */
+
+  for (j = 0u; j < n; j++)
+  {
+    for (i = 0u; i <= j; i++)
+    {
+      /* P(i,j) = sum over k >= j of U(i,k) * D(k) * U(j,k), with a unit diagonal in U */
+      if(i == j)
+      {
+        sum = pSrc[(j * n) + j];
+      }
+      else
+      {
+        sum = pSrc[(i * n) + j] * pSrc[(j * n) + j];
+      }
+
+      for (k = j + 1u; k < n; k++)
+      {
+        sum += pSrc[(i * n) + k] * pSrc[(k * n) + k] * pSrc[(j * n) + k];
+      }
+
+      pDst[(i * n) + j] = sum;
+      pDst[(j * n) + i] = sum;
+    }
+  }
+}
+
+/**
+ * @} end of Kalman group
+ */
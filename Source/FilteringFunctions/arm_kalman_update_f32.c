@@ -0,0 +1,197 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_kalman_update_f32.c
+*
+* Description:	Floating-point Kalman filter measurement update.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Floating-point Kalman filter measurement update.
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in] *pMeas points to the m measurements.
+ * @param[in] *pMeasPred points to the predicted measurements <code>h(x)</code> of an extended filter,
+ * or NULL to compute <code>H * x</code>.
+ * @return The function returns ARM_MATH_SINGULAR if the innovation covariance is not invertible,
+ * otherwise ARM_MATH_SUCCESS.
+ *
+ * \par
+ * For <code>ARM_KALMAN_SEQUENTIAL</code> and <code>ARM_KALMAN_UD</code> all measurements are
+ * processed with <code>arm_kalman_update_scalar_f32()</code>.
+ *
+ * \par
+ * For <code>ARM_KALMAN_JOSEPH</code> the block update is computed as
+ * <pre>
+ *    PHt = P * H'                 Si = inv(H * PHt + R)         K = PHt * Si
+ *    x = x + K * (z - H * x)      A = I - K * H                 P = A * P * A' + K * R * K'
+ * </pre>
+ * The products with H' and A' read H and A by rows instead of transposing them, and only the
+ * lower triangle of the new covariance is computed and mirrored.
+ */
+
+arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  const float32_t * pMeas,
+  const float32_t * pMeasPred)
+{
+  uint16_t n = S->numStates;                     /* number of states */
+  uint16_t m = S->numMeas;                       /* number of measurements */
+  float32_t *pX = S->pState;                     /* state estimate */
+  float32_t *pP = S->pCov;                       /* covariance */
+  float32_t *pH = S->pH;                         /* measurement matrix */
+  float32_t *pPHt = S->pWork;                    /* P * H', later K * R */
+  float32_t *pS = pPHt + (n * m);                /* innovation covariance */
+  float32_t *pSi = pS + (m * m);                 /* inverse of the innovation covariance */
+  float32_t *pK = pSi + (m * m);                 /* gain */
+  float32_t *pY = pK + (n * m);                  /* innovation */
+  float32_t *pA = pY + m;                        /* I - K * H */
+  float32_t *pT = pA + (n * n);                  /* A * P */
+  float32_t *pRow1, *pRow2;                      /* row pointers */
+  arm_matrix_instance_f32 H, P, R, PHt, Sm, Si, K, A, T;        /* matrix structures */
+  float32_t sum;                                 /* accumulator */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the measurement update */
+
+  if(S->method != (uint8_t) ARM_KALMAN_JOSEPH)
+  {
+    status = arm_kalman_update_scalar_f32(S, pMeas, pMeasPred, 0u, m);
+  }
+  else
+  {
+    arm_mat_init_f32(&H, m, n, pH);
+    arm_mat_init_f32(&P, n, n, pP);
+    arm_mat_init_f32(&R, m, m, S->pR);
+    arm_mat_init_f32(&PHt, n, m, pPHt);
+    arm_mat_init_f32(&Sm, m, m, pS);
+    arm_mat_init_f32(&Si, m, m, pSi);
+    arm_mat_init_f32(&K, n, m, pK);
+    arm_mat_init_f32(&A, n, n, pA);
+    arm_mat_init_f32(&T, n, n, pT);
+
+    /* Innovation y = z - h(x) or z - H * x */
+    for (i = 0u; i < m; i++)
+    {
+      if(pMeasPred != NULL)
+      {
+        sum = pMeasPred[i];
+      }
+      else
+      {
+        sum = 0.0f;
+
+        for (k = 0u; k < n; k++)
+        {
+          sum += pH[(i * n) + k] * pX[k];
+        }
+      }
+
+      pY[i] = pMeas[i] - sum;
+    }
+
+    /* PHt = P * H', rows of P against rows of H */
+    for (i = 0u; i < n; i++)
+    {
+      for (j = 0u; j < m; j++)
+      {
+        pRow1 = pP + (i * n);
+        pRow2 = pH + (j * n);
+        sum = 0.0f;
+
+        for (k = 0u; k < n; k++)
+        {
+          sum += *pRow1++ * *pRow2++;
+        }
+
+        pPHt[(i * m) + j] = sum;
+      }
+    }
+
+    /* S = H * PHt + R, inverted into Si. The inversion overwrites S. */
+    arm_mat_mult_f32(&H, &PHt, &Sm);
+    arm_mat_add_f32(&Sm, &R, &Sm);
+    status = arm_mat_inverse_f32(&Sm, &Si);
+
+    if(status == ARM_MATH_SUCCESS)
+    {
+      /* K = PHt * Si */
+      arm_mat_mult_f32(&PHt, &Si, &K);
+
+      /* x = x + K * y */
+      for (i = 0u; i < n; i++)
+      {
+        sum = 0.0f;
+
+        for (j = 0u; j < m; j++)
+        {
+          sum += pK[(i * m) + j] * pY[j];
+        }
+
+        pX[i] += sum;
+      }
+
+      /* A = I - K * H */
+      arm_mat_mult_f32(&K, &H, &A);
+      arm_negate_f32(pA, pA, (uint32_t) n * n);
+
+      for (i = 0u; i < n; i++)
+      {
+        pA[(i * n) + i] += 1.0f;
+      }
+
+      /* T = A * P and K * R, which reuses the PHt buffer */
+      arm_mat_mult_f32(&A, &P, &T);
+      arm_mat_mult_f32(&K, &R, &PHt);
+
+      /* P = T * A' + (K * R) * K', lower triangle computed and mirrored */
+      for (i = 0u; i < n; i++)
+      {
+        for (j = 0u; j <= i; j++)
+        {
+          pRow1 = pT + (i * n);
+          pRow2 = pA + (j * n);
+          sum = 0.0f;
+
+          for (k = 0u; k < n; k++)
+          {
+            sum += *pRow1++ * *pRow2++;
+          }
+
+          pRow1 = pPHt + (i * m);
+          pRow2 = pK + (j * m);
+
+          for (k = 0u; k < m; k++)
+          {
+            sum += *pRow1++ * *pRow2++;
+          }
+
+          pP[(i * n) + j] = sum;
+          pP[(j * n) + i] = sum;
+        }
+      }
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Kalman group
+ */
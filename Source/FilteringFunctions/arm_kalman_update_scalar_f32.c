@@ -0,0 +1,225 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_kalman_update_scalar_f32.c
+*
+* Description:	Floating-point Kalman filter sequential scalar measurement updates.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Floating-point Kalman filter sequential scalar measurement updates.
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in] *pMeas points to the m measurements.
+ * @param[in] *pMeasPred points to the predicted measurements <code>h(x)</code> of an extended filter,
+ * or NULL to compute <code>H * x</code>.
+ * @param[in] firstMeas index of the first measurement to process.
+ * @param[in] numUpdates number of measurements to process. The index wraps around after the last
+ * measurement.
+ * @return The function returns ARM_MATH_SINGULAR if an innovation variance is not positive,
+ * otherwise ARM_MATH_SUCCESS.
+ *
+ * \par
+ * Requires <code>ARM_KALMAN_SEQUENTIAL</code> or <code>ARM_KALMAN_UD</code>, where <code>pR</code>
+ * holds the m measurement variances. Each measurement i, with row <code>h</code> of H and variance
+ * <code>r</code>, is processed as a scalar update:
+ * <pre>
+ *    a = P * h'        s = h * a + r        k = a / s
+ *    x = x + k * (z(i) - h * x)             P = P - a * a' / s
+ * </pre>
+ * The covariance update is computed once per element pair and written to both triangles, so P
+ * stays symmetric. With <code>ARM_KALMAN_UD</code> the same update is carried out on the U-D
+ * factors with Bierman's algorithm.
+ *
+ * \par
+ * When the predicted measurements of an extended filter are given, they refer to the state
+ * before this call; the correction applied by the earlier scalar updates is added to them
+ * through H.
+ */
+
+arm_status arm_kalman_update_scalar_f32(
+  arm_kalman_instance_f32 * S,
+  const float32_t * pMeas,
+  const float32_t * pMeasPred,
+  uint16_t firstMeas,
+  uint16_t numUpdates)
+{
+  uint16_t n = S->numStates;                     /* number of states */
+  float32_t *pX = S->pState;                     /* state estimate */
+  float32_t *pP = S->pCov;                       /* covariance or its U-D factors */
+  float32_t *pDx = S->pWork;                     /* correction applied by this call */
+  float32_t *pA = S->pWork + n;                  /* P * h', or U' * h for the UD filter */
+  float32_t *pV = S->pWork + (2u * n);           /* D * U' * h for the UD filter */
+  float32_t *pB = S->pWork + (3u * n);           /* unnormalized gain for the UD filter */
+  float32_t *pH;                                 /* row of the measurement matrix */
+  float32_t innov;                               /* innovation */
+  float32_t s, invS;                             /* innovation variance and its reciprocal */
+  float32_t alpha, beta, lambda;                 /* Bierman recursion variables */
+  float32_t uij;                                 /* U(i,j) */
+  float32_t sum;                                 /* accumulator */
+  uint32_t i, j, u;                              /* loop counters */
+  uint32_t idx = firstMeas;                      /* index of the current measurement */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the measurement update */
+
+  arm_fill_f32(0.0f, pDx, n);
+
+  for (u = 0u; (u < numUpdates) && (status == ARM_MATH_SUCCESS); u++)
+  {
+    if(idx >= S->numMeas)
+    {
+      idx = 0u;
+    }
+
+    pH = S->pH + (idx * n);
+
+    /* Innovation of measurement idx */
+    sum = 0.0f;
+
+    if(pMeasPred != NULL)
+    {
+      for (i = 0u; i < n; i++)
+      {
+        sum += pH[i] * pDx[i];
+      }
+
+      sum += pMeasPred[idx];
+    }
+    else
+    {
+      for (i = 0u; i < n; i++)
+      {
+        sum += pH[i] * pX[i];
+      }
+    }
+
+    innov = pMeas[idx] - sum;
+
+    if(S->method == (uint8_t) ARM_KALMAN_UD)
+    {
+      /* f = U' * h and v = D * f */
+      for (j = 0u; j < n; j++)
+      {
+        sum = pH[j];
+
+        for (i = 0u; i < j; i++)
+        {
+          sum += pP[(i * n) + j] * pH[i];
+        }
+
+        pA[j] = sum;
+        pV[j] = pP[(j * n) + j] * sum;
+      }
+
+      /* Bierman's update of D and U, accumulating the unnormalized gain b */
+      alpha = S->pR[idx];
+
+      for (j = 0u; (j < n) && (status == ARM_MATH_SUCCESS); j++)
+      {
+        beta = alpha;
+        alpha += pA[j] * pV[j];
+
+        if(alpha <= 0.0f)
+        {
+          status = ARM_MATH_SINGULAR;
+        }
+        else
+        {
+          lambda = -pA[j] / beta;
+          pP[(j * n) + j] *= beta / alpha;
+
+          for (i = 0u; i < j; i++)
+          {
+            uij = pP[(i * n) + j];
+            pP[(i * n) + j] = uij + (lambda * pB[i]);
+            pB[i] += pV[j] * uij;
+          }
+
+          pB[j] = pV[j];
+        }
+      }
+
+      /* x = x + b * innov / alpha */
+      if(status == ARM_MATH_SUCCESS)
+      {
+        s = innov / alpha;
+
+        for (i = 0u; i < n; i++)
+        {
+          pX[i] += pB[i] * s;
+          pDx[i] += pB[i] * s;
+        }
+      }
+    }
+    else
+    {
+      /* a = P * h' and s = h * a + r */
+      s = S->pR[idx];
+
+      for (i = 0u; i < n; i++)
+      {
+        sum = 0.0f;
+
+        for (j = 0u; j < n; j++)
+        {
+          sum += pP[(i * n) + j] * pH[j];
+        }
+
+        pA[i] = sum;
+        s += pH[i] * sum;
+      }
+
+      if(s <= 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+      else
+      {
+        invS = 1.0f / s;
+
+        /* x = x + a * innov / s */
+        for (i = 0u; i < n; i++)
+        {
+          pX[i] += pA[i] * (innov * invS);
+          pDx[i] += pA[i] * (innov * invS);
+        }
+
+        /* P = P - a * a' / s, applied to both triangles */
+        for (i = 0u; i < n; i++)
+        {
+          sum = pA[i] * invS;
+
+          for (j = 0u; j <= i; j++)
+          {
+            pP[(i * n) + j] -= sum * pA[j];
+            pP[(j * n) + i] = pP[(i * n) + j];
+          }
+        }
+      }
+    }
+
+    idx++;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_median_filter_init_f32.c
+*
+* Description:	Floating-point running median filter initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup MedianFilter Running Median Filter
+ *
+ * Replaces each sample by the median of the last <code>windowLen</code> input samples.
+ * The median filter removes isolated spikes while keeping steps in the signal, which
+ * makes it suitable for despiking sensor data.
+ *
+ * \par Algorithm
+ * The window samples are kept in a ring buffer, and their positions are ordered by
+ * two heaps that meet at the median: a max-heap of the samples below the median and a
+ * min-heap of the samples above it. Both heaps are stored in one index array centred on
+ * the median entry, with the max-heap at negative positions and the min-heap at positive
+ * positions. Each ring buffer slot records its heap position, so the sample leaving the
+ * window is replaced in place by the new sample, which is then moved up or down its heap
+ * and, if needed, across the median. An update costs <code>O(log(windowLen))</code>
+ * comparisons instead of the <code>O(windowLen)</code> of an insertion sort.
+ *
+ * \par
+ * Until <code>windowLen</code> samples have been received, the output is the median of the
+ * samples received so far. For an even number of samples, which only happens during this
+ * start up phase or with an even <code>windowLen</code>, the output is the mean of the two
+ * middle samples, rounded down for the Q31 and Q15 filters.
+ *
+ * \par Instance Structure
+ * The instance holds the window length, the ring buffer of samples and the heap index
+ * buffers. The index buffer of <code>2*windowLen</code> entries is split into the heap
+ * position of each ring buffer slot and the heap itself.
+ */
+
+/**
+ * @addtogroup MedianFilter
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point running median filter.
+ * @param[out] *S points to an instance of the floating-point running median filter structure.
+ * @param[in]  windowLen number of samples in the window, 1 to 32767.
+ * @param[in]  *pData points to the ring buffer of windowLen samples.
+ * @param[in]  *pIndex points to the index buffer of 2*windowLen entries.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowLen</code> is out of range.
+ *
+ * \par
+ * The function also empties the window, and may be called again to restart the filter.
+ */
+
+arm_status arm_median_filter_init_f32(
+  arm_median_filter_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t * pData,
+  int16_t * pIndex)
+{
+  int32_t i, p;                                  /* loop counter and heap position */
+  arm_status status;                             /* status of initialization */
+
+  if((windowLen == 0u) || (windowLen > 0x7FFFu))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    S->windowLen = windowLen;
+    S->count = 0u;
+    S->idx = 0u;
+    S->pData = pData;
+    S->pPos = pIndex;
+    S->pHeap = pIndex + windowLen + (windowLen / 2u);
+
+    /* Assign the heap positions in the order the slots are filled: the first
+     ** sample takes the median entry, then the heaps grow alternately */
+    for (i = (int32_t) windowLen - 1; i >= 0; i--)
+    {
+      p = ((i + 1) / 2) * (((i & 1) != 0) ? -1 : 1);
+      S->pPos[i] = (int16_t) p;
+      S->pHeap[p] = (int16_t) i;
+      pData[i] = 0.0f;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MedianFilter group
+ */
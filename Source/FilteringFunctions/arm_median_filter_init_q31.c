@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_median_filter_init_q31.c
+*
+* Description:	Q31 running median filter initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MedianFilter
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 running median filter.
+ * @param[out] *S points to an instance of the Q31 running median filter structure.
+ * @param[in]  windowLen number of samples in the window, 1 to 32767.
+ * @param[in]  *pData points to the ring buffer of windowLen samples.
+ * @param[in]  *pIndex points to the index buffer of 2*windowLen entries.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowLen</code> is out of range.
+ *
+ * \par
+ * The function also empties the window, and may be called again to restart the filter.
+ */
+
+arm_status arm_median_filter_init_q31(
+  arm_median_filter_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t * pData,
+  int16_t * pIndex)
+{
+  int32_t i, p;                                  /* loop counter and heap position */
+  arm_status status;                             /* status of initialization */
+
+  if((windowLen == 0u) || (windowLen > 0x7FFFu))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    S->windowLen = windowLen;
+    S->count = 0u;
+    S->idx = 0u;
+    S->pData = pData;
+    S->pPos = pIndex;
+    S->pHeap = pIndex + windowLen + (windowLen / 2u);
+
+    /* Assign the heap positions in the order the slots are filled: the first
+     ** sample takes the median entry, then the heaps grow alternately */
+    for (i = (int32_t) windowLen - 1; i >= 0; i--)
+    {
+      p = ((i + 1) / 2) * (((i & 1) != 0) ? -1 : 1);
+      S->pPos[i] = (int16_t) p;
+      S->pHeap[p] = (int16_t) i;
+      pData[i] = 0;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MedianFilter group
+ */
@@ -0,0 +1,218 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_median_filter_q31.c
+*
+* Description:	Q31 running median filter processing function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MedianFilter
+ * @{
+ */
+
+/**
+ * @brief  Swaps heap entries i and j if the sample at i is less than the sample at j.
+ * @return 1 if the entries were swapped, 0 otherwise.
+ */
+
+static int32_t arm_median_swap_q31(
+  const arm_median_filter_instance_q31 * S,
+  int32_t i,
+  int32_t j)
+{
+  int16_t *pHeap = S->pHeap;
+  int16_t t;
+
+  if(S->pData[pHeap[i]] < S->pData[pHeap[j]])
+  {
+    t = pHeap[i];
+    pHeap[i] = pHeap[j];
+    pHeap[j] = t;
+    S->pPos[pHeap[i]] = (int16_t) i;
+    S->pPos[pHeap[j]] = (int16_t) j;
+
+    return (1);
+  }
+
+  return (0);
+}
+
+/**
+ * @brief  Moves the sample at child position i down the min-heap. Position 1 is the
+ * only child of the median.
+ */
+
+static void arm_median_min_down_q31(
+  const arm_median_filter_instance_q31 * S,
+  int32_t i,
+  int32_t minCt)
+{
+  for (; i <= minCt; i *= 2)
+  {
+    /* Follow the smaller child */
+    if((i > 1) && (i < minCt) && (S->pData[S->pHeap[i + 1]] < S->pData[S->pHeap[i]]))
+    {
+      i++;
+    }
+
+    if(arm_median_swap_q31(S, i, i / 2) == 0)
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * @brief  Moves the sample at child position i down the max-heap, at negative positions.
+ * Position -1 is the only child of the median.
+ */
+
+static void arm_median_max_down_q31(
+  const arm_median_filter_instance_q31 * S,
+  int32_t i,
+  int32_t maxCt)
+{
+  for (; i >= -maxCt; i *= 2)
+  {
+    /* Follow the larger child */
+    if((i < -1) && (i > -maxCt) && (S->pData[S->pHeap[i]] < S->pData[S->pHeap[i - 1]]))
+    {
+      i--;
+    }
+
+    if(arm_median_swap_q31(S, i / 2, i) == 0)
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * @brief  Q31 running median filter.
+ * @param[in,out] *S points to an instance of the Q31 running median filter structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[out]    *pDst points to the block of output samples.
+ * @param[in]     blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * <code>pDst</code> may be the same buffer as <code>pSrc</code>.
+ */
+
+void arm_median_filter_q31(
+  arm_median_filter_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pData = S->pData;                   /* ring buffer of samples */
+  int16_t *pHeap = S->pHeap;                     /* heap centred on the median */
+  uint32_t windowLen = S->windowLen;             /* window length */
+  q31_t in, old, med;                        /* new, leaving and median samples */
+  int32_t p, i;                                  /* heap positions */
+  int32_t minCt, maxCt;                          /* sizes of the min-heap and max-heap */
+  uint32_t isNew;                                /* 1 while the window fills */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    isNew = (S->count < windowLen) ? 1u : 0u;
+    p = S->pPos[S->idx];
+    old = pData[S->idx];
+    pData[S->idx] = in;
+    S->idx = ((S->idx + 1u) == windowLen) ? 0u : (S->idx + 1u);
+    S->count += isNew;
+
+    minCt = ((int32_t) S->count - 1) / 2;
+    maxCt = (int32_t) S->count / 2;
+
+    if(p > 0)
+    {
+      /* The slot is in the min-heap */
+      if((isNew == 0u) && (old < in))
+      {
+        arm_median_min_down_q31(S, p * 2, minCt);
+      }
+      else
+      {
+        for (i = p; (i > 0) && (arm_median_swap_q31(S, i, i / 2) != 0); i /= 2)
+        {
+        }
+
+        /* The new sample reached the median, rebalance the max-heap */
+        if(i == 0)
+        {
+          arm_median_max_down_q31(S, -1, maxCt);
+        }
+      }
+    }
+    else if(p < 0)
+    {
+      /* The slot is in the max-heap */
+      if((isNew == 0u) && (in < old))
+      {
+        arm_median_max_down_q31(S, p * 2, maxCt);
+      }
+      else
+      {
+        for (i = p; (i < 0) && (arm_median_swap_q31(S, i / 2, i) != 0); i /= 2)
+        {
+        }
+
+        /* The new sample reached the median, rebalance the min-heap */
+        if(i == 0)
+        {
+          arm_median_min_down_q31(S, 1, minCt);
+        }
+      }
+    }
+    else
+    {
+      /* The slot is the median itself */
+      if(maxCt > 0)
+      {
+        arm_median_max_down_q31(S, -1, maxCt);
+      }
+
+      if(minCt > 0)
+      {
+        arm_median_min_down_q31(S, 1, minCt);
+      }
+    }
+
+    /* Median, or mean of the two middle samples for an even count */
+    med = pData[pHeap[0]];
+
+    if((S->count & 1u) == 0u)
+    {
+      /* Halve before adding to avoid overflow, then restore the carry */
+      old = pData[pHeap[-1]];
+      med = (med >> 1) + (old >> 1) + (med & old & 1);
+    }
+
+    *pDst++ = med;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of MedianFilter group
+ */
@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_bilinear_map_f32.c
+*
+* Description:	Floating-point block bilinear map function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup InterpMap
+ * @{
+ */
+
+/**
+ * @brief  Floating-point block bilinear map.
+ * @param[in]  *S points to an instance of the floating-point bilinear map structure.
+ * @param[in]  *pX points to the block of X coordinates.
+ * @param[in]  *pY points to the block of Y coordinates.
+ * @param[out] *pOut points to the block of interpolated values.
+ * @param[in]  blockSize number of points to process.
+ * @return none.
+ *
+ * \par
+ * Points outside the table are clamped to its edges.
+ */
+
+void arm_bilinear_map_f32(
+  const arm_bilinear_map_instance_f32 * S,
+  float32_t * pX,
+  float32_t * pY,
+  float32_t * pOut,
+  uint32_t blockSize)
+{
+  const float32_t *pCell;                        /* first corner of the cell */
+  uint32_t strideY = S->strideY;                 /* distance between rows */
+  uint32_t ix, iy;                               /* cell indices */
+  float32_t fx, fy;                              /* fractional positions in the cell */
+  float32_t a, b;                                /* values interpolated along X */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Locate the cell and the position within it */
+    ix = arm_interp_axis_locate_f32(&S->axisX, *pX++, &fx);
+    iy = arm_interp_axis_locate_f32(&S->axisY, *pY++, &fy);
+
+    pCell = S->pData + ix + (iy * strideY);
+
+    /* Interpolate both rows along X, then along Y */
+    a = pCell[0] + (fx * (pCell[1] - pCell[0]));
+    b = pCell[strideY] + (fx * (pCell[strideY + 1u] - pCell[strideY]));
+
+    *pOut++ = a + (fy * (b - a));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of InterpMap group
+ */
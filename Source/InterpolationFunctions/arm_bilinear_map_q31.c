@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_bilinear_map_q31.c
+*
+* Description:	Q31 block bilinear map function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup InterpMap
+ * @{
+ */
+
+/*
+ * Interpolates between a and b at the 12.20 fraction f, rounded to nearest.
+ * The difference and the product are formed in 64 bits, so the result stays
+ * between a and b for the full Q31 range.
+ */
+
+static INLINE q31_t arm_map_lerp_q31(
+  q31_t a,
+  q31_t b,
+  q31_t f)
+{
+  return (a + (q31_t) (((((q63_t) b - a) * f) + 0x80000) >> 20));
+}
+
+/**
+ * @brief  Q31 block bilinear map.
+ * @param[in]  *S points to an instance of the Q31 bilinear map structure.
+ * @param[in]  *pX points to the block of X coordinates in 12.20 format.
+ * @param[in]  *pY points to the block of Y coordinates in 12.20 format.
+ * @param[out] *pOut points to the block of interpolated values.
+ * @param[in]  blockSize number of points to process.
+ * @return none.
+ *
+ * \par
+ * Points outside the table are clamped to its edges.
+ */
+
+void arm_bilinear_map_q31(
+  const arm_bilinear_map_instance_q31 * S,
+  q31_t * pX,
+  q31_t * pY,
+  q31_t * pOut,
+  uint32_t blockSize)
+{
+  const q31_t *pCell;                            /* first corner of the cell */
+  uint32_t strideY = S->strideY;                 /* distance between rows */
+  uint32_t ix, iy;                               /* cell indices */
+  q31_t fx, fy;                                  /* fractional positions in the cell */
+  q31_t a, b;                                    /* values interpolated along X */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Locate the cell and the position within it */
+    ix = arm_interp_axis_locate_q31(*pX++, S->numX, &fx);
+    iy = arm_interp_axis_locate_q31(*pY++, S->numY, &fy);
+
+    pCell = S->pData + ix + (iy * strideY);
+
+    /* Interpolate both rows along X, then along Y */
+    a = arm_map_lerp_q31(pCell[0], pCell[1], fx);
+    b = arm_map_lerp_q31(pCell[strideY], pCell[strideY + 1u], fx);
+
+    *pOut++ = arm_map_lerp_q31(a, b, fy);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of InterpMap group
+ */
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_interp_axis_init_f32.c
+*
+* Description:	Floating-point interpolation grid axis initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @defgroup InterpMap Bilinear and Trilinear Maps
+ *
+ * Evaluates blocks of points against a two or three dimensional table, such as a
+ * magnetometer or thermal calibration map. Compared with arm_bilinear_interp_f32(),
+ * the coordinates are given in the units of the map axes, the axes may be non-uniform,
+ * and points outside the table are clamped to its edges instead of returning zero.
+ *
+ * \par Axes
+ * Each dimension of the table is described by an arm_interp_axis_f32 structure.
+ * A uniform axis stores its first grid point and the reciprocal of its spacing, and
+ * a coordinate is located with a subtraction and a multiplication. A non-uniform axis
+ * points to a strictly increasing array of grid points and to a buffer of reciprocal
+ * interval lengths filled by arm_interp_axis_init_f32(). Its coordinates are located
+ * with a binary search, and the fractional position with a multiplication.
+ * Coordinates are clamped to the first and last grid points with conditional selects.
+ * A NaN coordinate is treated as the first grid point.
+ *
+ * \par Table layout
+ * The table is stored with the X index varying fastest. For a bilinear map, the value
+ * at grid point <code>(ix, iy)</code> is <code>pData[ix + iy * numX]</code>. For a trilinear
+ * map, the value at <code>(ix, iy, iz)</code> is <code>pData[ix + iy * numX + iz * numX * numY]</code>.
+ * The row and plane strides are computed by the initialization functions, so the
+ * process functions find the corners of a cell with one multiply-add per dimension.
+ * The two corners along X are adjacent in memory, so each cell reads 2 pairs of
+ * neighbouring values for a bilinear map and 4 pairs for a trilinear map.
+ *
+ * \par Algorithm
+ * With <code>fx</code>, <code>fy</code> and <code>fz</code> the fractional positions of a
+ * point within its cell, the bilinear map interpolates along X and then along Y:
+ * <pre>
+ *    a = f(ix, iy)   + fx * (f(ix+1, iy)   - f(ix, iy))
+ *    b = f(ix, iy+1) + fx * (f(ix+1, iy+1) - f(ix, iy+1))
+ *    out = a + fy * (b - a)   </pre>
+ * The trilinear map computes the same on the planes <code>iz</code> and <code>iz+1</code>
+ * and interpolates the two results along Z.
+ *
+ * \par Instance Structure
+ * The instance holds copies of the axes, the strides and a pointer to the table.
+ * The grid point and reciprocal interval arrays of non-uniform axes are referenced,
+ * not copied, and must stay valid while the map is used.
+ *
+ * \par Fixed-Point Maps
+ * The Q31 and Q15 maps support uniform axes only. Their coordinates are table indices
+ * in 12.20 format, as for arm_bilinear_interp_q31(), so each dimension has 2 to 2048
+ * grid points, and the instance stores the dimensions instead of axis structures.
+ * Coordinates are clamped to the table as for the floating-point maps. The Q31 maps
+ * interpolate with 64-bit products and the Q15 maps with the fractions rounded to 1.15,
+ * and each step is rounded to nearest, so the output stays within the range of the
+ * corners of its cell and cannot overflow.
+ */
+
+/**
+ * @addtogroup InterpMap
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for a floating-point interpolation grid axis.
+ * @param[out] *A points to the axis structure.
+ * @param[in]  numPoints number of grid points along the axis, at least 2.
+ * @param[in]  x0 first grid point of a uniform axis.
+ * @param[in]  spacing spacing of a uniform axis, greater than 0.
+ * @param[in]  *pPoints points to numPoints strictly increasing grid points, or NULL
+ * for a uniform axis.
+ * @param[out] *pInvDelta points to a buffer of numPoints - 1 values for the reciprocal
+ * interval lengths of a non-uniform axis. Not used for a uniform axis.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the
+ * axis has fewer than 2 points, a uniform spacing is not positive, the grid points are
+ * not strictly increasing or the reciprocal buffer is missing.
+ *
+ * \par
+ * <code>x0</code> and <code>spacing</code> are ignored for a non-uniform axis.
+ */
+
+arm_status arm_interp_axis_init_f32(
+  arm_interp_axis_f32 * A,
+  uint16_t numPoints,
+  float32_t x0,
+  float32_t spacing,
+  const float32_t * pPoints,
+  float32_t * pInvDelta)
+{
+  uint32_t i;                                    /* loop counter */
+  arm_status status;                             /* status of initialization */
+
+  status = ARM_MATH_SUCCESS;
+
+  if(numPoints < 2u)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else if(pPoints == NULL)
+  {
+    if(!(spacing > 0.0f))
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+      A->x0 = x0;
+      A->invSpacing = 1.0f / spacing;
+    }
+  }
+  else if(pInvDelta == NULL)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Reciprocal of each interval, checking that the grid points increase */
+    for (i = 0u; i < (uint32_t) (numPoints - 1u); i++)
+    {
+      if(!(pPoints[i + 1u] > pPoints[i]))
+      {
+        status = ARM_MATH_ARGUMENT_ERROR;
+        break;
+      }
+
+      pInvDelta[i] = 1.0f / (pPoints[i + 1u] - pPoints[i]);
+    }
+
+    A->x0 = pPoints[0];
+    A->invSpacing = 0.0f;
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    A->numPoints = numPoints;
+    A->maxIndex = (float32_t) (numPoints - 1u);
+    A->pPoints = pPoints;
+    A->pInvDelta = pInvDelta;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of InterpMap group
+ */
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_interp_f32.c
+*
+* Description:	Floating-point table interpolation function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup TableInterp
+ * @{
+ */
+
+/**
+ * @brief  Process function for the floating-point table interpolation.
+ * @param[in]  *S points to an instance of the floating-point table interpolation structure.
+ * @param[in]  *pIn points to the block of input values.
+ * @param[out] *pOut points to the block of interpolated values.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * Inputs below <code>x1</code> give the first table value and inputs above the last
+ * table entry give the last table value. A NaN input gives the first table value.
+ * The method is selected once per block, so the inner loops do not branch on it.
+ */
+
+void arm_interp_f32(
+  const arm_interp_instance_f32 * S,
+  float32_t * pIn,
+  float32_t * pOut,
+  uint32_t blockSize)
+{
+  float32_t *pY = S->pYData;                     /* table of output values */
+  float32_t *pM = S->pSlope;                     /* slopes at the table entries */
+  float32_t x1 = S->x1;                          /* input of the first table entry */
+  float32_t invSpacing = S->invSpacing;          /* reciprocal of the table spacing */
+  float32_t maxIndex = S->maxIndex;              /* index of the last table entry */
+  uint32_t lastSeg = S->nValues - 2u;            /* index of the last table segment */
+  float32_t t, f;                                /* table index and its fractional part */
+  float32_t y0, y1, m0, m1, c2, c3;              /* segment values, slopes and coefficients */
+  uint32_t i;                                    /* integer part of the table index */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  if(S->method == ARM_INTERP_LINEAR)
+  {
+    while(blkCnt > 0u)
+    {
+      /* Table index, clamped to [0, nValues - 1].  The comparisons are written so
+       ** that a NaN input selects index 0 */
+      t = (*pIn++ - x1) * invSpacing;
+      t = (t > 0.0f) ? t : 0.0f;
+      t = (t < maxIndex) ? t : maxIndex;
+
+      /* The last table entry is the end of the last segment */
+      i = (uint32_t) t;
+      i = (i < lastSeg) ? i : lastSeg;
+      f = t - (float32_t) i;
+
+      y0 = pY[i];
+      y1 = pY[i + 1u];
+
+      *pOut++ = y0 + (f * (y1 - y0));
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    /* PCHIP and Catmull-Rom only differ in the slopes computed at initialization */
+    while(blkCnt > 0u)
+    {
+      t = (*pIn++ - x1) * invSpacing;
+      t = (t > 0.0f) ? t : 0.0f;
+      t = (t < maxIndex) ? t : maxIndex;
+
+      i = (uint32_t) t;
+      i = (i < lastSeg) ? i : lastSeg;
+      f = t - (float32_t) i;
+
+      y0 = pY[i];
+      y1 = pY[i + 1u];
+      m0 = pM[i];
+      m1 = pM[i + 1u];
+
+      /* Cubic Hermite segment in Horner form */
+      c2 = (3.0f * (y1 - y0)) - (2.0f * m0) - m1;
+      c3 = (2.0f * (y0 - y1)) + m0 + m1;
+
+      *pOut++ = y0 + (f * (m0 + (f * (c2 + (f * c3)))));
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of TableInterp group
+ */
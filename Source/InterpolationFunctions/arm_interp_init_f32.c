@@ -0,0 +1,206 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_interp_init_f32.c
+*
+* Description:	Floating-point table interpolation initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @defgroup TableInterp Table Interpolation
+ *
+ * Interpolates a table of values sampled at uniform spacing, such as a sensor
+ * calibration curve. The table holds <code>nValues</code> outputs for the inputs
+ * <code>x1, x1 + xSpacing, ..., x1 + (nValues - 1) * xSpacing</code>.
+ *
+ * \par
+ * Unlike arm_linear_interp_f32(), the instance stores the reciprocal of the spacing,
+ * so locating a sample costs a subtraction and a multiplication instead of a division.
+ * The table index is clamped to <code>[0, nValues - 1]</code> with conditional selects,
+ * which gives the first or last table value outside the table range without a three way
+ * branch per sample.
+ *
+ * \par Methods
+ * With the table index <code>t</code> split into <code>i = floor(t)</code> and
+ * <code>f = t - i</code>, the methods compute:
+ * - ARM_INTERP_LINEAR: <code>y = y[i] + f * (y[i+1] - y[i])</code>.
+ * - ARM_INTERP_PCHIP: piecewise cubic Hermite interpolation with the Fritsch-Carlson
+ *   slopes. The curve is monotone wherever the table is monotone and does not overshoot
+ *   the table values, which suits calibration curves.
+ * - ARM_INTERP_CATMULL_ROM: cubic Hermite interpolation with the central difference slopes
+ *   <code>(y[i+1] - y[i-1]) / 2</code>. The curve has a continuous first derivative but may
+ *   overshoot near steps in the table.
+ *
+ * \par
+ * The cubic segments are evaluated as
+ * <pre>
+ *    y = y[i] + f * (m[i] + f * (c2 + f * c3))
+ *    c2 = 3 * (y[i+1] - y[i]) - 2 * m[i] - m[i+1]
+ *    c3 = 2 * (y[i] - y[i+1]) + m[i] + m[i+1]   </pre>
+ * where <code>m</code> is the slope at each table entry in table-index units.
+ * The slopes are computed once by the initialization function and stored in a
+ * user supplied buffer of <code>nValues</code> elements, so the process function
+ * reads four values per sample and does not depend on the neighbouring segments.
+ * At the table ends the PCHIP slopes use the shape preserving three point formula
+ * and the Catmull-Rom slopes use one sided differences.
+ *
+ * \par Instance Structure
+ * The instance holds the table, the slopes, the reciprocal spacing and the method.
+ * The slopes must be recomputed by calling the initialization function again whenever
+ * the table values change.
+ */
+
+/**
+ * @addtogroup TableInterp
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point table interpolation.
+ * @param[out] *S points to an instance of the floating-point table interpolation structure.
+ * @param[in]  method interpolation method.
+ * @param[in]  nValues number of table values, at least 2.
+ * @param[in]  x1 input value of the first table entry.
+ * @param[in]  xSpacing spacing between the inputs of consecutive table entries, greater than 0.
+ * @param[in]  *pYData points to the table of nValues output values.
+ * @param[out] *pSlope points to a buffer of nValues slopes filled for the cubic methods.
+ * May be NULL for ARM_INTERP_LINEAR.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * the method is unknown, the table is too short, the spacing is not positive or the
+ * slope buffer is missing for a cubic method.
+ */
+
+arm_status arm_interp_init_f32(
+  arm_interp_instance_f32 * S,
+  arm_interp_method method,
+  uint32_t nValues,
+  float32_t x1,
+  float32_t xSpacing,
+  float32_t * pYData,
+  float32_t * pSlope)
+{
+  float32_t d0, d1;                              /* differences of neighbouring table values */
+  float32_t m;                                   /* slope at a table entry */
+  uint32_t i;                                    /* loop counter */
+  uint32_t last;                                 /* index of the last table entry */
+  arm_status status;                             /* status of initialization */
+
+  if((nValues < 2u) || !(xSpacing > 0.0f) ||
+     ((method != ARM_INTERP_LINEAR) && (method != ARM_INTERP_PCHIP) &&
+      (method != ARM_INTERP_CATMULL_ROM)) ||
+     ((method != ARM_INTERP_LINEAR) && (pSlope == NULL)))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign the table and the precomputed reciprocal spacing */
+    S->nValues = nValues;
+    S->method = method;
+    S->x1 = x1;
+    S->invSpacing = 1.0f / xSpacing;
+    S->maxIndex = (float32_t) (nValues - 1u);
+    S->pYData = pYData;
+    S->pSlope = pSlope;
+
+    last = nValues - 1u;
+
+    if(method == ARM_INTERP_CATMULL_ROM)
+    {
+      /* One sided differences at the ends, central differences inside */
+      pSlope[0] = pYData[1] - pYData[0];
+      pSlope[last] = pYData[last] - pYData[last - 1u];
+
+      for (i = 1u; i < last; i++)
+      {
+        pSlope[i] = 0.5f * (pYData[i + 1u] - pYData[i - 1u]);
+      }
+    }
+    else if(method == ARM_INTERP_PCHIP)
+    {
+      if(nValues == 2u)
+      {
+        /* A single segment is a straight line */
+        pSlope[0] = pYData[1] - pYData[0];
+        pSlope[1] = pSlope[0];
+      }
+      else
+      {
+        /* Inside the table, the harmonic mean of the neighbouring differences,
+         ** or zero at a local extremum */
+        d0 = pYData[1] - pYData[0];
+
+        for (i = 1u; i < last; i++)
+        {
+          d1 = pYData[i + 1u] - pYData[i];
+
+          if((d0 * d1) > 0.0f)
+          {
+            pSlope[i] = (2.0f * d0 * d1) / (d0 + d1);
+          }
+          else
+          {
+            pSlope[i] = 0.0f;
+          }
+
+          d0 = d1;
+        }
+
+        /* Shape preserving three point formula at the first entry */
+        d0 = pYData[1] - pYData[0];
+        d1 = pYData[2] - pYData[1];
+        m = 0.5f * ((3.0f * d0) - d1);
+
+        if((m * d0) <= 0.0f)
+        {
+          m = 0.0f;
+        }
+        else if(((d0 * d1) <= 0.0f) && (fabsf(m) > fabsf(3.0f * d0)))
+        {
+          m = 3.0f * d0;
+        }
+
+        pSlope[0] = m;
+
+        /* and at the last entry */
+        d0 = pYData[last] - pYData[last - 1u];
+        d1 = pYData[last - 1u] - pYData[last - 2u];
+        m = 0.5f * ((3.0f * d0) - d1);
+
+        if((m * d0) <= 0.0f)
+        {
+          m = 0.0f;
+        }
+        else if(((d0 * d1) <= 0.0f) && (fabsf(m) > fabsf(3.0f * d0)))
+        {
+          m = 3.0f * d0;
+        }
+
+        pSlope[last] = m;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of TableInterp group
+ */
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_trilinear_map_f32.c
+*
+* Description:	Floating-point block trilinear map function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup InterpMap
+ * @{
+ */
+
+/**
+ * @brief  Floating-point block trilinear map.
+ * @param[in]  *S points to an instance of the floating-point trilinear map structure.
+ * @param[in]  *pX points to the block of X coordinates.
+ * @param[in]  *pY points to the block of Y coordinates.
+ * @param[in]  *pZ points to the block of Z coordinates.
+ * @param[out] *pOut points to the block of interpolated values.
+ * @param[in]  blockSize number of points to process.
+ * @return none.
+ *
+ * \par
+ * Points outside the table are clamped to its edges.
+ */
+
+void arm_trilinear_map_f32(
+  const arm_trilinear_map_instance_f32 * S,
+  float32_t * pX,
+  float32_t * pY,
+  float32_t * pZ,
+  float32_t * pOut,
+  uint32_t blockSize)
+{
+  const float32_t *pCell;                        /* first corner of the cell */
+  uint32_t strideY = S->strideY;                 /* distance between rows */
+  uint32_t strideZ = S->strideZ;                 /* distance between planes */
+  uint32_t ix, iy, iz;                           /* cell indices */
+  float32_t fx, fy, fz;                          /* fractional positions in the cell */
+  float32_t a, b, c0, c1;                        /* intermediate values */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Locate the cell and the position within it */
+    ix = arm_interp_axis_locate_f32(&S->axisX, *pX++, &fx);
+    iy = arm_interp_axis_locate_f32(&S->axisY, *pY++, &fy);
+    iz = arm_interp_axis_locate_f32(&S->axisZ, *pZ++, &fz);
+
+    pCell = S->pData + ix + (iy * strideY) + (iz * strideZ);
+
+    /* Bilinear interpolation on the lower plane */
+    a = pCell[0] + (fx * (pCell[1] - pCell[0]));
+    b = pCell[strideY] + (fx * (pCell[strideY + 1u] - pCell[strideY]));
+    c0 = a + (fy * (b - a));
+
+    /* and on the upper plane */
+    pCell += strideZ;
+    a = pCell[0] + (fx * (pCell[1] - pCell[0]));
+    b = pCell[strideY] + (fx * (pCell[strideY + 1u] - pCell[strideY]));
+    c1 = a + (fy * (b - a));
+
+    /* Interpolate between the planes */
+    *pOut++ = c0 + (fz * (c1 - c0));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of InterpMap group
+ */
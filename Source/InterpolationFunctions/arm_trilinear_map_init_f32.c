@@ -0,0 +1,57 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_trilinear_map_init_f32.c
+*
+* Description:	Floating-point trilinear map initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup InterpMap
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point trilinear map.
+ * @param[out] *S points to an instance of the floating-point trilinear map structure.
+ * @param[in]  *pAxisX points to the initialized X axis.
+ * @param[in]  *pAxisY points to the initialized Y axis.
+ * @param[in]  *pAxisZ points to the initialized Z axis.
+ * @param[in]  *pData points to the table of numX * numY * numZ values.
+ * @return The function returns ARM_MATH_SUCCESS.
+ */
+
+arm_status arm_trilinear_map_init_f32(
+  arm_trilinear_map_instance_f32 * S,
+  const arm_interp_axis_f32 * pAxisX,
+  const arm_interp_axis_f32 * pAxisY,
+  const arm_interp_axis_f32 * pAxisZ,
+  const float32_t * pData)
+{
+  /* Copy the axes and precompute the row and plane strides */
+  S->axisX = *pAxisX;
+  S->axisY = *pAxisY;
+  S->axisZ = *pAxisZ;
+  S->strideY = pAxisX->numPoints;
+  S->strideZ = (uint32_t) pAxisX->numPoints * pAxisY->numPoints;
+  S->pData = pData;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of InterpMap group
+ */
@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_trilinear_map_init_q31.c
+*
+* Description:	Q31 Trilinear map initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup InterpMap
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 trilinear map.
+ * @param[out] *S points to an instance of the Q31 trilinear map structure.
+ * @param[in]  numX number of grid points along X, 2 to 2048.
+ * @param[in]  numY number of grid points along Y, 2 to 2048.
+ * @param[in]  numZ number of grid points along Z, 2 to 2048.
+ * @param[in]  *pData points to the table of numX * numY * numZ values.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * a dimension is outside the range of the 12.20 coordinates.
+ */
+
+arm_status arm_trilinear_map_init_q31(
+  arm_trilinear_map_instance_q31 * S,
+  uint16_t numX,
+  uint16_t numY,
+  uint16_t numZ,
+  const q31_t * pData)
+{
+  /* Each axis needs at least one cell, and its last grid point must fit in 12.20 */
+  if((numX < 2u) || (numX > 2048u) ||
+     (numY < 2u) || (numY > 2048u) ||
+     (numZ < 2u) || (numZ > 2048u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Store the dimensions and precompute the row and plane strides */
+  S->numX = numX;
+  S->numY = numY;
+  S->numZ = numZ;
+  S->strideY = numX;
+  S->strideZ = (uint32_t) numX * numY;
+  S->pData = pData;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of InterpMap group
+ */
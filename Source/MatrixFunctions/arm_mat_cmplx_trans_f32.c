@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_cmplx_trans_f32.c
+*
+* Description:	Floating-point complex matrix transpose.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+/**
+ * @defgroup MatrixComplexTrans Complex Matrix Transpose
+ *
+ * Tranposes a complex matrix.
+ * The data of the complex matrix is stored in an interleaved fashion
+ * (real, imag, real, imag, ...) and <code>numRows</code>, <code>numCols</code>
+ * count complex elements, as for the complex matrix multiplication.
+ * Transposing an <code>M x N</code> complex matrix results in an <code>N x M</code> complex matrix.
+ *
+ * \par
+ * The transpose is blocked: four input rows are walked together so that every
+ * iteration writes four consecutive complex values (one cache line for floating-point data)
+ * of the output row while the four input rows are read sequentially.
+ * This keeps both the reads and the writes streaming, which matters for the 2-D FFT
+ * where the whole image is transposed twice per transform.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixComplexTrans
+ * @{
+ */
+
+/**
+  * @brief Floating-point complex matrix transpose.
+  * @param[in]  *pSrc points to the input complex matrix
+  * @param[out] *pDst points to the output complex matrix
+  * @return 	The function returns either  <code>ARM_MATH_SIZE_MISMATCH</code>
+  * or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+  */
+
+arm_status arm_mat_cmplx_trans_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pIn0, *pIn1, *pIn2, *pIn3;          /* input row pointers of the block */
+  float32_t *px;                                 /* Temporary output data matrix pointer */
+  uint16_t nRows = pSrc->numRows;                /* number of rows */
+  uint16_t nColumns = pSrc->numCols;             /* number of columns */
+  uint32_t rowStride = 2u * nColumns;            /* input row stride in floats */
+  uint32_t colStride = 2u * nRows;               /* output row stride in floats */
+  uint16_t col, row;                             /* loop counters */
+  arm_status status;                             /* status of matrix transpose  */
+  float32_t re0, im0, re1, im1, re2, im2, re3, im3;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pDst->numCols) || (pSrc->numCols != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    /* Process four input rows at a time */
+    row = nRows >> 2u;
+
+    while(row > 0u)
+    {
+      pIn0 = pIn;
+      pIn1 = pIn0 + rowStride;
+      pIn2 = pIn1 + rowStride;
+      pIn3 = pIn2 + rowStride;
+
+      /* The pointer px is set to starting address of the column being processed */
+      px = pOut;
+
+      col = nColumns;
+
+      while(col > 0u)
+      {
+        /* Read one complex element from each of the four rows */
+        re0 = pIn0[0];
+        im0 = pIn0[1];
+        re1 = pIn1[0];
+        im1 = pIn1[1];
+        re2 = pIn2[0];
+        im2 = pIn2[1];
+        re3 = pIn3[0];
+        im3 = pIn3[1];
+
+        /* Store them as four consecutive elements of the output row */
+        px[0] = re0;
+        px[1] = im0;
+        px[2] = re1;
+        px[3] = im1;
+        px[4] = re2;
+        px[5] = im2;
+        px[6] = re3;
+        px[7] = im3;
+
+        pIn0 += 2u;
+        pIn1 += 2u;
+        pIn2 += 2u;
+        pIn3 += 2u;
+
+        /* Update the pointer px to point to the next row of the transposed matrix */
+        px += colStride;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      /* Advance to the next block of four rows */
+      pIn += 4u * rowStride;
+      pOut += 8u;
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* Transpose the remaining 1 to 3 rows */
+    row = nRows % 0x4u;
+
+    while(row > 0u)
+    {
+      px = pOut;
+
+      col = nColumns;
+
+      while(col > 0u)
+      {
+        px[0] = pIn[0];
+        px[1] = pIn[1];
+        pIn += 2u;
+
+        /* Update the pointer px to point to the next row of the transposed matrix */
+        px += colStride;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      pOut += 2u;
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixComplexTrans group
+ */
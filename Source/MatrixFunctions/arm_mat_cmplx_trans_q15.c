@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_cmplx_trans_q15.c
+*
+* Description:	Q15 complex matrix transpose.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixComplexTrans
+ * @{
+ */
+
+/**
+  * @brief Q15 complex matrix transpose.
+  * @param[in]  *pSrc points to the input complex matrix
+  * @param[out] *pDst points to the output complex matrix
+  * @return 	The function returns either  <code>ARM_MATH_SIZE_MISMATCH</code>
+  * or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+  */
+
+arm_status arm_mat_cmplx_trans_q15(
+  const arm_matrix_instance_q15 * pSrc,
+  arm_matrix_instance_q15 * pDst)
+{
+  q31_t *pIn = (q31_t *) pSrc->pData;            /* input data matrix pointer, one complex value per word */
+  q31_t *pOut = (q31_t *) pDst->pData;           /* output data matrix pointer, one complex value per word */
+  q31_t *pIn0, *pIn1, *pIn2, *pIn3;              /* input row pointers of the block */
+  q31_t *px;                                     /* Temporary output data matrix pointer */
+  uint16_t nRows = pSrc->numRows;                /* number of rows */
+  uint16_t nColumns = pSrc->numCols;             /* number of columns */
+  uint16_t col, row;                             /* loop counters */
+  arm_status status;                             /* status of matrix transpose  */
+  q31_t in1, in2, in3, in4;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pDst->numCols) || (pSrc->numCols != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    /* Process four input rows at a time */
+    row = nRows >> 2u;
+
+    while(row > 0u)
+    {
+      pIn0 = pIn;
+      pIn1 = pIn0 + nColumns;
+      pIn2 = pIn1 + nColumns;
+      pIn3 = pIn2 + nColumns;
+
+      /* The pointer px is set to starting address of the column being processed */
+      px = pOut;
+
+      col = nColumns;
+
+      while(col > 0u)
+      {
+        /* Read one complex element (real and imag packed in a word) from each of the four rows */
+        in1 = *pIn0++;
+        in2 = *pIn1++;
+        in3 = *pIn2++;
+        in4 = *pIn3++;
+
+        /* Store them as four consecutive elements of the output row */
+        px[0] = in1;
+        px[1] = in2;
+        px[2] = in3;
+        px[3] = in4;
+
+        /* Update the pointer px to point to the next row of the transposed matrix */
+        px += nRows;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      /* Advance to the next block of four rows */
+      pIn += 4u * nColumns;
+      pOut += 4u;
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* Transpose the remaining 1 to 3 rows */
+    row = nRows % 0x4u;
+
+    while(row > 0u)
+    {
+      px = pOut;
+
+      col = nColumns;
+
+      while(col > 0u)
+      {
+        *px = *pIn++;
+
+        /* Update the pointer px to point to the next row of the transposed matrix */
+        px += nRows;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      pOut++;
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixComplexTrans group
+ */
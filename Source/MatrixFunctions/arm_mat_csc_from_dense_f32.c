@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_csc_from_dense_f32.c
+*
+* Description:	Floating-point conversion of a full matrix to CSC sparse storage.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Floating-point conversion of a full matrix to CSC sparse storage.
+ * @param[in]       *pSrc points to the full input matrix structure
+ * @param[in,out]   *pDst points to the CSC sparse matrix structure
+ * @param[in]       maxNonZeros number of entries that the <code>pRowIdx</code> and <code>pData</code> arrays can hold
+ * @return The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions differ,
+ * <code>ARM_MATH_LENGTH_ERROR</code> if the matrix has more than <code>maxNonZeros</code>
+ * non-zero entries, otherwise <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * Builds the sparsity pattern (<code>pColPtr</code>, <code>pRowIdx</code>) and copies the non-zero
+ * values, scanning the input column by column. The dimensions of the sparse structure must
+ * be set before the call.
+ */
+
+arm_status arm_mat_csc_from_dense_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_csc_instance_f32 * pDst,
+  uint16_t maxNonZeros)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  uint16_t numRows = pSrc->numRows;              /* number of rows */
+  uint16_t numCols = pSrc->numCols;              /* number of columns */
+  uint16_t *pColPtr = pDst->pColPtr;             /* column offsets */
+  uint16_t *pRowIdx = pDst->pRowIdx;             /* row indices */
+  float32_t *pData = pDst->pData;                /* stored values */
+  float32_t in;                                  /* temporary input value */
+  uint32_t nnz = 0u;                             /* number of stored entries */
+  uint16_t col, row;                             /* loop counters */
+  arm_status status;                             /* status of matrix conversion */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pDst->numRows) || (pSrc->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (col = 0u; col < numCols; col++)
+    {
+      /* First entry of this column */
+      pColPtr[col] = (uint16_t) nnz;
+
+      for (row = 0u; row < numRows; row++)
+      {
+        in = pIn[(row * numCols) + col];
+
+        if(in != 0.0f)
+        {
+          if(nnz < maxNonZeros)
+          {
+            pRowIdx[nnz] = row;
+            pData[nnz] = in;
+          }
+          else
+          {
+            status = ARM_MATH_LENGTH_ERROR;
+          }
+
+          nnz++;
+        }
+      }
+    }
+
+    /* End of the last column */
+    pColPtr[numCols] = (uint16_t) nnz;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
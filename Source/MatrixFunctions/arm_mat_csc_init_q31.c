@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_csc_init_q31.c
+*
+* Description:	Q31 CSC sparse matrix initialization.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixInit
+ * @{
+ */
+
+/**
+   * @brief  Q31 CSC sparse matrix initialization.
+   * @param[in,out] *S             points to an instance of the Q31 CSC sparse matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pColPtr	   points to the array of <code>nColumns+1</code> column offsets.
+   * @param[in]     *pRowIdx	   points to the array of row indices of the stored entries.
+   * @param[in]     *pData	   points to the array of values of the stored entries.
+   * @return        none
+   */
+
+void arm_mat_csc_init_q31(
+  arm_matrix_csc_instance_q31 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint16_t * pColPtr,
+  uint16_t * pRowIdx,
+  q31_t * pData)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Number of Columns */
+  S->numCols = nColumns;
+
+  /* Assign the sparsity pattern */
+  S->pColPtr = pColPtr;
+  S->pRowIdx = pRowIdx;
+
+  /* Assign Data pointer */
+  S->pData = pData;
+}
+
+/**
+ * @} end of MatrixInit group
+ */
@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_csc_mult_f32.c
+*
+* Description:	Floating-point CSC sparse matrix multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief  Adds a scaled row to another row: pDst[n] += scale * pSrc[n].
+ */
+
+static void arm_mat_csc_mult_row_f32(
+  float32_t scale,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    pDst[0] += scale * pSrc[0];
+    pDst[1] += scale * pSrc[1];
+    pDst[2] += scale * pSrc[2];
+    pDst[3] += scale * pSrc[3];
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ += scale * *pSrc++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief Floating-point CSC sparse matrix multiplication.
+ * @param[in]       *pSrcA points to the CSC sparse matrix structure of size <code>M x N</code>
+ * @param[in]       *pSrcB points to the full input matrix structure of size <code>N x P</code>
+ * @param[out]      *pDst points to the full output matrix structure of size <code>M x P</code>
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * Row j of B is scaled by every stored entry of column j and added to the output row
+ * given by the row index of the entry.
+ */
+
+arm_status arm_mat_csc_mult_f32(
+  const arm_matrix_csc_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  uint16_t *pColPtr = pSrcA->pColPtr;            /* column offsets */
+  uint16_t *pRowIdx = pSrcA->pRowIdx;            /* row indices */
+  float32_t *pData = pSrcA->pData;               /* stored values */
+  float32_t *pIn;                                /* row of B */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of B */
+  uint32_t col, e;                               /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    arm_fill_f32(0.0f, pDst->pData, (uint32_t) pSrcA->numRows * numColsB);
+
+    for (col = 0u; col < pSrcA->numCols; col++)
+    {
+      pIn = pSrcB->pData + (col * numColsB);
+
+      for (e = pColPtr[col]; e < pColPtr[col + 1u]; e++)
+      {
+        arm_mat_csc_mult_row_f32(pData[e], pIn,
+                                 pDst->pData + (pRowIdx[e] * numColsB), numColsB);
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_csc_mult_q31.c
+*
+* Description:	Q31 CSC sparse matrix multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Q31 CSC sparse matrix multiplication.
+ * @param[in]       *pSrcA points to the CSC sparse matrix structure of size <code>M x N</code>
+ * @param[in]       *pSrcB points to the full input matrix structure of size <code>N x P</code>
+ * @param[out]      *pDst points to the full output matrix structure of size <code>M x P</code>
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The partial sums are kept in the output matrix, as in <code>arm_mat_csc_mult_vec_q31()</code>:
+ * every product is truncated to 2.30 format and added with saturation, and the result is
+ * shifted left by 1 bit with saturation to yield 1.31 format.
+ */
+
+arm_status arm_mat_csc_mult_q31(
+  const arm_matrix_csc_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst)
+{
+  uint16_t *pColPtr = pSrcA->pColPtr;            /* column offsets */
+  uint16_t *pRowIdx = pSrcA->pRowIdx;            /* row indices */
+  q31_t *pData = pSrcA->pData;                   /* stored values */
+  q31_t *pIn;                                    /* row of B */
+  q31_t *pOut;                                   /* row of the output */
+  q31_t a;                                       /* stored entry */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of B */
+  uint32_t numOut;                               /* number of output values */
+  uint32_t col, e, i;                            /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    numOut = (uint32_t) pSrcA->numRows * numColsB;
+
+    arm_fill_q31(0, pDst->pData, numOut);
+
+    for (col = 0u; col < pSrcA->numCols; col++)
+    {
+      pIn = pSrcB->pData + (col * numColsB);
+
+      for (e = pColPtr[col]; e < pColPtr[col + 1u]; e++)
+      {
+        a = pData[e];
+        pOut = pDst->pData + (pRowIdx[e] * numColsB);
+
+        for (i = 0u; i < numColsB; i++)
+        {
+          pOut[i] = __QADD(pOut[i], (q31_t) (((q63_t) a * pIn[i]) >> 32));
+        }
+      }
+    }
+
+    /* Convert the results from 2.30 to 1.31 format */
+    pOut = pDst->pData;
+
+    for (i = 0u; i < numOut; i++)
+    {
+      pOut[i] = __QADD(pOut[i], pOut[i]);
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_csc_mult_vec_f32.c
+*
+* Description:	Floating-point CSC sparse matrix-vector multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Floating-point CSC sparse matrix-vector multiplication.
+ * @param[in]       *pSrcMat points to the CSC sparse matrix structure of size <code>M x N</code>
+ * @param[in]       *pVec points to the input vector of <code>N</code> values
+ * @param[out]      *pDst points to the output vector of <code>M</code> values
+ * @return none.
+ *
+ * Every column is scaled by its input value and added to the output;
+ * columns whose input value is zero are skipped.
+ */
+
+void arm_mat_csc_mult_vec_f32(
+  const arm_matrix_csc_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  uint16_t *pColPtr = pSrcMat->pColPtr;          /* column offsets */
+  uint16_t *pRowIdx = pSrcMat->pRowIdx;          /* row indices */
+  float32_t *pData = pSrcMat->pData;             /* stored values */
+  float32_t in;                                  /* input value of the column */
+  uint32_t col, e;                               /* loop counters */
+
+  arm_fill_f32(0.0f, pDst, pSrcMat->numRows);
+
+  for (col = 0u; col < pSrcMat->numCols; col++)
+  {
+    in = pVec[col];
+
+    if(in != 0.0f)
+    {
+      for (e = pColPtr[col]; e < pColPtr[col + 1u]; e++)
+      {
+        pDst[pRowIdx[e]] += pData[e] * in;
+      }
+    }
+  }
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
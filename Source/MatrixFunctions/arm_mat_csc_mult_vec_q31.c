@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_csc_mult_vec_q31.c
+*
+* Description:	Q31 CSC sparse matrix-vector multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Q31 CSC sparse matrix-vector multiplication.
+ * @param[in]       *pSrcMat points to the CSC sparse matrix structure of size <code>M x N</code>
+ * @param[in]       *pVec points to the input vector of <code>N</code> values
+ * @param[out]      *pDst points to the output vector of <code>M</code> values
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The partial sums are scattered to different outputs and are therefore kept in the
+ * output vector itself, as in <code>arm_mat_mult_fast_q31()</code>: every product is truncated
+ * to 2.30 format and added with saturation. The result is shifted left by 1 bit with
+ * saturation to yield 1.31 format.
+ * Columns whose input value is zero are skipped.
+ */
+
+void arm_mat_csc_mult_vec_q31(
+  const arm_matrix_csc_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+  q31_t * pDst)
+{
+  uint16_t *pColPtr = pSrcMat->pColPtr;          /* column offsets */
+  uint16_t *pRowIdx = pSrcMat->pRowIdx;          /* row indices */
+  q31_t *pData = pSrcMat->pData;                 /* stored values */
+  q31_t in;                                      /* input value of the column */
+  uint32_t col, e;                               /* loop counters */
+
+  arm_fill_q31(0, pDst, pSrcMat->numRows);
+
+  for (col = 0u; col < pSrcMat->numCols; col++)
+  {
+    in = pVec[col];
+
+    if(in != 0)
+    {
+      for (e = pColPtr[col]; e < pColPtr[col + 1u]; e++)
+      {
+        pDst[pRowIdx[e]] = __QADD(pDst[pRowIdx[e]],
+                                  (q31_t) (((q63_t) pData[e] * in) >> 32));
+      }
+    }
+  }
+
+  /* Convert the results from 2.30 to 1.31 format */
+  for (e = 0u; e < pSrcMat->numRows; e++)
+  {
+    pDst[e] = __QADD(pDst[e], pDst[e]);
+  }
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_csr_from_dense_f32.c
+*
+* Description:	Floating-point conversion of a full matrix to CSR sparse storage.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSparse Sparse Matrix Functions
+ *
+ * Jacobians and measurement matrices are often mostly zeros. The sparse matrix
+ * structures store only the non-zero entries, so products with them skip all
+ * the zero work.
+ *
+ * \par
+ * Two formats are provided. The compressed sparse row (CSR) structure
+ * <code>arm_matrix_csr_instance_f32</code> stores the entries row by row: the entries of
+ * row i are found at positions <code>pRowPtr[i]</code> to <code>pRowPtr[i+1]-1</code> of the
+ * <code>pColIdx</code> (column index) and <code>pData</code> (value) arrays.
+ * The compressed sparse column (CSC) structure <code>arm_matrix_csc_instance_f32</code>
+ * stores the entries column by column with <code>pColPtr</code> and <code>pRowIdx</code>.
+ * Indices are 16-bit, so a matrix holds at most 65535 stored entries.
+ * The same structures exist for Q31 data.
+ *
+ * \par
+ * CSR suits <code>y = A * x</code> with one accumulator per output value.
+ * CSC suits matrices that are built column by column, and matrices whose columns are
+ * mostly zero, since a column is skipped as a whole when its input value is zero.
+ *
+ * \par Sparsity pattern
+ * The pattern (offset and index arrays) is built once from a full matrix with
+ * <code>arm_mat_csr_from_dense_f32()</code> or <code>arm_mat_csc_from_dense_f32()</code>.
+ * When only the values change between updates, as for a linearized measurement model,
+ * <code>arm_mat_csr_gather_f32()</code> and <code>arm_mat_csc_gather_f32()</code> refresh the values
+ * using the stored pattern, without searching for the non-zero entries again.
+ * Several sparse matrices may share one pattern by pointing to the same offset and index arrays.
+ *
+ * \par
+ * The products <code>arm_mat_csr_mult_vec_f32()</code>, <code>arm_mat_csr_mult_f32()</code> and
+ * their CSC counterparts multiply a sparse matrix by a dense vector or a dense matrix.
+ * The output must not overlap the inputs.
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Floating-point conversion of a full matrix to CSR sparse storage.
+ * @param[in]       *pSrc points to the full input matrix structure
+ * @param[in,out]   *pDst points to the CSR sparse matrix structure
+ * @param[in]       maxNonZeros number of entries that the <code>pColIdx</code> and <code>pData</code> arrays can hold
+ * @return The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions differ,
+ * <code>ARM_MATH_LENGTH_ERROR</code> if the matrix has more than <code>maxNonZeros</code>
+ * non-zero entries, otherwise <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * Builds the sparsity pattern (<code>pRowPtr</code>, <code>pColIdx</code>) and copies the non-zero
+ * values, scanning the input row by row. The dimensions of the sparse structure must
+ * be set before the call.
+ */
+
+arm_status arm_mat_csr_from_dense_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_csr_instance_f32 * pDst,
+  uint16_t maxNonZeros)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  uint16_t numRows = pSrc->numRows;              /* number of rows */
+  uint16_t numCols = pSrc->numCols;              /* number of columns */
+  uint16_t *pRowPtr = pDst->pRowPtr;             /* row offsets */
+  uint16_t *pColIdx = pDst->pColIdx;             /* column indices */
+  float32_t *pData = pDst->pData;                /* stored values */
+  float32_t in;                                  /* temporary input value */
+  uint32_t nnz = 0u;                             /* number of stored entries */
+  uint16_t row, col;                             /* loop counters */
+  arm_status status;                             /* status of matrix conversion */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pDst->numRows) || (pSrc->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (row = 0u; row < numRows; row++)
+    {
+      /* First entry of this row */
+      pRowPtr[row] = (uint16_t) nnz;
+
+      for (col = 0u; col < numCols; col++)
+      {
+        in = pIn[(row * numCols) + col];
+
+        if(in != 0.0f)
+        {
+          if(nnz < maxNonZeros)
+          {
+            pColIdx[nnz] = col;
+            pData[nnz] = in;
+          }
+          else
+          {
+            status = ARM_MATH_LENGTH_ERROR;
+          }
+
+          nnz++;
+        }
+      }
+    }
+
+    /* End of the last row */
+    pRowPtr[numRows] = (uint16_t) nnz;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
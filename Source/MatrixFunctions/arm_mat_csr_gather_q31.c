@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_csr_gather_q31.c
+*
+* Description:	Q31 refresh of CSR sparse values from a full matrix.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Q31 refresh of CSR sparse values from a full matrix.
+ * @param[in]       *pSrc points to the full input matrix structure
+ * @param[in,out]   *pDst points to the CSR sparse matrix structure with a valid pattern
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * Copies the input values at the positions given by the existing sparsity pattern.
+ * The input is not searched for non-zero entries: values outside the pattern are ignored
+ * and stored positions keep their place even when their new value is zero.
+ */
+
+arm_status arm_mat_csr_gather_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_csr_instance_q31 * pDst)
+{
+  q31_t *pIn = pSrc->pData;                      /* input data matrix pointer */
+  uint16_t numCols = pSrc->numCols;              /* number of columns */
+  uint16_t *pRowPtr = pDst->pRowPtr;             /* row offsets */
+  uint16_t *pColIdx = pDst->pColIdx;             /* column indices */
+  q31_t *pData = pDst->pData;                    /* stored values */
+  uint32_t i, e;                                 /* loop counters */
+  arm_status status;                             /* status of matrix gather */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pDst->numRows) || (pSrc->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    for (i = 0u; i < pDst->numRows; i++)
+    {
+      for (e = pRowPtr[i]; e < pRowPtr[i + 1u]; e++)
+      {
+        pData[e] = pIn[(i * numCols) + pColIdx[e]];
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_csr_init_f32.c
+*
+* Description:	Floating-point CSR sparse matrix initialization.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixInit
+ * @{
+ */
+
+/**
+   * @brief  Floating-point CSR sparse matrix initialization.
+   * @param[in,out] *S             points to an instance of the floating-point CSR sparse matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pRowPtr	   points to the array of <code>nRows+1</code> row offsets.
+   * @param[in]     *pColIdx	   points to the array of column indices of the stored entries.
+   * @param[in]     *pData	   points to the array of values of the stored entries.
+   * @return        none
+   */
+
+void arm_mat_csr_init_f32(
+  arm_matrix_csr_instance_f32 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint16_t * pRowPtr,
+  uint16_t * pColIdx,
+  float32_t * pData)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Number of Columns */
+  S->numCols = nColumns;
+
+  /* Assign the sparsity pattern */
+  S->pRowPtr = pRowPtr;
+  S->pColIdx = pColIdx;
+
+  /* Assign Data pointer */
+  S->pData = pData;
+}
+
+/**
+ * @} end of MatrixInit group
+ */
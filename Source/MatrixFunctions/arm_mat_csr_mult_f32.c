@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_csr_mult_f32.c
+*
+* Description:	Floating-point CSR sparse matrix multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief  Adds a scaled row to another row: pDst[n] += scale * pSrc[n].
+ */
+
+static void arm_mat_csr_mult_row_f32(
+  float32_t scale,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    pDst[0] += scale * pSrc[0];
+    pDst[1] += scale * pSrc[1];
+    pDst[2] += scale * pSrc[2];
+    pDst[3] += scale * pSrc[3];
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ += scale * *pSrc++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief Floating-point CSR sparse matrix multiplication.
+ * @param[in]       *pSrcA points to the CSR sparse matrix structure of size <code>M x N</code>
+ * @param[in]       *pSrcB points to the full input matrix structure of size <code>N x P</code>
+ * @param[out]      *pDst points to the full output matrix structure of size <code>M x P</code>
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * Output row i is the sum of the rows of B selected by the column indices of the stored
+ * entries of row i, each scaled by its entry. Rows of A without entries produce zero rows.
+ */
+
+arm_status arm_mat_csr_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  uint16_t *pRowPtr = pSrcA->pRowPtr;            /* row offsets */
+  uint16_t *pColIdx = pSrcA->pColIdx;            /* column indices */
+  float32_t *pData = pSrcA->pData;               /* stored values */
+  float32_t *pOut;                               /* output row */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of B */
+  uint32_t row, e;                               /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    for (row = 0u; row < pSrcA->numRows; row++)
+    {
+      pOut = pDst->pData + (row * numColsB);
+
+      arm_fill_f32(0.0f, pOut, numColsB);
+
+      for (e = pRowPtr[row]; e < pRowPtr[row + 1u]; e++)
+      {
+        arm_mat_csr_mult_row_f32(pData[e], pSrcB->pData + (pColIdx[e] * numColsB),
+                                 pOut, numColsB);
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_csr_mult_q31.c
+*
+* Description:	Q31 CSR sparse matrix multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Q31 CSR sparse matrix multiplication.
+ * @param[in]       *pSrcA points to the CSR sparse matrix structure of size <code>M x N</code>
+ * @param[in]       *pSrcB points to the full input matrix structure of size <code>N x P</code>
+ * @param[out]      *pDst points to the full output matrix structure of size <code>M x P</code>
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Every output value is accumulated over the stored entries of its row in a 64-bit
+ * accumulator of 2.62 format, as in <code>arm_mat_mult_q31()</code>. The accumulator is right
+ * shifted by 31 bits and saturated to 1.31 format.
+ */
+
+arm_status arm_mat_csr_mult_q31(
+  const arm_matrix_csr_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst)
+{
+  uint16_t *pRowPtr = pSrcA->pRowPtr;            /* row offsets */
+  uint16_t *pColIdx = pSrcA->pColIdx;            /* column indices */
+  q31_t *pData = pSrcA->pData;                   /* stored values */
+  q31_t *pIn = pSrcB->pData;                     /* input matrix B */
+  q31_t *pOut = pDst->pData;                     /* output matrix */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of B */
+  q63_t sum;                                     /* accumulator */
+  uint32_t row, col, e;                          /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    for (row = 0u; row < pSrcA->numRows; row++)
+    {
+      for (col = 0u; col < numColsB; col++)
+      {
+        sum = 0;
+
+        /* Walk the stored entries of the row down the selected rows of B */
+        for (e = pRowPtr[row]; e < pRowPtr[row + 1u]; e++)
+        {
+          sum += (q63_t) pData[e] * pIn[(pColIdx[e] * numColsB) + col];
+        }
+
+        /* Convert the result from 2.62 to 1.31 format and store */
+        *pOut++ = clip_q63_to_q31(sum >> 31);
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
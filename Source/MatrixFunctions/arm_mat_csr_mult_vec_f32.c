@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_csr_mult_vec_f32.c
+*
+* Description:	Floating-point CSR sparse matrix-vector multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Floating-point CSR sparse matrix-vector multiplication.
+ * @param[in]       *pSrcMat points to the CSR sparse matrix structure of size <code>M x N</code>
+ * @param[in]       *pVec points to the input vector of <code>N</code> values
+ * @param[out]      *pDst points to the output vector of <code>M</code> values
+ * @return none.
+ *
+ * Every output value is the dot product of the stored entries of one row
+ * with the input values selected by their column indices.
+ */
+
+void arm_mat_csr_mult_vec_f32(
+  const arm_matrix_csr_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  uint16_t *pColIdx = pSrcMat->pColIdx;          /* column indices */
+  float32_t *pData = pSrcMat->pData;             /* stored values */
+  float32_t sum;                                 /* accumulator */
+  uint32_t row;                                  /* row loop counter */
+  uint32_t blkCnt;                               /* loop counter */
+
+  for (row = 0u; row < pSrcMat->numRows; row++)
+  {
+    sum = 0.0f;
+
+    /* Loop unrolling */
+    blkCnt = ((uint32_t) pSrcMat->pRowPtr[row + 1u] - pSrcMat->pRowPtr[row]);
+
+    while(blkCnt >= 4u)
+    {
+      sum += pData[0] * pVec[pColIdx[0]];
+      sum += pData[1] * pVec[pColIdx[1]];
+      sum += pData[2] * pVec[pColIdx[2]];
+      sum += pData[3] * pVec[pColIdx[3]];
+
+      pData += 4u;
+      pColIdx += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt -= 4u;
+    }
+
+    while(blkCnt > 0u)
+    {
+      sum += *pData++ * pVec[*pColIdx++];
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    *pDst++ = sum;
+  }
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
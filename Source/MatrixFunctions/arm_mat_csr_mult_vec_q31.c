@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_csr_mult_vec_q31.c
+*
+* Description:	Q31 CSR sparse matrix-vector multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Q31 CSR sparse matrix-vector multiplication.
+ * @param[in]       *pSrcMat points to the CSR sparse matrix structure of size <code>M x N</code>
+ * @param[in]       *pVec points to the input vector of <code>N</code> values
+ * @param[out]      *pDst points to the output vector of <code>M</code> values
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each row is accumulated in a 64-bit accumulator of 2.62 format, as in <code>arm_mat_mult_q31()</code>.
+ * Only the stored entries of a row are added, so the inputs need to be scaled down by
+ * log2 of the largest number of entries in a row rather than by log2 of the number of columns.
+ * The accumulator is right shifted by 31 bits and saturated to 1.31 format.
+ */
+
+void arm_mat_csr_mult_vec_q31(
+  const arm_matrix_csr_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+  q31_t * pDst)
+{
+  uint16_t *pColIdx = pSrcMat->pColIdx;          /* column indices */
+  q31_t *pData = pSrcMat->pData;                 /* stored values */
+  q63_t sum;                                     /* accumulator */
+  uint32_t row;                                  /* row loop counter */
+  uint32_t blkCnt;                               /* loop counter */
+
+  for (row = 0u; row < pSrcMat->numRows; row++)
+  {
+    sum = 0;
+
+    /* Loop unrolling */
+    blkCnt = ((uint32_t) pSrcMat->pRowPtr[row + 1u] - pSrcMat->pRowPtr[row]);
+
+    while(blkCnt >= 4u)
+    {
+      sum += (q63_t) pData[0] * pVec[pColIdx[0]];
+      sum += (q63_t) pData[1] * pVec[pColIdx[1]];
+      sum += (q63_t) pData[2] * pVec[pColIdx[2]];
+      sum += (q63_t) pData[3] * pVec[pColIdx[3]];
+
+      pData += 4u;
+      pColIdx += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt -= 4u;
+    }
+
+    while(blkCnt > 0u)
+    {
+      sum += (q63_t) * pData++ * pVec[*pColIdx++];
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Convert the result from 2.62 to 1.31 format and store */
+    *pDst++ = clip_q63_to_q31(sum >> 31);
+  }
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
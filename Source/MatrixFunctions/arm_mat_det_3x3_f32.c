@@ -0,0 +1,49 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_det_3x3_f32.c
+*
+* Description:	Floating-point 3x3 matrix determinant.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixFixedSize
+ * @{
+ */
+
+/**
+ * @brief Floating-point 3x3 matrix determinant.
+ * @param[in]       *pSrc points to the input matrix (9 values, row order)
+ * @return The determinant of the matrix.
+ *
+ * The determinant is expanded along the first row.
+ */
+
+float32_t arm_mat_det_3x3_f32(
+  const float32_t * pSrc)
+{
+  float32_t c0, c1, c2;                          /* Cofactors of the first row */
+
+  c0 = (pSrc[4] * pSrc[8]) - (pSrc[5] * pSrc[7]);
+  c1 = (pSrc[5] * pSrc[6]) - (pSrc[3] * pSrc[8]);
+  c2 = (pSrc[3] * pSrc[7]) - (pSrc[4] * pSrc[6]);
+
+  return ((pSrc[0] * c0) + (pSrc[1] * c1) + (pSrc[2] * c2));
+}
+
+/**
+ * @} end of MatrixFixedSize group
+ */
@@ -0,0 +1,64 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_det_4x4_f32.c
+*
+* Description:	Floating-point 4x4 matrix determinant.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixFixedSize
+ * @{
+ */
+
+/**
+ * @brief Floating-point 4x4 matrix determinant.
+ * @param[in]       *pSrc points to the input matrix (16 values, row order)
+ * @return The determinant of the matrix.
+ *
+ * \par
+ * The determinant is computed with the Laplace expansion by complementary minors:
+ * the six 2 x 2 minors of the upper two rows are paired with the six 2 x 2 minors
+ * of the lower two rows, which needs 30 multiplications instead of the 40 of a
+ * cofactor expansion.
+ */
+
+float32_t arm_mat_det_4x4_f32(
+  const float32_t * pSrc)
+{
+  float32_t s0, s1, s2, s3, s4, s5;              /* 2x2 minors of rows 0 and 1 */
+  float32_t c0, c1, c2, c3, c4, c5;              /* 2x2 minors of rows 2 and 3 */
+
+  s0 = (pSrc[0] * pSrc[5]) - (pSrc[4] * pSrc[1]);
+  s1 = (pSrc[0] * pSrc[6]) - (pSrc[4] * pSrc[2]);
+  s2 = (pSrc[0] * pSrc[7]) - (pSrc[4] * pSrc[3]);
+  s3 = (pSrc[1] * pSrc[6]) - (pSrc[5] * pSrc[2]);
+  s4 = (pSrc[1] * pSrc[7]) - (pSrc[5] * pSrc[3]);
+  s5 = (pSrc[2] * pSrc[7]) - (pSrc[6] * pSrc[3]);
+
+  c0 = (pSrc[8] * pSrc[13]) - (pSrc[12] * pSrc[9]);
+  c1 = (pSrc[8] * pSrc[14]) - (pSrc[12] * pSrc[10]);
+  c2 = (pSrc[8] * pSrc[15]) - (pSrc[12] * pSrc[11]);
+  c3 = (pSrc[9] * pSrc[14]) - (pSrc[13] * pSrc[10]);
+  c4 = (pSrc[9] * pSrc[15]) - (pSrc[13] * pSrc[11]);
+  c5 = (pSrc[10] * pSrc[15]) - (pSrc[14] * pSrc[11]);
+
+  return ((s0 * c5) - (s1 * c4) + (s2 * c3) + (s3 * c2) - (s4 * c1) + (s5 * c0));
+}
+
+/**
+ * @} end of MatrixFixedSize group
+ */
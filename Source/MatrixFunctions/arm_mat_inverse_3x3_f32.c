@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_inverse_3x3_f32.c
+*
+* Description:	Floating-point 3x3 matrix inverse.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixFixedSize
+ * @{
+ */
+
+/**
+ * @brief Floating-point 3x3 matrix inverse.
+ * @param[in]       *pSrc points to the input matrix (9 values, row order)
+ * @param[out]      *pDst points to the output matrix (9 values, row order)
+ * @return The function returns
+ * <code>ARM_MATH_SINGULAR</code> if the determinant is zero, otherwise <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The inverse is the adjugate (transposed cofactor matrix) scaled by the reciprocal
+ * of the determinant, so a single division is performed.
+ * The destination is not written when the matrix is singular.
+ * The destination may be the same array as the source.
+ */
+
+arm_status arm_mat_inverse_3x3_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t a00, a01, a02, a10, a11, a12, a20, a21, a22;        /* Input matrix held in registers */
+  float32_t c00, c01, c02;                       /* Cofactors of the first row */
+  float32_t det, invDet;                         /* Determinant and its reciprocal */
+  arm_status status;                             /* status of matrix inverse */
+
+  a00 = pSrc[0];
+  a01 = pSrc[1];
+  a02 = pSrc[2];
+  a10 = pSrc[3];
+  a11 = pSrc[4];
+  a12 = pSrc[5];
+  a20 = pSrc[6];
+  a21 = pSrc[7];
+  a22 = pSrc[8];
+
+  /* The cofactors of the first row give the determinant and the first column of the inverse */
+  c00 = (a11 * a22) - (a12 * a21);
+  c01 = (a12 * a20) - (a10 * a22);
+  c02 = (a10 * a21) - (a11 * a20);
+
+  det = (a00 * c00) + (a01 * c01) + (a02 * c02);
+
+  if(det == 0.0f)
+  {
+    status = ARM_MATH_SINGULAR;
+  }
+  else
+  {
+    invDet = 1.0f / det;
+
+    pDst[0] = c00 * invDet;
+    pDst[1] = ((a02 * a21) - (a01 * a22)) * invDet;
+    pDst[2] = ((a01 * a12) - (a02 * a11)) * invDet;
+    pDst[3] = c01 * invDet;
+    pDst[4] = ((a00 * a22) - (a02 * a20)) * invDet;
+    pDst[5] = ((a02 * a10) - (a00 * a12)) * invDet;
+    pDst[6] = c02 * invDet;
+    pDst[7] = ((a01 * a20) - (a00 * a21)) * invDet;
+    pDst[8] = ((a00 * a11) - (a01 * a10)) * invDet;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixFixedSize group
+ */
@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_inverse_4x4_f32.c
+*
+* Description:	Floating-point 4x4 matrix inverse.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixFixedSize
+ * @{
+ */
+
+/**
+ * @brief Floating-point 4x4 matrix inverse.
+ * @param[in]       *pSrc points to the input matrix (16 values, row order)
+ * @param[out]      *pDst points to the output matrix (16 values, row order)
+ * @return The function returns
+ * <code>ARM_MATH_SINGULAR</code> if the determinant is zero, otherwise <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The six 2 x 2 minors of the upper two rows and the six 2 x 2 minors of the lower
+ * two rows are computed once; the determinant and every cofactor of the adjugate are
+ * built from them, followed by a single division.
+ * The destination is not written when the matrix is singular.
+ * The destination may be the same array as the source.
+ */
+
+arm_status arm_mat_inverse_4x4_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t a00, a01, a02, a03, a10, a11, a12, a13;     /* Input matrix held in registers */
+  float32_t a20, a21, a22, a23, a30, a31, a32, a33;
+  float32_t s0, s1, s2, s3, s4, s5;              /* 2x2 minors of rows 0 and 1 */
+  float32_t c0, c1, c2, c3, c4, c5;              /* 2x2 minors of rows 2 and 3 */
+  float32_t det, invDet;                         /* Determinant and its reciprocal */
+  arm_status status;                             /* status of matrix inverse */
+
+  a00 = pSrc[0];
+  a01 = pSrc[1];
+  a02 = pSrc[2];
+  a03 = pSrc[3];
+  a10 = pSrc[4];
+  a11 = pSrc[5];
+  a12 = pSrc[6];
+  a13 = pSrc[7];
+  a20 = pSrc[8];
+  a21 = pSrc[9];
+  a22 = pSrc[10];
+  a23 = pSrc[11];
+  a30 = pSrc[12];
+  a31 = pSrc[13];
+  a32 = pSrc[14];
+  a33 = pSrc[15];
+
+  s0 = (a00 * a11) - (a10 * a01);
+  s1 = (a00 * a12) - (a10 * a02);
+  s2 = (a00 * a13) - (a10 * a03);
+  s3 = (a01 * a12) - (a11 * a02);
+  s4 = (a01 * a13) - (a11 * a03);
+  s5 = (a02 * a13) - (a12 * a03);
+
+  c0 = (a20 * a31) - (a30 * a21);
+  c1 = (a20 * a32) - (a30 * a22);
+  c2 = (a20 * a33) - (a30 * a23);
+  c3 = (a21 * a32) - (a31 * a22);
+  c4 = (a21 * a33) - (a31 * a23);
+  c5 = (a22 * a33) - (a32 * a23);
+
+  det = (s0 * c5) - (s1 * c4) + (s2 * c3) + (s3 * c2) - (s4 * c1) + (s5 * c0);
+
+  if(det == 0.0f)
+  {
+    status = ARM_MATH_SINGULAR;
+  }
+  else
+  {
+    invDet = 1.0f / det;
+
+    pDst[0] = ((a11 * c5) - (a12 * c4) + (a13 * c3)) * invDet;
+    pDst[1] = ((a02 * c4) - (a01 * c5) - (a03 * c3)) * invDet;
+    pDst[2] = ((a31 * s5) - (a32 * s4) + (a33 * s3)) * invDet;
+    pDst[3] = ((a22 * s4) - (a21 * s5) - (a23 * s3)) * invDet;
+
+    pDst[4] = ((a12 * c2) - (a10 * c5) - (a13 * c1)) * invDet;
+    pDst[5] = ((a00 * c5) - (a02 * c2) + (a03 * c1)) * invDet;
+    pDst[6] = ((a32 * s2) - (a30 * s5) - (a33 * s1)) * invDet;
+    pDst[7] = ((a20 * s5) - (a22 * s2) + (a23 * s1)) * invDet;
+
+    pDst[8] = ((a10 * c4) - (a11 * c2) + (a13 * c0)) * invDet;
+    pDst[9] = ((a01 * c2) - (a00 * c4) - (a03 * c0)) * invDet;
+    pDst[10] = ((a30 * s4) - (a31 * s2) + (a33 * s0)) * invDet;
+    pDst[11] = ((a21 * s2) - (a20 * s4) - (a23 * s0)) * invDet;
+
+    pDst[12] = ((a11 * c1) - (a10 * c3) - (a12 * c0)) * invDet;
+    pDst[13] = ((a00 * c3) - (a01 * c1) + (a02 * c0)) * invDet;
+    pDst[14] = ((a31 * s1) - (a30 * s3) - (a32 * s0)) * invDet;
+    pDst[15] = ((a20 * s3) - (a21 * s1) + (a22 * s0)) * invDet;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixFixedSize group
+ */
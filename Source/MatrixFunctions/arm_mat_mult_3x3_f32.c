@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_mult_3x3_f32.c
+*
+* Description:	Floating-point 3x3 matrix multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixFixedSize Fixed-Size Matrix Functions
+ *
+ * Fully unrolled kernels for 3 x 3 and 4 x 4 floating-point matrices as used by
+ * attitude determination code (direction cosine matrices, covariance blocks,
+ * homogeneous transforms).
+ *
+ * \par
+ * The generic matrix functions carry loop counters, size checking and the
+ * <code>arm_matrix_instance_f32</code> indirection which dominate the cost for
+ * such small operands. The fixed-size kernels instead take plain arrays of 9 or 16
+ * values stored in row order, perform no size checking and compute every output
+ * element with straight-line code.
+ *
+ * \par
+ * The following kernels are provided for both sizes:
+ * - <code>arm_mat_mult_NxN_f32()</code>: <code>C = A * B</code>.
+ * - <code>arm_mat_trans_mult_NxN_f32()</code>: <code>C = A' * B</code>, without forming the transpose.
+ * - <code>arm_mat_vec_mult_NxN_f32()</code>: <code>y = A * x</code>.
+ * - <code>arm_mat_det_NxN_f32()</code>: determinant.
+ * - <code>arm_mat_inverse_NxN_f32()</code>: inverse computed from the adjugate.
+ *
+ * \par
+ * Unless stated otherwise for a function, the destination may be the same
+ * array as one of the sources.
+ */
+
+/**
+ * @addtogroup MatrixFixedSize
+ * @{
+ */
+
+/**
+ * @brief Floating-point 3x3 matrix multiplication.
+ * @param[in]       *pSrcA points to the first input matrix (9 values, row order)
+ * @param[in]       *pSrcB points to the second input matrix (9 values, row order)
+ * @param[out]      *pDst points to the output matrix (9 values, row order)
+ * @return none.
+ *
+ * The destination may be the same array as <code>pSrcA</code> or <code>pSrcB</code>.
+ */
+
+void arm_mat_mult_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  float32_t b00, b01, b02, b10, b11, b12, b20, b21, b22;        /* Second matrix held in registers */
+  float32_t a0, a1, a2;                          /* Current row of the first matrix */
+
+  /* Load the second matrix once, it is used by every output row */
+  b00 = pSrcB[0];
+  b01 = pSrcB[1];
+  b02 = pSrcB[2];
+  b10 = pSrcB[3];
+  b11 = pSrcB[4];
+  b12 = pSrcB[5];
+  b20 = pSrcB[6];
+  b21 = pSrcB[7];
+  b22 = pSrcB[8];
+
+  /* Row 0: the row of A is read before the same row of the destination is written */
+  a0 = pSrcA[0];
+  a1 = pSrcA[1];
+  a2 = pSrcA[2];
+  pDst[0] = (a0 * b00) + (a1 * b10) + (a2 * b20);
+  pDst[1] = (a0 * b01) + (a1 * b11) + (a2 * b21);
+  pDst[2] = (a0 * b02) + (a1 * b12) + (a2 * b22);
+
+  /* Row 1 */
+  a0 = pSrcA[3];
+  a1 = pSrcA[4];
+  a2 = pSrcA[5];
+  pDst[3] = (a0 * b00) + (a1 * b10) + (a2 * b20);
+  pDst[4] = (a0 * b01) + (a1 * b11) + (a2 * b21);
+  pDst[5] = (a0 * b02) + (a1 * b12) + (a2 * b22);
+
+  /* Row 2 */
+  a0 = pSrcA[6];
+  a1 = pSrcA[7];
+  a2 = pSrcA[8];
+  pDst[6] = (a0 * b00) + (a1 * b10) + (a2 * b20);
+  pDst[7] = (a0 * b01) + (a1 * b11) + (a2 * b21);
+  pDst[8] = (a0 * b02) + (a1 * b12) + (a2 * b22);
+}
+
+/**
+ * @} end of MatrixFixedSize group
+ */
@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_mult_4x4_f32.c
+*
+* Description:	Floating-point 4x4 matrix multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixFixedSize
+ * @{
+ */
+
+/**
+ * @brief Floating-point 4x4 matrix multiplication.
+ * @param[in]       *pSrcA points to the first input matrix (16 values, row order)
+ * @param[in]       *pSrcB points to the second input matrix (16 values, row order)
+ * @param[out]      *pDst points to the output matrix (16 values, row order)
+ * @return none.
+ *
+ * The destination may be the same array as <code>pSrcA</code> or <code>pSrcB</code>.
+ */
+
+void arm_mat_mult_4x4_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  float32_t b00, b01, b02, b03, b10, b11, b12, b13;     /* Second matrix held in registers */
+  float32_t b20, b21, b22, b23, b30, b31, b32, b33;
+  float32_t a0, a1, a2, a3;                      /* Current row of the first matrix */
+
+  /* Load the second matrix once, it is used by every output row */
+  b00 = pSrcB[0];
+  b01 = pSrcB[1];
+  b02 = pSrcB[2];
+  b03 = pSrcB[3];
+  b10 = pSrcB[4];
+  b11 = pSrcB[5];
+  b12 = pSrcB[6];
+  b13 = pSrcB[7];
+  b20 = pSrcB[8];
+  b21 = pSrcB[9];
+  b22 = pSrcB[10];
+  b23 = pSrcB[11];
+  b30 = pSrcB[12];
+  b31 = pSrcB[13];
+  b32 = pSrcB[14];
+  b33 = pSrcB[15];
+
+  /* Row 0: the row of A is read before the same row of the destination is written */
+  a0 = pSrcA[0];
+  a1 = pSrcA[1];
+  a2 = pSrcA[2];
+  a3 = pSrcA[3];
+  pDst[0] = (a0 * b00) + (a1 * b10) + (a2 * b20) + (a3 * b30);
+  pDst[1] = (a0 * b01) + (a1 * b11) + (a2 * b21) + (a3 * b31);
+  pDst[2] = (a0 * b02) + (a1 * b12) + (a2 * b22) + (a3 * b32);
+  pDst[3] = (a0 * b03) + (a1 * b13) + (a2 * b23) + (a3 * b33);
+
+  /* Row 1 */
+  a0 = pSrcA[4];
+  a1 = pSrcA[5];
+  a2 = pSrcA[6];
+  a3 = pSrcA[7];
+  pDst[4] = (a0 * b00) + (a1 * b10) + (a2 * b20) + (a3 * b30);
+  pDst[5] = (a0 * b01) + (a1 * b11) + (a2 * b21) + (a3 * b31);
+  pDst[6] = (a0 * b02) + (a1 * b12) + (a2 * b22) + (a3 * b32);
+  pDst[7] = (a0 * b03) + (a1 * b13) + (a2 * b23) + (a3 * b33);
+
+  /* Row 2 */
+  a0 = pSrcA[8];
+  a1 = pSrcA[9];
+  a2 = pSrcA[10];
+  a3 = pSrcA[11];
+  pDst[8] = (a0 * b00) + (a1 * b10) + (a2 * b20) + (a3 * b30);
+  pDst[9] = (a0 * b01) + (a1 * b11) + (a2 * b21) + (a3 * b31);
+  pDst[10] = (a0 * b02) + (a1 * b12) + (a2 * b22) + (a3 * b32);
+  pDst[11] = (a0 * b03) + (a1 * b13) + (a2 * b23) + (a3 * b33);
+
+  /* Row 3 */
+  a0 = pSrcA[12];
+  a1 = pSrcA[13];
+  a2 = pSrcA[14];
+  a3 = pSrcA[15];
+  pDst[12] = (a0 * b00) + (a1 * b10) + (a2 * b20) + (a3 * b30);
+  pDst[13] = (a0 * b01) + (a1 * b11) + (a2 * b21) + (a3 * b31);
+  pDst[14] = (a0 * b02) + (a1 * b12) + (a2 * b22) + (a3 * b32);
+  pDst[15] = (a0 * b03) + (a1 * b13) + (a2 * b23) + (a3 * b33);
+}
+
+/**
+ * @} end of MatrixFixedSize group
+ */
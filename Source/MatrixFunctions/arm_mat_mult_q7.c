@@ -0,0 +1,220 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_mult_q7.c
+*
+* Description:	Q7 matrix multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Q7 matrix multiplication
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @param[in]       *pScratch points to scratch buffer of size numRowsB * numColsB
+ * @return          The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par Conditions for optimum performance
+ *  Input, output and scratch buffers should be aligned by 32-bit and numColsA should be a multiple of 4
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using a 32-bit internal accumulator. The inputs to the
+ * multiplications are in 1.7 format and multiplications yield a 2.14 result.
+ * The 2.14 intermediate results are accumulated in a 32-bit accumulator in 18.14 format,
+ * as in <code>arm_dot_prod_q7()</code>, so there is no risk of overflow for numColsA
+ * below 131072. The 18.14 result is then truncated to 18.7 format by discarding the
+ * low 7 bits and then saturated to 1.7 format.
+ *
+ * \par
+ * Matrix B is first transposed into the scratch buffer so that both operands of each
+ * output are read as contiguous rows, four q7 samples per 32-bit load.
+ * Two output columns are computed per pass and share the sign extension of matrix A.
+ */
+
+arm_status arm_mat_mult_q7(
+  const arm_matrix_instance_q7 * pSrcA,
+  const arm_matrix_instance_q7 * pSrcB,
+  arm_matrix_instance_q7 * pDst,
+  q7_t * pScratch)
+{
+  q7_t *pInA = pSrcA->pData;                     /* input data matrix pointer A */
+  q7_t *pInB = pSrcB->pData;                     /* input data matrix pointer B */
+  q7_t *pOut = pDst->pData;                      /* output data matrix pointer */
+  q7_t *pA;                                      /* row pointer of matrix A */
+  q7_t *pB0, *pB1;                               /* row pointers of the transposed matrix B */
+  q7_t *px;                                      /* transpose pointer */
+  uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint16_t numRowsB = pSrcB->numRows;            /* number of rows of input matrix B */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  q31_t sum0, sum1;                              /* accumulators */
+  q31_t inA, inB0, inB1;                         /* four samples of each operand */
+  q31_t a13, a02;                                /* odd and even samples of matrix A */
+  uint32_t row, col, colCnt, i;                  /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    /* Matrix transpose: the columns of B become the rows of the scratch buffer */
+    for (i = 0u; i < numRowsB; i++)
+    {
+      px = pScratch + i;
+      col = numColsB;
+
+      while(col > 0u)
+      {
+        *px = *pInB++;
+        px += numRowsB;
+
+        /* Decrement the loop counter */
+        col--;
+      }
+    }
+
+    row = numRowsA;
+
+    do
+    {
+      pB0 = pScratch;
+
+      /* Two output columns at a time */
+      col = (uint32_t) numColsB >> 1u;
+
+      while(col > 0u)
+      {
+        pA = pInA;
+        pB1 = pB0 + numColsA;
+
+        sum0 = 0;
+        sum1 = 0;
+
+        /* Four samples at a time */
+        colCnt = (uint32_t) numColsA >> 2u;
+
+        while(colCnt > 0u)
+        {
+          inA = *__SIMD32(pA)++;
+          inB0 = *__SIMD32(pB0)++;
+          inB1 = *__SIMD32(pB1)++;
+
+#ifdef CCS
+
+          /* extract the odd and the even q7_t samples to q15_t samples */
+          a13 = __SXTB16(inA, 8);
+          a02 = __SXTB16(inA, 0);
+
+          sum0 = __SMLAD(a13, __SXTB16(inB0, 8), sum0);
+          sum1 = __SMLAD(a13, __SXTB16(inB1, 8), sum1);
+          sum0 = __SMLAD(a02, __SXTB16(inB0, 0), sum0);
+          sum1 = __SMLAD(a02, __SXTB16(inB1, 0), sum1);
+
+#else
+
+          /* extract the odd and the even q7_t samples to q15_t samples */
+          a13 = __SXTB16(__ROR(inA, 8));
+          a02 = __SXTB16(inA);
+
+          sum0 = __SMLAD(a13, __SXTB16(__ROR(inB0, 8)), sum0);
+          sum1 = __SMLAD(a13, __SXTB16(__ROR(inB1, 8)), sum1);
+          sum0 = __SMLAD(a02, __SXTB16(inB0), sum0);
+          sum1 = __SMLAD(a02, __SXTB16(inB1), sum1);
+
+#endif
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Remaining 1 to 3 samples */
+        colCnt = (uint32_t) numColsA % 0x4u;
+
+        while(colCnt > 0u)
+        {
+          inA = *pA++;
+          sum0 += (q15_t) inA * *pB0++;
+          sum1 += (q15_t) inA * *pB1++;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Convert the results from 18.14 to 1.7 format and store */
+        pOut[0] = (q7_t) __SSAT(sum0 >> 7, 8);
+        pOut[1] = (q7_t) __SSAT(sum1 >> 7, 8);
+        pOut += 2u;
+
+        /* The next pair of columns starts after the second row of this one */
+        pB0 = pB1;
+
+        /* Decrement the loop counter */
+        col--;
+      }
+
+      /* Last column of an odd numColsB */
+      if((numColsB & 0x1u) != 0u)
+      {
+        pA = pInA;
+        sum0 = 0;
+        colCnt = numColsA;
+
+        while(colCnt > 0u)
+        {
+          sum0 += (q15_t) * pA++ * *pB0++;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        *pOut++ = (q7_t) __SSAT(sum0 >> 7, 8);
+      }
+
+      /* Move to the next row of matrix A */
+      pInA += numColsA;
+
+      /* Decrement the row loop counter */
+      row--;
+
+    } while(row > 0u);
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
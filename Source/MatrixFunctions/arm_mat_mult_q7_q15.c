@@ -0,0 +1,408 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_mult_q7_q15.c
+*
+* Description:	Q7 by Q15 matrix multiplication with Q31 accumulators.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixMultQ7Q15 Mixed-precision Matrix Multiplication
+ *
+ * Multiplies a Q7 weight matrix by a Q15 activation matrix and returns
+ * the raw 32-bit accumulators, which are then converted back to Q7 or Q15
+ * with a separate scale factor for each row (output channel):
+ *
+ * <pre>
+ *     arm_mat_reorder_q7(&W, &W);                      (once, when the weights are loaded)
+ *     arm_mat_mult_q7_q15(&W, &X, &Acc, pScratch);
+ *     arm_mat_requantize_q15(&Acc, pMult, pShift, &Y);
+ * </pre>
+ *
+ * The weights are stored in a blocked layout produced by <code>arm_mat_reorder_q7()</code>:
+ * the middle two samples of every block of four are swapped, so that the two halfword
+ * sign extensions of a 32-bit load give the samples in natural order. One 32-bit weight
+ * load then feeds two dual 16-bit multiply-accumulates without repacking the activations.
+ * The layout is the same for big-endian builds, where the two sign extensions of a
+ * load swap roles.
+ *
+ * The requantization of row <code>i</code> computes:
+ * <pre>
+ *     pDst[i][j] = sat((pSrc[i][j] * pMult[i]) >> (31 - pShift[i]))
+ * </pre>
+ * with rounding to nearest. <code>pMult[i]</code> is a Q31 fraction and <code>pShift[i]</code>
+ * a left shift in the range -31 to 30, so the overall scale factor is <code>pMult[i] * 2^pShift[i]</code>.
+ */
+
+/**
+ * @addtogroup MatrixMultQ7Q15
+ * @{
+ */
+
+/**
+ * @brief Q7 by Q15 matrix multiplication with Q31 accumulators.
+ * @param[in]       *pSrcA points to the Q7 weight matrix structure, in the layout of <code>arm_mat_reorder_q7()</code>
+ * @param[in]       *pSrcB points to the Q15 activation matrix structure
+ * @param[out]      *pDst points to the Q31 accumulator matrix structure
+ * @param[in]       *pScratch points to scratch buffer of size numRowsB * numColsB
+ * @return          The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par Conditions for optimum performance
+ *  Input, output and scratch buffers should be aligned by 32-bit and numColsA should be a multiple of 4
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The 1.7 by 1.15 products are in 2.22 format and are accumulated in a 32-bit
+ * accumulator of 10.22 format, which is written to the output without any shift.
+ * There is no risk of overflow as long as numColsA is at most 511:
+ * 512 products of -128 by -32768 add up to exactly 2^31.
+ *
+ * \par
+ * Matrix B is first transposed into the scratch buffer. The outputs are computed in
+ * blocks of two rows by two columns, so each weight load is shared by two columns
+ * and each activation load by two rows.
+ */
+
+arm_status arm_mat_mult_q7_q15(
+  const arm_matrix_instance_q7 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q31 * pDst,
+  q15_t * pScratch)
+{
+  arm_matrix_instance_q15 BT;                    /* transposed matrix B in the scratch buffer */
+  q7_t *pInA = pSrcA->pData;                     /* input data matrix pointer A */
+  q31_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  q7_t *pA0, *pA1;                               /* row pointers of matrix A */
+  q15_t *pB0, *pB1;                              /* row pointers of the transposed matrix B */
+  uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  q31_t sum00, sum01, sum10, sum11;              /* accumulators */
+  q31_t inA0, inA1;                              /* four weights of each row */
+  q31_t a01, a23, a45, a67;                      /* sign extended weight pairs */
+  q31_t b01, b23, b45, b67;                      /* activation pairs */
+  q15_t b0, b1;                                  /* single activations */
+  uint32_t row, col, colCnt;                     /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    /* Matrix transpose: the columns of B become the rows of the scratch buffer */
+    arm_mat_init_q15(&BT, numColsB, pSrcB->numRows, pScratch);
+    arm_mat_trans_q15(pSrcB, &BT);
+
+    /* Two rows of matrix A at a time */
+    row = (uint32_t) numRowsA >> 1u;
+
+    while(row > 0u)
+    {
+      pB0 = pScratch;
+
+      /* Two columns of matrix B at a time */
+      col = (uint32_t) numColsB >> 1u;
+
+      while(col > 0u)
+      {
+        pA0 = pInA;
+        pA1 = pInA + numColsA;
+        pB1 = pB0 + numColsA;
+
+        sum00 = 0;
+        sum01 = 0;
+        sum10 = 0;
+        sum11 = 0;
+
+        /* Four samples at a time */
+        colCnt = (uint32_t) numColsA >> 2u;
+
+        while(colCnt > 0u)
+        {
+          inA0 = *__SIMD32(pA0)++;
+          inA1 = *__SIMD32(pA1)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+          /* the reordered layout gives the weights in natural order */
+#ifdef CCS
+
+          a01 = __SXTB16(inA0, 0);
+          a23 = __SXTB16(inA0, 8);
+          a45 = __SXTB16(inA1, 0);
+          a67 = __SXTB16(inA1, 8);
+
+#else
+
+          a01 = __SXTB16(inA0);
+          a23 = __SXTB16(__ROR(inA0, 8));
+          a45 = __SXTB16(inA1);
+          a67 = __SXTB16(__ROR(inA1, 8));
+
+#endif
+
+#else
+
+          /* on big-endian the odd bytes of the load hold the first two weights */
+#ifdef CCS
+
+          a01 = __SXTB16(inA0, 8);
+          a23 = __SXTB16(inA0, 0);
+          a45 = __SXTB16(inA1, 8);
+          a67 = __SXTB16(inA1, 0);
+
+#else
+
+          a01 = __SXTB16(__ROR(inA0, 8));
+          a23 = __SXTB16(inA0);
+          a45 = __SXTB16(__ROR(inA1, 8));
+          a67 = __SXTB16(inA1);
+
+#endif
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+          b01 = *__SIMD32(pB0)++;
+          b23 = *__SIMD32(pB0)++;
+          b45 = *__SIMD32(pB1)++;
+          b67 = *__SIMD32(pB1)++;
+
+          sum00 = __SMLAD(a01, b01, sum00);
+          sum01 = __SMLAD(a01, b45, sum01);
+          sum10 = __SMLAD(a45, b01, sum10);
+          sum11 = __SMLAD(a45, b45, sum11);
+
+          sum00 = __SMLAD(a23, b23, sum00);
+          sum01 = __SMLAD(a23, b67, sum01);
+          sum10 = __SMLAD(a67, b23, sum10);
+          sum11 = __SMLAD(a67, b67, sum11);
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Remaining 1 to 3 samples */
+        colCnt = (uint32_t) numColsA % 0x4u;
+
+        while(colCnt > 0u)
+        {
+          b0 = *pB0++;
+          b1 = *pB1++;
+          sum00 += (q31_t) * pA0 * b0;
+          sum01 += (q31_t) * pA0++ * b1;
+          sum10 += (q31_t) * pA1 * b0;
+          sum11 += (q31_t) * pA1++ * b1;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        pOut[0] = sum00;
+        pOut[1] = sum01;
+        pOut[numColsB] = sum10;
+        pOut[numColsB + 1u] = sum11;
+        pOut += 2u;
+
+        /* The next pair of columns starts after the second row of this one */
+        pB0 = pB1;
+
+        /* Decrement the loop counter */
+        col--;
+      }
+
+      /* Last column of an odd numColsB, which is the only one for a single activation vector */
+      if((numColsB & 0x1u) != 0u)
+      {
+        pA0 = pInA;
+        pA1 = pInA + numColsA;
+
+        sum00 = 0;
+        sum10 = 0;
+
+        colCnt = (uint32_t) numColsA >> 2u;
+
+        while(colCnt > 0u)
+        {
+          inA0 = *__SIMD32(pA0)++;
+          inA1 = *__SIMD32(pA1)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+#ifdef CCS
+
+          a01 = __SXTB16(inA0, 0);
+          a23 = __SXTB16(inA0, 8);
+          a45 = __SXTB16(inA1, 0);
+          a67 = __SXTB16(inA1, 8);
+
+#else
+
+          a01 = __SXTB16(inA0);
+          a23 = __SXTB16(__ROR(inA0, 8));
+          a45 = __SXTB16(inA1);
+          a67 = __SXTB16(__ROR(inA1, 8));
+
+#endif
+
+#else
+
+#ifdef CCS
+
+          a01 = __SXTB16(inA0, 8);
+          a23 = __SXTB16(inA0, 0);
+          a45 = __SXTB16(inA1, 8);
+          a67 = __SXTB16(inA1, 0);
+
+#else
+
+          a01 = __SXTB16(__ROR(inA0, 8));
+          a23 = __SXTB16(inA0);
+          a45 = __SXTB16(__ROR(inA1, 8));
+          a67 = __SXTB16(inA1);
+
+#endif
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+          b01 = *__SIMD32(pB0)++;
+          b23 = *__SIMD32(pB0)++;
+
+          sum00 = __SMLAD(a01, b01, sum00);
+          sum10 = __SMLAD(a45, b01, sum10);
+          sum00 = __SMLAD(a23, b23, sum00);
+          sum10 = __SMLAD(a67, b23, sum10);
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        colCnt = (uint32_t) numColsA % 0x4u;
+
+        while(colCnt > 0u)
+        {
+          b0 = *pB0++;
+          sum00 += (q31_t) * pA0++ * b0;
+          sum10 += (q31_t) * pA1++ * b0;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        pOut[0] = sum00;
+        pOut[numColsB] = sum10;
+        pOut++;
+      }
+
+      /* Skip the second output row, already written, and move to the next pair of rows of A */
+      pOut += numColsB;
+      pInA += 2u * numColsA;
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* Last row of an odd numRowsA */
+    if((numRowsA & 0x1u) != 0u)
+    {
+      pB0 = pScratch;
+      col = numColsB;
+
+      while(col > 0u)
+      {
+        pA0 = pInA;
+        sum00 = 0;
+
+        colCnt = (uint32_t) numColsA >> 2u;
+
+        while(colCnt > 0u)
+        {
+          inA0 = *__SIMD32(pA0)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+#ifdef CCS
+
+          a01 = __SXTB16(inA0, 0);
+          a23 = __SXTB16(inA0, 8);
+
+#else
+
+          a01 = __SXTB16(inA0);
+          a23 = __SXTB16(__ROR(inA0, 8));
+
+#endif
+
+#else
+
+#ifdef CCS
+
+          a01 = __SXTB16(inA0, 8);
+          a23 = __SXTB16(inA0, 0);
+
+#else
+
+          a01 = __SXTB16(__ROR(inA0, 8));
+          a23 = __SXTB16(inA0);
+
+#endif
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+          sum00 = __SMLAD(a01, *__SIMD32(pB0)++, sum00);
+          sum00 = __SMLAD(a23, *__SIMD32(pB0)++, sum00);
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        colCnt = (uint32_t) numColsA % 0x4u;
+
+        while(colCnt > 0u)
+        {
+          sum00 += (q31_t) * pA0++ * *pB0++;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        *pOut++ = sum00;
+
+        /* Decrement the loop counter */
+        col--;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMultQ7Q15 group
+ */
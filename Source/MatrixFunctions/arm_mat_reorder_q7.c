@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_reorder_q7.c
+*
+* Description:	Reorders Q7 weights for arm_mat_mult_q7_q15.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMultQ7Q15
+ * @{
+ */
+
+/**
+ * @brief Reorders a Q7 weight matrix into the layout used by <code>arm_mat_mult_q7_q15()</code>.
+ * @param[in]       *pSrc points to the input matrix structure
+ * @param[out]      *pDst points to the output matrix structure
+ * @return          The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * Within every row, each block of four samples <code>w0 w1 w2 w3</code> is stored as
+ * <code>w0 w2 w1 w3</code>. The 1 to 3 samples left at the end of a row are copied unchanged.
+ * The source and destination may be the same matrix.
+ * This is done once when the weights are loaded, not per multiplication.
+ */
+
+arm_status arm_mat_reorder_q7(
+  const arm_matrix_instance_q7 * pSrc,
+  arm_matrix_instance_q7 * pDst)
+{
+  q7_t *pIn = pSrc->pData;                       /* input data matrix pointer */
+  q7_t *pOut = pDst->pData;                      /* output data matrix pointer */
+  uint16_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint16_t numCols = pSrc->numCols;              /* number of columns of the matrix */
+  q7_t in1, in2;                                 /* the two middle samples of a block */
+  uint32_t row, blkCnt;                          /* loop counters */
+  arm_status status;                             /* status of matrix reordering */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pDst->numRows) || (pSrc->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    row = numRows;
+
+    while(row > 0u)
+    {
+      /* Four samples at a time */
+      blkCnt = (uint32_t) numCols >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        in1 = pIn[1];
+        in2 = pIn[2];
+
+        pOut[0] = pIn[0];
+        pOut[1] = in2;
+        pOut[2] = in1;
+        pOut[3] = pIn[3];
+
+        pIn += 4u;
+        pOut += 4u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Remaining 1 to 3 samples */
+      blkCnt = (uint32_t) numCols % 0x4u;
+
+      while(blkCnt > 0u)
+      {
+        *pOut++ = *pIn++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMultQ7Q15 group
+ */
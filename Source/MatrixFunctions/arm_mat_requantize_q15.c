@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_requantize_q15.c
+*
+* Description:	Per-row requantization of Q31 accumulators to Q15.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMultQ7Q15
+ * @{
+ */
+
+/**
+ * @brief Requantizes a Q31 accumulator matrix to Q15 with one scale factor per row.
+ * @param[in]       *pSrc points to the input accumulator matrix structure
+ * @param[in]       *pMult points to the array of numRows Q31 scale fractions
+ * @param[in]       *pShift points to the array of numRows left shifts, in the range -31 to 30
+ * @param[out]      *pDst points to the output matrix structure
+ * @return          The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each input is multiplied by the scale fraction of its row in a 64-bit intermediate,
+ * rounded and right shifted by <code>31 - pShift[i]</code> bits, and then saturated to 1.15 format.
+ */
+
+arm_status arm_mat_requantize_q15(
+  const arm_matrix_instance_q31 * pSrc,
+  const q31_t * pMult,
+  const int8_t * pShift,
+  arm_matrix_instance_q15 * pDst)
+{
+  q31_t *pIn = pSrc->pData;                      /* input data matrix pointer */
+  q15_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  uint16_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint16_t numCols = pSrc->numCols;              /* number of columns of the matrix */
+  q31_t mult;                                    /* scale fraction of the current row */
+  int32_t rShift;                                /* right shift of the current row */
+  q63_t round;                                   /* rounding constant of the current row */
+  uint32_t row, blkCnt;                          /* loop counters */
+  arm_status status;                             /* status of matrix requantization */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pDst->numRows) || (pSrc->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    row = numRows;
+
+    while(row > 0u)
+    {
+      /* The scale factor is fetched once per row */
+      mult = *pMult++;
+      rShift = 31 - *pShift++;
+      round = (q63_t) 1 << (rShift - 1);
+
+      /* Loop unrolling */
+      blkCnt = (uint32_t) numCols >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        /* C = sat((A * mult) >> (31 - shift)) */
+        pOut[0] = (q15_t) __SSAT(clip_q63_to_q31(((q63_t) pIn[0] * mult + round) >> rShift), 16);
+        pOut[1] = (q15_t) __SSAT(clip_q63_to_q31(((q63_t) pIn[1] * mult + round) >> rShift), 16);
+        pOut[2] = (q15_t) __SSAT(clip_q63_to_q31(((q63_t) pIn[2] * mult + round) >> rShift), 16);
+        pOut[3] = (q15_t) __SSAT(clip_q63_to_q31(((q63_t) pIn[3] * mult + round) >> rShift), 16);
+
+        pIn += 4u;
+        pOut += 4u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Remaining 1 to 3 samples */
+      blkCnt = (uint32_t) numCols % 0x4u;
+
+      while(blkCnt > 0u)
+      {
+        *pOut++ = (q15_t) __SSAT(clip_q63_to_q31(((q63_t) *pIn++ * mult + round) >> rShift), 16);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMultQ7Q15 group
+ */
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_sym_pack_f32.c
+*
+* Description:	Packs a floating-point symmetric matrix.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixPacked Packed Symmetric and Triangular Matrices
+ *
+ * Covariance matrices are symmetric and their square-root factors are triangular,
+ * so only <code>n*(n+1)/2</code> of the <code>n*n</code> elements carry information.
+ * The packed matrix structures <code>arm_matrix_sym_instance_f32</code> and
+ * <code>arm_matrix_tri_instance_f32</code> store the lower triangle row by row:
+ * <pre>
+ *     | a00             |
+ *     | a10 a11         |      pData = { a00, a10, a11, a20, a21, a22, ... }
+ *     | a20 a21 a22     |
+ *     | ... ... ... ... |
+ * </pre>
+ * so element (i, j) with <code>j <= i</code> is stored at:
+ * <pre>
+ *     pData[i*(i+1)/2 + j]
+ * </pre>
+ * For a symmetric matrix element (j, i) is the same value. A triangular matrix is always
+ * lower triangular; the upper triangular matrix <code>L'</code> is reached through the
+ * <code>transFlag</code> argument of the triangular kernels.
+ *
+ * \par
+ * Element-wise operations on packed matrices of the same order, such as addition or
+ * scaling, are performed by applying the basic math functions (<code>arm_add_f32()</code>,
+ * <code>arm_scale_f32()</code>, ...) to the packed arrays directly.
+ *
+ * \par
+ * The functions in this group convert between full and packed storage, propagate a
+ * covariance with <code>P = A * P * A' + Q</code> (<code>arm_mat_sym_update_f32()</code>), and
+ * multiply by or solve with a triangular matrix (<code>arm_mat_tri_mult_f32()</code>,
+ * <code>arm_mat_tri_solve_f32()</code>).
+ * As for the other matrix functions, the dimensions are checked when
+ * <code>ARM_MATH_MATRIX_CHECK</code> is defined.
+ */
+
+/**
+ * @addtogroup MatrixPacked
+ * @{
+ */
+
+/**
+ * @brief Packs a floating-point symmetric matrix.
+ * @param[in]       *pSrc points to the full input matrix structure
+ * @param[out]      *pDst points to the packed output matrix structure
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * Only the lower triangle of the input matrix is read.
+ */
+
+arm_status arm_mat_sym_pack_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_sym_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  uint16_t numRows = pSrc->numRows;              /* number of rows */
+  uint16_t row, col;                             /* loop counters */
+  arm_status status;                             /* status of matrix packing */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    for (row = 0u; row < numRows; row++)
+    {
+      /* Copy the elements on and below the diagonal of this row */
+      for (col = 0u; col <= row; col++)
+      {
+        *pOut++ = pIn[col];
+      }
+
+      /* Move to the next row of the input */
+      pIn += numRows;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixPacked group
+ */
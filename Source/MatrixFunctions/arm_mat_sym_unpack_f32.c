@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_sym_unpack_f32.c
+*
+* Description:	Unpacks a floating-point symmetric matrix.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixPacked
+ * @{
+ */
+
+/**
+ * @brief Unpacks a floating-point symmetric matrix.
+ * @param[in]       *pSrc points to the packed input matrix structure
+ * @param[out]      *pDst points to the full output matrix structure
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * Both triangles of the output matrix are written.
+ */
+
+arm_status arm_mat_sym_unpack_f32(
+  const arm_matrix_sym_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  uint16_t numRows = pSrc->numRows;              /* number of rows */
+  uint16_t row, col;                             /* loop counters */
+  float32_t in;                                  /* temporary input value */
+  arm_status status;                             /* status of matrix unpacking */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pDst->numRows != pDst->numCols) || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    for (row = 0u; row < numRows; row++)
+    {
+      /* Element (row, col) is mirrored to (col, row) */
+      for (col = 0u; col <= row; col++)
+      {
+        in = *pIn++;
+        pOut[(row * numRows) + col] = in;
+        pOut[(col * numRows) + row] = in;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixPacked group
+ */
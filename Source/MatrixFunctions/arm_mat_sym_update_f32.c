@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_sym_update_f32.c
+*
+* Description:	Floating-point packed covariance update P = A * P * A' + Q.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixPacked
+ * @{
+ */
+
+/**
+ * @brief Floating-point packed covariance update.
+ * @param[in]       *pSrcA points to the full transition matrix structure A of size <code>M x N</code>
+ * @param[in]       *pSrcP points to the packed symmetric matrix structure P of order <code>N</code>
+ * @param[in]       *pSrcQ points to the packed symmetric matrix structure Q of order <code>M</code>, or NULL
+ * @param[out]      *pDst points to the packed symmetric output matrix structure of order <code>M</code>
+ * @param[in]       *pScratch points to a scratch buffer of <code>M*N</code> values
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * Computes <code>A * P * A' + Q</code>, or <code>A * P * A'</code> when <code>pSrcQ</code> is NULL.
+ *
+ * \par Algorithm
+ * The product <code>T = A * P</code> is formed in the scratch buffer first. The packed rows of P
+ * are walked once per row of A; every off-diagonal element <code>P(j,k)</code> is loaded once and
+ * used both as (j,k) and as (k,j). Only the lower triangle of <code>T * A'</code> is then
+ * computed, as dot products of rows of T and rows of A, so the second product costs half of
+ * the full matrix multiplication. With <code>M = N</code> the update takes <code>1.5*N^3</code>
+ * multiply-accumulates instead of <code>2*N^3</code>, and P, Q and the result occupy half the memory.
+ *
+ * \par
+ * P is no longer read once T is formed, so the destination may be the same structure as
+ * <code>pSrcP</code> or <code>pSrcQ</code>. The scratch buffer must not overlap any of the matrices.
+ */
+
+arm_status arm_mat_sym_update_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_sym_instance_f32 * pSrcP,
+  const arm_matrix_sym_instance_f32 * pSrcQ,
+  arm_matrix_sym_instance_f32 * pDst,
+  float32_t * pScratch)
+{
+  float32_t *pA;                                 /* row of the input matrix A */
+  float32_t *pAl;                                /* second row of A in the output stage */
+  float32_t *pT;                                 /* row of the intermediate matrix T */
+  float32_t *pP;                                 /* packed input matrix P */
+  float32_t *pQ = NULL;                          /* packed input matrix Q */
+  float32_t *pOut = pDst->pData;                 /* packed output matrix */
+  uint16_t numRows = pSrcA->numRows;             /* number of rows of A */
+  uint16_t numCols = pSrcA->numCols;             /* number of columns of A */
+  float32_t aij, p;                              /* temporary variables */
+  float32_t sum;                                 /* accumulator */
+  uint32_t i, j, l;                              /* loop counters */
+  uint32_t blkCnt;                               /* inner loop counter */
+  arm_status status;                             /* status of covariance update */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrcP->numRows != numCols) || (pDst->numRows != numRows) ||
+     ((pSrcQ != NULL) && (pSrcQ->numRows != numRows)))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    /* T = A * P, one row of T per row of A */
+    for (i = 0u; i < numRows; i++)
+    {
+      pA = pSrcA->pData + (i * numCols);
+      pT = pScratch + (i * numCols);
+      pP = pSrcP->pData;
+
+      for (j = 0u; j < numCols; j++)
+      {
+        aij = pA[j];
+        sum = 0.0f;
+
+        /* Packed row j of P holds P(j,0) .. P(j,j). Each off-diagonal value
+         ** contributes A(i,j)*P(j,k) to T(i,k) and A(i,k)*P(k,j) to T(i,j). */
+        l = 0u;
+        blkCnt = j >> 2u;
+
+        while(blkCnt > 0u)
+        {
+          p = pP[0];
+          pT[l] += aij * p;
+          sum += pA[l] * p;
+          p = pP[1];
+          pT[l + 1u] += aij * p;
+          sum += pA[l + 1u] * p;
+          p = pP[2];
+          pT[l + 2u] += aij * p;
+          sum += pA[l + 2u] * p;
+          p = pP[3];
+          pT[l + 3u] += aij * p;
+          sum += pA[l + 3u] * p;
+
+          pP += 4u;
+          l += 4u;
+
+          /* Decrement the loop counter */
+          blkCnt--;
+        }
+
+        blkCnt = j % 0x4u;
+
+        while(blkCnt > 0u)
+        {
+          p = *pP++;
+          pT[l] += aij * p;
+          sum += pA[l] * p;
+          l++;
+
+          /* Decrement the loop counter */
+          blkCnt--;
+        }
+
+        /* T(i,j) only receives contributions from later rows of P from here on */
+        pT[j] = sum + (aij * *pP++);
+      }
+    }
+
+    if(pSrcQ != NULL)
+    {
+      pQ = pSrcQ->pData;
+    }
+
+    /* Lower triangle of T * A' (+ Q), written in packed order */
+    for (i = 0u; i < numRows; i++)
+    {
+      for (l = 0u; l <= i; l++)
+      {
+        pT = pScratch + (i * numCols);
+        pAl = pSrcA->pData + (l * numCols);
+        sum = 0.0f;
+
+        /* Loop unrolling */
+        blkCnt = numCols >> 2u;
+
+        while(blkCnt > 0u)
+        {
+          sum += pT[0] * pAl[0];
+          sum += pT[1] * pAl[1];
+          sum += pT[2] * pAl[2];
+          sum += pT[3] * pAl[3];
+
+          pT += 4u;
+          pAl += 4u;
+
+          /* Decrement the loop counter */
+          blkCnt--;
+        }
+
+        blkCnt = numCols % 0x4u;
+
+        while(blkCnt > 0u)
+        {
+          sum += *pT++ * *pAl++;
+
+          /* Decrement the loop counter */
+          blkCnt--;
+        }
+
+        if(pQ != NULL)
+        {
+          sum += *pQ++;
+        }
+
+        *pOut++ = sum;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixPacked group
+ */
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_trans_mult_3x3_f32.c
+*
+* Description:	Floating-point 3x3 transpose-multiply.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixFixedSize
+ * @{
+ */
+
+/**
+ * @brief Floating-point 3x3 transpose-multiply.
+ * @param[in]       *pSrcA points to the first input matrix (9 values, row order)
+ * @param[in]       *pSrcB points to the second input matrix (9 values, row order)
+ * @param[out]      *pDst points to the output matrix <code>A' * B</code> (9 values, row order)
+ * @return none.
+ *
+ * The transpose of A is never formed: output row <code>i</code> is built from column
+ * <code>i</code> of A. Typical use is applying the inverse of a direction cosine matrix.
+ * The destination may be the same array as <code>pSrcA</code> or <code>pSrcB</code>.
+ */
+
+void arm_mat_trans_mult_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  float32_t a00, a01, a02, a10, a11, a12, a20, a21, a22;        /* First matrix held in registers */
+  float32_t b00, b01, b02, b10, b11, b12, b20, b21, b22;        /* Second matrix held in registers */
+
+  /* Load both inputs so that the destination may overlap either of them */
+  a00 = pSrcA[0];
+  a01 = pSrcA[1];
+  a02 = pSrcA[2];
+  a10 = pSrcA[3];
+  a11 = pSrcA[4];
+  a12 = pSrcA[5];
+  a20 = pSrcA[6];
+  a21 = pSrcA[7];
+  a22 = pSrcA[8];
+
+  b00 = pSrcB[0];
+  b01 = pSrcB[1];
+  b02 = pSrcB[2];
+  b10 = pSrcB[3];
+  b11 = pSrcB[4];
+  b12 = pSrcB[5];
+  b20 = pSrcB[6];
+  b21 = pSrcB[7];
+  b22 = pSrcB[8];
+
+  /* Row 0 of the output uses column 0 of A */
+  pDst[0] = (a00 * b00) + (a10 * b10) + (a20 * b20);
+  pDst[1] = (a00 * b01) + (a10 * b11) + (a20 * b21);
+  pDst[2] = (a00 * b02) + (a10 * b12) + (a20 * b22);
+
+  /* Row 1 of the output uses column 1 of A */
+  pDst[3] = (a01 * b00) + (a11 * b10) + (a21 * b20);
+  pDst[4] = (a01 * b01) + (a11 * b11) + (a21 * b21);
+  pDst[5] = (a01 * b02) + (a11 * b12) + (a21 * b22);
+
+  /* Row 2 of the output uses column 2 of A */
+  pDst[6] = (a02 * b00) + (a12 * b10) + (a22 * b20);
+  pDst[7] = (a02 * b01) + (a12 * b11) + (a22 * b21);
+  pDst[8] = (a02 * b02) + (a12 * b12) + (a22 * b22);
+}
+
+/**
+ * @} end of MatrixFixedSize group
+ */
@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_trans_vec_mult_f32.c
+*
+* Description:	Floating-point transposed matrix-vector multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectorMult
+ * @{
+ */
+
+/**
+ * @brief Floating-point transposed matrix-vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure of size <code>M x N</code>
+ * @param[in]       *pVec points to the input vector of <code>M</code> values
+ * @param[out]      *pDst points to the output vector of <code>N</code> values
+ * @return none.
+ */
+
+void arm_mat_trans_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  const float32_t *pCol = pSrcMat->pData;        /* first column of the current group */
+  const float32_t *pIn;                          /* matrix pointer */
+  const float32_t *px;                           /* input vector pointer */
+  float32_t sum0, sum1, sum2, sum3;              /* accumulators */
+  float32_t x;                                   /* input vector element */
+  uint32_t rowCnt, colCnt;                       /* loop counters */
+
+  /* Loop unrolling: four columns at a time */
+  colCnt = numCols >> 2u;
+
+  while(colCnt > 0u)
+  {
+    sum0 = 0.0f;
+    sum1 = 0.0f;
+    sum2 = 0.0f;
+    sum3 = 0.0f;
+
+    pIn = pCol;
+    px = pVec;
+    rowCnt = numRows;
+
+    /* Each vector element is loaded once for the four columns */
+    while(rowCnt > 0u)
+    {
+      x = *px++;
+      sum0 += pIn[0] * x;
+      sum1 += pIn[1] * x;
+      sum2 += pIn[2] * x;
+      sum3 += pIn[3] * x;
+
+      /* Move to the same columns of the next row */
+      pIn += numCols;
+
+      /* Decrement the loop counter */
+      rowCnt--;
+    }
+
+    pDst[0] = sum0;
+    pDst[1] = sum1;
+    pDst[2] = sum2;
+    pDst[3] = sum3;
+    pDst += 4u;
+
+    pCol += 4u;
+
+    /* Decrement the loop counter */
+    colCnt--;
+  }
+
+  /* Remaining 1 to 3 columns */
+  colCnt = numCols % 0x4u;
+
+  while(colCnt > 0u)
+  {
+    sum0 = 0.0f;
+    pIn = pCol;
+    px = pVec;
+    rowCnt = numRows;
+
+    while(rowCnt > 0u)
+    {
+      sum0 += *pIn * *px++;
+      pIn += numCols;
+
+      /* Decrement the loop counter */
+      rowCnt--;
+    }
+
+    *pDst++ = sum0;
+    pCol++;
+
+    /* Decrement the loop counter */
+    colCnt--;
+  }
+}
+
+/**
+ * @} end of MatrixVectorMult group
+ */
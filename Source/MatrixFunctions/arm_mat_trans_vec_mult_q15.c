@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_trans_vec_mult_q15.c
+*
+* Description:	Q15 transposed matrix-vector multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectorMult
+ * @{
+ */
+
+/**
+ * @brief Q15 transposed matrix-vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure of size <code>M x N</code>
+ * @param[in]       *pVec points to the input vector of <code>M</code> values
+ * @param[out]      *pDst points to the output vector of <code>N</code> values
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 1.15 by 1.15 products are accumulated in a 64-bit accumulator of 34.30 format,
+ * as in <code>arm_mat_mult_q15()</code>, so there is no risk of overflow.
+ * The accumulator is right shifted by 15 bits and saturated to 1.15 format.
+ */
+
+void arm_mat_trans_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst)
+{
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  const q15_t *pCol = pSrcMat->pData;            /* first column of the current group */
+  const q15_t *pIn;                              /* matrix pointer */
+  const q15_t *px;                               /* input vector pointer */
+  q63_t sum0, sum1, sum2, sum3;                  /* accumulators */
+  q15_t x;                                       /* input vector element */
+  uint32_t rowCnt, colCnt;                       /* loop counters */
+
+  /* Loop unrolling: four columns at a time */
+  colCnt = numCols >> 2u;
+
+  while(colCnt > 0u)
+  {
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+    pIn = pCol;
+    px = pVec;
+    rowCnt = numRows;
+
+    /* Each vector element is loaded once for the four columns */
+    while(rowCnt > 0u)
+    {
+      x = *px++;
+      sum0 += (q31_t) pIn[0] * x;
+      sum1 += (q31_t) pIn[1] * x;
+      sum2 += (q31_t) pIn[2] * x;
+      sum3 += (q31_t) pIn[3] * x;
+
+      /* Move to the same columns of the next row */
+      pIn += numCols;
+
+      /* Decrement the loop counter */
+      rowCnt--;
+    }
+
+    /* Convert the results from 34.30 to 1.15 format and store */
+    pDst[0] = (q15_t) __SSAT((q31_t) (sum0 >> 15), 16);
+    pDst[1] = (q15_t) __SSAT((q31_t) (sum1 >> 15), 16);
+    pDst[2] = (q15_t) __SSAT((q31_t) (sum2 >> 15), 16);
+    pDst[3] = (q15_t) __SSAT((q31_t) (sum3 >> 15), 16);
+    pDst += 4u;
+
+    pCol += 4u;
+
+    /* Decrement the loop counter */
+    colCnt--;
+  }
+
+  /* Remaining 1 to 3 columns */
+  colCnt = numCols % 0x4u;
+
+  while(colCnt > 0u)
+  {
+    sum0 = 0;
+    pIn = pCol;
+    px = pVec;
+    rowCnt = numRows;
+
+    while(rowCnt > 0u)
+    {
+      sum0 += (q31_t) * pIn * *px++;
+      pIn += numCols;
+
+      /* Decrement the loop counter */
+      rowCnt--;
+    }
+
+    *pDst++ = (q15_t) __SSAT((q31_t) (sum0 >> 15), 16);
+    pCol++;
+
+    /* Decrement the loop counter */
+    colCnt--;
+  }
+}
+
+/**
+ * @} end of MatrixVectorMult group
+ */
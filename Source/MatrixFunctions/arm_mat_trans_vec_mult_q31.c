@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_trans_vec_mult_q31.c
+*
+* Description:	Q31 transposed matrix-vector multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectorMult
+ * @{
+ */
+
+/**
+ * @brief Q31 transposed matrix-vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure of size <code>M x N</code>
+ * @param[in]       *pVec points to the input vector of <code>M</code> values
+ * @param[out]      *pDst points to the output vector of <code>N</code> values
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each column is accumulated in a 64-bit accumulator of 2.62 format, as in <code>arm_mat_mult_q31()</code>.
+ * The inputs are to be scaled down by log2(M) bits to avoid overflow.
+ * The accumulator is right shifted by 31 bits and saturated to 1.31 format.
+ */
+
+void arm_mat_trans_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+  q31_t * pDst)
+{
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  const q31_t *pCol = pSrcMat->pData;            /* first column of the current group */
+  const q31_t *pIn;                              /* matrix pointer */
+  const q31_t *px;                               /* input vector pointer */
+  q63_t sum0, sum1, sum2, sum3;                  /* accumulators */
+  q31_t x;                                       /* input vector element */
+  uint32_t rowCnt, colCnt;                       /* loop counters */
+
+  /* Loop unrolling: four columns at a time */
+  colCnt = numCols >> 2u;
+
+  while(colCnt > 0u)
+  {
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+    pIn = pCol;
+    px = pVec;
+    rowCnt = numRows;
+
+    /* Each vector element is loaded once for the four columns */
+    while(rowCnt > 0u)
+    {
+      x = *px++;
+      sum0 += (q63_t) pIn[0] * x;
+      sum1 += (q63_t) pIn[1] * x;
+      sum2 += (q63_t) pIn[2] * x;
+      sum3 += (q63_t) pIn[3] * x;
+
+      /* Move to the same columns of the next row */
+      pIn += numCols;
+
+      /* Decrement the loop counter */
+      rowCnt--;
+    }
+
+    /* Convert the results from 2.62 to 1.31 format and store */
+    pDst[0] = clip_q63_to_q31(sum0 >> 31);
+    pDst[1] = clip_q63_to_q31(sum1 >> 31);
+    pDst[2] = clip_q63_to_q31(sum2 >> 31);
+    pDst[3] = clip_q63_to_q31(sum3 >> 31);
+    pDst += 4u;
+
+    pCol += 4u;
+
+    /* Decrement the loop counter */
+    colCnt--;
+  }
+
+  /* Remaining 1 to 3 columns */
+  colCnt = numCols % 0x4u;
+
+  while(colCnt > 0u)
+  {
+    sum0 = 0;
+    pIn = pCol;
+    px = pVec;
+    rowCnt = numRows;
+
+    while(rowCnt > 0u)
+    {
+      sum0 += (q63_t) * pIn * *px++;
+      pIn += numCols;
+
+      /* Decrement the loop counter */
+      rowCnt--;
+    }
+
+    *pDst++ = clip_q63_to_q31(sum0 >> 31);
+    pCol++;
+
+    /* Decrement the loop counter */
+    colCnt--;
+  }
+}
+
+/**
+ * @} end of MatrixVectorMult group
+ */
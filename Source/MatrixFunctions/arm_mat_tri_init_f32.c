@@ -0,0 +1,49 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_tri_init_f32.c
+*
+* Description:	Floating-point packed triangular matrix initialization.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixInit
+ * @{
+ */
+
+/**
+   * @brief  Floating-point packed lower triangular matrix initialization.
+   * @param[in,out] *S             points to an instance of the floating-point packed triangular matrix structure.
+   * @param[in]     nRows          number of rows and columns of the matrix.
+   * @param[in]     *pData	   points to the packed data array of <code>nRows*(nRows+1)/2</code> values.
+   * @return        none
+   */
+
+void arm_mat_tri_init_f32(
+  arm_matrix_tri_instance_f32 * S,
+  uint16_t nRows,
+  float32_t * pData)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Data pointer */
+  S->pData = pData;
+}
+
+/**
+ * @} end of MatrixInit group
+ */
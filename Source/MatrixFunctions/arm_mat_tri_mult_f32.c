@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_tri_mult_f32.c
+*
+* Description:	Floating-point packed triangular matrix multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixPacked
+ * @{
+ */
+
+/**
+ * @brief  Adds a scaled row to another row: pDst[n] += scale * pSrc[n].
+ */
+
+static void arm_mat_tri_mult_row_f32(
+  float32_t scale,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    pDst[0] += scale * pSrc[0];
+    pDst[1] += scale * pSrc[1];
+    pDst[2] += scale * pSrc[2];
+    pDst[3] += scale * pSrc[3];
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ += scale * *pSrc++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief Floating-point packed triangular matrix multiplication.
+ * @param[in]       *pSrcL points to the packed lower triangular matrix structure L of order <code>N</code>
+ * @param[in]       *pSrcB points to the full input matrix structure B of size <code>N x M</code>
+ * @param[out]      *pDst points to the full output matrix structure of size <code>N x M</code>
+ * @param[in]       transFlag flag that selects <code>L * B</code> (transFlag = 0) or <code>L' * B</code> (transFlag = 1)
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * Only the <code>N*(N+1)/2</code> stored elements of L are multiplied.
+ * The output rows are produced in the order in which the input rows are no longer needed
+ * (last to first for <code>L * B</code>, first to last for <code>L' * B</code>), so the
+ * destination may be the same matrix as <code>pSrcB</code>.
+ */
+
+arm_status arm_mat_tri_mult_f32(
+  const arm_matrix_tri_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst,
+  uint8_t transFlag)
+{
+  float32_t *pL = pSrcL->pData;                  /* packed triangular matrix */
+  float32_t *pB = pSrcB->pData;                  /* input matrix */
+  float32_t *pOut = pDst->pData;                 /* output matrix */
+  uint16_t numRows = pSrcL->numRows;             /* order of L */
+  uint16_t numCols = pSrcB->numCols;             /* number of columns of B */
+  float32_t *pRow;                               /* packed row of L */
+  float32_t diag;                                /* diagonal element of L */
+  uint32_t i, k, c;                              /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrcB->numRows != numRows) || (pDst->numRows != numRows) ||
+     (pDst->numCols != numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    if(transFlag == 0u)
+    {
+      /* Output row i = sum over k <= i of L(i,k) * row k of B, last row first */
+      for (i = numRows; i > 0u; i--)
+      {
+        pRow = pL + (((i - 1u) * i) >> 1u);
+        diag = pRow[i - 1u];
+
+        /* The diagonal term reads and writes the same row */
+        for (c = 0u; c < numCols; c++)
+        {
+          pOut[((i - 1u) * numCols) + c] = diag * pB[((i - 1u) * numCols) + c];
+        }
+
+        for (k = 0u; k < (i - 1u); k++)
+        {
+          arm_mat_tri_mult_row_f32(pRow[k], pB + (k * numCols),
+                                   pOut + ((i - 1u) * numCols), numCols);
+        }
+      }
+    }
+    else
+    {
+      /* Output row i = sum over k >= i of L(k,i) * row k of B, first row first */
+      for (i = 0u; i < numRows; i++)
+      {
+        diag = pL[((i * (i + 1u)) >> 1u) + i];
+
+        for (c = 0u; c < numCols; c++)
+        {
+          pOut[(i * numCols) + c] = diag * pB[(i * numCols) + c];
+        }
+
+        for (k = i + 1u; k < numRows; k++)
+        {
+          arm_mat_tri_mult_row_f32(pL[((k * (k + 1u)) >> 1u) + i],
+                                   pB + (k * numCols), pOut + (i * numCols),
+                                   numCols);
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixPacked group
+ */
@@ -0,0 +1,174 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_tri_solve_f32.c
+*
+* Description:	Floating-point packed triangular system solver.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixPacked
+ * @{
+ */
+
+/**
+ * @brief  Subtracts a scaled row from another row: pDst[n] -= scale * pSrc[n].
+ */
+
+static void arm_mat_tri_solve_row_f32(
+  float32_t scale,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    pDst[0] -= scale * pSrc[0];
+    pDst[1] -= scale * pSrc[1];
+    pDst[2] -= scale * pSrc[2];
+    pDst[3] -= scale * pSrc[3];
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ -= scale * *pSrc++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief Floating-point packed triangular system solver.
+ * @param[in]       *pSrcL points to the packed lower triangular matrix structure L of order <code>N</code>
+ * @param[in]       *pSrcB points to the full right-hand side matrix structure B of size <code>N x M</code>
+ * @param[out]      *pDst points to the full solution matrix structure X of size <code>N x M</code>
+ * @param[in]       transFlag flag that selects <code>L * X = B</code> (transFlag = 0) or <code>L' * X = B</code> (transFlag = 1)
+ * @return The function returns <code>ARM_MATH_SIZE_MISMATCH</code> on a size mismatch,
+ * <code>ARM_MATH_SINGULAR</code> if a diagonal element of L is zero, otherwise <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * Forward substitution (transFlag = 0) or back substitution (transFlag = 1) is applied to all
+ * <code>M</code> columns at once, row by row, with one division per row.
+ * Together with a Cholesky factor this solves symmetric positive definite systems, e.g. for the
+ * Kalman gain, without forming an inverse.
+ *
+ * \par
+ * The destination may be the same matrix as <code>pSrcB</code>. When the matrix is singular
+ * the destination holds a partial result.
+ */
+
+arm_status arm_mat_tri_solve_f32(
+  const arm_matrix_tri_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst,
+  uint8_t transFlag)
+{
+  float32_t *pL = pSrcL->pData;                  /* packed triangular matrix */
+  float32_t *pOut = pDst->pData;                 /* solution matrix */
+  uint16_t numRows = pSrcL->numRows;             /* order of L */
+  uint16_t numCols = pSrcB->numCols;             /* number of columns of B */
+  float32_t *pRow;                               /* packed row of L */
+  float32_t *pX;                                 /* row of the solution being computed */
+  float32_t diag;                                /* diagonal element of L */
+  float32_t invDiag;                             /* reciprocal of the diagonal element */
+  uint32_t i, k, c;                              /* loop counters */
+  arm_status status;                             /* status of the solver */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrcB->numRows != numRows) || (pDst->numRows != numRows) ||
+     (pDst->numCols != numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif
+  {
+    /* The substitution works in place on the destination */
+    if(pOut != pSrcB->pData)
+    {
+      arm_copy_f32(pSrcB->pData, pOut, (uint32_t) numRows * numCols);
+    }
+
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0u; (i < numRows) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      if(transFlag == 0u)
+      {
+        /* Forward substitution: row i uses the solved rows above it */
+        pRow = pL + ((i * (i + 1u)) >> 1u);
+        pX = pOut + (i * numCols);
+
+        for (k = 0u; k < i; k++)
+        {
+          arm_mat_tri_solve_row_f32(pRow[k], pOut + (k * numCols), pX, numCols);
+        }
+
+        diag = pRow[i];
+      }
+      else
+      {
+        /* Back substitution: row n-1-i uses the solved rows below it */
+        pX = pOut + ((numRows - 1u - i) * numCols);
+
+        for (k = numRows - i; k < numRows; k++)
+        {
+          arm_mat_tri_solve_row_f32(pL[((k * (k + 1u)) >> 1u) + (numRows - 1u - i)],
+                                    pOut + (k * numCols), pX, numCols);
+        }
+
+        diag = pL[(((numRows - 1u - i) * (numRows - i)) >> 1u) + (numRows - 1u - i)];
+      }
+
+      if(diag == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+      else
+      {
+        invDiag = 1.0f / diag;
+
+        for (c = 0u; c < numCols; c++)
+        {
+          pX[c] *= invDiag;
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixPacked group
+ */
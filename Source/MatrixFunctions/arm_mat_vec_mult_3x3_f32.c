@@ -0,0 +1,55 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_vec_mult_3x3_f32.c
+*
+* Description:	Floating-point 3x3 matrix-vector multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixFixedSize
+ * @{
+ */
+
+/**
+ * @brief Floating-point 3x3 matrix-vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix (9 values, row order)
+ * @param[in]       *pVec points to the input vector (3 values)
+ * @param[out]      *pDst points to the output vector (3 values)
+ * @return none.
+ *
+ * The destination may be the same array as <code>pVec</code>.
+ */
+
+void arm_mat_vec_mult_3x3_f32(
+  const float32_t * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  float32_t x0, x1, x2;                          /* Input vector held in registers */
+
+  x0 = pVec[0];
+  x1 = pVec[1];
+  x2 = pVec[2];
+
+  pDst[0] = (pSrcMat[0] * x0) + (pSrcMat[1] * x1) + (pSrcMat[2] * x2);
+  pDst[1] = (pSrcMat[3] * x0) + (pSrcMat[4] * x1) + (pSrcMat[5] * x2);
+  pDst[2] = (pSrcMat[6] * x0) + (pSrcMat[7] * x1) + (pSrcMat[8] * x2);
+}
+
+/**
+ * @} end of MatrixFixedSize group
+ */
@@ -0,0 +1,57 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_vec_mult_4x4_f32.c
+*
+* Description:	Floating-point 4x4 matrix-vector multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixFixedSize
+ * @{
+ */
+
+/**
+ * @brief Floating-point 4x4 matrix-vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix (16 values, row order)
+ * @param[in]       *pVec points to the input vector (4 values)
+ * @param[out]      *pDst points to the output vector (4 values)
+ * @return none.
+ *
+ * The destination may be the same array as <code>pVec</code>.
+ */
+
+void arm_mat_vec_mult_4x4_f32(
+  const float32_t * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  float32_t x0, x1, x2, x3;                      /* Input vector held in registers */
+
+  x0 = pVec[0];
+  x1 = pVec[1];
+  x2 = pVec[2];
+  x3 = pVec[3];
+
+  pDst[0] = (pSrcMat[0] * x0) + (pSrcMat[1] * x1) + (pSrcMat[2] * x2) + (pSrcMat[3] * x3);
+  pDst[1] = (pSrcMat[4] * x0) + (pSrcMat[5] * x1) + (pSrcMat[6] * x2) + (pSrcMat[7] * x3);
+  pDst[2] = (pSrcMat[8] * x0) + (pSrcMat[9] * x1) + (pSrcMat[10] * x2) + (pSrcMat[11] * x3);
+  pDst[3] = (pSrcMat[12] * x0) + (pSrcMat[13] * x1) + (pSrcMat[14] * x2) + (pSrcMat[15] * x3);
+}
+
+/**
+ * @} end of MatrixFixedSize group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_vec_mult_f32.c
+*
+* Description:	Floating-point matrix-vector multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixVectorMult Matrix-Vector Multiplication
+ *
+ * Multiplies a matrix by a vector, <code>y = A * x</code>, or the transpose of a
+ * matrix by a vector, <code>y = A' * x</code>, without building a one-column matrix
+ * for <code>arm_mat_mult_f32()</code>:
+ * <pre>
+ *     pDst[i] = sum(pSrcMat[i][j] * pVec[j]),   j = 0 ... numCols-1,   i = 0 ... numRows-1
+ *     pDst[j] = sum(pSrcMat[i][j] * pVec[i]),   i = 0 ... numRows-1,   j = 0 ... numCols-1   (transposed)
+ * </pre>
+ * The product processes four rows, or four columns for the transposed product, at a
+ * time, so each element of <code>pVec</code> is loaded once per group of four outputs.
+ * The transposed product reads the matrix row by row as stored, which suits a weight
+ * matrix stored one output per column, and no transposed copy is needed.
+ *
+ * \par
+ * The fixed-point functions accumulate in the same formats as
+ * <code>arm_mat_mult_q31()</code> and <code>arm_mat_mult_q15()</code>. The inputs
+ * are to be scaled down by log2 of the length of the sums to avoid overflow.
+ */
+
+/**
+ * @addtogroup MatrixVectorMult
+ * @{
+ */
+
+/**
+ * @brief Floating-point matrix-vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure of size <code>M x N</code>
+ * @param[in]       *pVec points to the input vector of <code>N</code> values
+ * @param[out]      *pDst points to the output vector of <code>M</code> values
+ * @return none.
+ */
+
+void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  const float32_t *pRow0 = pSrcMat->pData;       /* first row of the current group */
+  const float32_t *pRow1, *pRow2, *pRow3;        /* other rows of the current group */
+  const float32_t *px;                           /* input vector pointer */
+  float32_t sum0, sum1, sum2, sum3;              /* accumulators */
+  float32_t x;                                   /* input vector element */
+  uint32_t rowCnt, colCnt;                       /* loop counters */
+
+  /* Loop unrolling: four rows at a time */
+  rowCnt = numRows >> 2u;
+
+  while(rowCnt > 0u)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+
+    sum0 = 0.0f;
+    sum1 = 0.0f;
+    sum2 = 0.0f;
+    sum3 = 0.0f;
+
+    px = pVec;
+    colCnt = numCols;
+
+    /* Each vector element is loaded once for the four rows */
+    while(colCnt > 0u)
+    {
+      x = *px++;
+      sum0 += *pRow0++ * x;
+      sum1 += *pRow1++ * x;
+      sum2 += *pRow2++ * x;
+      sum3 += *pRow3++ * x;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    pDst[0] = sum0;
+    pDst[1] = sum1;
+    pDst[2] = sum2;
+    pDst[3] = sum3;
+    pDst += 4u;
+
+    /* The next group starts after the last row of this one */
+    pRow0 = pRow3;
+
+    /* Decrement the loop counter */
+    rowCnt--;
+  }
+
+  /* Remaining 1 to 3 rows */
+  rowCnt = numRows % 0x4u;
+
+  while(rowCnt > 0u)
+  {
+    sum0 = 0.0f;
+    px = pVec;
+    colCnt = numCols;
+
+    while(colCnt > 0u)
+    {
+      sum0 += *pRow0++ * *px++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    *pDst++ = sum0;
+
+    /* Decrement the loop counter */
+    rowCnt--;
+  }
+}
+
+/**
+ * @} end of MatrixVectorMult group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_vec_mult_q15.c
+*
+* Description:	Q15 matrix-vector multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectorMult
+ * @{
+ */
+
+/**
+ * @brief Q15 matrix-vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure of size <code>M x N</code>
+ * @param[in]       *pVec points to the input vector of <code>N</code> values
+ * @param[out]      *pDst points to the output vector of <code>M</code> values
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input buffers should be aligned by 32-bit and N should be even
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 1.15 by 1.15 products are accumulated in a 64-bit accumulator of 34.30 format,
+ * as in <code>arm_mat_mult_q15()</code>, so there is no risk of overflow.
+ * The accumulator is right shifted by 15 bits and saturated to 1.15 format.
+ */
+
+void arm_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst)
+{
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  q15_t *pRow0 = pSrcMat->pData;                 /* first row of the current group */
+  q15_t *pRow1, *pRow2, *pRow3;                  /* other rows of the current group */
+  q15_t *px;                                     /* input vector pointer */
+  q63_t sum0, sum1, sum2, sum3;                  /* accumulators */
+  q31_t x;                                       /* two input vector elements */
+  uint32_t rowCnt, colCnt;                       /* loop counters */
+
+  /* Loop unrolling: four rows at a time */
+  rowCnt = numRows >> 2u;
+
+  while(rowCnt > 0u)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+    px = (q15_t *) pVec;
+
+    /* Two columns at a time: each pair of vector elements is loaded once for the four rows */
+    colCnt = (uint32_t) numCols >> 1u;
+
+    while(colCnt > 0u)
+    {
+      x = *__SIMD32(px)++;
+      sum0 = __SMLALD(*__SIMD32(pRow0)++, x, sum0);
+      sum1 = __SMLALD(*__SIMD32(pRow1)++, x, sum1);
+      sum2 = __SMLALD(*__SIMD32(pRow2)++, x, sum2);
+      sum3 = __SMLALD(*__SIMD32(pRow3)++, x, sum3);
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Last column of an odd number of columns */
+    if((numCols & 0x1u) != 0u)
+    {
+      x = *px;
+      sum0 += (q31_t) * pRow0++ * x;
+      sum1 += (q31_t) * pRow1++ * x;
+      sum2 += (q31_t) * pRow2++ * x;
+      sum3 += (q31_t) * pRow3++ * x;
+    }
+
+    /* Convert the results from 34.30 to 1.15 format and store */
+    pDst[0] = (q15_t) __SSAT((q31_t) (sum0 >> 15), 16);
+    pDst[1] = (q15_t) __SSAT((q31_t) (sum1 >> 15), 16);
+    pDst[2] = (q15_t) __SSAT((q31_t) (sum2 >> 15), 16);
+    pDst[3] = (q15_t) __SSAT((q31_t) (sum3 >> 15), 16);
+    pDst += 4u;
+
+    /* The next group starts after the last row of this one */
+    pRow0 = pRow3;
+
+    /* Decrement the loop counter */
+    rowCnt--;
+  }
+
+  /* Remaining 1 to 3 rows */
+  rowCnt = numRows % 0x4u;
+
+  while(rowCnt > 0u)
+  {
+    sum0 = 0;
+    px = (q15_t *) pVec;
+    colCnt = numCols;
+
+    while(colCnt > 0u)
+    {
+      sum0 += (q31_t) * pRow0++ * *px++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    *pDst++ = (q15_t) __SSAT((q31_t) (sum0 >> 15), 16);
+
+    /* Decrement the loop counter */
+    rowCnt--;
+  }
+}
+
+/**
+ * @} end of MatrixVectorMult group
+ */
@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_mat_vec_mult_q7.c
+*
+* Description:	Q7 matrix-vector multiplication.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectorMult
+ * @{
+ */
+
+/**
+ * @brief Q7 matrix-vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure of size <code>M x N</code>
+ * @param[in]       *pVec points to the input vector of <code>N</code> values
+ * @param[out]      *pDst points to the output vector of <code>M</code> values
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input buffers should be aligned by 32-bit and N should be a multiple of 4
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 1.7 by 1.7 products are in 2.14 format and are accumulated in a 32-bit
+ * accumulator of 18.14 format, as in <code>arm_dot_prod_q7()</code>, so there is no
+ * risk of overflow. The accumulator is right shifted by 7 bits and saturated to 1.7 format.
+ */
+
+void arm_mat_vec_mult_q7(
+  const arm_matrix_instance_q7 * pSrcMat,
+  const q7_t * pVec,
+  q7_t * pDst)
+{
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  q7_t *pRow0 = pSrcMat->pData;                  /* first row of the current group */
+  q7_t *pRow1, *pRow2, *pRow3;                   /* other rows of the current group */
+  q7_t *px;                                      /* input vector pointer */
+  q31_t sum0, sum1, sum2, sum3;                  /* accumulators */
+  q31_t in0, in1, in2, in3;                      /* four matrix elements of each row */
+  q31_t x, x13, x02;                             /* four vector elements, odd and even pairs */
+  uint32_t rowCnt, colCnt;                       /* loop counters */
+
+  /* Loop unrolling: four rows at a time */
+  rowCnt = numRows >> 2u;
+
+  while(rowCnt > 0u)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+    px = (q7_t *) pVec;
+
+    /* Four columns at a time: the vector elements are loaded and extended once for the four rows */
+    colCnt = (uint32_t) numCols >> 2u;
+
+    while(colCnt > 0u)
+    {
+      x = *__SIMD32(px)++;
+      in0 = *__SIMD32(pRow0)++;
+      in1 = *__SIMD32(pRow1)++;
+      in2 = *__SIMD32(pRow2)++;
+      in3 = *__SIMD32(pRow3)++;
+
+#ifdef CCS
+
+      /* extract the odd and the even q7_t samples to q15_t samples */
+      x13 = __SXTB16(x, 8);
+      x02 = __SXTB16(x, 0);
+
+      sum0 = __SMLAD(__SXTB16(in0, 8), x13, sum0);
+      sum1 = __SMLAD(__SXTB16(in1, 8), x13, sum1);
+      sum2 = __SMLAD(__SXTB16(in2, 8), x13, sum2);
+      sum3 = __SMLAD(__SXTB16(in3, 8), x13, sum3);
+
+      sum0 = __SMLAD(__SXTB16(in0, 0), x02, sum0);
+      sum1 = __SMLAD(__SXTB16(in1, 0), x02, sum1);
+      sum2 = __SMLAD(__SXTB16(in2, 0), x02, sum2);
+      sum3 = __SMLAD(__SXTB16(in3, 0), x02, sum3);
+
+#else
+
+      /* extract the odd and the even q7_t samples to q15_t samples */
+      x13 = __SXTB16(__ROR(x, 8));
+      x02 = __SXTB16(x);
+
+      sum0 = __SMLAD(__SXTB16(__ROR(in0, 8)), x13, sum0);
+      sum1 = __SMLAD(__SXTB16(__ROR(in1, 8)), x13, sum1);
+      sum2 = __SMLAD(__SXTB16(__ROR(in2, 8)), x13, sum2);
+      sum3 = __SMLAD(__SXTB16(__ROR(in3, 8)), x13, sum3);
+
+      sum0 = __SMLAD(__SXTB16(in0), x02, sum0);
+      sum1 = __SMLAD(__SXTB16(in1), x02, sum1);
+      sum2 = __SMLAD(__SXTB16(in2), x02, sum2);
+      sum3 = __SMLAD(__SXTB16(in3), x02, sum3);
+
+#endif
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Remaining 1 to 3 columns */
+    colCnt = (uint32_t) numCols % 0x4u;
+
+    while(colCnt > 0u)
+    {
+      x = *px++;
+      sum0 += (q15_t) * pRow0++ * x;
+      sum1 += (q15_t) * pRow1++ * x;
+      sum2 += (q15_t) * pRow2++ * x;
+      sum3 += (q15_t) * pRow3++ * x;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Convert the results from 18.14 to 1.7 format and store */
+    pDst[0] = (q7_t) __SSAT(sum0 >> 7, 8);
+    pDst[1] = (q7_t) __SSAT(sum1 >> 7, 8);
+    pDst[2] = (q7_t) __SSAT(sum2 >> 7, 8);
+    pDst[3] = (q7_t) __SSAT(sum3 >> 7, 8);
+    pDst += 4u;
+
+    /* The next group starts after the last row of this one */
+    pRow0 = pRow3;
+
+    /* Decrement the loop counter */
+    rowCnt--;
+  }
+
+  /* Remaining 1 to 3 rows */
+  rowCnt = numRows % 0x4u;
+
+  while(rowCnt > 0u)
+  {
+    sum0 = 0;
+    px = (q7_t *) pVec;
+    colCnt = numCols;
+
+    while(colCnt > 0u)
+    {
+      sum0 += (q15_t) * pRow0++ * *px++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    *pDst++ = (q7_t) __SSAT(sum0 >> 7, 8);
+
+    /* Decrement the loop counter */
+    rowCnt--;
+  }
+}
+
+/**
+ * @} end of MatrixVectorMult group
+ */
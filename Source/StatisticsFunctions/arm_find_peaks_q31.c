@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_find_peaks_q31.c
+*
+* Description:	Peak picking on a Q31 vector.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup FindPeaks
+ * @{
+ */
+
+/**
+ * @brief  Peak picking on a Q31 vector.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  blockSize length of the input vector.
+ * @param[in]  threshold smallest value of a peak.
+ * @param[in]  minDistance minimum distance between two peaks, in samples.
+ * @param[in]  maxPeaks maximum number of peaks to return.
+ * @param[out] *pPeakIndex points to the indices of the peaks, of length maxPeaks.
+ * @param[out] *pNumPeaks number of peaks found returned here.
+ * @return none.
+ */
+
+void arm_find_peaks_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t threshold,
+  uint32_t minDistance,
+  uint32_t maxPeaks,
+  uint32_t * pPeakIndex,
+  uint32_t * pNumPeaks)
+{
+  q31_t val;                                     /* Value of the current peak */
+  uint32_t numPeaks = 0u;                        /* Number of peaks reported */
+  uint32_t i, j;                                 /* Start and end of a flat top */
+  uint32_t peak;                                 /* Index of the current peak */
+  uint32_t w, n;                                 /* Smallest reported peak, loop counter */
+
+  i = 1u;
+
+  while((i + 1u) < blockSize)
+  {
+    if(pSrc[i] > pSrc[i - 1u])
+    {
+      /* Find the end of a flat top */
+      j = i;
+      while(((j + 1u) < blockSize) && (pSrc[j + 1u] == pSrc[i]))
+      {
+        j++;
+      }
+
+      val = pSrc[i];
+
+      if(((j + 1u) < blockSize) && (pSrc[j + 1u] < val) && (val >= threshold))
+      {
+        peak = i + ((j - i) >> 1u);
+
+        if((numPeaks > 0u) && ((peak - pPeakIndex[numPeaks - 1u]) < minDistance))
+        {
+          /* Too close to the previous peak: keep the larger */
+          if(val > pSrc[pPeakIndex[numPeaks - 1u]])
+          {
+            pPeakIndex[numPeaks - 1u] = peak;
+          }
+        }
+        else if(numPeaks < maxPeaks)
+        {
+          pPeakIndex[numPeaks] = peak;
+          numPeaks++;
+        }
+        else if(maxPeaks > 0u)
+        {
+          /* Output full: drop the smallest peak if the new one is larger */
+          w = 0u;
+          for (n = 1u; n < numPeaks; n++)
+          {
+            if(pSrc[pPeakIndex[n]] < pSrc[pPeakIndex[w]])
+            {
+              w = n;
+            }
+          }
+
+          if(val > pSrc[pPeakIndex[w]])
+          {
+            for (n = w; n < (numPeaks - 1u); n++)
+            {
+              pPeakIndex[n] = pPeakIndex[n + 1u];
+            }
+            pPeakIndex[numPeaks - 1u] = peak;
+          }
+        }
+      }
+
+      /* Continue after the flat top */
+      i = j + 1u;
+    }
+    else
+    {
+      i++;
+    }
+  }
+
+  *pNumPeaks = numPeaks;
+}
+
+/**
+ * @} end of FindPeaks group
+ */
@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_histogram_f32.c
+*
+* Description:	Floating-point histogram function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Histogram Histogram
+ *
+ * Counts the samples of a block that fall into each of <code>numBins</code> equal width
+ * bins spanning <code>[minVal, maxVal)</code>. Bin <code>b</code> covers the values
+ * <pre>
+ *    minVal + b * (maxVal - minVal) / numBins  <=  x  <  minVal + (b + 1) * (maxVal - minVal) / numBins
+ * </pre>
+ * Samples below <code>minVal</code> are counted in the first bin and samples at or above
+ * <code>maxVal</code> in the last bin, so every sample is counted.
+ *
+ * \par
+ * The counts are added to <code>pHist</code>, which lets a histogram be accumulated over
+ * several blocks. Clear <code>pHist</code> with <code>arm_fill_q31()</code> or
+ * <code>memset()</code> before the first block.
+ *
+ * \par
+ * The bin index is computed with a multiplication by the precomputed reciprocal of the bin
+ * width rather than a division per sample. The fixed-point functions use a 32-bit
+ * fractional reciprocal that is rounded up, which gives the exact bin for every input
+ * value, and they read two (Q15) or four (Q7) samples with each 32-bit load.
+ * A histogram with <code>maxVal <= minVal</code> or <code>numBins == 0</code> is invalid and
+ * the function returns <code>ARM_MATH_ARGUMENT_ERROR</code> without counting.
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief  Histogram of a floating-point vector.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  blockSize length of the input vector.
+ * @param[in]  minVal lower edge of the first bin.
+ * @param[in]  maxVal upper edge of the last bin.
+ * @param[in]  numBins number of bins.
+ * @param[in,out] *pHist points to the bin counts, of length numBins. The counts are incremented.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the range or
+ * the number of bins is invalid.
+ *
+ * NaN inputs are counted in the first bin.
+ */
+
+arm_status arm_histogram_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t minVal,
+  float32_t maxVal,
+  uint16_t numBins,
+  uint32_t * pHist)
+{
+  float32_t scale;                               /* bins per unit of input */
+  float32_t lastBin;                             /* index of the last bin */
+  float32_t t;                                   /* bin position of the sample */
+  uint32_t blkCnt;                               /* loop counter */
+  arm_status status;                             /* status of histogram */
+
+  if((numBins == 0u) || !(maxVal > minVal))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    scale = (float32_t) numBins / (maxVal - minVal);
+    lastBin = (float32_t) (numBins - 1u);
+
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      t = (*pSrc++ - minVal) * scale;
+
+      /* Clamp to the edge bins; the comparisons are false for NaN, which selects bin 0 */
+      t = (t > 0.0f) ? t : 0.0f;
+      t = (t < lastBin) ? t : lastBin;
+
+      pHist[(uint32_t) t]++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Histogram group
+ */
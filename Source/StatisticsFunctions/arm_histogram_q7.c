@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_histogram_q7.c
+*
+* Description:	Q7 histogram function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief  Bin index of a Q7 sample.
+ * @param[in]  x sample.
+ * @param[in]  minVal lower edge of the first bin.
+ * @param[in]  scale bins per input step with 32 fractional bits, rounded up.
+ * @param[in]  lastBin index of the last bin.
+ * @return bin index.
+ */
+
+static uint32_t arm_histogram_bin_q7(
+  q31_t x,
+  q31_t minVal,
+  uint64_t scale,
+  uint32_t lastBin)
+{
+  q31_t diff = x - minVal;
+  uint32_t bin = 0u;
+
+  if(diff > 0)
+  {
+    bin = (uint32_t) ((((uint64_t) diff) * scale) >> 32);
+    bin = (bin < lastBin) ? bin : lastBin;
+  }
+
+  return (bin);
+}
+
+/**
+ * @brief  Histogram of a Q7 vector.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  blockSize length of the input vector.
+ * @param[in]  minVal lower edge of the first bin.
+ * @param[in]  maxVal upper edge of the last bin.
+ * @param[in]  numBins number of bins.
+ * @param[in,out] *pHist points to the bin counts, of length numBins. The counts are incremented.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the range or
+ * the number of bins is invalid.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The reciprocal of the bin width is held in 64 bits with 32 fractional bits and rounded
+ * up. For input ranges of up to 2^16 steps the error of the product is smaller than the
+ * distance to the next bin edge, so each sample is placed in the same bin as an exact
+ * division would place it.
+ */
+
+arm_status arm_histogram_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  q7_t minVal,
+  q7_t maxVal,
+  uint16_t numBins,
+  uint32_t * pHist)
+{
+  uint64_t scale;                                /* bins per input step in 32.32 format */
+  uint32_t range;                                /* width of the histogram range */
+  uint32_t lastBin;                              /* index of the last bin */
+  q31_t in;                                      /* four packed input samples */
+  uint32_t blkCnt;                               /* loop counter */
+  arm_status status;                             /* status of histogram */
+
+  if((numBins == 0u) || (maxVal <= minVal))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    range = (uint32_t) ((q31_t) maxVal - minVal);
+    scale = ((((uint64_t) numBins) << 32) + (range - 1u)) / range;
+    lastBin = (uint32_t) numBins - 1u;
+
+    /* Loop unrolling: read four samples with each 32-bit load */
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* The four samples are counted independently, so their order
+       ** within the word does not depend on the endianness */
+      in = *__SIMD32(pSrc)++;
+
+      pHist[arm_histogram_bin_q7((q7_t) in, minVal, scale, lastBin)]++;
+      pHist[arm_histogram_bin_q7((q7_t) (in >> 8), minVal, scale, lastBin)]++;
+      pHist[arm_histogram_bin_q7((q7_t) (in >> 16), minVal, scale, lastBin)]++;
+      pHist[arm_histogram_bin_q7((q7_t) (in >> 24), minVal, scale, lastBin)]++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Count the remaining 1 to 3 samples */
+    blkCnt = blockSize % 0x4u;
+
+    while(blkCnt > 0u)
+    {
+      pHist[arm_histogram_bin_q7(*pSrc++, minVal, scale, lastBin)]++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Histogram group
+ */
@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_peak_refine_cmplx_f32.c
+*
+* Description:	Sub-bin peak refinement of a floating-point complex spectrum.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup PeakRefine
+ * @{
+ */
+
+/**
+ * @brief  Sub-bin refinement of a peak of a floating-point complex spectrum.
+ * @param[in]  *pSrc points to the complex spectrum, interleaved as (real, imag) pairs.
+ * @param[in]  numBins number of complex bins.
+ * @param[in]  index bin of the peak, usually found on the magnitude of the spectrum.
+ * @param[out] *pOffset position of the peak relative to index, in bins, returned here.
+ * @return none.
+ */
+
+void arm_peak_refine_cmplx_f32(
+  float32_t * pSrc,
+  uint32_t numBins,
+  uint32_t index,
+  float32_t * pOffset)
+{
+  float32_t numRe, numIm;                        /* X[k-1] - X[k+1] */
+  float32_t denRe, denIm;                        /* 2*X[k] - X[k-1] - X[k+1] */
+  float32_t mag;                                 /* |den|^2 */
+  float32_t offset = 0.0f;                       /* Position relative to index */
+  float32_t *pX;                                 /* Points to X[k-1] */
+
+  if((index > 0u) && ((index + 1u) < numBins))
+  {
+    pX = pSrc + 2u * (index - 1u);
+
+    numRe = pX[0] - pX[4];
+    numIm = pX[1] - pX[5];
+    denRe = (2.0f * pX[2]) - pX[0] - pX[4];
+    denIm = (2.0f * pX[3]) - pX[1] - pX[5];
+
+    mag = (denRe * denRe) + (denIm * denIm);
+
+    if(mag > 0.0f)
+    {
+      /* Re(num / den) = Re(num * conj(den)) / |den|^2 */
+      offset = ((numRe * denRe) + (numIm * denIm)) / mag;
+      offset = (offset > -1.0f) ? offset : -1.0f;
+      offset = (offset < 1.0f) ? offset : 1.0f;
+    }
+  }
+
+  *pOffset = offset;
+}
+
+/**
+ * @} end of PeakRefine group
+ */
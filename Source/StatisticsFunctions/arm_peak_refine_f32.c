@@ -0,0 +1,197 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_peak_refine_f32.c
+*
+* Description:	Sub-sample peak refinement of a floating-point vector.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup PeakRefine Sub-Sample Peak Refinement
+ *
+ * Estimates the position and height of a peak between samples from the peak sample
+ * <code>y0 = x[k]</code> and its neighbours <code>y- = x[k-1]</code> and
+ * <code>y+ = x[k+1]</code>, for example to measure a tone frequency to a fraction of an
+ * FFT bin or a delay to a fraction of a lag. The peak is at <code>k + offset</code>.
+ *
+ * \par Parabolic interpolation
+ * Fits a parabola through the three samples:
+ * <pre>
+ *     offset = (y- - y+) / (2 * (y- - 2*y0 + y+))
+ *     height = y0 - (y- - y+) * offset / 4
+ * </pre>
+ * It suits correlation peaks and magnitude spectra with a smooth main lobe.
+ *
+ * \par Gaussian interpolation
+ * Applies the same fit to <code>log(y)</code>, which is exact for a Gaussian peak and
+ * is more accurate than the parabola on magnitude spectra of Gaussian-like windows.
+ * It needs three positive samples and falls back to the parabola otherwise.
+ *
+ * \par Jacobsen estimator
+ * <code>arm_peak_refine_cmplx_f32()</code> uses the complex FFT bins <code>X</code>
+ * instead of their magnitudes:
+ * <pre>
+ *     offset = Re((X[k-1] - X[k+1]) / (2*X[k] - X[k-1] - X[k+1]))
+ * </pre>
+ * It has a much smaller bias than magnitude interpolation for an unwindowed FFT.
+ *
+ * \par
+ * The offset is zero at the first and last sample, and when the samples are not
+ * concave around <code>k</code>, and it is limited to [-1, +1]. The fixed-point
+ * functions return the height in the input format, saturated, and compute in single
+ * precision floating point.
+ */
+
+/**
+ * @addtogroup PeakRefine
+ * @{
+ */
+
+/*
+ * @brief  Base-2 logarithm of a positive normalized value.
+ */
+
+static float32_t arm_peak_refine_log2(
+  float32_t x)
+{
+  float32_t f, y;                                /* Mantissa fraction and polynomial */
+  int32_t e;                                     /* Exponent */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u;                                           /* Bits of the input */
+
+  /* Split into exponent and mantissa in [1, 2) */
+  u.f = x;
+  e = (u.i >> 23) - 127;
+  u.i = (u.i & 0x007FFFFF) | 0x3F800000;
+  f = u.f - 1.0f;
+
+  /* log2(1 + f) polynomial */
+  y = 2.0016649997e-2f;
+  y = (y * f) - 9.4626809736e-2f;
+  y = (y * f) + 2.1394321218e-1f;
+  y = (y * f) - 3.3837719766e-1f;
+  y = (y * f) + 4.7749636368e-1f;
+  y = (y * f) - 7.2114409218e-1f;
+  y = (y * f) + 1.4426929832f;
+
+  return ((float32_t) e + (y * f));
+}
+
+/*
+ * @brief  Base-2 exponential, for results in the normalized range.
+ */
+
+static float32_t arm_peak_refine_exp2(
+  float32_t x)
+{
+  float32_t f, y;                                /* Fraction and polynomial */
+  int32_t n;                                     /* Integer part */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u;                                           /* Bits of the scale 2^n */
+
+  x = (x > -126.0f) ? x : -126.0f;
+  x = (x < 127.0f) ? x : 127.0f;
+
+  /* x = n + f with f in [-0.5, 0.5] */
+  n = (int32_t) (x + 128.5f) - 128;
+  f = x - (float32_t) n;
+
+  /* 2^f polynomial */
+  y = 1.535336188319500e-4f;
+  y = (y * f) + 1.339887440266574e-3f;
+  y = (y * f) + 9.618437357674640e-3f;
+  y = (y * f) + 5.550332471162809e-2f;
+  y = (y * f) + 2.402264791363012e-1f;
+  y = (y * f) + 6.931472028550421e-1f;
+  y = (y * f) + 1.0f;
+
+  u.i = (n + 127) << 23;
+
+  return (y * u.f);
+}
+
+/**
+ * @brief  Sub-sample refinement of a peak of a floating-point vector.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  blockSize length of the input vector.
+ * @param[in]  index index of the peak sample.
+ * @param[in]  method interpolation, ARM_PEAK_PARABOLIC or ARM_PEAK_GAUSSIAN.
+ * @param[out] *pOffset position of the peak relative to index returned here.
+ * @param[out] *pValue interpolated height of the peak returned here.
+ * @return none.
+ */
+
+void arm_peak_refine_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t index,
+  arm_peak_refine_method method,
+  float32_t * pOffset,
+  float32_t * pValue)
+{
+  float32_t ym, y0, yp;                          /* Left, peak and right samples */
+  float32_t den;                                 /* Curvature of the fit */
+  float32_t offset = 0.0f;                       /* Position relative to index */
+  float32_t value = pSrc[index];                 /* Height of the peak */
+  uint32_t useLog;                               /* Gaussian fit on logarithms */
+
+  if((index > 0u) && ((index + 1u) < blockSize))
+  {
+    ym = pSrc[index - 1u];
+    y0 = pSrc[index];
+    yp = pSrc[index + 1u];
+
+    useLog = ((method == ARM_PEAK_GAUSSIAN) &&
+              (ym > 0.0f) && (y0 > 0.0f) && (yp > 0.0f)) ? 1u : 0u;
+
+    if(useLog != 0u)
+    {
+      ym = arm_peak_refine_log2(ym);
+      y0 = arm_peak_refine_log2(y0);
+      yp = arm_peak_refine_log2(yp);
+    }
+
+    den = ym - (2.0f * y0) + yp;
+
+    /* Only a concave fit has a maximum */
+    if(den < 0.0f)
+    {
+      offset = (0.5f * (ym - yp)) / den;
+      offset = (offset > -1.0f) ? offset : -1.0f;
+      offset = (offset < 1.0f) ? offset : 1.0f;
+
+      value = y0 - (0.25f * (ym - yp) * offset);
+
+      if(useLog != 0u)
+      {
+        value = arm_peak_refine_exp2(value);
+      }
+    }
+  }
+
+  *pOffset = offset;
+  *pValue = value;
+}
+
+/**
+ * @} end of PeakRefine group
+ */
@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_peak_refine_q15.c
+*
+* Description:	Sub-sample peak refinement of a Q15 vector.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup PeakRefine
+ * @{
+ */
+
+/**
+ * @brief  Sub-sample refinement of a peak of a Q15 vector.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  blockSize length of the input vector.
+ * @param[in]  index index of the peak sample.
+ * @param[in]  method interpolation, ARM_PEAK_PARABOLIC or ARM_PEAK_GAUSSIAN.
+ * @param[out] *pOffset position of the peak relative to index returned here.
+ * @param[out] *pValue interpolated height of the peak in 1.15 format returned here.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The three samples are converted to single precision, which is exact for Q15.
+ * The interpolated height can exceed the peak sample and is saturated to the Q15 range.
+ */
+
+void arm_peak_refine_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t index,
+  arm_peak_refine_method method,
+  float32_t * pOffset,
+  q15_t * pValue)
+{
+  float32_t in[3];                               /* Left, peak and right samples */
+  float32_t value;                               /* Interpolated height */
+
+  if((index > 0u) && ((index + 1u) < blockSize))
+  {
+    in[0] = (float32_t) pSrc[index - 1u];
+    in[1] = (float32_t) pSrc[index];
+    in[2] = (float32_t) pSrc[index + 1u];
+
+    /* The fits are scale invariant, so the raw values are used */
+    arm_peak_refine_f32(in, 3u, 1u, method, pOffset, &value);
+
+    *pValue = (value < 32767.0f) ? (q15_t) value : 0x7FFF;
+  }
+  else
+  {
+    *pOffset = 0.0f;
+    *pValue = pSrc[index];
+  }
+}
+
+/**
+ * @} end of PeakRefine group
+ */
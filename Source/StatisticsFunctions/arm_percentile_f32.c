@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_percentile_f32.c
+*
+* Description:	Floating-point percentile function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Percentile Percentile
+ *
+ * Computes a percentile of an array of data, such as the median (percentile 0.5)
+ * or the 95th percentile (0.95) of a block of sensor samples.
+ *
+ * \par Algorithm
+ * The percentile <code>p</code> of <code>N</code> samples is taken at the rank
+ * <code>r = p * (N - 1)</code> of the sorted samples, interpolating linearly between the
+ * samples of rank <code>floor(r)</code> and <code>floor(r) + 1</code>. For an odd
+ * <code>N</code> the median is the middle sample, and for an even <code>N</code> it is the
+ * mean of the two middle samples.
+ *
+ * \par
+ * Instead of sorting, the sample of rank <code>floor(r)</code> is found with Hoare's
+ * selection algorithm (quickselect), which partitions the data around a pivot and only
+ * continues into the side that contains the requested rank. This takes <code>O(N)</code>
+ * operations on average, compared with <code>O(N log N)</code> for a sort. After selection,
+ * every sample above that rank is not smaller, so the next sample is their minimum.
+ *
+ * \par
+ * The input is copied to the scratch buffer, which is reordered, so the input vector is
+ * left unchanged. <code>pScratch</code> may point to <code>pSrc</code> when the input does not
+ * need to be preserved. Percentiles outside <code>[0, 1]</code> are clamped, and an empty
+ * vector gives 0.
+ */
+
+/**
+ * @addtogroup Percentile
+ * @{
+ */
+
+/**
+ * @brief  Percentile of a floating-point vector.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  blockSize length of the input vector.
+ * @param[in]  percentile requested percentile as a fraction, 0.0 to 1.0. The median is 0.5.
+ * @param[in]  *pScratch points to a scratch buffer of blockSize values.
+ * @param[out] *pResult percentile value returned here.
+ * @return none.
+ */
+
+void arm_percentile_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t percentile,
+  float32_t * pScratch,
+  float32_t * pResult)
+{
+  float32_t *pA = pScratch;                      /* data being partitioned */
+  float32_t pivot, t;                            /* pivot and temporary value */
+  float32_t rank, frac;                          /* rank and its fractional part */
+  float32_t lowVal, highVal;                     /* samples at rank k and k + 1 */
+  int32_t lo, hi, i, j;                          /* partition bounds and indices */
+  int32_t k;                                     /* selected rank */
+
+  if(blockSize == 0u)
+  {
+    *pResult = 0.0f;
+  }
+  else
+  {
+    if(pScratch != pSrc)
+    {
+      arm_copy_f32(pSrc, pScratch, blockSize);
+    }
+
+    /* Rank of the percentile, clamped to the data */
+    percentile = (percentile > 0.0f) ? percentile : 0.0f;
+    percentile = (percentile < 1.0f) ? percentile : 1.0f;
+    rank = percentile * (float32_t) (blockSize - 1u);
+    k = (int32_t) rank;
+    k = (k < ((int32_t) blockSize - 1)) ? k : ((int32_t) blockSize - 1);
+    frac = rank - (float32_t) k;
+
+    /* Hoare selection: partition around the current sample of rank k
+     ** and keep the side that contains rank k */
+    lo = 0;
+    hi = (int32_t) blockSize - 1;
+
+    while(lo < hi)
+    {
+      pivot = pA[k];
+      i = lo;
+      j = hi;
+
+      do
+      {
+        while(pA[i] < pivot)
+        {
+          i++;
+        }
+
+        while(pivot < pA[j])
+        {
+          j--;
+        }
+
+        if(i <= j)
+        {
+          t = pA[i];
+          pA[i] = pA[j];
+          pA[j] = t;
+          i++;
+          j--;
+        }
+      } while(i <= j);
+
+      if(j < k)
+      {
+        lo = i;
+      }
+
+      if(k < i)
+      {
+        hi = j;
+      }
+    }
+
+    lowVal = pA[k];
+    highVal = lowVal;
+
+    /* The sample of rank k + 1 is the smallest of the samples above rank k */
+    if((frac > 0.0f) && ((k + 1) < (int32_t) blockSize))
+    {
+      highVal = pA[k + 1];
+
+      for (i = k + 2; i < (int32_t) blockSize; i++)
+      {
+        highVal = (pA[i] < highVal) ? pA[i] : highVal;
+      }
+    }
+
+    *pResult = lowVal + (frac * (highVal - lowVal));
+  }
+}
+
+/**
+ * @} end of Percentile group
+ */
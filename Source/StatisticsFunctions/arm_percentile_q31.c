@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_percentile_q31.c
+*
+* Description:	Q31 percentile function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Percentile
+ * @{
+ */
+
+/**
+ * @brief  Percentile of a Q31 vector.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  blockSize length of the input vector.
+ * @param[in]  percentile requested percentile as a fraction, 0.0 to 1.0. The median is 0.5.
+ * @param[in]  *pScratch points to a scratch buffer of blockSize values.
+ * @param[out] *pResult percentile value returned here.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The interpolation is computed in 64-bit arithmetic with the fraction in 2.30 format.
+ * The result lies between the two samples, so it cannot overflow.
+ * @return none.
+ */
+
+void arm_percentile_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  float32_t percentile,
+  q31_t * pScratch,
+  q31_t * pResult)
+{
+  q31_t *pA = pScratch;                          /* data being partitioned */
+  q31_t pivot, t;                                /* pivot and temporary value */
+  float32_t rank, frac;                          /* rank and its fractional part */
+  q31_t lowVal, highVal;                         /* samples at rank k and k + 1 */
+  int32_t lo, hi, i, j;                          /* partition bounds and indices */
+  int32_t k;                                     /* selected rank */
+  q63_t diff;                                    /* difference of the two samples */
+
+  if(blockSize == 0u)
+  {
+    *pResult = 0;
+  }
+  else
+  {
+    if(pScratch != pSrc)
+    {
+      arm_copy_q31(pSrc, pScratch, blockSize);
+    }
+
+    /* Rank of the percentile, clamped to the data */
+    percentile = (percentile > 0.0f) ? percentile : 0.0f;
+    percentile = (percentile < 1.0f) ? percentile : 1.0f;
+    rank = percentile * (float32_t) (blockSize - 1u);
+    k = (int32_t) rank;
+    k = (k < ((int32_t) blockSize - 1)) ? k : ((int32_t) blockSize - 1);
+    frac = rank - (float32_t) k;
+
+    /* Hoare selection: partition around the current sample of rank k
+     ** and keep the side that contains rank k */
+    lo = 0;
+    hi = (int32_t) blockSize - 1;
+
+    while(lo < hi)
+    {
+      pivot = pA[k];
+      i = lo;
+      j = hi;
+
+      do
+      {
+        while(pA[i] < pivot)
+        {
+          i++;
+        }
+
+        while(pivot < pA[j])
+        {
+          j--;
+        }
+
+        if(i <= j)
+        {
+          t = pA[i];
+          pA[i] = pA[j];
+          pA[j] = t;
+          i++;
+          j--;
+        }
+      } while(i <= j);
+
+      if(j < k)
+      {
+        lo = i;
+      }
+
+      if(k < i)
+      {
+        hi = j;
+      }
+    }
+
+    lowVal = pA[k];
+    highVal = lowVal;
+
+    /* The sample of rank k + 1 is the smallest of the samples above rank k */
+    if((frac > 0.0f) && ((k + 1) < (int32_t) blockSize))
+    {
+      highVal = pA[k + 1];
+
+      for (i = k + 2; i < (int32_t) blockSize; i++)
+      {
+        highVal = (pA[i] < highVal) ? pA[i] : highVal;
+      }
+    }
+
+    /* Interpolate with the fraction in 2.30 format */
+    diff = (q63_t) highVal - lowVal;
+    *pResult = lowVal + (q31_t) ((diff * (q31_t) (frac * 1073741824.0f)) >> 30);
+  }
+}
+
+/**
+ * @} end of Percentile group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_sliding_stats_get_f32.c
+*
+* Description:	Floating-point sliding window statistics result function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Returns the floating-point statistics of the current window.
+ * @param[in]  *S points to an instance of the floating-point sliding window statistics structure.
+ * @param[out] *pResult points to the statistics.
+ * @return none.
+ *
+ * \par
+ * With no samples every statistic is 0, and with one sample the variance is 0.
+ */
+
+void arm_sliding_stats_get_f32(
+  const arm_sliding_stats_instance_f32 * S,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t var = 0.0f;                          /* variance */
+  float32_t meanSq = 0.0f;                       /* mean of the squares */
+  uint32_t oldest;                               /* history position of the oldest sample */
+
+  if(S->count > 1u)
+  {
+    var = S->m2 / (float32_t) (S->count - 1u);
+
+    /* Rounding can leave a tiny negative sum of squared deviations */
+    var = (var > 0.0f) ? var : 0.0f;
+  }
+
+  if(S->count > 0u)
+  {
+    meanSq = S->sumSq / (float32_t) S->count;
+
+    /* The running sum of squares may also round below 0 */
+    meanSq = (meanSq > 0.0f) ? meanSq : 0.0f;
+  }
+
+  pResult->mean = S->mean;
+  pResult->var = var;
+  arm_sqrt_f32(var, &pResult->std);
+  arm_sqrt_f32(meanSq, &pResult->rms);
+  pResult->power = S->sumSq;
+
+  /* Positions are counted from the oldest sample in the window */
+  oldest = (S->count == S->windowLen) ? S->head : 0u;
+
+  pResult->min = 0.0f;
+  pResult->minIndex = 0u;
+  pResult->max = 0.0f;
+  pResult->maxIndex = 0u;
+
+  if((S->pMinQueue != NULL) && (S->minLen > 0u))
+  {
+    pResult->min = S->pHistory[S->pMinQueue[S->minFront]];
+    pResult->minIndex = ((S->pMinQueue[S->minFront] + S->windowLen) - oldest) % S->windowLen;
+  }
+
+  if((S->pMaxQueue != NULL) && (S->maxLen > 0u))
+  {
+    pResult->max = S->pHistory[S->pMaxQueue[S->maxFront]];
+    pResult->maxIndex = ((S->pMaxQueue[S->maxFront] + S->windowLen) - oldest) % S->windowLen;
+  }
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_sliding_stats_get_q31.c
+*
+* Description:	Q31 sliding window statistics result function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/*
+ * @brief  Square root of a non-negative 2.62 value, rounded and saturated to 1.31 format.
+ *
+ * The input is normalized by an even shift before arm_sqrt_q31(), and the result is
+ * shifted back by half of it, so small values keep their precision.
+ */
+
+static q31_t arm_stats_sqrt_q62(
+  q63_t in)
+{
+  uint32_t hi = (uint32_t) (in >> 32);           /* upper word of the input */
+  int32_t shift;                                 /* half of the normalization shift */
+  q31_t root;                                    /* square root of the normalized input */
+
+  if(in <= 0)
+  {
+    return (0);
+  }
+
+  if(in >= 0x4000000000000000LL)
+  {
+    return (0x7FFFFFFF);
+  }
+
+  /* in << (2 * shift) lies in [2^60, 2^62) */
+  shift = (int32_t) ((hi != 0u) ? __CLZ(hi) : (32u + __CLZ((uint32_t) in)));
+  shift = (shift - 2) >> 1;
+
+  arm_sqrt_q31((q31_t) ((in << (2 * shift)) >> 31), &root);
+
+  if(shift > 0)
+  {
+    root = (q31_t) (((q63_t) root + ((q63_t) 1 << (shift - 1))) >> shift);
+  }
+
+  return (root);
+}
+
+/**
+ * @brief  Returns the Q31 statistics of the current window.
+ * @param[in]  *S points to an instance of the Q31 sliding window statistics structure.
+ * @param[out] *pResult points to the statistics.
+ * @return none.
+ *
+ * \par
+ * With no samples every statistic is 0, and with one sample the variance is 0.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The mean, variance, standard deviation and RMS value are rounded and saturated to
+ * 1.31 format. The power is the sum of squares of the window in 33.31 format.
+ * The standard deviation and RMS value are the square roots of the variance and of
+ * the mean of the squares before they are rounded from 16.48 format, so they stay
+ * accurate when the variance is far below 1 LSB.
+ */
+
+void arm_sliding_stats_get_q31(
+  const arm_sliding_stats_instance_q31 * S,
+  arm_stats_result_q31 * pResult)
+{
+  q63_t n = (q63_t) S->count;                    /* number of samples */
+  q63_t sum = S->sum;                            /* sum of the samples */
+  q63_t mean = 0;                                /* rounded mean */
+  q63_t r;                                       /* remainder of the mean */
+  q63_t m2;                                      /* sum of squared deviations in 16.48 format */
+  q63_t var48 = 0;                               /* variance in 16.48 format */
+  q63_t meanSq48 = 0;                            /* mean of the squares in 16.48 format */
+  uint32_t oldest;                               /* history position of the oldest sample */
+
+  if(n > 0)
+  {
+    /* Mean rounded to nearest, the division truncates towards zero */
+    mean = ((sum >= 0) ? (sum + (n >> 1)) : (sum - (n >> 1))) / n;
+    meanSq48 = (S->sumSq + (n >> 1)) / n;
+  }
+
+  if(n > 1)
+  {
+    /* M2 = sum(x^2) - N * mean^2 - 2 * r * mean - r^2 / N, in 16.48 format */
+    r = sum - (n * mean);
+
+    m2 = S->sumSq - (n * ((mean * mean) >> 14));
+    m2 -= (2 * r * mean) >> 14;
+    m2 -= ((r * r) / n) >> 14;
+
+    /* Truncation of the squares can leave a tiny negative value */
+    m2 = (m2 > 0) ? m2 : 0;
+
+    var48 = (m2 + ((n - 1) >> 1)) / (n - 1);
+  }
+
+  pResult->mean = (q31_t) mean;
+  pResult->var = clip_q63_to_q31((var48 + 0x10000) >> 17);
+
+  /* 16.48 values below 2.0 are shifted to 2.62 format for the square roots */
+  pResult->std = arm_stats_sqrt_q62((var48 < 0x2000000000000LL) ? (var48 << 14) : 0x7FFFFFFFFFFFFFFFLL);
+  pResult->rms = arm_stats_sqrt_q62((meanSq48 < 0x2000000000000LL) ? (meanSq48 << 14) : 0x7FFFFFFFFFFFFFFFLL);
+  pResult->power = (S->sumSq + 0x10000) >> 17;
+
+  /* Positions are counted from the oldest sample in the window */
+  oldest = (S->count == S->windowLen) ? S->head : 0u;
+
+  pResult->min = 0;
+  pResult->minIndex = 0u;
+  pResult->max = 0;
+  pResult->maxIndex = 0u;
+
+  if((S->pMinQueue != NULL) && (S->minLen > 0u))
+  {
+    pResult->min = S->pHistory[S->pMinQueue[S->minFront]];
+    pResult->minIndex = ((S->pMinQueue[S->minFront] + S->windowLen) - oldest) % S->windowLen;
+  }
+
+  if((S->pMaxQueue != NULL) && (S->maxLen > 0u))
+  {
+    pResult->max = S->pHistory[S->pMaxQueue[S->maxFront]];
+    pResult->maxIndex = ((S->pMaxQueue[S->maxFront] + S->windowLen) - oldest) % S->windowLen;
+  }
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_sliding_stats_init_f32.c
+*
+* Description:	Floating-point sliding window statistics initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point sliding window statistics.
+ * @param[out] *S points to an instance of the floating-point sliding window statistics structure.
+ * @param[in]  windowLen number of samples in the window, 1 to 65535.
+ * @param[in]  *pHistory points to the history buffer of windowLen samples.
+ * @param[in]  *pMinQueue points to the minimum queue of windowLen entries, or NULL.
+ * @param[in]  *pMaxQueue points to the maximum queue of windowLen entries, or NULL.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowLen</code> is 0 or the history buffer is missing.
+ *
+ * \par
+ * The function also empties the window, and may be called again to restart the statistics.
+ */
+
+arm_status arm_sliding_stats_init_f32(
+  arm_sliding_stats_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t * pHistory,
+  uint16_t * pMinQueue,
+  uint16_t * pMaxQueue)
+{
+  arm_status status;                             /* status of initialization */
+
+  if((windowLen == 0u) || (pHistory == NULL))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    S->windowLen = windowLen;
+    S->count = 0u;
+    S->head = 0u;
+    S->minFront = 0u;
+    S->minLen = 0u;
+    S->maxFront = 0u;
+    S->maxLen = 0u;
+    S->pHistory = pHistory;
+    S->pMinQueue = pMinQueue;
+    S->pMaxQueue = pMaxQueue;
+    S->sinceSync = 0u;
+    S->mean = 0.0f;
+    S->m2 = 0.0f;
+    S->sumSq = 0.0f;
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_sliding_stats_init_q31.c
+*
+* Description:	Q31 sliding window statistics initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup SlidingStats Sliding Window Statistics
+ *
+ * Tracks the mean, variance, standard deviation, RMS value, power, minimum and
+ * maximum of the last <code>windowLen</code> samples of a signal. Each new sample
+ * updates the statistics in constant time, instead of recomputing arm_mean, arm_rms
+ * or arm_var over the whole window each time the result is needed.
+ *
+ * \par
+ * The instance keeps a history buffer of <code>windowLen</code> samples. When the window
+ * is full, each new sample replaces the oldest one, which is subtracted from the running
+ * sums. Until the window is full, the statistics cover the samples received so far.
+ * Samples are added in blocks of any length, including 1, with the update functions,
+ * and the get functions return the statistics of the current window in an
+ * arm_stats_result structure, as for the statistics summary. The minimum and maximum
+ * positions count from the oldest sample in the window. When several samples share the
+ * minimum or maximum value, the newest one is reported, since it stays in the window longest.
+ *
+ * \par Minimum and maximum
+ * The minimum and maximum are tracked with monotonic queues of history positions.
+ * A new sample removes from the back of the queue every sample it dominates, and the
+ * front of the queue leaves when its sample leaves the window. Each sample enters and
+ * leaves each queue at most once, so the cost is constant per sample on average.
+ * Each queue holds up to <code>windowLen</code> positions. Passing NULL for a queue
+ * disables that statistic and returns 0 for it.
+ *
+ * \par Fixed-point running sums
+ * The Q31 and Q15 functions keep the sum and the sum of squares of the window in 64-bit
+ * accumulators. Each square is truncated the same way when it enters and when it leaves
+ * the window, so the sums stay exact and do not drift however long the filter runs.
+ * The variance is formed from these sums with integer arithmetic as in arm_stats_get_q31().
+ *
+ * \par Floating-point running moments
+ * The floating-point functions update the mean and the sum of squared deviations with the
+ * sliding form of Welford's method, which does not cancel on signals with a large offset.
+ * Rounding errors are removed by recomputing the moments from the history every
+ * <code>windowLen</code> samples, which costs about two operations per sample on average.
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 sliding window statistics.
+ * @param[out] *S points to an instance of the Q31 sliding window statistics structure.
+ * @param[in]  windowLen number of samples in the window, 1 to 32767.
+ * @param[in]  *pHistory points to the history buffer of windowLen samples.
+ * @param[in]  *pMinQueue points to the minimum queue of windowLen entries, or NULL.
+ * @param[in]  *pMaxQueue points to the maximum queue of windowLen entries, or NULL.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowLen</code> is out of range or the history buffer is missing.
+ *
+ * \par
+ * The function also empties the window, and may be called again to restart the statistics.
+ */
+
+arm_status arm_sliding_stats_init_q31(
+  arm_sliding_stats_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t * pHistory,
+  uint16_t * pMinQueue,
+  uint16_t * pMaxQueue)
+{
+  arm_status status;                             /* status of initialization */
+
+  if((windowLen == 0u) || (windowLen > 0x7FFFu) || (pHistory == NULL))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    S->windowLen = windowLen;
+    S->count = 0u;
+    S->head = 0u;
+    S->minFront = 0u;
+    S->minLen = 0u;
+    S->maxFront = 0u;
+    S->maxLen = 0u;
+    S->pHistory = pHistory;
+    S->pMinQueue = pMinQueue;
+    S->pMaxQueue = pMaxQueue;
+    S->sum = 0;
+    S->sumSq = 0;
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_sliding_stats_update_f32.c
+*
+* Description:	Floating-point sliding window statistics update function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of floating-point samples to the sliding window statistics.
+ * @param[in,out] *S points to an instance of the floating-point sliding window statistics structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[in]     blockSize number of samples in the block.
+ * @return none.
+ *
+ * \par
+ * While the window fills, the mean and sum of squared deviations follow Welford's update.
+ * Once it is full, a sample <code>x</code> replacing the oldest sample <code>y</code> gives
+ * <pre>
+ *     mean' = mean + (x - y) / N
+ *     M2'   = M2 + (x - y) * ((x - mean') + (y - mean))  </pre>
+ * Every <code>windowLen</code> replacements the moments are recomputed from the history
+ * to remove the accumulated rounding error.
+ */
+
+void arm_sliding_stats_update_f32(
+  arm_sliding_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  float32_t *pHist = S->pHistory;                /* history buffer */
+  uint16_t *pMinQ = S->pMinQueue;                /* minimum queue */
+  uint16_t *pMaxQ = S->pMaxQueue;                /* maximum queue */
+  uint32_t windowLen = S->windowLen;             /* window length */
+  uint32_t count = S->count;                     /* samples in the window */
+  uint32_t head = S->head;                       /* history position of the next sample */
+  uint32_t sinceSync = S->sinceSync;             /* replacements since the last recomputation */
+  uint32_t minFront = S->minFront, minLen = S->minLen;  /* minimum queue front and length */
+  uint32_t maxFront = S->maxFront, maxLen = S->maxLen;  /* maximum queue front and length */
+  uint32_t back;                                 /* queue position of the last entry */
+  uint32_t i;                                    /* loop counter */
+  float32_t mean = S->mean, m2 = S->m2, sumSq = S->sumSq;  /* running moments */
+  float32_t invLen = 1.0f / (float32_t) windowLen;  /* reciprocal of the window length */
+  float32_t in, out, d, meanOld, sum;            /* temporary variables */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(count == windowLen)
+    {
+      /* The oldest sample is replaced by the new one */
+      out = pHist[head];
+      d = in - out;
+      meanOld = mean;
+      mean += d * invLen;
+      m2 += d * ((in - mean) + (out - meanOld));
+      sumSq += (in * in) - (out * out);
+
+      /* and leaves the queues, if it is at their front */
+      if((pMinQ != NULL) && (pMinQ[minFront] == head))
+      {
+        minFront = ((minFront + 1u) == windowLen) ? 0u : (minFront + 1u);
+        minLen--;
+      }
+
+      if((pMaxQ != NULL) && (pMaxQ[maxFront] == head))
+      {
+        maxFront = ((maxFront + 1u) == windowLen) ? 0u : (maxFront + 1u);
+        maxLen--;
+      }
+
+      sinceSync++;
+    }
+    else
+    {
+      /* Welford update while the window fills */
+      count++;
+      d = in - mean;
+      mean += d / (float32_t) count;
+      m2 += d * (in - mean);
+      sumSq += in * in;
+    }
+
+    pHist[head] = in;
+
+    if(pMinQ != NULL)
+    {
+      /* Drop the samples that can no longer be the minimum */
+      back = minFront + minLen;
+
+      while((minLen > 0u) && (pHist[pMinQ[(back > windowLen) ? (back - windowLen - 1u) : (back - 1u)]] >= in))
+      {
+        minLen--;
+        back--;
+      }
+
+      pMinQ[(back >= windowLen) ? (back - windowLen) : back] = (uint16_t) head;
+      minLen++;
+    }
+
+    if(pMaxQ != NULL)
+    {
+      /* Drop the samples that can no longer be the maximum */
+      back = maxFront + maxLen;
+
+      while((maxLen > 0u) && (pHist[pMaxQ[(back > windowLen) ? (back - windowLen - 1u) : (back - 1u)]] <= in))
+      {
+        maxLen--;
+        back--;
+      }
+
+      pMaxQ[(back >= windowLen) ? (back - windowLen) : back] = (uint16_t) head;
+      maxLen++;
+    }
+
+    head = ((head + 1u) == windowLen) ? 0u : (head + 1u);
+
+    if(sinceSync == windowLen)
+    {
+      /* Recompute the moments from the history in two passes */
+      sum = 0.0f;
+      sumSq = 0.0f;
+
+      for (i = 0u; i < windowLen; i++)
+      {
+        sum += pHist[i];
+        sumSq += pHist[i] * pHist[i];
+      }
+
+      mean = sum * invLen;
+      m2 = 0.0f;
+
+      for (i = 0u; i < windowLen; i++)
+      {
+        d = pHist[i] - mean;
+        m2 += d * d;
+      }
+
+      sinceSync = 0u;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->count = (uint16_t) count;
+  S->head = (uint16_t) head;
+  S->sinceSync = (uint16_t) sinceSync;
+  S->minFront = (uint16_t) minFront;
+  S->minLen = (uint16_t) minLen;
+  S->maxFront = (uint16_t) maxFront;
+  S->maxLen = (uint16_t) maxLen;
+  S->mean = mean;
+  S->m2 = m2;
+  S->sumSq = sumSq;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_sliding_stats_update_q15.c
+*
+* Description:	Q15 sliding window statistics update function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of Q15 samples to the sliding window statistics.
+ * @param[in,out] *S points to an instance of the Q15 sliding window statistics structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[in]     blockSize number of samples in the block.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum of the window and the 2.30 squares are kept exactly in 64-bit accumulators,
+ * in 49.15 and 34.30 format.
+ */
+
+void arm_sliding_stats_update_q15(
+  arm_sliding_stats_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  q15_t *pHist = S->pHistory;                    /* history buffer */
+  uint16_t *pMinQ = S->pMinQueue;                /* minimum queue */
+  uint16_t *pMaxQ = S->pMaxQueue;                /* maximum queue */
+  uint32_t windowLen = S->windowLen;             /* window length */
+  uint32_t count = S->count;                     /* samples in the window */
+  uint32_t head = S->head;                       /* history position of the next sample */
+  uint32_t minFront = S->minFront, minLen = S->minLen;  /* minimum queue front and length */
+  uint32_t maxFront = S->maxFront, maxLen = S->maxLen;  /* maximum queue front and length */
+  uint32_t back;                                 /* queue position of the last entry */
+  q63_t sum = S->sum, sumSq = S->sumSq;          /* running sums */
+  q15_t in, out;                                 /* entering and leaving samples */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(count == windowLen)
+    {
+      /* The oldest sample leaves the window */
+      out = pHist[head];
+      sum -= out;
+      sumSq -= (q31_t) out * out;
+
+      /* and the queues, if it is at their front */
+      if((pMinQ != NULL) && (pMinQ[minFront] == head))
+      {
+        minFront = ((minFront + 1u) == windowLen) ? 0u : (minFront + 1u);
+        minLen--;
+      }
+
+      if((pMaxQ != NULL) && (pMaxQ[maxFront] == head))
+      {
+        maxFront = ((maxFront + 1u) == windowLen) ? 0u : (maxFront + 1u);
+        maxLen--;
+      }
+    }
+    else
+    {
+      count++;
+    }
+
+    pHist[head] = in;
+    sum += in;
+    sumSq += (q31_t) in * in;
+
+    if(pMinQ != NULL)
+    {
+      /* Drop the samples that can no longer be the minimum */
+      back = minFront + minLen;
+
+      while((minLen > 0u) && (pHist[pMinQ[(back > windowLen) ? (back - windowLen - 1u) : (back - 1u)]] >= in))
+      {
+        minLen--;
+        back--;
+      }
+
+      pMinQ[(back >= windowLen) ? (back - windowLen) : back] = (uint16_t) head;
+      minLen++;
+    }
+
+    if(pMaxQ != NULL)
+    {
+      /* Drop the samples that can no longer be the maximum */
+      back = maxFront + maxLen;
+
+      while((maxLen > 0u) && (pHist[pMaxQ[(back > windowLen) ? (back - windowLen - 1u) : (back - 1u)]] <= in))
+      {
+        maxLen--;
+        back--;
+      }
+
+      pMaxQ[(back >= windowLen) ? (back - windowLen) : back] = (uint16_t) head;
+      maxLen++;
+    }
+
+    head = ((head + 1u) == windowLen) ? 0u : (head + 1u);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->count = (uint16_t) count;
+  S->head = (uint16_t) head;
+  S->minFront = (uint16_t) minFront;
+  S->minLen = (uint16_t) minLen;
+  S->maxFront = (uint16_t) maxFront;
+  S->maxLen = (uint16_t) maxLen;
+  S->sum = sum;
+  S->sumSq = sumSq;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
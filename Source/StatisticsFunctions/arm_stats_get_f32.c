@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_stats_get_f32.c
+*
+* Description:	Floating-point streaming statistics result function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StatsSummary
+ * @{
+ */
+
+/**
+ * @brief  Returns the floating-point statistics accumulated since the last reset.
+ * @param[in]  *S points to an instance of the floating-point statistics structure.
+ * @param[out] *pResult points to the statistics.
+ * @return none.
+ *
+ * \par
+ * With no samples every statistic is 0, and with one sample the variance is 0.
+ */
+
+void arm_stats_get_f32(
+  const arm_stats_instance_f32 * S,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t var = 0.0f;                          /* variance */
+  float32_t meanSq = 0.0f;                       /* mean of the squares */
+
+  if(S->count > 1u)
+  {
+    var = S->m2 / (float32_t) (S->count - 1u);
+
+    /* Rounding can leave a tiny negative sum of squared deviations */
+    var = (var > 0.0f) ? var : 0.0f;
+  }
+
+  if(S->count > 0u)
+  {
+    meanSq = S->sumSq / (float32_t) S->count;
+  }
+
+  pResult->mean = S->mean;
+  pResult->var = var;
+  arm_sqrt_f32(var, &pResult->std);
+  arm_sqrt_f32(meanSq, &pResult->rms);
+  pResult->power = S->sumSq;
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+ * @} end of StatsSummary group
+ */
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_stats_get_q15.c
+*
+* Description:	Q15 streaming statistics result function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StatsSummary
+ * @{
+ */
+
+/**
+ * @brief  Returns the Q15 statistics accumulated since the last reset.
+ * @param[in]  *S points to an instance of the Q15 statistics structure.
+ * @param[out] *pResult points to the statistics.
+ * @return none.
+ *
+ * \par
+ * With no samples every statistic is 0, and with one sample the variance is 0.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The mean, variance, standard deviation and RMS value are rounded and saturated to
+ * 1.15 format. The standard deviation and RMS value are the square roots of the variance
+ * and of the mean of the squares in 2.30 format, taken before these are rounded.
+ * The power is the sum of squares in 34.30 format, as returned by arm_power_q15().
+ * The sum of squared deviations is computed exactly in 2.30 units as
+ * <pre>
+ *     M2 = sum(x^2) - N * mean^2 - 2 * r * mean - r^2 / N  </pre>
+ * where <code>mean</code> is the rounded mean and <code>r = sum(x) - N * mean</code> is the
+ * exact remainder of the division, so the variance has no cancellation error.
+ */
+
+void arm_stats_get_q15(
+  const arm_stats_instance_q15 * S,
+  arm_stats_result_q15 * pResult)
+{
+  q63_t n = (q63_t) S->count;                    /* number of samples */
+  q63_t sum = S->sum;                            /* sum of the samples */
+  q63_t mean = 0;                                /* rounded mean */
+  q63_t r;                                       /* remainder of the mean */
+  q63_t m2;                                      /* sum of squared deviations in 34.30 format */
+  q63_t var30 = 0;                               /* variance in 2.30 format */
+  q63_t meanSq30 = 0;                            /* mean of the squares in 2.30 format */
+  q31_t root;                                    /* square root in 1.31 format */
+
+  if(n > 0)
+  {
+    /* Mean rounded to nearest, the division truncates towards zero */
+    mean = ((sum >= 0) ? (sum + (n >> 1)) : (sum - (n >> 1))) / n;
+    meanSq30 = (S->sumSq + (n >> 1)) / n;
+  }
+
+  if(n > 1)
+  {
+    r = sum - (n * mean);
+
+    m2 = S->sumSq - (n * mean * mean) - (2 * r * mean) - (((r * r) + (n >> 1)) / n);
+
+    var30 = (m2 + ((n - 1) >> 1)) / (n - 1);
+  }
+
+  pResult->mean = (q15_t) mean;
+  pResult->var = (q15_t) __SSAT((q31_t) ((var30 + 0x4000) >> 15), 16);
+
+  /* The square roots are taken before the 2.30 values are rounded to 1.15 format */
+  arm_sqrt_q31(clip_q63_to_q31(var30 << 1), &root);
+  pResult->std = (q15_t) __SSAT((q31_t) (((q63_t) root + 0x8000) >> 16), 16);
+  arm_sqrt_q31(clip_q63_to_q31(meanSq30 << 1), &root);
+  pResult->rms = (q15_t) __SSAT((q31_t) (((q63_t) root + 0x8000) >> 16), 16);
+  pResult->power = S->sumSq;
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+ * @} end of StatsSummary group
+ */
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_stats_get_q31.c
+*
+* Description:	Q31 streaming statistics result function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StatsSummary
+ * @{
+ */
+
+/*
+ * @brief  Square root of a non-negative 2.62 value, rounded and saturated to 1.31 format.
+ *
+ * The input is normalized by an even shift before arm_sqrt_q31(), and the result is
+ * shifted back by half of it, so small values keep their precision.
+ */
+
+static q31_t arm_stats_sqrt_q62(
+  q63_t in)
+{
+  uint32_t hi = (uint32_t) (in >> 32);           /* upper word of the input */
+  int32_t shift;                                 /* half of the normalization shift */
+  q31_t root;                                    /* square root of the normalized input */
+
+  if(in <= 0)
+  {
+    return (0);
+  }
+
+  if(in >= 0x4000000000000000LL)
+  {
+    return (0x7FFFFFFF);
+  }
+
+  /* in << (2 * shift) lies in [2^60, 2^62) */
+  shift = (int32_t) ((hi != 0u) ? __CLZ(hi) : (32u + __CLZ((uint32_t) in)));
+  shift = (shift - 2) >> 1;
+
+  arm_sqrt_q31((q31_t) ((in << (2 * shift)) >> 31), &root);
+
+  if(shift > 0)
+  {
+    root = (q31_t) (((q63_t) root + ((q63_t) 1 << (shift - 1))) >> shift);
+  }
+
+  return (root);
+}
+
+/**
+ * @brief  Returns the Q31 statistics accumulated since the last reset.
+ * @param[in]  *S points to an instance of the Q31 statistics structure.
+ * @param[out] *pResult points to the statistics.
+ * @return none.
+ *
+ * \par
+ * With no samples every statistic is 0, and with one sample the variance is 0.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The mean, variance, standard deviation and RMS value are rounded and saturated to
+ * 1.31 format. The power is the sum of squares in 33.31 format.
+ * The sum of squared deviations is computed as
+ * <pre>
+ *     M2 = sum(x^2) - N * mean^2 - 2 * r * mean - r^2 / N  </pre>
+ * where <code>mean</code> is the rounded mean and <code>r = sum(x) - N * mean</code> is the
+ * exact remainder of the division. The products are kept to 2.62 precision, so the only
+ * rounding is that of the accumulated sum of squares, whatever the offset of the signal.
+ * The variance and the mean of the squares are divided out in 2.62 format, and the
+ * standard deviation and RMS value are the square roots of these 2.62 values. They stay
+ * accurate when the variance is far below 1 LSB.
+ */
+
+void arm_stats_get_q31(
+  const arm_stats_instance_q31 * S,
+  arm_stats_result_q31 * pResult)
+{
+  q63_t n = (q63_t) S->count;                    /* number of samples */
+  q63_t sum = S->sum;                            /* sum of the samples */
+  q63_t mean = 0;                                /* rounded mean */
+  q63_t r;                                       /* remainder of the mean */
+  q63_t m2;                                      /* sum of squared deviations in 1.31 units */
+  q63_t m2Low;                                   /* fractional part of m2, in 2.62 units */
+  q63_t t;                                       /* partial product */
+  q63_t var62 = 0;                               /* variance in 2.62 format */
+  q63_t meanSq62 = 0;                            /* mean of the squares in 2.62 format */
+
+  if(n > 0)
+  {
+    /* Mean rounded to nearest, the division truncates towards zero */
+    mean = ((sum >= 0) ? (sum + (n >> 1)) : (sum - (n >> 1))) / n;
+    /* sumSq / N in 2.62 format, as a long division to avoid overflowing sumSq << 31 */
+    meanSq62 = ((S->sumSq / n) << 31) + ((((S->sumSq % n) << 31) + (n >> 1)) / n);
+  }
+
+  if(n > 1)
+  {
+    r = sum - (n * mean);
+
+    /* N * mean^2: the 2.62 square is split so that the product cannot overflow */
+    t = mean * mean;
+    m2 = S->sumSq - (n * (t >> 31));
+    t = n * (t & 0x7FFFFFFF);
+    m2 -= t >> 31;
+    m2Low = t & 0x7FFFFFFF;
+
+    /* 2 * r * mean, |r| <= N / 2 */
+    t = 2 * r * mean;
+    m2 -= t >> 31;
+    m2Low += t & 0x7FFFFFFF;
+
+    /* r^2 / N, below 2^30 */
+    m2Low += ((r * r) + (n >> 1)) / n;
+
+    /* M2 = m2 * 2^31 - m2Low, carried so that the fractional part is in [0, 2^31) */
+    t = (m2Low + 0x7FFFFFFF) >> 31;
+    m2 -= t;
+    m2Low = (t << 31) - m2Low;
+
+    /* Rounding of the sum of squares can leave a tiny negative value */
+    if(m2 < 0)
+    {
+      m2 = 0;
+      m2Low = 0;
+    }
+
+    /* M2 / (N - 1) in 2.62 format, saturated below 2.0 */
+    t = m2 / (n - 1);
+    var62 = (t > 0x7FFFFFFF) ? 0x7FFFFFFFFFFFFFFFLL :
+      ((t << 31) + (((((m2 % (n - 1)) << 31) + m2Low) + ((n - 1) >> 1)) / (n - 1)));
+  }
+
+  pResult->mean = (q31_t) mean;
+  pResult->var = clip_q63_to_q31((var62 >> 31) + ((var62 >> 30) & 1));
+  pResult->std = arm_stats_sqrt_q62(var62);
+  pResult->rms = arm_stats_sqrt_q62(meanSq62);
+  pResult->power = S->sumSq;
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+ * @} end of StatsSummary group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_stats_reset_f32.c
+*
+* Description:	Floating-point streaming statistics reset function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup StatsSummary Statistics Summary
+ *
+ * Computes the mean, variance, standard deviation, RMS value, power, minimum and
+ * maximum of a signal, together with the positions of the minimum and maximum, in a
+ * single pass over the data. The result matches calling arm_mean, arm_var, arm_std,
+ * arm_rms, arm_power, arm_min and arm_max on the same data, except for the precision
+ * of the variance described below.
+ *
+ * \par
+ * The statistics can be computed for one buffer with the summary functions,
+ * for example arm_stats_summary_f32(), or accumulated across blocks with an instance:
+ * <pre>
+ *     arm_stats_reset_f32(&S);
+ *     for each block
+ *         arm_stats_update_f32(&S, pBlock, blockSize);
+ *     arm_stats_get_f32(&S, &result);  </pre>
+ * The minimum and maximum positions count samples from the last reset.
+ * As in arm_min and arm_max, the first occurrence is reported.
+ * The variance and standard deviation use the <code>N - 1</code> normalization of arm_var.
+ *
+ * \par Numerical stability
+ * The variance is not computed as <code>(sum(x^2) - sum(x)^2 / N) / (N - 1)</code> in
+ * floating-point. That form cancels when the signal has a large offset relative to its
+ * spread, which is typical of sensor data.
+ * - The floating-point functions split the data into chunks of 32 samples. Each chunk
+ *   accumulates the sum and the sum of squares of its samples minus the first sample of
+ *   the chunk. The chunk mean and sum of squared deviations are then merged into the
+ *   running values with the pairwise update of Chan, Golub and LeVeque:
+ *   <pre>
+ *     delta = meanB - meanA
+ *     mean  = meanA + delta * nB / (nA + nB)
+ *     M2    = M2A + M2B + delta^2 * nA * nB / (nA + nB)  </pre>
+ *   This costs one subtraction per sample and a few operations per chunk, and has the
+ *   accuracy of Welford's per-sample update without a division per sample.
+ * - The Q31 and Q15 functions accumulate the sum of the samples exactly in 64 bits, and
+ *   the sum of squares exactly for Q15 and with rounding to 1.31 units for Q31. The sum of
+ *   squared deviations is formed from these sums with integer arithmetic that includes the
+ *   remainder of the mean, so no cancellation occurs.
+ *   The variance is accurate to about 1 LSB.
+ */
+
+/**
+ * @addtogroup StatsSummary
+ * @{
+ */
+
+/**
+ * @brief  Reset function for the floating-point streaming statistics.
+ * @param[out] *S points to an instance of the floating-point statistics structure.
+ * @return none.
+ */
+
+void arm_stats_reset_f32(
+  arm_stats_instance_f32 * S)
+{
+  S->count = 0u;
+  S->mean = 0.0f;
+  S->m2 = 0.0f;
+  S->sumSq = 0.0f;
+  S->min = 0.0f;
+  S->max = 0.0f;
+  S->minIndex = 0u;
+  S->maxIndex = 0u;
+}
+
+/**
+ * @} end of StatsSummary group
+ */
@@ -0,0 +1,47 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_stats_reset_q31.c
+*
+* Description:	Q31 streaming statistics reset function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StatsSummary
+ * @{
+ */
+
+/**
+ * @brief  Reset function for the Q31 streaming statistics.
+ * @param[out] *S points to an instance of the Q31 statistics structure.
+ * @return none.
+ */
+
+void arm_stats_reset_q31(
+  arm_stats_instance_q31 * S)
+{
+  S->count = 0u;
+  S->sum = 0;
+  S->sumSq = 0;
+  S->min = 0;
+  S->max = 0;
+  S->minIndex = 0u;
+  S->maxIndex = 0u;
+}
+
+/**
+ * @} end of StatsSummary group
+ */
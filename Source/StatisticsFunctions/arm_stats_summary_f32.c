@@ -0,0 +1,49 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_stats_summary_f32.c
+*
+* Description:	Single pass floating-point statistics summary function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StatsSummary
+ * @{
+ */
+
+/**
+ * @brief  Statistics summary of a floating-point vector.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  blockSize length of the input vector.
+ * @param[out] *pResult points to the statistics.
+ * @return none.
+ */
+
+void arm_stats_summary_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult)
+{
+  arm_stats_instance_f32 S;                      /* statistics of this vector */
+
+  arm_stats_reset_f32(&S);
+  arm_stats_update_f32(&S, pSrc, blockSize);
+  arm_stats_get_f32(&S, pResult);
+}
+
+/**
+ * @} end of StatsSummary group
+ */
@@ -0,0 +1,49 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_stats_summary_q15.c
+*
+* Description:	Single pass Q15 statistics summary function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StatsSummary
+ * @{
+ */
+
+/**
+ * @brief  Statistics summary of a Q15 vector.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  blockSize length of the input vector.
+ * @param[out] *pResult points to the statistics.
+ * @return none.
+ */
+
+void arm_stats_summary_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q15 * pResult)
+{
+  arm_stats_instance_q15 S;                      /* statistics of this vector */
+
+  arm_stats_reset_q15(&S);
+  arm_stats_update_q15(&S, pSrc, blockSize);
+  arm_stats_get_q15(&S, pResult);
+}
+
+/**
+ * @} end of StatsSummary group
+ */
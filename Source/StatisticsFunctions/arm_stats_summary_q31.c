@@ -0,0 +1,49 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_stats_summary_q31.c
+*
+* Description:	Single pass Q31 statistics summary function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StatsSummary
+ * @{
+ */
+
+/**
+ * @brief  Statistics summary of a Q31 vector.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  blockSize length of the input vector.
+ * @param[out] *pResult points to the statistics.
+ * @return none.
+ */
+
+void arm_stats_summary_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q31 * pResult)
+{
+  arm_stats_instance_q31 S;                      /* statistics of this vector */
+
+  arm_stats_reset_q31(&S);
+  arm_stats_update_q31(&S, pSrc, blockSize);
+  arm_stats_get_q31(&S, pResult);
+}
+
+/**
+ * @} end of StatsSummary group
+ */
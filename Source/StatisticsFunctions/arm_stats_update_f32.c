@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_stats_update_f32.c
+*
+* Description:	Floating-point streaming statistics update function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StatsSummary
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of floating-point samples to the streaming statistics.
+ * @param[in,out] *S points to an instance of the floating-point statistics structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[in]     blockSize number of samples in the block.
+ * @return none.
+ */
+
+void arm_stats_update_f32(
+  arm_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  float32_t in, d;                               /* input sample and its offset from the reference */
+  float32_t ref;                                 /* reference sample of the chunk */
+  float32_t sum, sumSq;                          /* chunk sums of offsets and squared offsets */
+  float32_t power;                               /* sum of squares of the block */
+  float32_t meanB, m2B, delta;                   /* chunk statistics and their distance to the running mean */
+  float32_t nA, nB, invN;                        /* sample counts and reciprocal of the total */
+  float32_t minVal = S->min, maxVal = S->max;    /* running minimum and maximum */
+  uint32_t minIdx = S->minIndex, maxIdx = S->maxIndex;  /* their positions */
+  uint32_t index = S->count;                     /* position of the current sample */
+  uint32_t chunk, blkCnt;                        /* chunk length and loop counter */
+
+  /* The first sample of the stream starts the minimum and maximum */
+  if((S->count == 0u) && (blockSize > 0u))
+  {
+    minVal = pSrc[0];
+    maxVal = pSrc[0];
+    minIdx = 0u;
+    maxIdx = 0u;
+  }
+
+  power = 0.0f;
+
+  while(blockSize > 0u)
+  {
+    chunk = (blockSize < 32u) ? blockSize : 32u;
+    blockSize -= chunk;
+
+    ref = pSrc[0];
+    sum = 0.0f;
+    sumSq = 0.0f;
+
+    blkCnt = chunk;
+
+    while(blkCnt > 0u)
+    {
+      in = *pSrc++;
+
+      /* Offset from the reference keeps the squares small */
+      d = in - ref;
+      sum += d;
+      sumSq += d * d;
+      power += in * in;
+
+      if(in < minVal)
+      {
+        minVal = in;
+        minIdx = index;
+      }
+
+      if(in > maxVal)
+      {
+        maxVal = in;
+        maxIdx = index;
+      }
+
+      index++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Mean and sum of squared deviations of the chunk */
+    nB = (float32_t) chunk;
+    meanB = sum / nB;
+    m2B = sumSq - (sum * meanB);
+    meanB += ref;
+
+    /* Merge the chunk into the running statistics */
+    nA = (float32_t) S->count;
+    invN = 1.0f / (nA + nB);
+    delta = meanB - S->mean;
+
+    S->mean += delta * nB * invN;
+    S->m2 += m2B + (delta * delta * nA * nB * invN);
+    S->count += chunk;
+  }
+
+  S->sumSq += power;
+  S->min = minVal;
+  S->max = maxVal;
+  S->minIndex = minIdx;
+  S->maxIndex = maxIdx;
+}
+
+/**
+ * @} end of StatsSummary group
+ */
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_stats_update_q15.c
+*
+* Description:	Q15 streaming statistics update function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StatsSummary
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of Q15 samples to the streaming statistics.
+ * @param[in,out] *S points to an instance of the Q15 statistics structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[in]     blockSize number of samples in the block.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum of the samples and the 2.30 squares are accumulated exactly in 64-bit
+ * accumulators, in 49.15 and 34.30 format. Both have room for 2^32 samples.
+ */
+
+void arm_stats_update_q15(
+  arm_stats_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  q63_t sum = 0;                                 /* sum of the block */
+  q63_t sumSq = 0;                               /* sum of squares of the block */
+  q15_t in;                                      /* input sample */
+  q15_t minVal = S->min, maxVal = S->max;        /* running minimum and maximum */
+  uint32_t minIdx = S->minIndex, maxIdx = S->maxIndex;  /* their positions */
+  uint32_t index = S->count;                     /* position of the current sample */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  /* The first sample of the stream starts the minimum and maximum */
+  if((S->count == 0u) && (blockSize > 0u))
+  {
+    minVal = pSrc[0];
+    maxVal = pSrc[0];
+    minIdx = 0u;
+    maxIdx = 0u;
+  }
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    sum += in;
+    sumSq += (q31_t) in * in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIdx = index;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = index;
+    }
+
+    index++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->count += blockSize;
+  S->sum += sum;
+  S->sumSq += sumSq;
+  S->min = minVal;
+  S->max = maxVal;
+  S->minIndex = minIdx;
+  S->maxIndex = maxIdx;
+}
+
+/**
+ * @} end of StatsSummary group
+ */
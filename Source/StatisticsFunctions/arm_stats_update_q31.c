@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_stats_update_q31.c
+*
+* Description:	Q31 streaming statistics update function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StatsSummary
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of Q31 samples to the streaming statistics.
+ * @param[in,out] *S points to an instance of the Q31 statistics structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[in]     blockSize number of samples in the block.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum of the samples is accumulated exactly in 1.31 units in a 64-bit accumulator.
+ * The 2.62 squares are truncated to 16.48 format and accumulated over chunks of at most
+ * 2^15 samples, which cannot overflow. Each chunk sum is then rounded to 1.31 units
+ * and added to a 64-bit accumulator in 33.31 format. Both accumulators have room
+ * for 2^32 samples.
+ */
+
+void arm_stats_update_q31(
+  arm_stats_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  q63_t sum = 0;                                 /* sum of the block */
+  q63_t sumSq;                                   /* sum of squares of the chunk in 16.48 format */
+  q31_t in;                                      /* input sample */
+  q31_t minVal = S->min, maxVal = S->max;        /* running minimum and maximum */
+  uint32_t minIdx = S->minIndex, maxIdx = S->maxIndex;  /* their positions */
+  uint32_t index = S->count;                     /* position of the current sample */
+  uint32_t chunk, blkCnt;                        /* chunk length and loop counter */
+
+  /* The first sample of the stream starts the minimum and maximum */
+  if((S->count == 0u) && (blockSize > 0u))
+  {
+    minVal = pSrc[0];
+    maxVal = pSrc[0];
+    minIdx = 0u;
+    maxIdx = 0u;
+  }
+
+  S->count += blockSize;
+
+  while(blockSize > 0u)
+  {
+    chunk = (blockSize < 0x8000u) ? blockSize : 0x8000u;
+    blockSize -= chunk;
+
+    sumSq = 0;
+    blkCnt = chunk;
+
+    while(blkCnt > 0u)
+    {
+      in = *pSrc++;
+
+      sum += in;
+      sumSq += ((q63_t) in * in) >> 14;
+
+      if(in < minVal)
+      {
+        minVal = in;
+        minIdx = index;
+      }
+
+      if(in > maxVal)
+      {
+        maxVal = in;
+        maxIdx = index;
+      }
+
+      index++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Round the chunk from 16.48 to 33.31 format */
+    S->sumSq += (sumSq + 0x10000) >> 17;
+  }
+
+  S->sum += sum;
+  S->min = minVal;
+  S->max = maxVal;
+  S->minIndex = minIdx;
+  S->maxIndex = maxIdx;
+}
+
+/**
+ * @} end of StatsSummary group
+ */
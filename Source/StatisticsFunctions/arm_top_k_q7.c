@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_top_k_q7.c
+*
+* Description:	Largest values of a Q7 vector.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup TopK
+ * @{
+ */
+
+/*
+ * @brief  Sifts an entry down the min-heap.
+ * @param[in,out] *pVal points to the heap values.
+ * @param[in,out] *pIdx points to the heap indices.
+ * @param[in]     n number of heap entries.
+ * @param[in]     i position of the entry.
+ * @return none.
+ *
+ * An entry is weaker than another if its value is smaller, or equal with a larger index.
+ */
+
+static void arm_top_k_sift_q7(
+  q7_t * pVal,
+  uint32_t * pIdx,
+  uint32_t n,
+  uint32_t i)
+{
+  q7_t val = pVal[i];                            /* Entry being sifted */
+  uint32_t idx = pIdx[i];
+  uint32_t child;                                /* Weaker child */
+
+  while((2u * i + 1u) < n)
+  {
+    child = 2u * i + 1u;
+
+    if(((child + 1u) < n) &&
+       ((pVal[child + 1u] < pVal[child]) ||
+        ((pVal[child + 1u] == pVal[child]) && (pIdx[child + 1u] > pIdx[child]))))
+    {
+      child++;
+    }
+
+    /* Stop when the entry is not stronger than its weaker child */
+    if((val < pVal[child]) || ((val == pVal[child]) && (idx > pIdx[child])))
+    {
+      break;
+    }
+
+    pVal[i] = pVal[child];
+    pIdx[i] = pIdx[child];
+    i = child;
+  }
+
+  pVal[i] = val;
+  pIdx[i] = idx;
+}
+
+/**
+ * @brief  Largest values of a Q7 vector.
+ * @param[in]  *pSrc points to the input vector.
+ * @param[in]  blockSize length of the input vector.
+ * @param[in]  k number of values to find.
+ * @param[out] *pDstVal points to the k largest values, in decreasing order.
+ * @param[out] *pDstIndex points to the indices of the values.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>k</code> is zero or larger than <code>blockSize</code>.
+ */
+
+arm_status arm_top_k_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q7_t * pDstVal,
+  uint32_t * pDstIndex)
+{
+  q7_t val;                                      /* Temporary value */
+  uint32_t idx;                                  /* Temporary index */
+  uint32_t i;                                    /* Loop counter */
+  arm_status status;                             /* Status of the search */
+
+  if((k == 0u) || (k > blockSize))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Heap of the first k samples */
+    for (i = 0u; i < k; i++)
+    {
+      pDstVal[i] = pSrc[i];
+      pDstIndex[i] = i;
+    }
+
+    i = k >> 1u;
+    while(i > 0u)
+    {
+      i--;
+      arm_top_k_sift_q7(pDstVal, pDstIndex, k, i);
+    }
+
+    /* A later sample enters only if it is larger than the weakest kept */
+    for (i = k; i < blockSize; i++)
+    {
+      if(pSrc[i] > pDstVal[0])
+      {
+        pDstVal[0] = pSrc[i];
+        pDstIndex[0] = i;
+        arm_top_k_sift_q7(pDstVal, pDstIndex, k, 0u);
+      }
+    }
+
+    /* Move the weakest to the end until the heap is sorted in decreasing order */
+    i = k;
+    while(i > 1u)
+    {
+      i--;
+      val = pDstVal[0];
+      idx = pDstIndex[0];
+      pDstVal[0] = pDstVal[i];
+      pDstIndex[0] = pDstIndex[i];
+      pDstVal[i] = val;
+      pDstIndex[i] = idx;
+      arm_top_k_sift_q7(pDstVal, pDstIndex, i, 0u);
+    }
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of TopK group
+ */
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_dsp_arena_alloc.c
+*
+* Description:	Persistent allocation from the DSP arena.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup DspArena
+ * @{
+ */
+
+/*
+ * @brief  Persistent allocation from one region.
+ * @param[in,out] *P points to the region.
+ * @param[in]     size number of bytes.
+ * @param[in]     align alignment in bytes, a power of two.
+ * @return pointer to the block, or NULL if the region is full.
+ */
+
+static void *arm_dsp_arena_alloc_pool(
+  arm_dsp_arena_pool * P,
+  uint32_t size,
+  uint32_t align)
+{
+  void *pBlock = NULL;                           /* Allocated block */
+  uint32_t avail;                                /* Bytes between the persistent blocks and the scratch */
+  uint32_t pad;                                  /* Bytes skipped to align the block */
+
+  avail = P->size - P->scratchSize - P->used;
+  pad = (0u - ((uint32_t) (size_t) P->pBase + P->used)) & (align - 1u);
+
+  /* The block must end below the scratch reserved at the top of the region */
+  if((P->pBase != NULL) && (size <= avail) && (pad <= (avail - size)))
+  {
+    pBlock = P->pBase + P->used + pad;
+    P->used += pad + size;
+  }
+
+  return (pBlock);
+}
+
+/**
+ * @brief  Persistent allocation from a DSP arena.
+ * @param[in,out] *A points to an instance of the DSP arena structure.
+ * @param[in]     region region to allocate from.
+ * @param[in]     size number of bytes.
+ * @param[in]     align alignment in bytes, a power of two, or 0 for ARM_DSP_ARENA_ALIGN.
+ * @return pointer to the block, or NULL if the region is full.
+ *
+ * \par
+ * With <code>ARM_DSP_ARENA_ANY</code> the block is taken from the TCM if it fits there
+ * and from the SRAM otherwise.
+ */
+
+void *arm_dsp_arena_alloc(
+  arm_dsp_arena * A,
+  arm_dsp_arena_region region,
+  uint32_t size,
+  uint32_t align)
+{
+  void *pBlock;                                  /* Allocated block */
+
+  if(align == 0u)
+  {
+    align = ARM_DSP_ARENA_ALIGN;
+  }
+
+  if(region == ARM_DSP_ARENA_ANY)
+  {
+    /* Prefer the TCM, fall back to the SRAM */
+    pBlock = arm_dsp_arena_alloc_pool(&A->pool[ARM_DSP_ARENA_TCM], size, align);
+
+    if(pBlock == NULL)
+    {
+      pBlock =
+        arm_dsp_arena_alloc_pool(&A->pool[ARM_DSP_ARENA_SRAM], size, align);
+    }
+  }
+  else
+  {
+    pBlock = arm_dsp_arena_alloc_pool(&A->pool[region], size, align);
+  }
+
+  return (pBlock);
+}
+
+/**
+ * @} end of DspArena group
+ */
@@ -0,0 +1,57 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_dsp_arena_get_usage.c
+*
+* Description:	Memory taken from the DSP arena.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup DspArena
+ * @{
+ */
+
+/**
+ * @brief  Memory taken from a DSP arena.
+ * @param[in] *A points to an instance of the DSP arena structure.
+ * @param[in] region region to report, ARM_DSP_ARENA_ANY for the total.
+ * @return number of bytes taken by persistent allocations and the shared scratch,
+ * including alignment padding.
+ */
+
+uint32_t arm_dsp_arena_get_usage(
+  const arm_dsp_arena * A,
+  arm_dsp_arena_region region)
+{
+  uint32_t usage;                                /* Bytes in use */
+
+  if(region == ARM_DSP_ARENA_ANY)
+  {
+    usage = A->pool[ARM_DSP_ARENA_TCM].used +
+      A->pool[ARM_DSP_ARENA_TCM].scratchSize +
+      A->pool[ARM_DSP_ARENA_SRAM].used + A->pool[ARM_DSP_ARENA_SRAM].scratchSize;
+  }
+  else
+  {
+    usage = A->pool[region].used + A->pool[region].scratchSize;
+  }
+
+  return (usage);
+}
+
+/**
+ * @} end of DspArena group
+ */
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_dsp_arena_init.c
+*
+* Description:	Initialization function for the DSP arena allocator.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup DspArena DSP Arena Allocator
+ *
+ * Hands out the state, coefficient and scratch buffers of the library instances from
+ * memory regions supplied by the application, so that the buffers of a whole
+ * processing chain are sized at initialization instead of by hand.
+ * Nothing is ever freed: the arena is filled once at start-up, and
+ * <code>arm_dsp_arena_get_usage()</code> then gives the number of bytes each region
+ * needs, which can be used to trim the static memory budget.
+ *
+ * \par Regions
+ * An arena has two regions, <code>ARM_DSP_ARENA_TCM</code> and
+ * <code>ARM_DSP_ARENA_SRAM</code>, for the tightly coupled and the system memory.
+ * Either may be absent. Requests for <code>ARM_DSP_ARENA_ANY</code> are served from
+ * the TCM while it has room and from the SRAM after that, so the buffers allocated
+ * first, typically those of the most frequently run kernels, land in the faster memory.
+ *
+ * \par Persistent and scratch allocations
+ * Persistent blocks, such as filter states, are taken from the bottom of a region.
+ * Scratch blocks are taken from the top of the region in groups started by
+ * <code>arm_dsp_arena_scratch_begin()</code>: the blocks of one group are disjoint,
+ * and every group starts again at the top, so the groups overlay each other. Put the
+ * scratch buffers of kernels that run together in one group and those of kernels
+ * that never run concurrently in separate groups; the region then reserves only the
+ * largest group. A persistent allocation never overlaps the scratch reserved so far.
+ * <pre>
+ *     arm_dsp_arena_init(&arena, tcm, sizeof(tcm), sram, sizeof(sram));
+ *     pState = arm_dsp_arena_alloc(&arena, ARM_DSP_ARENA_TCM,
+ *                                  arm_fir_get_state_size_f32(numTaps, blockSize) * sizeof(float32_t), 0);
+ *     arm_dsp_arena_scratch_begin(&arena, ARM_DSP_ARENA_SRAM);
+ *     pScratch1 = arm_dsp_arena_scratch_alloc(&arena, ARM_DSP_ARENA_SRAM,
+ *                                  arm_conv_get_scratch_size_q15(lenA, lenB) * sizeof(q15_t), 0);
+ *     pScratch2 = arm_dsp_arena_scratch_alloc(&arena, ARM_DSP_ARENA_SRAM,
+ *                                  arm_conv_get_scratch2_size_q15(lenA, lenB) * sizeof(q15_t), 0);
+ * </pre>
+ *
+ * \par Alignment
+ * Blocks are aligned to <code>ARM_DSP_ARENA_ALIGN</code>, the 32-byte cache line of
+ * the Cortex-R4/R5, unless a different power of two is requested, so buffers do not
+ * share cache lines and satisfy the 32-bit alignment the SIMD kernels expect.
+ * The allocation functions return NULL when a region is full or absent.
+ */
+
+/**
+ * @addtogroup DspArena
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the DSP arena allocator.
+ * @param[out] *A points to an instance of the DSP arena structure.
+ * @param[in]  *pTcm points to the TCM region, or NULL.
+ * @param[in]  tcmSize size of the TCM region in bytes.
+ * @param[in]  *pSram points to the SRAM region, or NULL.
+ * @param[in]  sramSize size of the SRAM region in bytes.
+ * @return none.
+ */
+
+void arm_dsp_arena_init(
+  arm_dsp_arena * A,
+  void *pTcm,
+  uint32_t tcmSize,
+  void *pSram,
+  uint32_t sramSize)
+{
+  arm_dsp_arena_pool *P;                         /* Region being set up */
+  uint32_t trim;                                 /* Bytes above the last cache line boundary */
+  uint32_t i;                                    /* Loop counter */
+
+  /* Record the regions */
+  A->pool[ARM_DSP_ARENA_TCM].pBase = (uint8_t *) pTcm;
+  A->pool[ARM_DSP_ARENA_TCM].size = (pTcm != NULL) ? tcmSize : 0u;
+  A->pool[ARM_DSP_ARENA_SRAM].pBase = (uint8_t *) pSram;
+  A->pool[ARM_DSP_ARENA_SRAM].size = (pSram != NULL) ? sramSize : 0u;
+
+  for (i = 0u; i < ARM_DSP_ARENA_NUM_REGIONS; i++)
+  {
+    P = &A->pool[i];
+
+    /* Trim the top of the region to a cache line, scratch blocks are aligned from there.
+     * Only the low address bits matter, the cast through size_t keeps them on 64-bit hosts */
+    trim = ((uint32_t) (size_t) P->pBase + P->size) & (ARM_DSP_ARENA_ALIGN - 1u);
+    P->size = (P->size > trim) ? (P->size - trim) : 0u;
+
+    P->used = 0u;
+    P->scratchSize = 0u;
+    P->scratchUsed = 0u;
+  }
+}
+
+/**
+ * @} end of DspArena group
+ */
@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_dsp_arena_scratch.c
+*
+* Description:	Shared scratch allocation from the DSP arena.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup DspArena
+ * @{
+ */
+
+/*
+ * @brief  Scratch allocation from one region.
+ * @param[in,out] *P points to the region.
+ * @param[in]     size number of bytes.
+ * @param[in]     align alignment in bytes, a power of two.
+ * @return pointer to the block, or NULL if the region is full.
+ */
+
+static void *arm_dsp_arena_scratch_pool(
+  arm_dsp_arena_pool * P,
+  uint32_t size,
+  uint32_t align)
+{
+  void *pBlock = NULL;                           /* Allocated block */
+  uint32_t avail;                                /* Bytes between the persistent blocks and the group */
+  uint32_t pad;                                  /* Bytes skipped to align the block */
+
+  avail = P->size - P->used - P->scratchUsed;
+  pad = ((uint32_t) (size_t) P->pBase + P->size - P->scratchUsed - size) & (align - 1u);
+
+  /* The group grows down from the top of the region towards the persistent blocks */
+  if((P->pBase != NULL) && (size <= avail) && (pad <= (avail - size)))
+  {
+    P->scratchUsed += size + pad;
+    pBlock = P->pBase + P->size - P->scratchUsed;
+
+    /* The region reserves the largest group */
+    if(P->scratchUsed > P->scratchSize)
+    {
+      P->scratchSize = P->scratchUsed;
+    }
+  }
+
+  return (pBlock);
+}
+
+/**
+ * @brief  Starts a scratch group of a DSP arena.
+ * @param[in,out] *A points to an instance of the DSP arena structure.
+ * @param[in]     region region of the group, ARM_DSP_ARENA_ANY for both.
+ * @return none.
+ *
+ * \par
+ * The blocks of the new group reuse the memory of the previous groups of the region.
+ */
+
+void arm_dsp_arena_scratch_begin(
+  arm_dsp_arena * A,
+  arm_dsp_arena_region region)
+{
+  if(region == ARM_DSP_ARENA_ANY)
+  {
+    A->pool[ARM_DSP_ARENA_TCM].scratchUsed = 0u;
+    A->pool[ARM_DSP_ARENA_SRAM].scratchUsed = 0u;
+  }
+  else
+  {
+    A->pool[region].scratchUsed = 0u;
+  }
+}
+
+/**
+ * @brief  Scratch allocation from a DSP arena.
+ * @param[in,out] *A points to an instance of the DSP arena structure.
+ * @param[in]     region region to allocate from.
+ * @param[in]     size number of bytes.
+ * @param[in]     align alignment in bytes, a power of two, or 0 for ARM_DSP_ARENA_ALIGN.
+ * @return pointer to the block, or NULL if the region is full.
+ *
+ * \par
+ * The block does not overlap the other blocks of the current group but may overlap the
+ * blocks of earlier groups. With <code>ARM_DSP_ARENA_ANY</code> the block is taken from
+ * the TCM if it fits there and from the SRAM otherwise.
+ */
+
+void *arm_dsp_arena_scratch_alloc(
+  arm_dsp_arena * A,
+  arm_dsp_arena_region region,
+  uint32_t size,
+  uint32_t align)
+{
+  void *pBlock;                                  /* Allocated block */
+
+  if(align == 0u)
+  {
+    align = ARM_DSP_ARENA_ALIGN;
+  }
+
+  if(region == ARM_DSP_ARENA_ANY)
+  {
+    /* Prefer the TCM, fall back to the SRAM */
+    pBlock =
+      arm_dsp_arena_scratch_pool(&A->pool[ARM_DSP_ARENA_TCM], size, align);
+
+    if(pBlock == NULL)
+    {
+      pBlock =
+        arm_dsp_arena_scratch_pool(&A->pool[ARM_DSP_ARENA_SRAM], size, align);
+    }
+  }
+  else
+  {
+    pBlock = arm_dsp_arena_scratch_pool(&A->pool[region], size, align);
+  }
+
+  return (pBlock);
+}
+
+/**
+ * @} end of DspArena group
+ */
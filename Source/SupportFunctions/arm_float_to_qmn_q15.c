@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_float_to_qmn_q15.c
+*
+* Description:	Converts the elements of the floating-point vector to Qm.n Q15 vector.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup float_to_qmn Convert 32-bit floating point value to Qm.n
+ *
+ * Converts floating-point values to fixed-point values with any number of fractional
+ * bits, for example the 4.12 or 12.20 formats of ADC and DAC data:
+ * <pre>
+ *     pDst[n] = sat(round(pSrc[n] * 2^fracBits)),   0 <= n < blockSize.
+ * </pre>
+ * The result is saturated to the range of the output type. The rounding is selected
+ * per call by an <code>arm_conversion_mode</code>:
+ * - <code>ARM_CONVERT_TRUNCATE</code> truncates towards zero, as <code>arm_float_to_q15()</code>
+ * and the other conversions do without <code>ARM_MATH_ROUNDING</code>.
+ * - <code>ARM_CONVERT_ROUND</code> rounds to the nearest value.
+ * - <code>ARM_CONVERT_DITHER</code> adds triangular (TPDF) dither of up to +/-1 LSB
+ * before rounding to the nearest value, which decorrelates the quantization error
+ * from the signal. The dither is the difference of two 16-bit uniform values taken
+ * from a 32-bit xorshift generator whose state is passed in <code>pDitherState</code>
+ * and updated, so consecutive blocks continue the same sequence.
+ * <code>pDitherState</code> is only used in this mode.
+ *
+ * \par
+ * Rounding adds a value just below one half with the sign of the sample, made with
+ * integer operations on the sign bit, so there is no branch on the sign and all
+ * arithmetic is in single precision. Saturation uses conditional selects. The mode is
+ * tested once per call.
+ */
+
+/**
+ * @addtogroup float_to_qmn
+ * @{
+ */
+
+/**
+ * @brief  Rounds and saturates one scaled sample to Q15.
+ * @param[in]  y scaled sample.
+ * @param[in]  bias bit pattern of the rounding offset, zero to truncate.
+ * @return saturated result.
+ */
+
+static q31_t arm_float_to_qmn_sat_q15(
+  float32_t y,
+  int32_t bias)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u, h;                                        /* Sample and rounding offset bits */
+
+  /* Rounding offset with the sign of the sample */
+  u.f = y;
+  h.i = (u.i & (int32_t) 0x80000000) | bias;
+  y += h.f;
+
+  /* Saturate and truncate towards zero */
+  y = (y > -32768.0f) ? y : -32768.0f;
+  y = (y < 32767.0f) ? y : 32767.0f;
+
+  return ((q31_t) y);
+}
+
+/**
+ * @brief  Converts the elements of a floating-point vector to a Q15 vector with fracBits fractional bits.
+ * @param[in]       *pSrc points to the floating-point input vector
+ * @param[out]      *pDst points to the Q15 output vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       fracBits number of fractional bits of the output, 0 to 15
+ * @param[in]       mode rounding mode
+ * @param[in,out]   *pDitherState points to the nonzero state of the dither generator
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The output has 15 - fracBits integer bits. Results outside of the allowable Q15 range
+ * [0x8000 0x7FFF] are saturated.
+ */
+
+void arm_float_to_qmn_q15(
+  float32_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize,
+  uint8_t fracBits,
+  arm_conversion_mode mode,
+  uint32_t * pDitherState)
+{
+  float32_t scale;                               /* 2^fracBits */
+  float32_t in1, in2;                            /* scaled inputs */
+  int32_t bias;                                  /* rounding offset bits */
+  uint32_t state;                                /* dither generator state */
+  q31_t out1, out2;                              /* temporary output variables */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u;                                           /* scale bits */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* 2^fracBits from its exponent */
+  u.i = (127 + (int32_t) fracBits) << 23;
+  scale = u.f;
+
+  /* largest float below one half for rounding, zero for truncation */
+  bias = (mode == ARM_CONVERT_TRUNCATE) ? 0 : 0x3EFFFFFF;
+
+  if(mode == ARM_CONVERT_DITHER)
+  {
+    state = (*pDitherState != 0u) ? *pDitherState : 1u;
+
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      /* xorshift32 generator */
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+
+      /* TPDF dither in (-1, 1) LSB as the difference of the two 16-bit halves */
+      in1 = (*pSrc++ * scale) +
+        ((float32_t) ((int32_t) (state >> 16) - (int32_t) (state & 0xFFFFu)) * 1.52587890625e-5f);
+
+      *pDst++ = (q15_t) arm_float_to_qmn_sat_q15(in1, bias);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    *pDitherState = state;
+  }
+  else
+  {
+    /*loop Unrolling */
+    blkCnt = blockSize >> 1u;
+
+    /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+     ** a second loop below computes the remaining sample. */
+    while(blkCnt > 0u)
+    {
+      in1 = pSrc[0] * scale;
+      in2 = pSrc[1] * scale;
+      pSrc += 2u;
+
+      out1 = arm_float_to_qmn_sat_q15(in1, bias);
+      out2 = arm_float_to_qmn_sat_q15(in2, bias);
+
+      /* store the two results with one write */
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      *__SIMD32(pDst)++ = __PKHBT(out1, out2, 16);
+
+#else
+
+      *__SIMD32(pDst)++ = __PKHBT(out2, out1, 16);
+
+#endif	//	#ifndef ARM_MATH_BIG_ENDIAN
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is odd, compute the remaining output sample here. */
+    blkCnt = blockSize % 0x2u;
+
+    while(blkCnt > 0u)
+    {
+      *pDst++ = (q15_t) arm_float_to_qmn_sat_q15(*pSrc++ * scale, bias);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of float_to_qmn group
+ */
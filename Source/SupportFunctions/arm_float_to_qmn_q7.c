@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_float_to_qmn_q7.c
+*
+* Description:	Converts the elements of the floating-point vector to Qm.n Q7 vector.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup float_to_qmn
+ * @{
+ */
+
+/**
+ * @brief  Rounds and saturates one scaled sample to Q7.
+ * @param[in]  y scaled sample.
+ * @param[in]  bias bit pattern of the rounding offset, zero to truncate.
+ * @return saturated result.
+ */
+
+static q31_t arm_float_to_qmn_sat_q7(
+  float32_t y,
+  int32_t bias)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u, h;                                        /* Sample and rounding offset bits */
+
+  /* Rounding offset with the sign of the sample */
+  u.f = y;
+  h.i = (u.i & (int32_t) 0x80000000) | bias;
+  y += h.f;
+
+  /* Saturate and truncate towards zero */
+  y = (y > -128.0f) ? y : -128.0f;
+  y = (y < 127.0f) ? y : 127.0f;
+
+  return ((q31_t) y);
+}
+
+/**
+ * @brief  Converts the elements of a floating-point vector to a Q7 vector with fracBits fractional bits.
+ * @param[in]       *pSrc points to the floating-point input vector
+ * @param[out]      *pDst points to the Q7 output vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       fracBits number of fractional bits of the output, 0 to 7
+ * @param[in]       mode rounding mode
+ * @param[in,out]   *pDitherState points to the nonzero state of the dither generator
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The output has 7 - fracBits integer bits. Results outside of the allowable Q7 range
+ * [0x80 0x7F] are saturated.
+ */
+
+void arm_float_to_qmn_q7(
+  float32_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize,
+  uint8_t fracBits,
+  arm_conversion_mode mode,
+  uint32_t * pDitherState)
+{
+  float32_t scale;                               /* 2^fracBits */
+  float32_t in1, in2, in3, in4;                  /* scaled inputs */
+  int32_t bias;                                  /* rounding offset bits */
+  uint32_t state;                                /* dither generator state */
+  q31_t out1, out2, out3, out4;                  /* temporary output variables */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u;                                           /* scale bits */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* 2^fracBits from its exponent */
+  u.i = (127 + (int32_t) fracBits) << 23;
+  scale = u.f;
+
+  /* largest float below one half for rounding, zero for truncation */
+  bias = (mode == ARM_CONVERT_TRUNCATE) ? 0 : 0x3EFFFFFF;
+
+  if(mode == ARM_CONVERT_DITHER)
+  {
+    state = (*pDitherState != 0u) ? *pDitherState : 1u;
+
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      /* xorshift32 generator */
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+
+      /* TPDF dither in (-1, 1) LSB as the difference of the two 16-bit halves */
+      in1 = (*pSrc++ * scale) +
+        ((float32_t) ((int32_t) (state >> 16) - (int32_t) (state & 0xFFFFu)) * 1.52587890625e-5f);
+
+      *pDst++ = (q7_t) arm_float_to_qmn_sat_q7(in1, bias);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    *pDitherState = state;
+  }
+  else
+  {
+    /*loop Unrolling */
+    blkCnt = blockSize >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      in1 = pSrc[0] * scale;
+      in2 = pSrc[1] * scale;
+      in3 = pSrc[2] * scale;
+      in4 = pSrc[3] * scale;
+      pSrc += 4u;
+
+      out1 = arm_float_to_qmn_sat_q7(in1, bias);
+      out2 = arm_float_to_qmn_sat_q7(in2, bias);
+      out3 = arm_float_to_qmn_sat_q7(in3, bias);
+      out4 = arm_float_to_qmn_sat_q7(in4, bias);
+
+      /* Store the results of 4 inputs in the destination buffer in single cycle by packing */
+      *__SIMD32(pDst)++ = __PACKq7(out1, out2, out3, out4);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4u;
+
+    while(blkCnt > 0u)
+    {
+      *pDst++ = (q7_t) arm_float_to_qmn_sat_q7(*pSrc++ * scale, bias);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of float_to_qmn group
+ */
@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_qmn_to_float_q31.c
+*
+* Description:	Converts the elements of the Qm.n Q31 vector to floating-point vector.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup qmn_to_float Convert Qm.n value to 32-bit floating point
+ *
+ * Converts fixed-point values with any number of fractional bits to floating-point:
+ * <pre>
+ *     pDst[n] = (float32_t) pSrc[n] * 2^-fracBits,   0 <= n < blockSize.
+ * </pre>
+ * This is the inverse of the Qm.n conversions in float_to_qmn. The scale factor is made
+ * from its exponent bits, so the conversion is exact for Q7 and Q15 inputs and rounds
+ * Q31 inputs to the 24-bit precision of the result.
+ */
+
+/**
+ * @addtogroup qmn_to_float
+ * @{
+ */
+
+/**
+ * @brief  Converts the elements of a Q31 vector with fracBits fractional bits to a floating-point vector.
+ * @param[in]       *pSrc points to the Q31 input vector
+ * @param[out]      *pDst points to the floating-point output vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       fracBits number of fractional bits of the input, 0 to 31
+ * @return none.
+ */
+
+void arm_qmn_to_float_q31(
+  q31_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize,
+  uint8_t fracBits)
+{
+  float32_t scale;                               /* 2^-fracBits */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u;                                           /* scale bits */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* 2^-fracBits from its exponent */
+  u.i = (127 - (int32_t) fracBits) << 23;
+  scale = u.f;
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = (float32_t) A * 2^-fracBits */
+    pDst[0] = (float32_t) pSrc[0] * scale;
+    pDst[1] = (float32_t) pSrc[1] * scale;
+    pDst[2] = (float32_t) pSrc[2] * scale;
+    pDst[3] = (float32_t) pSrc[3] * scale;
+
+    /* update pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = (float32_t) A * 2^-fracBits */
+    *pDst++ = (float32_t) *pSrc++ * scale;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of qmn_to_float group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cfft2d_f32.c
+*
+* Description:	Floating-point 2-D complex FFT/IFFT processing function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup CFFT2D Complex 2-D FFT Functions
+ *
+ * \par
+ * Computes the two dimensional Complex Fast Fourier Transform (CFFT) or its inverse
+ * of a <code>numRows x numCols</code> complex image stored in row order.
+ * \par
+ * The data is stored in an interleaved fashion:
+ * <pre> {real(0,0), imag(0,0), real(0,1), imag(0,1), ..., real(0,numCols-1), imag(0,numCols-1), real(1,0), ...} </pre>
+ * and the transform is computed in-place.
+ *
+ * \par Algorithm:
+ * \par
+ * The 2-D transform is separable and is computed with the row-column method:
+ * -# a 1-D CFFT of length <code>numCols</code> is applied to every row of the image;
+ * -# the image is transposed into the scratch buffer with <code>arm_mat_cmplx_trans_f32()</code>
+ * (or <code>arm_mat_cmplx_trans_q15()</code>) so that the columns become contiguous rows;
+ * -# a 1-D CFFT of length <code>numRows</code> is applied to every row of the scratch buffer;
+ * -# the scratch buffer is transposed back into the image.
+ * \par
+ * Every 1-D transform therefore runs on contiguous data and no strided copies are made;
+ * the two blocked transposes are the only passes with a non-unit stride.
+ *
+ * \par Lengths supported by the transform:
+ * \par
+ * Both <code>numRows</code> and <code>numCols</code> must be lengths supported by the
+ * radix-4 CFFT, i.e. one of [16, 64, 256, 1024]. They need not be equal.
+ *
+ * \par Instance Structure
+ * The instance structure holds the row and column CFFT instances and a pointer to the scratch buffer.
+ * The scratch buffer must hold <code>2*numRows*numCols</code> values and may be shared by
+ * transforms that never run concurrently.
+ *
+ * \par Initialization Functions
+ * The initialization function sets up the row and column CFFT instances with
+ * <code>arm_cfft_radix4_init_f32()</code> (or <code>arm_cfft_radix4_init_q15()</code>)
+ * with bit reversal enabled, so that the output is in natural order.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 version applies <code>arm_cfft_radix4_q15()</code> along both dimensions, and each
+ * 1-D transform downscales its input by 2 per radix-4 stage. The output of the 2-D transform
+ * is therefore scaled down by the product of the row and column scale factors
+ * (e.g. a 64 x 64 transform divides the result by 64 * 64).
+ */
+
+/**
+ * @addtogroup CFFT2D
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point 2-D CFFT/CIFFT.
+ * @param[in]      *S    points to an instance of the floating-point 2-D CFFT/CIFFT structure.
+ * @param[in, out] *pSrc points to the complex image of size <code>2*numRows*numCols</code>. Processing occurs in-place.
+ * @return none.
+ *
+ * \par
+ * The inverse transform is scaled by <code>1/(numRows*numCols)</code>, since each 1-D CIFFT is scaled by its own length.
+ */
+
+void arm_cfft2d_f32(
+  const arm_cfft2d_instance_f32 * S,
+  float32_t * pSrc)
+{
+  arm_matrix_instance_f32 img;                   /* image viewed as a complex matrix */
+  arm_matrix_instance_f32 trans;                 /* transposed image in the scratch buffer */
+  float32_t *pRow;                               /* pointer to the row being transformed */
+  uint32_t rowLen = 2u * S->numCols;             /* length of an image row in floats */
+  uint32_t colLen = 2u * S->numRows;             /* length of an image column in floats */
+  uint16_t i;                                    /* loop counter */
+
+  /* Transform along the rows */
+  pRow = pSrc;
+  i = S->numRows;
+
+  while(i > 0u)
+  {
+    arm_cfft_radix4_f32(&S->rowFft, pRow);
+    pRow += rowLen;
+
+    /* Decrement the row loop counter */
+    i--;
+  }
+
+  /* Transpose the image so that the columns are contiguous */
+  arm_mat_init_f32(&img, S->numRows, S->numCols, pSrc);
+  arm_mat_init_f32(&trans, S->numCols, S->numRows, S->pScratch);
+  arm_mat_cmplx_trans_f32(&img, &trans);
+
+  /* Transform along the columns */
+  pRow = S->pScratch;
+  i = S->numCols;
+
+  while(i > 0u)
+  {
+    arm_cfft_radix4_f32(&S->colFft, pRow);
+    pRow += colLen;
+
+    /* Decrement the column loop counter */
+    i--;
+  }
+
+  /* Transpose back into natural order */
+  arm_mat_cmplx_trans_f32(&trans, &img);
+}
+
+/**
+ * @} end of CFFT2D group
+ */
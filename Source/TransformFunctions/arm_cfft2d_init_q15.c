@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cfft2d_init_q15.c
+*
+* Description:	Q15 2-D complex FFT/IFFT initialization function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup CFFT2D
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q15 2-D CFFT/CIFFT.
+* @param[in,out] *S             points to an instance of the Q15 2-D CFFT/CIFFT structure.
+* @param[in]     numRows        number of rows of the image (length of the column transforms).
+* @param[in]     numCols        number of columns of the image (length of the row transforms).
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]     *pScratch      points to the scratch buffer of size <code>2*numRows*numCols</code>.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+* <code>numRows</code> or <code>numCols</code> is not a supported length.
+*/
+
+arm_status arm_cfft2d_init_q15(
+  arm_cfft2d_instance_q15 * S,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint8_t ifftFlag,
+  q15_t * pScratch)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  /*  Initialise the image dimensions */
+  S->numRows = numRows;
+  S->numCols = numCols;
+
+  /*  Initialise the scratch buffer pointer */
+  S->pScratch = pScratch;
+
+  /*  Row transforms operate on numCols points, output in natural order */
+  if(arm_cfft_radix4_init_q15(&S->rowFft, numCols, ifftFlag, 1u) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /*  Column transforms operate on numRows points, output in natural order */
+  if(arm_cfft_radix4_init_q15(&S->colFft, numRows, ifftFlag, 1u) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of CFFT2D group
+ */
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2011 ARM Limited. All rights reserved.
+*
+* $Date:        18. October 2026
+* $Revision: 	V2.0.0_ORBIT_ADCS
+*
+* Project:      Cortex-R DSP Library
+* Title:	    arm_cfft2d_q15.c
+*
+* Description:	Q15 2-D complex FFT/IFFT processing function.
+*
+* Target Processor:          Cortex-R4/R5
+*
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup CFFT2D
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 2-D CFFT/CIFFT.
+ * @param[in]      *S    points to an instance of the Q15 2-D CFFT/CIFFT structure.
+ * @param[in, out] *pSrc points to the complex image of size <code>2*numRows*numCols</code>. Processing occurs in-place.
+ * @return none.
+ *
+ * \par
+ * Each 1-D transform downscales its input by 2 per stage, refer to the function <code>arm_cfft_radix4_q15()</code>
+ * for the output format of the row and column transforms.
+ */
+
+void arm_cfft2d_q15(
+  const arm_cfft2d_instance_q15 * S,
+  q15_t * pSrc)
+{
+  arm_matrix_instance_q15 img;                   /* image viewed as a complex matrix */
+  arm_matrix_instance_q15 trans;                 /* transposed image in the scratch buffer */
+  q15_t *pRow;                                   /* pointer to the row being transformed */
+  uint32_t rowLen = 2u * S->numCols;             /* length of an image row in samples */
+  uint32_t colLen = 2u * S->numRows;             /* length of an image column in samples */
+  uint16_t i;                                    /* loop counter */
+
+  /* Transform along the rows */
+  pRow = pSrc;
+  i = S->numRows;
+
+  while(i > 0u)
+  {
+    arm_cfft_radix4_q15(&S->rowFft, pRow);
+    pRow += rowLen;
+
+    /* Decrement the row loop counter */
+    i--;
+  }
+
+  /* Transpose the image so that the columns are contiguous */
+  arm_mat_init_q15(&img, S->numRows, S->numCols, pSrc);
+  arm_mat_init_q15(&trans, S->numCols, S->numRows, S->pScratch);
+  arm_mat_cmplx_trans_q15(&img, &trans);
+
+  /* Transform along the columns */
+  pRow = S->pScratch;
+  i = S->numCols;
+
+  while(i > 0u)
+  {
+    arm_cfft_radix4_q15(&S->colFft, pRow);
+    pRow += colLen;
+
+    /* Decrement the column loop counter */
+    i--;
+  }
+
+  /* Transpose back into natural order */
+  arm_mat_cmplx_trans_q15(&trans, &img);
+}
+
+/**
+ * @} end of CFFT2D group
+ */